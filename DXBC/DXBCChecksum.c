@@ -8,12 +8,13 @@
 **********************************************************************
 */
 
+#include <stdint.h>
 #include <string.h>
 
 #include "md5.h"
 
 typedef unsigned char BYTE;
-typedef unsigned long DWORD;
+typedef uint32_t DWORD;
 
 static const DWORD dwHashOffset = 0x14;
 
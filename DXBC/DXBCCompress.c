@@ -0,0 +1,211 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <string.h>
+
+#include "DXBCCompress.h"
+
+// A sequence is a token byte (literal count in the high nibble, match length - 4 in the low nibble), extra
+// literal count bytes, the literals, a 16-bit match offset and extra match length bytes. A nibble of 15 is
+// continued by bytes that are added up until one is below 255. The last sequence has literals only.
+#define DXBC_LZ_MIN_MATCH           4
+#define DXBC_LZ_MAX_OFFSET          0xFFFF
+#define DXBC_LZ_HASH_BITS           12
+#define DXBC_LZ_WILD_COPY           16  // short literal runs and matches are copied in fixed-size blocks when the output has room
+
+static uint32_t ReadU32(const unsigned char* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void WriteU32(unsigned char* p, uint32_t value)
+{
+    p[0] = (unsigned char)value;
+    p[1] = (unsigned char)(value >> 8);
+    p[2] = (unsigned char)(value >> 16);
+    p[3] = (unsigned char)(value >> 24);
+}
+
+static uint32_t HashU32(uint32_t value)
+{
+    return (value * 2654435761u) >> (32 - DXBC_LZ_HASH_BITS);
+}
+
+static unsigned char* WriteLength(unsigned char* pOut, const unsigned char* pEnd, uint32_t length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        if (pOut >= pEnd)
+            return NULL;
+        *pOut++ = 255;
+    }
+    if (pOut >= pEnd)
+        return NULL;
+    *pOut++ = (unsigned char)length;
+    return pOut;
+}
+
+static unsigned char* WriteSequence(unsigned char* pOut, const unsigned char* pEnd, const unsigned char* pLiterals, uint32_t literalCount,
+                                    uint32_t offset, uint32_t matchLength)
+{
+    if (pOut >= pEnd)
+        return NULL;
+
+    uint32_t matchCode = matchLength ? matchLength - DXBC_LZ_MIN_MATCH : 0;
+    *pOut++ = (unsigned char)(((literalCount < 15 ? literalCount : 15) << 4) | (matchCode < 15 ? matchCode : 15));
+    if (literalCount >= 15)
+        pOut = WriteLength(pOut, pEnd, literalCount - 15);
+    if (pOut == NULL || (uint32_t)(pEnd - pOut) < literalCount)
+        return NULL;
+    memcpy(pOut, pLiterals, literalCount);
+    pOut += literalCount;
+
+    if (matchLength == 0)
+        return pOut;
+    if (pEnd - pOut < 2)
+        return NULL;
+    *pOut++ = (unsigned char)offset;
+    *pOut++ = (unsigned char)(offset >> 8);
+    return matchCode >= 15 ? WriteLength(pOut, pEnd, matchCode - 15) : pOut;
+}
+
+uint32_t GetDXBCCompressBound(uint32_t dwSize)
+{
+    return DXBC_COMPRESSED_HEADER_SIZE + dwSize + dwSize / 255 + 16;
+}
+
+uint32_t CompressDXBC(const unsigned char* pData, uint32_t dwSize, unsigned char* pOut, uint32_t dwOutSize)
+{
+    if (dwOutSize < DXBC_COMPRESSED_HEADER_SIZE)
+        return 0;
+    WriteU32(pOut, DXBC_COMPRESSED_MAGIC);
+    WriteU32(pOut + 4, dwSize);
+
+    // most recent position of every hashed 4-byte sequence, offset by one so 0 means empty
+    uint32_t table[1 << DXBC_LZ_HASH_BITS];
+    memset(table, 0, sizeof(table));
+
+    unsigned char* pWrite = pOut + DXBC_COMPRESSED_HEADER_SIZE;
+    const unsigned char* pEnd = pOut + dwOutSize;
+    uint32_t anchor = 0;
+    uint32_t position = 0;
+    while (pWrite && position + DXBC_LZ_MIN_MATCH <= dwSize)
+    {
+        uint32_t hash = HashU32(ReadU32(pData + position));
+        uint32_t candidate = table[hash];
+        table[hash] = position + 1;
+        if (candidate == 0 || position + 1 - candidate > DXBC_LZ_MAX_OFFSET || ReadU32(pData + candidate - 1) != ReadU32(pData + position))
+        {
+            position++;
+            continue;
+        }
+
+        uint32_t match = candidate - 1;
+        uint32_t length = DXBC_LZ_MIN_MATCH;
+        while (position + length < dwSize && pData[match + length] == pData[position + length])
+            length++;
+
+        pWrite = WriteSequence(pWrite, pEnd, pData + anchor, position - anchor, position - match, length);
+        position += length;
+        anchor = position;
+    }
+
+    if (pWrite)
+        pWrite = WriteSequence(pWrite, pEnd, pData + anchor, dwSize - anchor, 0, 0);
+    return pWrite ? (uint32_t)(pWrite - pOut) : 0;
+}
+
+uint32_t GetDXBCDecompressedSize(const unsigned char* pData, uint32_t dwSize)
+{
+    if (dwSize < DXBC_COMPRESSED_HEADER_SIZE || ReadU32(pData) != DXBC_COMPRESSED_MAGIC)
+        return 0;
+    return ReadU32(pData + 4);
+}
+
+static const unsigned char* ReadLength(const unsigned char* pData, const unsigned char* pEnd, uint32_t* pLength)
+{
+    unsigned char value;
+    do
+    {
+        if (pData >= pEnd)
+            return NULL;
+        value = *pData++;
+        *pLength += value;
+    } while (value == 255);
+    return pData;
+}
+
+int DecompressDXBC(const unsigned char* pData, uint32_t dwSize, unsigned char* pOut, uint32_t dwOutSize)
+{
+    if (GetDXBCDecompressedSize(pData, dwSize) != dwOutSize)
+        return 0;
+
+    const unsigned char* pRead = pData + DXBC_COMPRESSED_HEADER_SIZE;
+    const unsigned char* pEnd = pData + dwSize;
+    uint32_t written = 0;
+    while (pRead < pEnd)
+    {
+        unsigned char token = *pRead++;
+
+        uint32_t literalCount = token >> 4;
+        if (literalCount == 15 && (pRead = ReadLength(pRead, pEnd, &literalCount)) == NULL)
+            return 0;
+        if ((uint32_t)(pEnd - pRead) < literalCount || dwOutSize - written < literalCount)
+            return 0;
+        if (literalCount <= DXBC_LZ_WILD_COPY && pEnd - pRead >= DXBC_LZ_WILD_COPY && dwOutSize - written >= DXBC_LZ_WILD_COPY)
+            memcpy(pOut + written, pRead, DXBC_LZ_WILD_COPY);
+        else
+            memcpy(pOut + written, pRead, literalCount);
+        pRead += literalCount;
+        written += literalCount;
+
+        // the last sequence has no match
+        if (pRead == pEnd)
+            break;
+
+        if (pEnd - pRead < 2)
+            return 0;
+        uint32_t offset = (uint32_t)pRead[0] | ((uint32_t)pRead[1] << 8);
+        pRead += 2;
+        uint32_t length = token & 15;
+        if (length == 15 && (pRead = ReadLength(pRead, pEnd, &length)) == NULL)
+            return 0;
+        length += DXBC_LZ_MIN_MATCH;
+        if (offset == 0 || offset > written || dwOutSize - written < length)
+            return 0;
+
+        // matches may overlap the bytes they produce, 8-byte blocks only read bytes already written when the offset is 8 or more
+        const unsigned char* pMatch = pOut + written - offset;
+        if (offset >= 8 && dwOutSize - written >= length + 8)
+        {
+            for (uint32_t i = 0; i < length; i += 8)
+                memcpy(pOut + written + i, pMatch + i, 8);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < length; ++i)
+                pOut[written + i] = pMatch[i];
+        }
+        written += length;
+    }
+    return written == dwOutSize;
+}
@@ -0,0 +1,50 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Tag at the start of a compressed blob, followed by the decompressed size and the LZ sequences.
+#define DXBC_COMPRESSED_MAGIC       0x5A584646  // 'FFXZ'
+#define DXBC_COMPRESSED_HEADER_SIZE 8
+
+// Returns the largest size CompressDXBC can produce for dwSize input bytes.
+uint32_t GetDXBCCompressBound(uint32_t dwSize);
+
+// Compresses a blob into pOut. Returns the compressed size, or 0 if pOut is too small.
+uint32_t CompressDXBC(const unsigned char* pData, uint32_t dwSize, unsigned char* pOut, uint32_t dwOutSize);
+
+// Returns the decompressed size of a blob written by CompressDXBC, 0 if the blob is not compressed.
+uint32_t GetDXBCDecompressedSize(const unsigned char* pData, uint32_t dwSize);
+
+// Decompresses a blob written by CompressDXBC. pOut must hold GetDXBCDecompressedSize bytes.
+// Returns non-zero on success, 0 if the compressed data is malformed.
+int DecompressDXBC(const unsigned char* pData, uint32_t dwSize, unsigned char* pOut, uint32_t dwOutSize);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,284 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <string.h>
+
+#include "DXBCPatch.h"
+
+#define DXBC_FOURCC(a, b, c, d)     ((uint32_t)(a) | ((uint32_t)(b) << 8) | ((uint32_t)(c) << 16) | ((uint32_t)(d) << 24))
+
+// container header: magic, checksum[4], version, total size, chunk count, chunk offsets
+#define DXBC_HEADER_SIZE            0x20
+#define DXBC_CHECKSUM_OFFSET        0x04
+#define DXBC_VERSION_OFFSET         0x14
+#define DXBC_TOTAL_SIZE_OFFSET      0x18
+#define DXBC_CHUNK_COUNT_OFFSET     0x1C
+
+// shader chunk opcodes
+#define DXBC_OPCODE_CUSTOMDATA      0x035
+#define DXBC_SYNC_TGSM              0x010010BE  // sync_g
+#define DXBC_SYNC_TGSM_THREADS      0x010018BE  // sync_g_t
+
+// blobs embedded with fxc /Fh are plain byte arrays and are not guaranteed to be DWORD aligned
+static uint32_t ReadDXBC32(const unsigned char* pData, uint32_t dwOffset)
+{
+    uint32_t value;
+    memcpy(&value, pData + dwOffset, sizeof(value));
+    return value;
+}
+
+static void WriteDXBC32(unsigned char* pData, uint32_t dwOffset, uint32_t value)
+{
+    memcpy(pData + dwOffset, &value, sizeof(value));
+}
+
+static void SignDXBC(unsigned char* pData, uint32_t dwSize)
+{
+    uint32_t hash[4];
+    CalculateDXBCChecksum(pData, dwSize, hash);
+    memcpy(pData + DXBC_CHECKSUM_OFFSET, hash, sizeof(hash));
+}
+
+// returns the offset of the first chunk with the given fourcc, 0 if there is none
+static uint32_t FindDXBCChunk(const unsigned char* pData, uint32_t dwFourCC)
+{
+    uint32_t count = ReadDXBC32(pData, DXBC_CHUNK_COUNT_OFFSET);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t offset = ReadDXBC32(pData, DXBC_HEADER_SIZE + i * 4);
+        if (ReadDXBC32(pData, offset) == dwFourCC)
+            return offset;
+    }
+    return 0;
+}
+
+int ValidateDXBCContainer(const unsigned char* pData, uint32_t dwSize)
+{
+    if (pData == NULL || dwSize < DXBC_HEADER_SIZE || (dwSize & 3) != 0)
+        return 0;
+    if (ReadDXBC32(pData, 0) != DXBC_FOURCC('D', 'X', 'B', 'C') || ReadDXBC32(pData, DXBC_TOTAL_SIZE_OFFSET) != dwSize)
+        return 0;
+
+    uint32_t count = ReadDXBC32(pData, DXBC_CHUNK_COUNT_OFFSET);
+    if (count > (dwSize - DXBC_HEADER_SIZE) / 4)
+        return 0;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t offset = ReadDXBC32(pData, DXBC_HEADER_SIZE + i * 4);
+        if (offset < DXBC_HEADER_SIZE + count * 4 || offset > dwSize - 8 || (offset & 3) != 0)
+            return 0;
+        if (ReadDXBC32(pData, offset + 4) > dwSize - 8 - offset)
+            return 0;
+    }
+    return 1;
+}
+
+uint32_t GetDXBCPatchFlags(const unsigned char* pData, uint32_t dwSize)
+{
+    if (!ValidateDXBCContainer(pData, dwSize))
+        return 0;
+
+    uint32_t count = ReadDXBC32(pData, DXBC_CHUNK_COUNT_OFFSET);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t offset = ReadDXBC32(pData, DXBC_HEADER_SIZE + i * 4);
+        if (ReadDXBC32(pData, offset) == DXBC_FOURCC('P', 'R', 'I', 'V') && ReadDXBC32(pData, offset + 4) >= 8 && ReadDXBC32(pData, offset + 8) == DXBC_PATCH_MARKER)
+            return ReadDXBC32(pData, offset + 12);
+    }
+    return 0;
+}
+
+int PatchDXBCGroupMemoryBarrier(unsigned char* pData, uint32_t dwSize)
+{
+    if (!ValidateDXBCContainer(pData, dwSize))
+        return -1;
+
+    // shader model 5 stores its program in SHEX, shader model 4 in SHDR
+    uint32_t chunk = FindDXBCChunk(pData, DXBC_FOURCC('S', 'H', 'E', 'X'));
+    if (chunk == 0)
+        chunk = FindDXBCChunk(pData, DXBC_FOURCC('S', 'H', 'D', 'R'));
+    if (chunk == 0)
+        return 0;
+
+    // program: version token, length in DWORDs, instructions
+    uint32_t chunkSize = ReadDXBC32(pData, chunk + 4);
+    uint32_t program = chunk + 8;
+    if (chunkSize < 8)
+        return -1;
+    uint32_t length = ReadDXBC32(pData, program + 4);
+    if (length < 2 || length > chunkSize / 4)
+        return -1;
+
+    int patched = 0;
+    for (uint32_t i = 2; i < length;)
+    {
+        uint32_t token = ReadDXBC32(pData, program + i * 4);
+        uint32_t instructionLength = (token >> 24) & 0x7F;
+        if ((token & 0x7FF) == DXBC_OPCODE_CUSTOMDATA)
+            instructionLength = (i + 1 < length) ? ReadDXBC32(pData, program + (i + 1) * 4) : 0;
+        if (instructionLength == 0 || instructionLength > length - i)
+            return -1;
+
+        if (token == DXBC_SYNC_TGSM)
+        {
+            WriteDXBC32(pData, program + i * 4, DXBC_SYNC_TGSM_THREADS);
+            ++patched;
+        }
+        i += instructionLength;
+    }
+
+    if (patched)
+        SignDXBC(pData, dwSize);
+    return patched;
+}
+
+uint32_t MarkDXBCPatched(const unsigned char* pData, uint32_t dwSize, uint32_t dwFlags, unsigned char* pOut, uint32_t dwOutSize)
+{
+    if (!ValidateDXBCContainer(pData, dwSize) || dwOutSize < dwSize + DXBC_PATCH_MARKER_SIZE)
+        return 0;
+
+    uint32_t count = ReadDXBC32(pData, DXBC_CHUNK_COUNT_OFFSET);
+    uint32_t tableEnd = DXBC_HEADER_SIZE + count * 4;
+    uint32_t newSize = dwSize + DXBC_PATCH_MARKER_SIZE;
+
+    // one more entry in the chunk table moves every existing chunk by 4 bytes
+    memcpy(pOut, pData, DXBC_HEADER_SIZE);
+    WriteDXBC32(pOut, DXBC_TOTAL_SIZE_OFFSET, newSize);
+    WriteDXBC32(pOut, DXBC_CHUNK_COUNT_OFFSET, count + 1);
+    for (uint32_t i = 0; i < count; ++i)
+        WriteDXBC32(pOut, DXBC_HEADER_SIZE + i * 4, ReadDXBC32(pData, DXBC_HEADER_SIZE + i * 4) + 4);
+    WriteDXBC32(pOut, tableEnd, dwSize + 4);
+    memcpy(pOut + tableEnd + 4, pData + tableEnd, dwSize - tableEnd);
+
+    WriteDXBC32(pOut, dwSize + 4, DXBC_FOURCC('P', 'R', 'I', 'V'));
+    WriteDXBC32(pOut, dwSize + 8, 8);
+    WriteDXBC32(pOut, dwSize + 12, DXBC_PATCH_MARKER);
+    WriteDXBC32(pOut, dwSize + 16, dwFlags);
+
+    SignDXBC(pOut, newSize);
+    return newSize;
+}
+
+static int IsDXBCChunkStripped(uint32_t dwFourCC, const uint32_t* pStrip, uint32_t dwStripCount)
+{
+    for (uint32_t i = 0; i < dwStripCount; ++i)
+    {
+        if (pStrip[i] == dwFourCC)
+            return 1;
+    }
+    return 0;
+}
+
+// chunk header and payload, padded so the next chunk stays DWORD aligned
+static uint32_t GetDXBCChunkSize(const unsigned char* pData, uint32_t dwOffset)
+{
+    return (8 + ReadDXBC32(pData, dwOffset + 4) + 3) & ~3u;
+}
+
+uint32_t StripDXBCChunks(const unsigned char* pData, uint32_t dwSize, const uint32_t* pStrip, uint32_t dwStripCount, unsigned char* pOut, uint32_t dwOutSize)
+{
+    if (!ValidateDXBCContainer(pData, dwSize) || dwOutSize < dwSize)
+        return 0;
+
+    uint32_t count = ReadDXBC32(pData, DXBC_CHUNK_COUNT_OFFSET);
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (!IsDXBCChunkStripped(ReadDXBC32(pData, ReadDXBC32(pData, DXBC_HEADER_SIZE + i * 4)), pStrip, dwStripCount))
+            ++kept;
+    }
+    if (kept == count)
+    {
+        memcpy(pOut, pData, dwSize);
+        return dwSize;
+    }
+
+    // kept chunks are packed in their original order right after the shorter chunk table
+    uint32_t newSize = DXBC_HEADER_SIZE + kept * 4;
+    uint32_t entry = 0;
+    memcpy(pOut, pData, DXBC_HEADER_SIZE);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t offset = ReadDXBC32(pData, DXBC_HEADER_SIZE + i * 4);
+        if (IsDXBCChunkStripped(ReadDXBC32(pData, offset), pStrip, dwStripCount))
+            continue;
+
+        uint32_t chunkSize = GetDXBCChunkSize(pData, offset);
+        WriteDXBC32(pOut, DXBC_HEADER_SIZE + entry++ * 4, newSize);
+        memcpy(pOut + newSize, pData + offset, chunkSize);
+        newSize += chunkSize;
+    }
+    WriteDXBC32(pOut, DXBC_TOTAL_SIZE_OFFSET, newSize);
+    WriteDXBC32(pOut, DXBC_CHUNK_COUNT_OFFSET, kept);
+
+    SignDXBC(pOut, newSize);
+    return newSize;
+}
+
+static int VerifyDXBCChecksum(const unsigned char* pData, uint32_t dwSize)
+{
+    uint32_t hash[4];
+    CalculateDXBCChecksum((unsigned char*)pData, dwSize, hash);
+    return memcmp(pData + DXBC_CHECKSUM_OFFSET, hash, sizeof(hash)) == 0;
+}
+
+int VerifyDXBCStrip(const unsigned char* pData, uint32_t dwSize, const unsigned char* pStripped, uint32_t dwStrippedSize, const uint32_t* pStrip, uint32_t dwStripCount)
+{
+    if (!ValidateDXBCContainer(pData, dwSize) || !ValidateDXBCContainer(pStripped, dwStrippedSize))
+        return 0;
+    if (!VerifyDXBCChecksum(pData, dwSize) || !VerifyDXBCChecksum(pStripped, dwStrippedSize))
+        return 0;
+    if (ReadDXBC32(pData, DXBC_VERSION_OFFSET) != ReadDXBC32(pStripped, DXBC_VERSION_OFFSET))
+        return 0;
+
+    // an unchanged copy only has to be free of the stripped chunks, whatever its layout
+    uint32_t count = ReadDXBC32(pData, DXBC_CHUNK_COUNT_OFFSET);
+    if (dwStrippedSize == dwSize && memcmp(pStripped, pData, dwSize) == 0)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (IsDXBCChunkStripped(ReadDXBC32(pData, ReadDXBC32(pData, DXBC_HEADER_SIZE + i * 4)), pStrip, dwStripCount))
+                return 0;
+        }
+        return 1;
+    }
+
+    uint32_t strippedCount = ReadDXBC32(pStripped, DXBC_CHUNK_COUNT_OFFSET);
+    uint32_t expectedSize = DXBC_HEADER_SIZE + strippedCount * 4;
+    uint32_t entry = 0;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t offset = ReadDXBC32(pData, DXBC_HEADER_SIZE + i * 4);
+        if (IsDXBCChunkStripped(ReadDXBC32(pData, offset), pStrip, dwStripCount))
+            continue;
+        if (entry == strippedCount)
+            return 0;
+
+        uint32_t chunkSize = GetDXBCChunkSize(pData, offset);
+        uint32_t strippedOffset = ReadDXBC32(pStripped, DXBC_HEADER_SIZE + entry++ * 4);
+        if (chunkSize > dwStrippedSize || strippedOffset > dwStrippedSize - chunkSize || memcmp(pStripped + strippedOffset, pData + offset, chunkSize) != 0)
+            return 0;
+        expectedSize += chunkSize;
+    }
+    return entry == strippedCount && expectedSize == dwStrippedSize;
+}
@@ -0,0 +1,70 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Payload tag of the PRIV chunk that marks a container patched offline.
+#define DXBC_PATCH_MARKER       0x50584646  // 'FFXP'
+
+// Bytes added to a container by MarkDXBCPatched (one chunk offset, chunk header and payload).
+#define DXBC_PATCH_MARKER_SIZE  (4 + 8 + 8)
+
+// Patch rules, recorded in the marker so a loader knows which ones were applied.
+#define DXBC_PATCH_GROUP_MEMORY_BARRIER     0x00000001  // GroupMemoryBarrier -> GroupMemoryBarrierWithGroupSync
+#define DXBC_PATCH_ALL                      (DXBC_PATCH_GROUP_MEMORY_BARRIER)
+
+// Computes the checksum stored at offset 4 of a container.
+void CalculateDXBCChecksum(unsigned char* pData, uint32_t dwSize, uint32_t dwHash[4]);
+
+// Returns non-zero when the container header and chunk table fit in dwSize bytes.
+int ValidateDXBCContainer(const unsigned char* pData, uint32_t dwSize);
+
+// Returns the DXBC_PATCH_* rules a container was patched with offline, 0 if it carries no marker.
+uint32_t GetDXBCPatchFlags(const unsigned char* pData, uint32_t dwSize);
+
+// Rewrites every GroupMemoryBarrier in the shader chunk and re-signs the container when something changed.
+// Returns the number of instructions rewritten, or -1 if the container or its shader chunk is malformed.
+int PatchDXBCGroupMemoryBarrier(unsigned char* pData, uint32_t dwSize);
+
+// Copies the container to pOut with a marker chunk recording dwFlags appended, and re-signs it.
+// pOut must hold dwSize + DXBC_PATCH_MARKER_SIZE bytes. Returns the new size, or 0 on failure.
+uint32_t MarkDXBCPatched(const unsigned char* pData, uint32_t dwSize, uint32_t dwFlags, unsigned char* pOut, uint32_t dwOutSize);
+
+// Copies the container to pOut without the chunks whose fourcc is one of the dwStripCount in pStrip, rewrites the
+// chunk table and re-signs it. pOut must hold dwSize bytes. Returns the new size, dwSize when no chunk was dropped
+// (pOut then holds an unchanged copy), or 0 on failure.
+uint32_t StripDXBCChunks(const unsigned char* pData, uint32_t dwSize, const uint32_t* pStrip, uint32_t dwStripCount, unsigned char* pOut, uint32_t dwOutSize);
+
+// Checks a container written by StripDXBCChunks against its source: both carry a valid checksum, the result holds
+// none of the stripped chunks, every other chunk of the source in the same order and byte for byte, and is exactly
+// as large as the header, chunk table and chunks kept. Returns non-zero when all of that holds.
+int VerifyDXBCStrip(const unsigned char* pData, uint32_t dwSize, const unsigned char* pStripped, uint32_t dwStrippedSize, const uint32_t* pStrip, uint32_t dwStripCount);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,1153 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// ffx_dxbc_patch: applies the DXBC patch rules offline so CreatePipelineDX11 can use the embedded blobs as they are.
+//
+// usage: ffx_dxbc_patch [-check] [-verbose] [-strip[=FOURCC,...]] [-dedup] [-compress] [-bench] <file | @listfile>...
+//
+// Each file is either a header written by fxc /Fh (every "const BYTE name[] = { ... };" array in it is patched)
+// or a raw container (.cso). Files are rewritten in place; blobs that already carry the marker are left untouched,
+// so running the tool again on the same outputs is a no-op. With -check nothing is written and the exit code is 1
+// when some blob still needs patching.
+//
+// With -strip, chunks the runtime never reads are dropped from every blob after patching and the container is
+// re-signed. The default list is DXBC_STRIP_DEFAULT (reflection, statistics and debug info: the DX11 backend takes
+// its bindings from the generated reflection tables, not from RDEF); -strip=RDEF,STAT names the chunks explicitly.
+// Every blob is checked against its source with VerifyDXBCStrip, and the blob data sizes before and after are
+// reported. Stripping runs before deduplication, so blobs that only differed in dropped chunks become aliases.
+//
+// With -dedup, a header whose blob has the same DXBC checksum and size as a header earlier in the inputs is
+// rewritten to include that header and #define its array name to the earlier one, so the permutation tables
+// keep their names but each distinct blob is compiled in once. Aliases are checked against their blob again on
+// every run, and the blob data sizes before and after are reported.
+//
+// With -compress, the arrays left after deduplication are replaced by their DXBCCompress form when it is smaller.
+// ffxGetPermutationBlobByIndex recognizes those arrays and decompresses them on first use. Compressed arrays are
+// decompressed again for patching and deduplication, so every mode can run on the output of the others.
+//
+// With -bench, the arrays of every header are read back once the other modes are done and, for each effect (the
+// directory holding the header), the blob data sizes before and after compression are reported along with the
+// decompression throughput and the slowest blob to decompress, what the first pipeline using it waits for in
+// ffxGetPermutationBlobByIndex. Combine it with -check to measure a build's headers without touching them.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "DXBCCompress.h"
+#include "DXBCPatch.h"
+
+#define DXBC_STRIP_DEFAULT      "RDEF,STAT,SDBG,SPDB"
+#define DXBC_STRIP_MAX_CHUNKS   16
+#define DXBC_BENCH_REPEAT       32
+
+typedef struct Buffer
+{
+    unsigned char*  data;
+    size_t          size;
+    size_t          capacity;
+} Buffer;
+
+typedef struct Options
+{
+    int             check;
+    int             verbose;
+    int             dedup;
+    int             compress;
+    int             bench;
+    uint32_t        strip[DXBC_STRIP_MAX_CHUNKS];
+    uint32_t        stripCount;
+} Options;
+
+typedef struct Stats
+{
+    unsigned        files;
+    unsigned        blobs;
+    unsigned        patched;
+    unsigned        skipped;
+    unsigned        barriers;
+    unsigned        errors;
+    unsigned        unique;
+    unsigned        aliases;
+    unsigned        aliased;
+    unsigned long long  blobBytes;
+    unsigned long long  uniqueBytes;
+    unsigned        compressed;
+    unsigned long long  rawBytes;
+    unsigned long long  compressedBytes;
+    unsigned        stripped;
+    unsigned long long  unstrippedBytes;
+    unsigned long long  strippedBytes;
+} Stats;
+
+typedef struct PathList
+{
+    char**          paths;
+    unsigned        count;
+    unsigned        capacity;
+} PathList;
+
+// the blobs of one effect, as measured by -bench
+typedef struct EffectBench
+{
+    char                name[64];
+    unsigned            blobs;
+    unsigned            compressed;
+    unsigned long long  rawBytes;
+    unsigned long long  storedBytes;
+    unsigned long long  decompressedBytes;
+    double              decompressSeconds;
+    double              slowestSeconds;
+} EffectBench;
+
+// the blob of one fxc header, as seen by -dedup
+typedef struct HeaderBlob
+{
+    const char*     path;
+    char            name[256];
+    unsigned char   checksum[16];
+    uint32_t        size;
+    int             alias;          // already rewritten by an earlier run, name and checksum come from the alias
+    char            target[256];    // array an alias refers to
+    int             canonical;      // index of the first header with the same blob, -1 if this is the first
+    int             referenced;     // other headers alias this one
+} HeaderBlob;
+
+static FILE* OpenStream(const char* path, const char* mode)
+{
+#ifdef _MSC_VER
+    FILE* file = NULL;
+    if (fopen_s(&file, path, mode) != 0)
+        return NULL;
+    return file;
+#else
+    return fopen(path, mode);
+#endif
+}
+
+static int Reserve(Buffer* buffer, size_t size)
+{
+    if (size <= buffer->capacity)
+        return 1;
+    size_t capacity = buffer->capacity ? buffer->capacity : 4096;
+    while (capacity < size)
+        capacity *= 2;
+    unsigned char* data = (unsigned char*)realloc(buffer->data, capacity);
+    if (data == NULL)
+        return 0;
+    buffer->data = data;
+    buffer->capacity = capacity;
+    return 1;
+}
+
+static int Append(Buffer* buffer, const void* data, size_t size)
+{
+    if (!Reserve(buffer, buffer->size + size))
+        return 0;
+    memcpy(buffer->data + buffer->size, data, size);
+    buffer->size += size;
+    return 1;
+}
+
+static int ReadInputFile(const char* path, Buffer* buffer)
+{
+    FILE* file = OpenStream(path, "rb");
+    if (file == NULL)
+        return 0;
+
+    unsigned char chunk[65536];
+    size_t count;
+    int result = 1;
+    while (result && (count = fread(chunk, 1, sizeof(chunk), file)) != 0)
+        result = Append(buffer, chunk, count);
+    fclose(file);
+    return result;
+}
+
+static int WriteOutputFile(const char* path, const Buffer* buffer)
+{
+    FILE* file = OpenStream(path, "wb");
+    if (file == NULL)
+        return 0;
+    int result = fwrite(buffer->data, 1, buffer->size, file) == buffer->size;
+    return fclose(file) == 0 && result;
+}
+
+// patches one container, returns 1 if pOut holds a new container, 0 if the blob is already patched, -1 on error
+static int PatchBlob(unsigned char* pData, uint32_t dwSize, Buffer* pOut, const char* name, const Options* options, Stats* stats)
+{
+    stats->blobs++;
+
+    if (!ValidateDXBCContainer(pData, dwSize))
+    {
+        fprintf(stderr, "error: %s: not a valid DXBC container\n", name);
+        stats->errors++;
+        return -1;
+    }
+
+    uint32_t flags = GetDXBCPatchFlags(pData, dwSize);
+    if ((flags & DXBC_PATCH_ALL) == DXBC_PATCH_ALL)
+    {
+        if (options->verbose)
+            printf("%s: already patched\n", name);
+        stats->skipped++;
+        return 0;
+    }
+    if (flags != 0)
+    {
+        fprintf(stderr, "error: %s: patched with an older rule set (0x%x), rebuild the shader\n", name, flags);
+        stats->errors++;
+        return -1;
+    }
+
+    int barriers = PatchDXBCGroupMemoryBarrier(pData, dwSize);
+    if (barriers < 0)
+    {
+        fprintf(stderr, "error: %s: malformed shader chunk\n", name);
+        stats->errors++;
+        return -1;
+    }
+
+    if (!Reserve(pOut, dwSize + DXBC_PATCH_MARKER_SIZE))
+    {
+        stats->errors++;
+        return -1;
+    }
+    pOut->size = MarkDXBCPatched(pData, dwSize, DXBC_PATCH_ALL, pOut->data, dwSize + DXBC_PATCH_MARKER_SIZE);
+
+    if (options->verbose)
+        printf("%s: %d barrier(s) patched\n", name, barriers);
+    stats->patched++;
+    stats->barriers += barriers;
+    return 1;
+}
+
+// drops the -strip chunks from one container, returns 1 if pOut holds a smaller container, 0 if there was nothing to
+// drop and -1 on error
+static int StripBlob(const unsigned char* pData, uint32_t dwSize, Buffer* pOut, const char* name, const Options* options, Stats* stats)
+{
+    if (!Reserve(pOut, dwSize))
+    {
+        stats->errors++;
+        return -1;
+    }
+    uint32_t size = StripDXBCChunks(pData, dwSize, options->strip, options->stripCount, pOut->data, dwSize);
+    if (size == 0 || !VerifyDXBCStrip(pData, dwSize, pOut->data, size, options->strip, options->stripCount))
+    {
+        fprintf(stderr, "error: %s: %s\n", name, size == 0 ? "not a valid DXBC container" : "stripped container does not match its source");
+        stats->errors++;
+        return -1;
+    }
+
+    stats->unstrippedBytes += dwSize;
+    stats->strippedBytes += size;
+    if (size == dwSize)
+        return 0;
+
+    if (options->verbose)
+        printf("%s: stripped %u -> %u bytes\n", name, dwSize, size);
+    pOut->size = size;
+    stats->stripped++;
+    return 1;
+}
+
+// patches and then strips one container, returns 1 if pOut holds a new container, 0 if the blob is unchanged, -1 on error
+static int ProcessBlob(unsigned char* pData, uint32_t dwSize, Buffer* pOut, const char* name, const Options* options, Stats* stats)
+{
+    int patched = PatchBlob(pData, dwSize, pOut, name, options, stats);
+    if (patched < 0 || options->stripCount == 0)
+        return patched;
+
+    Buffer stripped = { 0 };
+    int result = patched > 0 ? StripBlob(pOut->data, (uint32_t)pOut->size, &stripped, name, options, stats)
+                             : StripBlob(pData, dwSize, &stripped, name, options, stats);
+    if (result > 0)
+    {
+        Buffer previous = *pOut;
+        *pOut = stripped;
+        stripped = previous;
+    }
+    free(stripped.data);
+    return result < 0 ? -1 : (patched | result);
+}
+
+static int PatchBinary(const char* path, Buffer* file, const Options* options, Stats* stats)
+{
+    Buffer blob = { 0 };
+    int result = ProcessBlob(file->data, (uint32_t)file->size, &blob, path, options, stats);
+    if (result > 0 && !options->check && !WriteOutputFile(path, &blob))
+    {
+        fprintf(stderr, "error: %s: cannot write file\n", path);
+        stats->errors++;
+    }
+    free(blob.data);
+    return result >= 0;
+}
+
+static const char* FindText(const char* text, const char* end, const char* pattern)
+{
+    size_t length = strlen(pattern);
+    for (; text + length <= end; ++text)
+    {
+        if (memcmp(text, pattern, length) == 0)
+            return text;
+    }
+    return NULL;
+}
+
+// one "const BYTE name[] = { ... };" array of a header
+typedef struct HeaderArray
+{
+    const char*     name;
+    const char*     nameEnd;
+    const char*     open;
+    const char*     close;
+} HeaderArray;
+
+// finds the next array at or after text, returns 0 if there is none and -1 if it is not terminated
+static int FindHeaderArray(const char* text, const char* end, HeaderArray* array)
+{
+    const char* declaration = FindText(text, end, "const BYTE ");
+    if (declaration == NULL)
+        return 0;
+
+    array->name = declaration + strlen("const BYTE ");
+    array->nameEnd = array->name;
+    while (array->nameEnd < end && (isalnum((unsigned char)*array->nameEnd) || *array->nameEnd == '_'))
+        ++array->nameEnd;
+    array->open = FindText(array->nameEnd, end, "{");
+    array->close = array->open ? FindText(array->open, end, "}") : NULL;
+    return array->close ? 1 : -1;
+}
+
+static void AppendByteArray(Buffer* output, const unsigned char* data, size_t size)
+{
+    Append(output, "\n", 1);
+    for (size_t i = 0; i < size; ++i)
+    {
+        char value[8];
+        int length = snprintf(value, sizeof(value), (i % 16 == 0) ? "    %3u" : ", %3u", data[i]);
+        Append(output, value, length);
+        if (i % 16 == 15 || i + 1 == size)
+            Append(output, (i + 1 == size) ? "\n" : ",\n", (i + 1 == size) ? 1 : 2);
+    }
+}
+
+// replaces a compressed array by its contents, returns 1 if it was compressed, 0 if not and -1 if it is malformed
+static int ExpandByteArray(Buffer* bytes, const char* name, Stats* stats)
+{
+    uint32_t size = GetDXBCDecompressedSize(bytes->data, (uint32_t)bytes->size);
+    if (size == 0)
+        return 0;
+
+    Buffer expanded = { 0 };
+    if (!Reserve(&expanded, size) || !DecompressDXBC(bytes->data, (uint32_t)bytes->size, expanded.data, size))
+    {
+        fprintf(stderr, "error: %s: malformed compressed blob\n", name);
+        stats->errors++;
+        free(expanded.data);
+        return -1;
+    }
+    free(bytes->data);
+    bytes->data = expanded.data;
+    bytes->size = size;
+    bytes->capacity = expanded.capacity;
+    return 1;
+}
+
+// decimal or hex byte values separated by commas
+static int ParseByteArray(const char* open, const char* close, Buffer* bytes, const char* name, Stats* stats)
+{
+    bytes->size = 0;
+    for (const char* cursor = open + 1; cursor < close;)
+    {
+        if (!isdigit((unsigned char)*cursor))
+        {
+            ++cursor;
+            continue;
+        }
+        char* next;
+        unsigned long value = strtoul(cursor, &next, 0);
+        unsigned char byte = (unsigned char)value;
+        if (value > 0xFF || !Append(bytes, &byte, 1))
+        {
+            fprintf(stderr, "error: %s: bad byte value\n", name);
+            stats->errors++;
+            return 0;
+        }
+        cursor = next;
+    }
+    return 1;
+}
+
+// rewrites every "const BYTE name[] = { ... };" array of an fxc header, everything else is copied as is
+static int PatchHeader(const char* path, Buffer* file, const Options* options, Stats* stats)
+{
+    const char* text = (const char*)file->data;
+    const char* end = text + file->size;
+    Buffer output = { 0 };
+    Buffer bytes = { 0 };
+    Buffer blob = { 0 };
+    int modified = 0;
+    int result = 1;
+
+    const char* copied = text;
+    HeaderArray array;
+    int found;
+    while (result && (found = FindHeaderArray(copied, end, &array)) != 0)
+    {
+        if (found < 0)
+        {
+            fprintf(stderr, "error: %s: unterminated array\n", path);
+            stats->errors++;
+            result = 0;
+            break;
+        }
+
+        char blobName[256];
+        snprintf(blobName, sizeof(blobName), "%s(%.*s)", path, (int)(array.nameEnd - array.name), array.name);
+
+        // a compressed blob that still needs patching is written back uncompressed
+        if (!ParseByteArray(array.open, array.close, &bytes, blobName, stats) || ExpandByteArray(&bytes, blobName, stats) < 0)
+        {
+            result = 0;
+            break;
+        }
+
+        int patched = ProcessBlob(bytes.data, (uint32_t)bytes.size, &blob, blobName, options, stats);
+        if (patched < 0)
+        {
+            result = 0;
+            break;
+        }
+
+        Append(&output, copied, array.open + 1 - copied);
+        if (patched > 0)
+        {
+            AppendByteArray(&output, blob.data, blob.size);
+            modified = 1;
+        }
+        else
+        {
+            Append(&output, array.open + 1, array.close - array.open - 1);
+        }
+        copied = array.close;
+    }
+
+    if (result && modified && !options->check)
+    {
+        Append(&output, copied, end - copied);
+        if (!WriteOutputFile(path, &output))
+        {
+            fprintf(stderr, "error: %s: cannot write file\n", path);
+            stats->errors++;
+            result = 0;
+        }
+    }
+
+    free(output.data);
+    free(bytes.data);
+    free(blob.data);
+    return result;
+}
+
+static int PatchFile(const char* path, const Options* options, Stats* stats)
+{
+    Buffer file = { 0 };
+    if (!ReadInputFile(path, &file))
+    {
+        fprintf(stderr, "error: %s: cannot read file\n", path);
+        stats->errors++;
+        return 0;
+    }
+
+    stats->files++;
+    int result = (file.size >= 4 && memcmp(file.data, "DXBC", 4) == 0) ? PatchBinary(path, &file, options, stats)
+                                                                      : PatchHeader(path, &file, options, stats);
+    free(file.data);
+    return result;
+}
+
+static int AddPath(PathList* list, const char* path)
+{
+    if (list->count == list->capacity)
+    {
+        unsigned capacity = list->capacity ? list->capacity * 2 : 256;
+        char** paths = (char**)realloc(list->paths, capacity * sizeof(char*));
+        if (paths == NULL)
+            return 0;
+        list->paths = paths;
+        list->capacity = capacity;
+    }
+    size_t length = strlen(path) + 1;
+    char* copy = (char*)malloc(length);
+    if (copy == NULL)
+        return 0;
+    memcpy(copy, path, length);
+    list->paths[list->count++] = copy;
+    return 1;
+}
+
+static void FreePaths(PathList* list)
+{
+    for (unsigned i = 0; i < list->count; ++i)
+        free(list->paths[i]);
+    free(list->paths);
+}
+
+static int IsSeparator(char c)
+{
+    return c == '/' || c == '\\';
+}
+
+static int GetFullPath(const char* path, char* pOut, size_t outSize)
+{
+#ifdef _WIN32
+    return _fullpath(pOut, path, outSize) != NULL;
+#else
+    char* full = realpath(path, NULL);
+    if (full == NULL)
+        return 0;
+    int fits = strlen(full) < outSize;
+    if (fits)
+        strcpy(pOut, full);
+    free(full);
+    return fits;
+#endif
+}
+
+// path of pTo relative to the directory of pFrom with '/' separators, as written in an #include.
+// Both are made absolute first so "./" or ".." in the inputs do not miscount the directory levels;
+// pTo stays absolute when the two share no root (different drives).
+static void GetIncludePath(const char* pFromPath, const char* pToPath, char* pOut, size_t outSize)
+{
+    char fromFull[1024];
+    char toFull[1024];
+    int resolved = GetFullPath(pFromPath, fromFull, sizeof(fromFull)) && GetFullPath(pToPath, toFull, sizeof(toFull));
+    const char* pFrom = resolved ? fromFull : pFromPath;
+    const char* pTo = resolved ? toFull : pToPath;
+
+    size_t common = 0;
+    for (size_t i = 0; pFrom[i] && pTo[i]; ++i)
+    {
+        if (IsSeparator(pFrom[i]) && IsSeparator(pTo[i]))
+            common = i + 1;
+        else if (pFrom[i] != pTo[i])
+            break;
+    }
+
+    size_t length = 0;
+    pOut[0] = '\0';
+    if (common > 0 || !resolved)
+    {
+        // one step up for every directory level of pFrom below the common prefix
+        for (const char* c = pFrom + common; *c && length + 4 < outSize; ++c)
+        {
+            if (IsSeparator(*c))
+                length += snprintf(pOut + length, outSize - length, "../");
+        }
+    }
+    for (const char* c = pTo + common; *c && length + 1 < outSize; ++c)
+        pOut[length++] = IsSeparator(*c) ? '/' : *c;
+    pOut[length] = '\0';
+}
+
+#define DEDUP_ALIAS_PREFIX "// ffx_dxbc_patch -dedup: "
+
+static const char* ParseIdentifier(const char* text, char* pOut, size_t outSize)
+{
+    size_t length = 0;
+    while (text && (isalnum((unsigned char)text[length]) || text[length] == '_'))
+        ++length;
+    if (length == 0 || length >= outSize)
+        return NULL;
+    memcpy(pOut, text, length);
+    pOut[length] = '\0';
+    return text + length;
+}
+
+static const char* ParseLiteral(const char* text, const char* literal)
+{
+    size_t length = strlen(literal);
+    return (text && strncmp(text, literal, length) == 0) ? text + length : NULL;
+}
+
+static int HexDigit(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+// reads the single array of an fxc header or the alias left by an earlier run, returns 0 if the header has neither
+static int ReadHeaderBlob(const char* path, HeaderBlob* header, Stats* stats)
+{
+    Buffer file = { 0 };
+    if (!ReadInputFile(path, &file) || !Append(&file, "", 1))
+    {
+        fprintf(stderr, "error: %s: cannot read file\n", path);
+        stats->errors++;
+        free(file.data);
+        return 0;
+    }
+
+    const char* text = (const char*)file.data;
+    const char* end = text + file.size - 1;
+    int result = 0;
+    memset(header, 0, sizeof(*header));
+    header->path = path;
+    header->canonical = -1;
+
+    const char* alias = FindText(text, end, DEDUP_ALIAS_PREFIX);
+    HeaderArray array;
+    if (alias != NULL)
+    {
+        // "name = target (checksum <32 hex digits>, <size> bytes)"
+        const char* cursor = ParseIdentifier(alias + strlen(DEDUP_ALIAS_PREFIX), header->name, sizeof(header->name));
+        cursor = ParseLiteral(cursor, " = ");
+        cursor = ParseIdentifier(cursor, header->target, sizeof(header->target));
+        cursor = ParseLiteral(cursor, " (checksum ");
+        for (int i = 0; cursor && i < 16; ++i, cursor += 2)
+        {
+            int high = HexDigit(cursor[0]);
+            int low = high < 0 ? -1 : HexDigit(cursor[1]);
+            if (low < 0)
+            {
+                // malformed, reported below
+                cursor = NULL;
+                break;
+            }
+            header->checksum[i] = (unsigned char)(high * 16 + low);
+        }
+        cursor = ParseLiteral(cursor, ", ");
+        if (cursor && isdigit((unsigned char)*cursor))
+        {
+            char* next;
+            header->size = (uint32_t)strtoul(cursor, &next, 10);
+            cursor = ParseLiteral(next, " bytes)");
+        }
+        else
+        {
+            cursor = NULL;
+        }
+
+        if (cursor != NULL)
+        {
+            header->alias = 1;
+            result = 1;
+        }
+        else
+        {
+            fprintf(stderr, "error: %s: malformed alias\n", path);
+            stats->errors++;
+        }
+    }
+    else if (FindHeaderArray(text, end, &array) > 0 && FindText(array.close, end, "const BYTE ") == NULL)
+    {
+        Buffer bytes = { 0 };
+        if (array.nameEnd - array.name < (int)sizeof(header->name) && ParseByteArray(array.open, array.close, &bytes, path, stats) &&
+            ExpandByteArray(&bytes, path, stats) >= 0 && bytes.size >= 20 && memcmp(bytes.data, "DXBC", 4) == 0)
+        {
+            memcpy(header->name, array.name, array.nameEnd - array.name);
+            memcpy(header->checksum, bytes.data + 4, sizeof(header->checksum));
+            header->size = (uint32_t)bytes.size;
+            result = 1;
+        }
+        free(bytes.data);
+    }
+
+    free(file.data);
+    return result;
+}
+
+static int WriteAliasHeader(const HeaderBlob* header, const HeaderBlob* target)
+{
+    char includePath[1024];
+    GetIncludePath(header->path, target->path, includePath, sizeof(includePath));
+
+    char text[4096];
+    int length = snprintf(text, sizeof(text), "#pragma once\n" DEDUP_ALIAS_PREFIX "%s = %s (checksum ", header->name, target->name);
+    for (int i = 0; i < 16; ++i)
+        length += snprintf(text + length, sizeof(text) - length, "%02x", header->checksum[i]);
+    length += snprintf(text + length, sizeof(text) - length,
+                       ", %u bytes)\n\n#include \"%s\"\n\n#define %s %s\n", header->size, includePath, header->name, target->name);
+
+    Buffer output = { (unsigned char*)text, (size_t)length, sizeof(text) };
+    return length < (int)sizeof(text) && WriteOutputFile(header->path, &output);
+}
+
+// aliases are included by other headers next to their own table entry, so the blob they share needs a guard
+static int AddIncludeGuard(const char* path)
+{
+    static const char guard[] = "#pragma once\n";
+    Buffer file = { 0 };
+    Buffer output = { 0 };
+    int result = ReadInputFile(path, &file);
+    if (result && (file.size < sizeof(guard) - 1 || memcmp(file.data, guard, sizeof(guard) - 1) != 0))
+    {
+        result = Append(&output, guard, sizeof(guard) - 1) && Append(&output, file.data, file.size) && WriteOutputFile(path, &output);
+    }
+    free(file.data);
+    free(output.data);
+    return result;
+}
+
+// keeps one copy of every distinct blob among the fxc headers, in input order
+static void DeduplicateHeaders(const PathList* inputs, const Options* options, Stats* stats)
+{
+    HeaderBlob* headers = (HeaderBlob*)calloc(inputs->count ? inputs->count : 1, sizeof(HeaderBlob));
+    unsigned count = 0;
+    if (headers == NULL)
+    {
+        stats->errors++;
+        return;
+    }
+
+    for (unsigned i = 0; i < inputs->count; ++i)
+    {
+        if (ReadHeaderBlob(inputs->paths[i], &headers[count], stats))
+            count++;
+    }
+
+    // the first header with a blob owns it, aliases from earlier runs must still match their owner
+    for (unsigned i = 0; i < count; ++i)
+    {
+        HeaderBlob* header = &headers[i];
+        for (unsigned j = 0; j < count && header->canonical < 0; ++j)
+        {
+            const HeaderBlob* other = &headers[j];
+            if (j == i || other->alias)
+                continue;
+            if (header->alias ? strcmp(other->name, header->target) == 0
+                              : (j < i && other->canonical < 0 && other->size == header->size &&
+                                 memcmp(other->checksum, header->checksum, sizeof(header->checksum)) == 0))
+                header->canonical = (int)j;
+        }
+
+        stats->blobBytes += header->size;
+        if (header->alias)
+        {
+            const HeaderBlob* target = header->canonical >= 0 ? &headers[header->canonical] : NULL;
+            if (target == NULL || target->size != header->size || memcmp(target->checksum, header->checksum, sizeof(header->checksum)) != 0)
+            {
+                fprintf(stderr, "error: %s: %s no longer matches %s, delete the header and rebuild\n", header->path, header->name, header->target);
+                stats->errors++;
+                continue;
+            }
+        }
+        if (header->canonical < 0)
+        {
+            stats->unique++;
+            stats->uniqueBytes += header->size;
+            continue;
+        }
+
+        stats->aliases++;
+        headers[header->canonical].referenced = 1;
+        if (header->alias)
+            continue;
+
+        if (options->verbose)
+            printf("%s: %s is identical to %s\n", header->path, header->name, headers[header->canonical].name);
+        stats->aliased++;
+        if (!options->check && !WriteAliasHeader(header, &headers[header->canonical]))
+        {
+            fprintf(stderr, "error: %s: cannot write file\n", header->path);
+            stats->errors++;
+        }
+    }
+
+    for (unsigned i = 0; i < count && !options->check; ++i)
+    {
+        if (headers[i].referenced && !AddIncludeGuard(headers[i].path))
+        {
+            fprintf(stderr, "error: %s: cannot write file\n", headers[i].path);
+            stats->errors++;
+        }
+    }
+
+    free(headers);
+}
+
+// replaces the arrays of a header by their compressed form when it is smaller, raw containers are left as they are
+static void CompressHeader(const char* path, const Options* options, Stats* stats)
+{
+    Buffer file = { 0 };
+    if (!ReadInputFile(path, &file))
+    {
+        fprintf(stderr, "error: %s: cannot read file\n", path);
+        stats->errors++;
+        return;
+    }
+    if (file.size >= 4 && memcmp(file.data, "DXBC", 4) == 0)
+    {
+        free(file.data);
+        return;
+    }
+
+    const char* text = (const char*)file.data;
+    const char* end = text + file.size;
+    Buffer output = { 0 };
+    Buffer bytes = { 0 };
+    Buffer packed = { 0 };
+    int modified = 0;
+    int result = 1;
+
+    const char* copied = text;
+    HeaderArray array;
+    while (result && FindHeaderArray(copied, end, &array) > 0)
+    {
+        result = ParseByteArray(array.open, array.close, &bytes, path, stats);
+        uint32_t rawSize = result ? GetDXBCDecompressedSize(bytes.data, (uint32_t)bytes.size) : 0;
+        uint32_t packedSize = 0;
+        if (result && rawSize == 0)
+        {
+            rawSize = (uint32_t)bytes.size;
+            result = Reserve(&packed, GetDXBCCompressBound(rawSize));
+            packedSize = result ? CompressDXBC(bytes.data, rawSize, packed.data, (uint32_t)packed.capacity) : 0;
+        }
+        if (!result)
+            break;
+
+        Append(&output, copied, array.open + 1 - copied);
+        if (packedSize != 0 && packedSize < rawSize)
+        {
+            AppendByteArray(&output, packed.data, packedSize);
+            stats->compressed++;
+            stats->compressedBytes += packedSize;
+            modified = 1;
+        }
+        else
+        {
+            Append(&output, array.open + 1, array.close - array.open - 1);
+            stats->compressedBytes += bytes.size;
+        }
+        stats->rawBytes += rawSize;
+        copied = array.close;
+    }
+
+    if (result && modified && !options->check)
+    {
+        Append(&output, copied, end - copied);
+        if (!WriteOutputFile(path, &output))
+        {
+            fprintf(stderr, "error: %s: cannot write file\n", path);
+            stats->errors++;
+        }
+    }
+
+    free(file.data);
+    free(output.data);
+    free(bytes.data);
+    free(packed.data);
+}
+
+static double GetSeconds(void)
+{
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return (double)time.tv_sec + (double)time.tv_nsec * 1e-9;
+}
+
+// fxc headers are written next to their shader source, in a directory named after the effect
+static void GetEffectName(const char* path, char* pOut, size_t outSize)
+{
+    const char* last = NULL;
+    const char* previous = NULL;
+    for (const char* cursor = path; *cursor; ++cursor)
+    {
+        if ((*cursor == '/' || *cursor == '\\') && cursor[1] != '/' && cursor[1] != '\\')
+        {
+            previous = last;
+            last = cursor;
+        }
+    }
+
+    const char* begin = previous ? previous + 1 : path;
+    size_t length = last ? (size_t)(last - begin) : 0;
+    while (length && (begin[length - 1] == '/' || begin[length - 1] == '\\'))
+        --length;
+    if (length == 0 || length >= outSize)
+    {
+        begin = ".";
+        length = 1;
+    }
+    memcpy(pOut, begin, length);
+    pOut[length] = '\0';
+}
+
+static void PrintEffectBench(const EffectBench* effect)
+{
+    printf("ffx_dxbc_patch: %s: %u blob(s), %u compressed, blob data %llu -> %llu bytes", effect->name, effect->blobs,
+           effect->compressed, effect->rawBytes, effect->storedBytes);
+    if (effect->compressed)
+        printf(", decompression %.0f MB/s, slowest blob %.1f us", effect->decompressedBytes / effect->decompressSeconds * 1e-6,
+               effect->slowestSeconds * 1e6);
+    printf("\n");
+}
+
+// decompresses every compressed array DXBC_BENCH_REPEAT times and reports the sizes and timings of each effect
+static void BenchHeaders(const PathList* inputs, Stats* stats)
+{
+    EffectBench* effects = NULL;
+    unsigned effectCount = 0;
+    EffectBench total = { "total" };
+    Buffer bytes = { 0 };
+    Buffer raw = { 0 };
+
+    for (unsigned i = 0; i < inputs->count; ++i)
+    {
+        const char* path = inputs->paths[i];
+        Buffer file = { 0 };
+        if (!ReadInputFile(path, &file))
+        {
+            fprintf(stderr, "error: %s: cannot read file\n", path);
+            stats->errors++;
+            continue;
+        }
+
+        char name[sizeof(total.name)];
+        GetEffectName(path, name, sizeof(name));
+        EffectBench* effect = NULL;
+        for (unsigned j = 0; j < effectCount && effect == NULL; ++j)
+        {
+            if (strcmp(effects[j].name, name) == 0)
+                effect = &effects[j];
+        }
+        if (effect == NULL)
+        {
+            EffectBench* grown = (EffectBench*)realloc(effects, (effectCount + 1) * sizeof(EffectBench));
+            if (grown == NULL)
+            {
+                stats->errors++;
+                free(file.data);
+                break;
+            }
+            effects = grown;
+            effect = &effects[effectCount++];
+            memset(effect, 0, sizeof(*effect));
+            memcpy(effect->name, name, sizeof(name));
+        }
+
+        // raw containers and aliases hold no array
+        const char* text = (const char*)file.data;
+        const char* end = text + file.size;
+        HeaderArray array;
+        for (const char* cursor = text; (file.size < 4 || memcmp(text, "DXBC", 4) != 0) && FindHeaderArray(cursor, end, &array) > 0; cursor = array.close)
+        {
+            if (!ParseByteArray(array.open, array.close, &bytes, path, stats))
+                break;
+
+            uint32_t rawSize = GetDXBCDecompressedSize(bytes.data, (uint32_t)bytes.size);
+            effect->blobs++;
+            effect->storedBytes += bytes.size;
+            effect->rawBytes += rawSize ? rawSize : bytes.size;
+            if (rawSize == 0)
+                continue;
+
+            if (!Reserve(&raw, rawSize))
+            {
+                stats->errors++;
+                break;
+            }
+            // the fastest of several runs, the others are mostly noise from the rest of the system
+            double seconds = 0.0;
+            int decompressed = 1;
+            for (int repeat = 0; repeat < DXBC_BENCH_REPEAT && decompressed; ++repeat)
+            {
+                double start = GetSeconds();
+                decompressed = DecompressDXBC(bytes.data, (uint32_t)bytes.size, raw.data, rawSize);
+                double elapsed = GetSeconds() - start;
+                if (repeat == 0 || elapsed < seconds)
+                    seconds = elapsed;
+            }
+            if (!decompressed)
+            {
+                fprintf(stderr, "error: %s: malformed compressed array\n", path);
+                stats->errors++;
+                break;
+            }
+
+            effect->compressed++;
+            effect->decompressedBytes += rawSize;
+            effect->decompressSeconds += seconds;
+            if (seconds > effect->slowestSeconds)
+                effect->slowestSeconds = seconds;
+        }
+        free(file.data);
+    }
+
+    for (unsigned i = 0; i < effectCount; ++i)
+    {
+        PrintEffectBench(&effects[i]);
+        total.blobs += effects[i].blobs;
+        total.compressed += effects[i].compressed;
+        total.rawBytes += effects[i].rawBytes;
+        total.storedBytes += effects[i].storedBytes;
+        total.decompressedBytes += effects[i].decompressedBytes;
+        total.decompressSeconds += effects[i].decompressSeconds;
+        if (effects[i].slowestSeconds > total.slowestSeconds)
+            total.slowestSeconds = effects[i].slowestSeconds;
+    }
+    PrintEffectBench(&total);
+
+    free(effects);
+    free(bytes.data);
+    free(raw.data);
+}
+
+// "RDEF,STAT,..." to fourccs, returns 0 if an entry is not four characters or names a chunk the runtime needs
+static int ParseStripList(const char* list, Options* options)
+{
+    options->stripCount = 0;
+    for (const char* cursor = list;; cursor += 5)
+    {
+        if (strlen(cursor) < 4 || (cursor[4] != ',' && cursor[4] != '\0') || options->stripCount == DXBC_STRIP_MAX_CHUNKS)
+            return 0;
+        if (memcmp(cursor, "SHEX", 4) == 0 || memcmp(cursor, "SHDR", 4) == 0 || memcmp(cursor, "PRIV", 4) == 0)
+            return 0;
+
+        options->strip[options->stripCount++] = (uint32_t)(unsigned char)cursor[0] | ((uint32_t)(unsigned char)cursor[1] << 8) |
+                                                ((uint32_t)(unsigned char)cursor[2] << 16) | ((uint32_t)(unsigned char)cursor[3] << 24);
+        if (cursor[4] == '\0')
+            return 1;
+    }
+}
+
+// a list file names one input per line, as written by MSBuild's WriteLinesToFile
+static void ReadListFile(const char* path, PathList* inputs, Stats* stats)
+{
+    Buffer list = { 0 };
+    if (!ReadInputFile(path, &list) || !Append(&list, "\n", 1))
+    {
+        fprintf(stderr, "error: %s: cannot read list file\n", path);
+        stats->errors++;
+        free(list.data);
+        return;
+    }
+
+    char* line = (char*)list.data;
+    char* end = line + list.size;
+    while (line < end)
+    {
+        char* lineEnd = line;
+        while (*lineEnd != '\n')
+            ++lineEnd;
+        *lineEnd = '\0';
+
+        while (*line == ' ' || *line == '\t')
+            ++line;
+        for (char* trim = lineEnd; trim > line && (trim[-1] == '\r' || trim[-1] == ' ' || trim[-1] == '\t'); --trim)
+            trim[-1] = '\0';
+
+        if (*line != '\0' && !AddPath(inputs, line))
+            stats->errors++;
+        line = lineEnd + 1;
+    }
+    free(list.data);
+}
+
+int main(int argc, char** argv)
+{
+    Options options = { 0 };
+    Stats stats = { 0 };
+    PathList inputs = { 0 };
+    int arguments = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-check") == 0)
+            options.check = 1;
+        else if (strcmp(argv[i], "-verbose") == 0)
+            options.verbose = 1;
+        else if (strcmp(argv[i], "-dedup") == 0)
+            options.dedup = 1;
+        else if (strcmp(argv[i], "-compress") == 0)
+            options.compress = 1;
+        else if (strcmp(argv[i], "-bench") == 0)
+            options.bench = 1;
+        else if (strcmp(argv[i], "-strip") == 0 || strncmp(argv[i], "-strip=", 7) == 0)
+        {
+            if (!ParseStripList(argv[i][6] == '=' ? argv[i] + 7 : DXBC_STRIP_DEFAULT, &options))
+            {
+                fprintf(stderr, "error: %s: expected a comma separated list of chunk fourccs other than SHEX, SHDR and PRIV\n", argv[i]);
+                return 2;
+            }
+        }
+    }
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (argv[i][0] == '-')
+            continue;
+        if (argv[i][0] == '@')
+            ReadListFile(argv[i] + 1, &inputs, &stats);
+        else if (!AddPath(&inputs, argv[i]))
+            stats.errors++;
+        arguments++;
+    }
+
+    if (arguments == 0)
+    {
+        fprintf(stderr, "usage: ffx_dxbc_patch [-check] [-verbose] [-strip[=FOURCC,...]] [-dedup] [-compress] [-bench] <file | @listfile>...\n");
+        return 2;
+    }
+
+    for (unsigned i = 0; i < inputs.count; ++i)
+        PatchFile(inputs.paths[i], &options, &stats);
+
+    printf("ffx_dxbc_patch: %u file(s), %u blob(s), %u %s, %u barrier(s), %u already patched\n",
+           stats.files, stats.blobs, stats.patched, options.check ? "need patching" : "patched", stats.barriers, stats.skipped);
+    if (options.stripCount)
+        printf("ffx_dxbc_patch: %u blob(s) %s, blob data %llu -> %llu bytes\n",
+               stats.stripped, options.check ? "need stripping" : "stripped", stats.unstrippedBytes, stats.strippedBytes);
+
+    // aliases are only written once every blob is patched, so they are compared in their final form
+    if (options.dedup && stats.errors == 0)
+    {
+        DeduplicateHeaders(&inputs, &options, &stats);
+        printf("ffx_dxbc_patch: %u distinct blob(s), %u alias(es), %u %s, blob data %llu -> %llu bytes\n",
+               stats.unique, stats.aliases, stats.aliased, options.check ? "need aliasing" : "aliased", stats.blobBytes, stats.uniqueBytes);
+    }
+
+    // aliases hold no array, so only the blobs left after deduplication are compressed
+    if (options.compress && stats.errors == 0)
+    {
+        for (unsigned i = 0; i < inputs.count; ++i)
+            CompressHeader(inputs.paths[i], &options, &stats);
+        printf("ffx_dxbc_patch: %u blob(s) %s, blob data %llu -> %llu bytes\n",
+               stats.compressed, options.check ? "need compressing" : "compressed", stats.rawBytes, stats.compressedBytes);
+    }
+
+    if (options.bench && stats.errors == 0)
+        BenchHeaders(&inputs, &stats);
+
+    FreePaths(&inputs);
+
+    if (stats.errors)
+        return 2;
+    return (options.check && (stats.patched || stats.stripped || stats.aliased || stats.compressed)) ? 1 : 0;
+}
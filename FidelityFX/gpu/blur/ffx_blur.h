@@ -71,7 +71,7 @@
 /// @ingroup FfxGPUBlur
 #define FFX_BLUR_DISPATCH_Y  8
 
-#ifndef FFX_CPU
+#if !defined(FFX_CPU) || defined(FFX_GPU)
 
 /// FFX_BLUR_OPTION_KERNEL_DIMENSION needs to be defined by the client application
 /// App should define e.g the following for 5x5 blur:
@@ -120,13 +120,13 @@
 // Define CacheTypes<FP16, SOA> 
 #if BLUR_GROUPSHARED_MEMORY_SOA
     #if BLUR_GROUPSHARED_MEMORY_HALF
-        #ifdef FFX_HLSL
+        #if defined(FFX_HLSL) || defined(FFX_CPU)
             #define BLUR_GROUPSHARED_MEMORY_TYPE groupshared FfxFloat16
         #else
             #define BLUR_GROUPSHARED_MEMORY_TYPE shared FfxFloat16
         #endif
     #else 
-        #ifdef FFX_HLSL
+        #if defined(FFX_HLSL) || defined(FFX_CPU)
             #define BLUR_GROUPSHARED_MEMORY_TYPE groupshared FfxFloat32
         #else
             #define BLUR_GROUPSHARED_MEMORY_TYPE shared FfxFloat32
@@ -134,13 +134,13 @@
     #endif 
 #else // BLUR_GROUPSHARED_MEMORY_SOA
     #if BLUR_GROUPSHARED_MEMORY_HALF
-        #ifdef FFX_HLSL
+        #if defined(FFX_HLSL) || defined(FFX_CPU)
             #define BLUR_GROUPSHARED_MEMORY_TYPE groupshared FfxFloat16x3
         #else
             #define BLUR_GROUPSHARED_MEMORY_TYPE shared FfxFloat16x3
         #endif
     #else 
-        #ifdef FFX_HLSL
+        #if defined(FFX_HLSL) || defined(FFX_CPU)
             #define BLUR_GROUPSHARED_MEMORY_TYPE groupshared FfxFloat32x3
         #else
             #define BLUR_GROUPSHARED_MEMORY_TYPE shared FfxFloat32x3
@@ -175,7 +175,7 @@ MinTiles     -> Ceil(HalfKernel / TileSize) * 2 + 1
 
 
 #if BLUR_GROUPSHARED_MEMORY_PK_UINT
-#ifdef FFX_HLSL
+#if defined(FFX_HLSL) || defined(FFX_CPU)
     groupshared FfxUInt32  OutputCacheRG[NUM_PIXELS_OUTPUT_CACHE]; // RG: 2x fp16's are packed into 32bit unsigned int
     groupshared FfxFloat32 OutputCacheB [NUM_PIXELS_OUTPUT_CACHE]; // B : don't use fp16 for B to avoid bank conflicts
 #else
@@ -215,7 +215,7 @@ MinTiles     -> Ceil(HalfKernel / TileSize) * 2 + 1
     #define NUM_PIXELS_INPUT_CACHE ((INPUT_CACHE_TILE_SIZE_X * FFX_BLUR_TILE_SIZE_Y) * NUM_TILES_INPUT_CACHE)
 
     #if BLUR_GROUPSHARED_MEMORY_PK_UINT
-        #ifdef FFX_HLSL
+        #if defined(FFX_HLSL) || defined(FFX_CPU)
             groupshared FfxUInt32  InputCacheRG[NUM_PIXELS_INPUT_CACHE]; // RG: 2x fp16's are packed into 32bit unsigned int
             groupshared FfxFloat32 InputCacheB [NUM_PIXELS_INPUT_CACHE]; // B : don't use fp16 for B to avoid bank conflicts
         #else
@@ -265,7 +265,7 @@ MinTiles     -> Ceil(HalfKernel / TileSize) * 2 + 1
 FfxUInt32 PackF2(FfxFloat32x2 c) { return (ffxF32ToF16(c.r) << 16) | ffxF32ToF16(c.g); }
 FfxFloat32x2 UnpackToF2(FfxUInt32 packedRG)
 {
-#ifdef FFX_HLSL
+#if defined(FFX_HLSL) || defined(FFX_CPU)
     return f16tof32(FfxUInt32x2(packedRG >> 16, packedRG & 0xFFFF));
 #else
     return unpackHalf2x16(packedRG).yx;
@@ -276,7 +276,7 @@ FfxUInt32 PackH2(FfxFloat16x2 c) { return (ffxF32ToF16(FfxFloat32(c.r)) << 16) |
 FfxFloat16x2 UnpackToH2(FfxUInt32 packedRG){ return FfxFloat16x2(UnpackToF2(packedRG)); }
 #endif
 
-#ifdef FFX_HLSL
+#if defined(FFX_HLSL) || defined(FFX_CPU)
 inline FfxUInt32 FlattenIndex(FfxInt32x2 Index, FfxInt32 ElementStride)
 #else
 FfxUInt32 FlattenIndex(FfxInt32x2 Index, FfxInt32 ElementStride)
@@ -579,7 +579,7 @@ FfxFloat32x3 HorizontalBlurFromCachedInput(FfxInt32x2 threadID)
         const FfxInt16x2 ImageSizeClampValueXY = ImageSize.xy - FfxInt16x2(1, 1);
         const FfxUInt32 iTileCount = DIV_AND_ROUND_UP(FfxUInt32(ImageSize.y), FFX_BLUR_TILE_SIZE_Y * FFX_BLUR_DISPATCH_Y);
         FfxFloat16x3 value = FfxFloat16x3(0, 0, 0);
-        #ifndef FFX_HLSL
+        #if !defined(FFX_HLSL) && !defined(FFX_CPU)
         // For some reason using 16 bit integer for this loop in glsl does not work. It seems to be due to the use of
         // a negative value as a starting value that is compared to a positive value, which seems to incorrectly cause
         // the condition to always be false.
@@ -933,5 +933,5 @@ void ffxBlur(
     }
 }
 
-#endif // !FFX_CPU
+#endif // #if !defined(FFX_CPU) || defined(FFX_GPU)
 #endif // FFX_BLUR_H
@@ -0,0 +1,122 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "ffx_cas_resources.h"
+
+#if defined(FFX_GPU)
+#include "ffx_core.h"
+
+struct cbCAS
+{
+    FfxUInt32x4 const0;
+    FfxUInt32x4 const1;
+   #define FFX_CAS_CONSTANT_BUFFER_1_SIZE 8  // Number of 32-bit values. This must be kept in sync with the cbCAS size.
+};
+
+static_assert(sizeof(cbCAS) == FFX_CAS_CONSTANT_BUFFER_1_SIZE * sizeof(FfxUInt32), "cbCAS must match the layout of the HLSL constant buffer.");
+
+#if defined(CAS_BIND_CB_CAS)
+    static const FfxCpuConstantBuffer<cbCAS> cb_cas(CAS_BIND_CB_CAS);
+#else
+    static const FfxCpuConstantBuffer<cbCAS> cb_cas;
+#endif
+
+FfxUInt32x4 Const0()
+{
+    return cb_cas->const0;
+}
+
+FfxUInt32x4 Const1()
+{
+    return cb_cas->const1;
+}
+
+static const FfxCpuSamplerState s_LinearClamp = { FFX_CPU_SAMPLER_FILTER_LINEAR };
+
+    // SRVs
+    #if defined(CAS_BIND_SRV_INPUT_COLOR)
+        static const FfxCpuTexture2D<FfxFloat32x4>        r_input_color(CAS_BIND_SRV_INPUT_COLOR);
+    #endif
+
+    // UAV declarations
+    #if defined(CAS_BIND_UAV_OUTPUT_COLOR)
+        static const FfxCpuRWTexture2D<FfxFloat32x4>      rw_output_color(CAS_BIND_UAV_OUTPUT_COLOR);
+    #endif
+
+FfxFloat32x3 casLoad(FFX_PARAMETER_IN FfxInt32x2 position)
+{
+#if defined(CAS_BIND_SRV_INPUT_COLOR)
+    return r_input_color.Load(FfxInt32x3(position, 0)).rgb;
+#else
+    return 0.f;
+#endif
+}
+
+// Transform input from the load into a linear color space between 0 and 1.
+void casInput(FFX_PARAMETER_INOUT FfxFloat32 red, FFX_PARAMETER_INOUT FfxFloat32 green, FFX_PARAMETER_INOUT FfxFloat32 blue)
+{
+#if FFX_CAS_COLOR_SPACE_CONVERSION == 1    // gamma 2.0
+    red   *= red;
+    green *= green;
+    blue  *= blue;
+#elif FFX_CAS_COLOR_SPACE_CONVERSION == 2  // gamma 2.2
+    red   = ffxLinearFromGamma(red, FfxFloat32(2.2f));
+    green = ffxLinearFromGamma(green, FfxFloat32(2.2f));
+    blue  = ffxLinearFromGamma(blue, FfxFloat32(2.2f));
+#elif FFX_CAS_COLOR_SPACE_CONVERSION == 3  // sRGB output (auto-degamma'd on sampler read)
+
+#elif FFX_CAS_COLOR_SPACE_CONVERSION == 4  // sRGB input/output
+    red   = ffxLinearFromSrgb(red);
+    green = ffxLinearFromSrgb(green);
+    blue  = ffxLinearFromSrgb(blue);
+#endif
+}
+
+void casOutput(FFX_PARAMETER_INOUT FfxFloat32 red, FFX_PARAMETER_INOUT FfxFloat32 green, FFX_PARAMETER_INOUT FfxFloat32 blue)
+{
+#if FFX_CAS_COLOR_SPACE_CONVERSION == 1    // gamma 2.0
+    red   = ffxSqrt(red);
+    green = ffxSqrt(green);
+    blue  = ffxSqrt(blue);
+#elif FFX_CAS_COLOR_SPACE_CONVERSION == 2  // gamma 2.2
+    red   = ffxGammaFromLinear(red, FfxFloat32(1/2.2f));
+    green = ffxGammaFromLinear(green, FfxFloat32(1/2.2f));
+    blue  = ffxGammaFromLinear(blue, FfxFloat32(1/2.2f));
+#elif FFX_CAS_COLOR_SPACE_CONVERSION == 3  // sRGB output (auto-degamma'd on sampler read)
+    red   = ffxSrgbFromLinear(red);
+    green = ffxSrgbFromLinear(green);
+    blue  = ffxSrgbFromLinear(blue);
+#elif FFX_CAS_COLOR_SPACE_CONVERSION == 4  // sRGB input/output
+    red   = ffxSrgbFromLinear(red);
+    green = ffxSrgbFromLinear(green);
+    blue  = ffxSrgbFromLinear(blue);
+#endif
+}
+
+void casStoreOutput(FfxInt32x2 iPxPos, FfxFloat32x4 fColor)
+{
+#if defined(CAS_BIND_UAV_OUTPUT_COLOR)
+    rw_output_color[iPxPos] = fColor;
+#endif
+}
+
+#endif // #if defined(FFX_GPU)
@@ -23,7 +23,12 @@
 #ifndef FFX_COMMON_TYPES_H
 #define FFX_COMMON_TYPES_H
 
-#if defined(FFX_CPU)
+#if defined(FFX_CPU) && defined(FFX_GPU)
+#define FFX_PARAMETER_IN
+#define FFX_PARAMETER_OUT       FfxCpuInOut::
+#define FFX_PARAMETER_INOUT     FfxCpuInOut::
+#define FFX_PARAMETER_UNIFORM
+#elif defined(FFX_CPU)
 #define FFX_PARAMETER_IN
 #define FFX_PARAMETER_OUT
 #define FFX_PARAMETER_INOUT
@@ -91,6 +96,24 @@ typedef int64_t FfxInt64;
 /// @ingroup CPUTypes
 typedef float FfxFloat32;
 
+#if defined(FFX_GPU)
+/// The vector template used when shader code is compiled for the CPU.
+///
+/// Defined in ffx_core_cpu.h.
+///
+/// @ingroup CPUTypes
+template<typename T, int N> struct FfxCpuVector;
+
+typedef FfxCpuVector<FfxFloat32, 2> FfxFloat32x2;
+typedef FfxCpuVector<FfxFloat32, 3> FfxFloat32x3;
+typedef FfxCpuVector<FfxFloat32, 4> FfxFloat32x4;
+typedef FfxCpuVector<FfxInt32, 2>   FfxInt32x2;
+typedef FfxCpuVector<FfxInt32, 3>   FfxInt32x3;
+typedef FfxCpuVector<FfxInt32, 4>   FfxInt32x4;
+typedef FfxCpuVector<FfxUInt32, 2>  FfxUInt32x2;
+typedef FfxCpuVector<FfxUInt32, 3>  FfxUInt32x3;
+typedef FfxCpuVector<FfxUInt32, 4>  FfxUInt32x4;
+#else
 /// A typedef for a 2-dimensional floating point value.
 ///
 /// @ingroup CPUTypes
@@ -155,6 +178,7 @@ typedef uint32_t FfxUInt32x3[3];
 ///
 /// @ingroup CPUTypes
 typedef uint32_t FfxUInt32x4[4];
+#endif // #if defined(FFX_GPU)
 #endif // #if defined(FFX_CPU)
 
 #if defined(FFX_HLSL)
@@ -410,6 +434,41 @@ typedef min16int4   FfxInt16x4;
 
 #if defined(FFX_GPU)
 // Common typedefs:
+#if defined(FFX_CPU)
+
+// The CPU shader path only runs full precision code.
+#define FFX_MIN16_F  FfxFloat32
+#define FFX_MIN16_F2 FfxFloat32x2
+#define FFX_MIN16_F3 FfxFloat32x3
+#define FFX_MIN16_F4 FfxFloat32x4
+
+#define FFX_MIN16_I  FfxInt32
+#define FFX_MIN16_I2 FfxInt32x2
+#define FFX_MIN16_I3 FfxInt32x3
+#define FFX_MIN16_I4 FfxInt32x4
+
+#define FFX_MIN16_U  FfxUInt32
+#define FFX_MIN16_U2 FfxUInt32x2
+#define FFX_MIN16_U3 FfxUInt32x3
+#define FFX_MIN16_U4 FfxUInt32x4
+
+#define FFX_16BIT_F  FfxFloat32
+#define FFX_16BIT_F2 FfxFloat32x2
+#define FFX_16BIT_F3 FfxFloat32x3
+#define FFX_16BIT_F4 FfxFloat32x4
+
+#define FFX_16BIT_I  FfxInt32
+#define FFX_16BIT_I2 FfxInt32x2
+#define FFX_16BIT_I3 FfxInt32x3
+#define FFX_16BIT_I4 FfxInt32x4
+
+#define FFX_16BIT_U  FfxUInt32
+#define FFX_16BIT_U2 FfxUInt32x2
+#define FFX_16BIT_U3 FfxUInt32x3
+#define FFX_16BIT_U4 FfxUInt32x4
+
+#endif // #if defined(FFX_CPU)
+
 #if defined(FFX_HLSL)
 FFX_MIN16_SCALAR( FFX_MIN16_F , float );
 FFX_MIN16_VECTOR( FFX_MIN16_F2, float, 2 );
@@ -20,6 +20,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#if !defined(FFX_GPU)
 /// A define for a true value in a boolean expression.
 ///
 /// @ingroup CPUTypes
@@ -29,6 +30,7 @@
 ///
 /// @ingroup CPUTypes
 #define FFX_FALSE (0)
+#endif // #if !defined(FFX_GPU)
  
 #if !defined(FFX_STATIC)
 /// A define to abstract declaration of static variables and functions.
@@ -42,6 +44,8 @@
 /// 
 /// @ingroup ffxHost
 
+#if !defined(FFX_GPU)
+
 #ifdef __clang__
 #pragma clang diagnostic ignored "-Wunused-variable"
 #endif
@@ -336,3 +340,2428 @@ FFX_STATIC FfxUInt32 ffxPackHalf2x16(FfxFloat32x2 x)
 {
     return ffxF32ToF16(x[0]) + (ffxF32ToF16(x[1]) << 16);
 }
+
+#endif // #if !defined(FFX_GPU)
+
+#if defined(FFX_GPU)
+
+/// @defgroup CPUShader CPU Shader Core
+/// Definitions of the GPU platform abstraction used when shader code is compiled as C++.
+///
+/// Defining both <c><i>FFX_CPU</i></c> and <c><i>FFX_GPU</i></c> compiles the portable
+/// FidelityFX algorithm headers as native code for the CPU backend. This section provides
+/// the HLSL vector types with swizzles, the HLSL intrinsics, the resource objects declared by
+/// the <c><i>*_callbacks_cpp.h</i></c> files and the <c><i>ffx*</i></c> platform functions
+/// otherwise found in ffx_core_hlsl.h.
+///
+/// The standard headers and <c><i>ffx_cpu.h</i></c> must be included before this file, see
+/// <c><i>ffx_cpu_kernel.h</i></c>. Passes are compiled with <c><i>FFX_HALF</i></c> set to 0,
+/// wave intrinsics are not available, and <c><i>out</i></c>/<c><i>inout</i></c> parameters
+/// are passed by reference instead of copy-in/copy-out.
+///
+/// @ingroup CPUCore
+
+#if FFX_HALF
+#error The CPU shader path only supports full precision, FFX_HALF must be 0.
+#endif // #if FFX_HALF
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4201) // nonstandard extension used: nameless struct/union
+#endif // #if defined(_MSC_VER)
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wgnu-anonymous-struct"
+#pragma clang diagnostic ignored "-Wnested-anon-types"
+#endif // #if defined(__clang__)
+
+/// A define for abstracting select functionality between shading languages.
+///
+/// @ingroup CPUShader
+#define FFX_SELECT(cond, arg1, arg2) ffxCpuSelect(cond, arg1, arg2)
+
+/// A define for abstracting shared memory between shading languages.
+///
+/// The invocations of a workgroup all run on one worker thread, so shared memory is per thread.
+///
+/// @ingroup CPUShader
+#define FFX_GROUPSHARED static thread_local
+
+/// A define for abstracting compute memory barriers between shading languages.
+///
+/// @ingroup CPUShader
+#define FFX_GROUP_MEMORY_BARRIER ffxCpuGroupMemoryBarrier()
+
+/// A define for abstracting compute atomic additions between shading languages.
+///
+/// @ingroup CPUShader
+#define FFX_ATOMIC_ADD(x, y) InterlockedAdd(x, y)
+
+/// A define for abstracting compute atomic additions between shading languages.
+///
+/// @ingroup CPUShader
+#define FFX_ATOMIC_ADD_RETURN(x, y, r) InterlockedAdd(x, y, r)
+
+/// A define for abstracting compute atomic OR between shading languages.
+///
+/// @ingroup CPUShader
+#define FFX_ATOMIC_OR(x, y) InterlockedOr(x, y)
+
+/// A define for abstracting compute atomic min between shading languages.
+///
+/// @ingroup CPUShader
+#define FFX_ATOMIC_MIN(x, y) InterlockedMin(x, y)
+
+/// A define for abstracting compute atomic max between shading languages.
+///
+/// @ingroup CPUShader
+#define FFX_ATOMIC_MAX(x, y) InterlockedMax(x, y)
+
+/// A define for abstracting loop unrolling between shading languages.
+///
+/// @ingroup CPUShader
+#define FFX_UNROLL
+
+/// A define for abstracting a 'greater than' comparison operator between two types.
+///
+/// @ingroup CPUShader
+#define FFX_GREATER_THAN(x, y) x > y
+
+/// A define for abstracting a 'greater than or equal' comparison operator between two types.
+///
+/// @ingroup CPUShader
+#define FFX_GREATER_THAN_EQUAL(x, y) x >= y
+
+/// A define for abstracting a 'less than' comparison operator between two types.
+///
+/// @ingroup CPUShader
+#define FFX_LESS_THAN(x, y) x < y
+
+/// A define for abstracting a 'less than or equal' comparison operator between two types.
+///
+/// @ingroup CPUShader
+#define FFX_LESS_THAN_EQUAL(x, y) x <= y
+
+/// A define for abstracting an 'equal' comparison operator between two types.
+///
+/// @ingroup CPUShader
+#define FFX_EQUAL(x, y) x == y
+
+/// A define for abstracting a 'not equal' comparison operator between two types.
+///
+/// @ingroup CPUShader
+#define FFX_NOT_EQUAL(x, y) x != y
+
+/// A define for abstracting matrix multiply operations between shading languages.
+///
+/// @ingroup CPUShader
+#define FFX_MATRIX_MULTIPLY(a, b) mul(a, b)
+
+/// A define for abstracting vector transformations between shading languages.
+///
+/// @ingroup CPUShader
+#define FFX_TRANSFORM_VECTOR(a, b) mul(a, b)
+
+/// A define for abstracting modulo operations between shading languages.
+///
+/// @ingroup CPUShader
+#define FFX_MODULO(a, b) (fmod(a, b))
+
+/// Broadcast a scalar value to a 1-dimensional floating point vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_FLOAT32(x) FfxFloat32(x)
+
+/// Broadcast a scalar value to a 2-dimensional floating point vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_FLOAT32X2(x) FfxFloat32(x)
+
+/// Broadcast a scalar value to a 3-dimensional floating point vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_FLOAT32X3(x) FfxFloat32(x)
+
+/// Broadcast a scalar value to a 4-dimensional floating point vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_FLOAT32X4(x) FfxFloat32(x)
+
+/// Broadcast a scalar value to a 1-dimensional unsigned integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_UINT32(x) FfxUInt32(x)
+
+/// Broadcast a scalar value to a 2-dimensional unsigned integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_UINT32X2(x) FfxUInt32(x)
+
+/// Broadcast a scalar value to a 3-dimensional unsigned integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_UINT32X3(x) FfxUInt32(x)
+
+/// Broadcast a scalar value to a 4-dimensional unsigned integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_UINT32X4(x) FfxUInt32(x)
+
+/// Broadcast a scalar value to a 1-dimensional signed integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_INT32(x) FfxInt32(x)
+
+/// Broadcast a scalar value to a 2-dimensional signed integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_INT32X2(x) FfxInt32(x)
+
+/// Broadcast a scalar value to a 3-dimensional signed integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_INT32X3(x) FfxInt32(x)
+
+/// Broadcast a scalar value to a 4-dimensional signed integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_INT32X4(x) FfxInt32(x)
+
+/// Broadcast a scalar value to a 1-dimensional half-precision floating point vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_MIN_FLOAT16(a)   FFX_MIN16_F(a)
+
+/// Broadcast a scalar value to a 2-dimensional half-precision floating point vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_MIN_FLOAT16X2(a) FFX_MIN16_F(a)
+
+/// Broadcast a scalar value to a 3-dimensional half-precision floating point vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_MIN_FLOAT16X3(a) FFX_MIN16_F(a)
+
+/// Broadcast a scalar value to a 4-dimensional half-precision floating point vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_MIN_FLOAT16X4(a) FFX_MIN16_F(a)
+
+/// Broadcast a scalar value to a 1-dimensional half-precision unsigned integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_MIN_UINT16(a)   FFX_MIN16_U(a)
+
+/// Broadcast a scalar value to a 2-dimensional half-precision unsigned integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_MIN_UINT16X2(a) FFX_MIN16_U(a)
+
+/// Broadcast a scalar value to a 3-dimensional half-precision unsigned integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_MIN_UINT16X3(a) FFX_MIN16_U(a)
+
+/// Broadcast a scalar value to a 4-dimensional half-precision unsigned integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_MIN_UINT16X4(a) FFX_MIN16_U(a)
+
+/// Broadcast a scalar value to a 1-dimensional half-precision signed integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_MIN_INT16(a)   FFX_MIN16_I(a)
+
+/// Broadcast a scalar value to a 2-dimensional half-precision signed integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_MIN_INT16X2(a) FFX_MIN16_I(a)
+
+/// Broadcast a scalar value to a 3-dimensional half-precision signed integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_MIN_INT16X3(a) FFX_MIN16_I(a)
+
+/// Broadcast a scalar value to a 4-dimensional half-precision signed integer vector.
+///
+/// @ingroup CPUShader
+#define FFX_BROADCAST_MIN_INT16X4(a) FFX_MIN16_I(a)
+
+//==============================================================================================================================
+//                                                     VECTOR TYPES
+//==============================================================================================================================
+
+template<typename T, int N, int... I>
+struct FfxCpuSwizzle;
+
+/// Traits describing a scalar, vector or swizzle operand of a shader expression.
+///
+/// <c><i>VectorSize</i></c> is 0 for scalars, so scalars broadcast against vectors of any size.
+///
+/// @ingroup CPUShader
+template<typename X, typename = void>
+struct FfxCpuOperand
+{
+    static const bool IsValid    = false;
+    static const int  Size       = 0;
+    static const int  VectorSize = 0;
+    typedef void ElementType;
+};
+
+template<typename X>
+struct FfxCpuOperand<X, typename std::enable_if<std::is_arithmetic<X>::value>::type>
+{
+    static const bool IsValid    = true;
+    static const int  Size       = 1;
+    static const int  VectorSize = 0;
+    typedef X ElementType;
+
+    static X get(const X& value, int) { return value; }
+};
+
+template<typename T, int N>
+struct FfxCpuOperand<FfxCpuVector<T, N>, void>
+{
+    static const bool IsValid    = true;
+    static const int  Size       = N;
+    static const int  VectorSize = N;
+    typedef T ElementType;
+
+    static T get(const FfxCpuVector<T, N>& value, int index) { return value.data[index]; }
+};
+
+template<typename T, int N, int... I>
+struct FfxCpuOperand<FfxCpuSwizzle<T, N, I...>, void>
+{
+    static const bool IsValid    = true;
+    static const int  Size       = int(sizeof...(I));
+    static const int  VectorSize = int(sizeof...(I));
+    typedef T ElementType;
+
+    static T get(const FfxCpuSwizzle<T, N, I...>& value, int index) { return value.get(index); }
+};
+
+constexpr int ffxCpuCombineSize(int a, int b)
+{
+    return a == 0 ? b : (b == 0 ? a : (a < b ? a : b));
+}
+
+/// Traits of the common type of several operands, following the HLSL promotion rules.
+///
+/// Any floating point operand promotes to <c><i>FfxFloat32</i></c>, otherwise any unsigned operand
+/// promotes to <c><i>FfxUInt32</i></c>. Vectors of different sizes truncate to the smallest one.
+///
+/// @ingroup CPUShader
+template<typename... X>
+struct FfxCpuCommon
+{
+    static const bool IsValid    = (FfxCpuOperand<X>::IsValid && ...);
+    static const bool IsFloat    = (std::is_floating_point<typename FfxCpuOperand<X>::ElementType>::value || ...);
+    static const bool IsUnsigned = ((std::is_unsigned<typename FfxCpuOperand<X>::ElementType>::value && !std::is_same<typename FfxCpuOperand<X>::ElementType, bool>::value) || ...);
+
+    static constexpr int vectorSize()
+    {
+        int size = 0;
+        ((size = ffxCpuCombineSize(size, FfxCpuOperand<X>::VectorSize)), ...);
+        return size;
+    }
+
+    static const int VectorSize = vectorSize();
+    typedef typename std::conditional<IsFloat, FfxFloat32, typename std::conditional<IsUnsigned, FfxUInt32, FfxInt32>::type>::type ElementType;
+};
+
+template<typename R, int N>
+struct FfxCpuResultType
+{
+    typedef FfxCpuVector<R, N> Type;
+};
+
+template<typename R>
+struct FfxCpuResultType<R, 0>
+{
+    typedef R Type;
+};
+
+/// The type of an expression on several operands, with the elements promoted to their common type.
+///
+/// @ingroup CPUShader
+template<typename... X>
+using FfxCpuPromoted = typename std::enable_if<FfxCpuCommon<X...>::IsValid,
+    typename FfxCpuResultType<typename FfxCpuCommon<X...>::ElementType, FfxCpuCommon<X...>::VectorSize>::Type>::type;
+
+/// The type of an expression on several operands, with elements of type <c><i>R</i></c>.
+///
+/// @ingroup CPUShader
+template<typename R, typename... X>
+using FfxCpuShaped = typename std::enable_if<FfxCpuCommon<X...>::IsValid,
+    typename FfxCpuResultType<R, FfxCpuCommon<X...>::VectorSize>::Type>::type;
+
+/// The type of an operator expression, which requires at least one vector operand.
+///
+/// @ingroup CPUShader
+template<typename R, typename A, typename B>
+using FfxCpuOperatorResult = typename std::enable_if<FfxCpuCommon<A, B>::IsValid && (FfxCpuCommon<A, B>::VectorSize > 0),
+    FfxCpuVector<R, FfxCpuCommon<A, B>::VectorSize>>::type;
+
+/// Apply a function to every component of its operands, promoted to <c><i>E</i></c>.
+///
+/// @ingroup CPUShader
+template<typename R, typename E, typename F, typename... X>
+typename FfxCpuResultType<R, FfxCpuCommon<X...>::VectorSize>::Type ffxCpuApply(F function, const X&... operands)
+{
+    const int size = FfxCpuCommon<X...>::VectorSize;
+    if constexpr (size == 0)
+    {
+        return R(function(E(operands)...));
+    }
+    else
+    {
+        FfxCpuVector<R, size> result;
+        for (int index = 0; index < size; ++index)
+            result.data[index] = R(function(E(FfxCpuOperand<X>::get(operands, index))...));
+        return result;
+    }
+}
+
+/// A swizzle of the components of a vector, aliasing the storage of that vector.
+///
+/// @ingroup CPUShader
+template<typename T, int N, int... I>
+struct FfxCpuSwizzle
+{
+    static const int Size = int(sizeof...(I));
+
+    T data[N];
+
+    T get(int index) const
+    {
+        static_assert(((I < N) && ...), "Swizzle component out of range.");
+        const int indices[] = { I... };
+        return data[indices[index]];
+    }
+
+    FfxCpuSwizzle& operator=(const FfxCpuSwizzle& other)
+    {
+        return *this = FfxCpuVector<T, Size>(other);
+    }
+
+    template<typename X>
+    FfxCpuSwizzle& operator=(const X& value)
+    {
+        static_assert(((I < N) && ...), "Swizzle component out of range.");
+        const FfxCpuVector<T, Size> vector(value);
+        int index = 0;
+        ((data[I] = vector.data[index++]), ...);
+        return *this;
+    }
+
+#define FFX_CPU_SWIZZLE_COMPOUND_OPERATOR(op)                               \
+    template<typename X>                                                    \
+    FfxCpuSwizzle& operator op##=(const X& value)                           \
+    {                                                                       \
+        return *this = FfxCpuVector<T, Size>(*this) op value;               \
+    }
+
+    FFX_CPU_SWIZZLE_COMPOUND_OPERATOR(+)
+    FFX_CPU_SWIZZLE_COMPOUND_OPERATOR(-)
+    FFX_CPU_SWIZZLE_COMPOUND_OPERATOR(*)
+    FFX_CPU_SWIZZLE_COMPOUND_OPERATOR(/)
+    FFX_CPU_SWIZZLE_COMPOUND_OPERATOR(%)
+    FFX_CPU_SWIZZLE_COMPOUND_OPERATOR(&)
+    FFX_CPU_SWIZZLE_COMPOUND_OPERATOR(|)
+    FFX_CPU_SWIZZLE_COMPOUND_OPERATOR(^)
+    FFX_CPU_SWIZZLE_COMPOUND_OPERATOR(<<)
+    FFX_CPU_SWIZZLE_COMPOUND_OPERATOR(>>)
+
+#undef FFX_CPU_SWIZZLE_COMPOUND_OPERATOR
+};
+
+/// The swizzles declared by the vectors, grouped by the highest component they use.
+///
+/// @ingroup CPUShader
+#define FFX_CPU_SWIZZLES_2(T, N) \
+    FfxCpuSwizzle<T, N, 0, 0> xx; \
+    FfxCpuSwizzle<T, N, 0, 1> xy; \
+    FfxCpuSwizzle<T, N, 1, 0> yx; \
+    FfxCpuSwizzle<T, N, 1, 1> yy; \
+    FfxCpuSwizzle<T, N, 0, 0> rr; \
+    FfxCpuSwizzle<T, N, 0, 1> rg; \
+    FfxCpuSwizzle<T, N, 1, 0> gr; \
+    FfxCpuSwizzle<T, N, 1, 1> gg; \
+    FfxCpuSwizzle<T, N, 0, 0, 0> xxx; \
+    FfxCpuSwizzle<T, N, 1, 1, 1> yyy; \
+    FfxCpuSwizzle<T, N, 0, 0, 0> rrr; \
+    FfxCpuSwizzle<T, N, 1, 1, 1> ggg; \
+    FfxCpuSwizzle<T, N, 0, 0, 0, 0> xxxx; \
+    FfxCpuSwizzle<T, N, 1, 1, 1, 1> yyyy; \
+    FfxCpuSwizzle<T, N, 0, 0, 0, 0> rrrr; \
+    FfxCpuSwizzle<T, N, 1, 1, 1, 1> gggg;
+
+#define FFX_CPU_SWIZZLES_3(T, N) \
+    FfxCpuSwizzle<T, N, 0, 2> xz; \
+    FfxCpuSwizzle<T, N, 1, 2> yz; \
+    FfxCpuSwizzle<T, N, 2, 0> zx; \
+    FfxCpuSwizzle<T, N, 2, 1> zy; \
+    FfxCpuSwizzle<T, N, 2, 2> zz; \
+    FfxCpuSwizzle<T, N, 0, 2> rb; \
+    FfxCpuSwizzle<T, N, 1, 2> gb; \
+    FfxCpuSwizzle<T, N, 2, 0> br; \
+    FfxCpuSwizzle<T, N, 2, 1> bg; \
+    FfxCpuSwizzle<T, N, 2, 2> bb; \
+    FfxCpuSwizzle<T, N, 0, 1, 2> xyz; \
+    FfxCpuSwizzle<T, N, 2, 1, 0> zyx; \
+    FfxCpuSwizzle<T, N, 2, 2, 2> zzz; \
+    FfxCpuSwizzle<T, N, 0, 1, 2> rgb; \
+    FfxCpuSwizzle<T, N, 2, 1, 0> bgr; \
+    FfxCpuSwizzle<T, N, 2, 2, 2> bbb; \
+    FfxCpuSwizzle<T, N, 2, 2, 2, 2> zzzz; \
+    FfxCpuSwizzle<T, N, 2, 2, 2, 2> bbbb;
+
+#define FFX_CPU_SWIZZLES_4(T, N) \
+    FfxCpuSwizzle<T, N, 0, 3> xw; \
+    FfxCpuSwizzle<T, N, 1, 3> yw; \
+    FfxCpuSwizzle<T, N, 2, 3> zw; \
+    FfxCpuSwizzle<T, N, 3, 0> wx; \
+    FfxCpuSwizzle<T, N, 3, 1> wy; \
+    FfxCpuSwizzle<T, N, 3, 2> wz; \
+    FfxCpuSwizzle<T, N, 3, 3> ww; \
+    FfxCpuSwizzle<T, N, 0, 3> ra; \
+    FfxCpuSwizzle<T, N, 1, 3> ga; \
+    FfxCpuSwizzle<T, N, 2, 3> ba; \
+    FfxCpuSwizzle<T, N, 3, 0> ar; \
+    FfxCpuSwizzle<T, N, 3, 1> ag; \
+    FfxCpuSwizzle<T, N, 3, 2> ab; \
+    FfxCpuSwizzle<T, N, 3, 3> aa; \
+    FfxCpuSwizzle<T, N, 3, 3, 3> www; \
+    FfxCpuSwizzle<T, N, 1, 2, 3> yzw; \
+    FfxCpuSwizzle<T, N, 0, 1, 3> xyw; \
+    FfxCpuSwizzle<T, N, 3, 3, 3> aaa; \
+    FfxCpuSwizzle<T, N, 1, 2, 3> gba; \
+    FfxCpuSwizzle<T, N, 0, 1, 2, 3> xyzw; \
+    FfxCpuSwizzle<T, N, 3, 2, 1, 0> wzyx; \
+    FfxCpuSwizzle<T, N, 3, 3, 3, 3> wwww; \
+    FfxCpuSwizzle<T, N, 0, 1, 2, 3> rgba; \
+    FfxCpuSwizzle<T, N, 2, 1, 0, 3> bgra; \
+    FfxCpuSwizzle<T, N, 3, 3, 3, 3> aaaa;
+
+/// The component storage of a vector, aliased by the component names and the swizzles.
+///
+/// @ingroup CPUShader
+template<typename T, int N>
+struct FfxCpuVectorStorage;
+
+template<typename T>
+struct FfxCpuVectorStorage<T, 2>
+{
+    union
+    {
+        T data[2];
+        struct { T x, y; };
+        struct { T r, g; };
+        FFX_CPU_SWIZZLES_2(T, 2)
+    };
+};
+
+template<typename T>
+struct FfxCpuVectorStorage<T, 3>
+{
+    union
+    {
+        T data[3];
+        struct { T x, y, z; };
+        struct { T r, g, b; };
+        FFX_CPU_SWIZZLES_2(T, 3)
+        FFX_CPU_SWIZZLES_3(T, 3)
+    };
+};
+
+template<typename T>
+struct FfxCpuVectorStorage<T, 4>
+{
+    union
+    {
+        T data[4];
+        struct { T x, y, z, w; };
+        struct { T r, g, b, a; };
+        FFX_CPU_SWIZZLES_2(T, 4)
+        FFX_CPU_SWIZZLES_3(T, 4)
+        FFX_CPU_SWIZZLES_4(T, 4)
+    };
+};
+
+/// An HLSL style vector of <c><i>N</i></c> components of type <c><i>T</i></c>.
+///
+/// Vectors convert implicitly from scalars (broadcast), from vectors of at least the same size
+/// (truncation) and from swizzles of the same size, and can be built from any list of scalars,
+/// vectors and swizzles adding up to <c><i>N</i></c> components.
+///
+/// @ingroup CPUShader
+template<typename T, int N>
+struct FfxCpuVector : FfxCpuVectorStorage<T, N>
+{
+    FfxCpuVector()
+    {
+        for (int index = 0; index < N; ++index)
+            this->data[index] = T(0);
+    }
+
+    FfxCpuVector(const FfxCpuVector& other)
+    {
+        for (int index = 0; index < N; ++index)
+            this->data[index] = other.data[index];
+    }
+
+    template<typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    FfxCpuVector(U value)
+    {
+        for (int index = 0; index < N; ++index)
+            this->data[index] = T(value);
+    }
+
+    template<typename U, int M, typename = typename std::enable_if<(M > N) || (M == N && !std::is_same<T, U>::value)>::type>
+    FfxCpuVector(const FfxCpuVector<U, M>& other)
+    {
+        for (int index = 0; index < N; ++index)
+            this->data[index] = T(other.data[index]);
+    }
+
+    template<typename U, int M, int... I, typename = typename std::enable_if<int(sizeof...(I)) == N>::type>
+    FfxCpuVector(const FfxCpuSwizzle<U, M, I...>& swizzle)
+    {
+        for (int index = 0; index < N; ++index)
+            this->data[index] = T(swizzle.get(index));
+    }
+
+    template<typename A, typename B, typename... C,
+             typename = typename std::enable_if<FfxCpuCommon<A, B, C...>::IsValid && (FfxCpuOperand<A>::Size + FfxCpuOperand<B>::Size + (0 + ... + FfxCpuOperand<C>::Size)) == N>::type>
+    FfxCpuVector(const A& a, const B& b, const C&... c)
+    {
+        int index = 0;
+        append(index, a);
+        append(index, b);
+        (append(index, c), ...);
+    }
+
+    FfxCpuVector& operator=(const FfxCpuVector& other)
+    {
+        for (int index = 0; index < N; ++index)
+            this->data[index] = other.data[index];
+        return *this;
+    }
+
+    T& operator[](FfxUInt32 index)
+    {
+        return this->data[index];
+    }
+
+    const T& operator[](FfxUInt32 index) const
+    {
+        return this->data[index];
+    }
+
+#define FFX_CPU_VECTOR_COMPOUND_OPERATOR(op)                                \
+    template<typename X>                                                    \
+    FfxCpuVector& operator op##=(const X& value)                            \
+    {                                                                       \
+        return *this = FfxCpuVector(*this op value);                        \
+    }
+
+    FFX_CPU_VECTOR_COMPOUND_OPERATOR(+)
+    FFX_CPU_VECTOR_COMPOUND_OPERATOR(-)
+    FFX_CPU_VECTOR_COMPOUND_OPERATOR(*)
+    FFX_CPU_VECTOR_COMPOUND_OPERATOR(/)
+    FFX_CPU_VECTOR_COMPOUND_OPERATOR(%)
+    FFX_CPU_VECTOR_COMPOUND_OPERATOR(&)
+    FFX_CPU_VECTOR_COMPOUND_OPERATOR(|)
+    FFX_CPU_VECTOR_COMPOUND_OPERATOR(^)
+    FFX_CPU_VECTOR_COMPOUND_OPERATOR(<<)
+    FFX_CPU_VECTOR_COMPOUND_OPERATOR(>>)
+
+#undef FFX_CPU_VECTOR_COMPOUND_OPERATOR
+
+private:
+    template<typename X>
+    void append(int& index, const X& value)
+    {
+        for (int component = 0; component < FfxCpuOperand<X>::Size; ++component)
+            this->data[index++] = T(FfxCpuOperand<X>::get(value, component));
+    }
+};
+
+static_assert(sizeof(FfxCpuVector<FfxFloat32, 3>) == 3 * sizeof(FfxFloat32), "Vectors must be tightly packed to map constant buffers.");
+static_assert(sizeof(FfxCpuVector<FfxUInt32, 4>) == 4 * sizeof(FfxUInt32), "Vectors must be tightly packed to map constant buffers.");
+
+/// A vector <c><i>out</i></c> or <c><i>inout</i></c> parameter.
+///
+/// HLSL copies these parameters in and out, so a swizzle such as <c><i>color.rgb</i></c> can be
+/// passed as well as a whole vector. The value is written back when the parameter is destroyed.
+///
+/// @ingroup CPUShader
+template<typename T, int N>
+struct FfxCpuVectorReference : FfxCpuVector<T, N>
+{
+    void* target;
+    void (*store)(void* target, const FfxCpuVector<T, N>& value);
+
+    FfxCpuVectorReference(FfxCpuVector<T, N>& vector)
+        : FfxCpuVector<T, N>(vector)
+        , target(&vector)
+        , store([](void* target, const FfxCpuVector<T, N>& value) { *static_cast<FfxCpuVector<T, N>*>(target) = value; })
+    {
+    }
+
+    template<int M, int... I, typename = typename std::enable_if<int(sizeof...(I)) == N>::type>
+    FfxCpuVectorReference(FfxCpuSwizzle<T, M, I...>& swizzle)
+        : FfxCpuVector<T, N>(swizzle)
+        , target(&swizzle)
+        , store([](void* target, const FfxCpuVector<T, N>& value) { *static_cast<FfxCpuSwizzle<T, M, I...>*>(target) = value; })
+    {
+    }
+
+    FfxCpuVectorReference(FfxCpuVectorReference& other)
+        : FfxCpuVectorReference(static_cast<FfxCpuVector<T, N>&>(other))
+    {
+    }
+
+    FfxCpuVectorReference(const FfxCpuVectorReference&) = delete;
+
+    ~FfxCpuVectorReference()
+    {
+        store(target, *this);
+    }
+
+    using FfxCpuVector<T, N>::operator=;
+};
+
+template<typename T, int N>
+struct FfxCpuOperand<FfxCpuVectorReference<T, N>, void> : FfxCpuOperand<FfxCpuVector<T, N>, void>
+{
+};
+
+FFX_STATIC FfxFloat32 ffxCpuModulo(FfxFloat32 a, FfxFloat32 b)
+{
+    return std::fmod(a, b);
+}
+
+FFX_STATIC FfxUInt32 ffxCpuModulo(FfxUInt32 a, FfxUInt32 b)
+{
+    return a % b;
+}
+
+FFX_STATIC FfxInt32 ffxCpuModulo(FfxInt32 a, FfxInt32 b)
+{
+    return a % b;
+}
+
+#define FFX_CPU_ARITHMETIC_OPERATOR(op)                                                                                     \
+    template<typename A, typename B>                                                                                        \
+    FfxCpuOperatorResult<typename FfxCpuCommon<A, B>::ElementType, A, B> operator op(const A& a, const B& b)               \
+    {                                                                                                                       \
+        typedef typename FfxCpuCommon<A, B>::ElementType E;                                                                 \
+        return ffxCpuApply<E, E>([](E x, E y) { return E(x op y); }, a, b);                                                 \
+    }
+
+#define FFX_CPU_COMPARISON_OPERATOR(op)                                                                                     \
+    template<typename A, typename B>                                                                                        \
+    FfxCpuOperatorResult<FfxBoolean, A, B> operator op(const A& a, const B& b)                                              \
+    {                                                                                                                       \
+        typedef typename FfxCpuCommon<A, B>::ElementType E;                                                                 \
+        return ffxCpuApply<FfxBoolean, E>([](E x, E y) { return x op y; }, a, b);                                           \
+    }
+
+#define FFX_CPU_LOGICAL_OPERATOR(op)                                                                                        \
+    template<typename A, typename B>                                                                                        \
+    FfxCpuOperatorResult<FfxBoolean, A, B> operator op(const A& a, const B& b)                                              \
+    {                                                                                                                       \
+        return ffxCpuApply<FfxBoolean, FfxBoolean>([](FfxBoolean x, FfxBoolean y) { return x op y; }, a, b);                \
+    }
+
+FFX_CPU_ARITHMETIC_OPERATOR(+)
+FFX_CPU_ARITHMETIC_OPERATOR(-)
+FFX_CPU_ARITHMETIC_OPERATOR(*)
+FFX_CPU_ARITHMETIC_OPERATOR(/)
+FFX_CPU_ARITHMETIC_OPERATOR(&)
+FFX_CPU_ARITHMETIC_OPERATOR(|)
+FFX_CPU_ARITHMETIC_OPERATOR(^)
+FFX_CPU_COMPARISON_OPERATOR(==)
+FFX_CPU_COMPARISON_OPERATOR(!=)
+FFX_CPU_COMPARISON_OPERATOR(<)
+FFX_CPU_COMPARISON_OPERATOR(<=)
+FFX_CPU_COMPARISON_OPERATOR(>)
+FFX_CPU_COMPARISON_OPERATOR(>=)
+FFX_CPU_LOGICAL_OPERATOR(&&)
+FFX_CPU_LOGICAL_OPERATOR(||)
+
+#undef FFX_CPU_ARITHMETIC_OPERATOR
+#undef FFX_CPU_COMPARISON_OPERATOR
+#undef FFX_CPU_LOGICAL_OPERATOR
+
+template<typename A, typename B>
+FfxCpuOperatorResult<typename FfxCpuCommon<A, B>::ElementType, A, B> operator%(const A& a, const B& b)
+{
+    typedef typename FfxCpuCommon<A, B>::ElementType E;
+    return ffxCpuApply<E, E>([](E x, E y) { return ffxCpuModulo(x, y); }, a, b);
+}
+
+// shifts keep the type of the left operand and only use the low 5 bits of the shift amount
+template<typename A, typename B>
+FfxCpuOperatorResult<typename FfxCpuCommon<A>::ElementType, A, B> operator<<(const A& a, const B& b)
+{
+    typedef typename FfxCpuCommon<A>::ElementType E;
+    return ffxCpuApply<E, FfxUInt32>([](FfxUInt32 x, FfxUInt32 y) { return E(x << (y & 31)); }, a, b);
+}
+
+template<typename A, typename B>
+FfxCpuOperatorResult<typename FfxCpuCommon<A>::ElementType, A, B> operator>>(const A& a, const B& b)
+{
+    typedef typename FfxCpuCommon<A>::ElementType E;
+    return ffxCpuApply<E, E>([](E x, E y) { return E(x >> (FfxUInt32(y) & 31)); }, a, b);
+}
+
+template<typename A>
+FfxCpuOperatorResult<typename FfxCpuCommon<A>::ElementType, A, A> operator-(const A& a)
+{
+    typedef typename FfxCpuCommon<A>::ElementType E;
+    return ffxCpuApply<E, E>([](E x) { return E(-x); }, a);
+}
+
+template<typename A>
+FfxCpuOperatorResult<typename FfxCpuCommon<A>::ElementType, A, A> operator+(const A& a)
+{
+    typedef typename FfxCpuCommon<A>::ElementType E;
+    return ffxCpuApply<E, E>([](E x) { return x; }, a);
+}
+
+template<typename A>
+FfxCpuOperatorResult<typename FfxCpuCommon<A>::ElementType, A, A> operator~(const A& a)
+{
+    typedef typename FfxCpuCommon<A>::ElementType E;
+    return ffxCpuApply<E, E>([](E x) { return E(~x); }, a);
+}
+
+template<typename A>
+FfxCpuOperatorResult<FfxBoolean, A, A> operator!(const A& a)
+{
+    return ffxCpuApply<FfxBoolean, FfxBoolean>([](FfxBoolean x) { return !x; }, a);
+}
+
+/// Select between two values per component, as the HLSL ternary operator does on vectors.
+///
+/// @ingroup CPUShader
+template<typename C, typename A, typename B>
+FfxCpuShaped<typename FfxCpuCommon<A, B>::ElementType, C, A, B> ffxCpuSelect(const C& condition, const A& a, const B& b)
+{
+    typedef typename FfxCpuCommon<A, B>::ElementType E;
+    if constexpr (FfxCpuOperand<C>::VectorSize == 0)
+    {
+        return condition ? FfxCpuPromoted<A, B>(a) : FfxCpuPromoted<A, B>(b);
+    }
+    else
+    {
+        const int size = ffxCpuCombineSize(FfxCpuOperand<C>::VectorSize, FfxCpuCommon<A, B>::VectorSize);
+        FfxCpuVector<E, size> result;
+        for (int index = 0; index < size; ++index)
+            result.data[index] = FfxCpuOperand<C>::get(condition, index) ? E(FfxCpuOperand<A>::get(a, index)) : E(FfxCpuOperand<B>::get(b, index));
+        return result;
+    }
+}
+
+
+//==============================================================================================================================
+//                                                     INTRINSICS
+//==============================================================================================================================
+
+/// Reinterpret the bits of a 32-bit value as another 32-bit type.
+///
+/// @ingroup CPUShader
+template<typename To, typename From>
+To ffxCpuBitCast(From value)
+{
+    static_assert(sizeof(To) == sizeof(From), "Bit casts require types of the same size.");
+    To result;
+    memcpy(&result, &value, sizeof(To));
+    return result;
+}
+
+FFX_STATIC FfxFloat32 ffxCpuMinimum(FfxFloat32 a, FfxFloat32 b)
+{
+    // like the GPU, a NaN operand returns the other operand
+    return (b < a || a != a) ? b : a;
+}
+
+FFX_STATIC FfxFloat32 ffxCpuMaximum(FfxFloat32 a, FfxFloat32 b)
+{
+    return (b > a || a != a) ? b : a;
+}
+
+template<typename E>
+E ffxCpuMinimum(E a, E b)
+{
+    return b < a ? b : a;
+}
+
+template<typename E>
+E ffxCpuMaximum(E a, E b)
+{
+    return b > a ? b : a;
+}
+
+/// Convert a 32-bit float to the bits of a 16-bit float, rounding to nearest even.
+///
+/// @ingroup CPUShader
+FFX_STATIC FfxUInt32 ffxCpuFloat32ToFloat16(FfxFloat32 value)
+{
+    const FfxUInt32 bits     = ffxCpuBitCast<FfxUInt32>(value);
+    const FfxUInt32 sign     = (bits >> 16) & 0x8000u;
+    const FfxUInt32 absolute = bits & 0x7FFFFFFFu;
+
+    // NaN and infinity
+    if (absolute >= 0x7F800000u)
+        return sign | 0x7C00u | (absolute > 0x7F800000u ? 0x0200u : 0u);
+
+    // overflow to infinity
+    if (absolute >= 0x477FF000u)
+        return sign | 0x7C00u;
+
+    // denormals and zero
+    if (absolute < 0x38800000u)
+    {
+        if (absolute < 0x33000000u)
+            return sign;
+
+        const FfxUInt32 exponent = absolute >> 23;
+        const FfxUInt32 mantissa = (absolute & 0x007FFFFFu) | 0x00800000u;
+        const FfxUInt32 shift    = 126u - exponent;
+        const FfxUInt32 rounding = (1u << (shift - 1)) - 1u + ((mantissa >> shift) & 1u);
+        return sign | ((mantissa + rounding) >> shift);
+    }
+
+    const FfxUInt32 rounding = 0x0FFFu + ((absolute >> 13) & 1u);
+    return sign | ((absolute - 0x38000000u + rounding) >> 13);
+}
+
+/// Convert the bits of a 16-bit float in the low 16 bits of a value to a 32-bit float.
+///
+/// @ingroup CPUShader
+FFX_STATIC FfxFloat32 ffxCpuFloat16ToFloat32(FfxUInt32 value)
+{
+    const FfxUInt32 sign     = (value & 0x8000u) << 16;
+    FfxUInt32       exponent = (value >> 10) & 0x1Fu;
+    FfxUInt32       mantissa = value & 0x03FFu;
+
+    if (exponent == 0x1Fu)
+        return ffxCpuBitCast<FfxFloat32>(sign | 0x7F800000u | (mantissa << 13));
+
+    if (exponent == 0)
+    {
+        if (mantissa == 0)
+            return ffxCpuBitCast<FfxFloat32>(sign);
+
+        // normalize the denormal
+        exponent = 1;
+        while ((mantissa & 0x0400u) == 0)
+        {
+            mantissa <<= 1;
+            --exponent;
+        }
+        mantissa &= 0x03FFu;
+    }
+
+    return ffxCpuBitCast<FfxFloat32>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+}
+
+FFX_STATIC FfxUInt32 ffxCpuFirstBitHigh(FfxUInt32 value)
+{
+    if (value == 0)
+        return ~0u;
+
+    FfxUInt32 index = 31;
+    while ((value & (1u << index)) == 0)
+        --index;
+    return index;
+}
+
+FFX_STATIC FfxUInt32 ffxCpuFirstBitHigh(FfxInt32 value)
+{
+    // negative values return the highest clear bit
+    return ffxCpuFirstBitHigh(FfxUInt32(value < 0 ? ~value : value));
+}
+
+FFX_STATIC FfxUInt32 ffxCpuFirstBitLow(FfxUInt32 value)
+{
+    if (value == 0)
+        return ~0u;
+
+    FfxUInt32 index = 0;
+    while ((value & (1u << index)) == 0)
+        ++index;
+    return index;
+}
+
+FFX_STATIC FfxUInt32 ffxCpuCountBits(FfxUInt32 value)
+{
+    FfxUInt32 count = 0;
+    for (; value; value &= value - 1)
+        ++count;
+    return count;
+}
+
+FFX_STATIC FfxUInt32 ffxCpuReverseBits(FfxUInt32 value)
+{
+    FfxUInt32 result = 0;
+    for (FfxUInt32 bit = 0; bit < 32; ++bit)
+        result |= ((value >> bit) & 1u) << (31 - bit);
+    return result;
+}
+
+FFX_STATIC FfxFloat32 ffxCpuSmoothStep(FfxFloat32 low, FfxFloat32 high, FfxFloat32 value)
+{
+    const FfxFloat32 t = ffxCpuMinimum(ffxCpuMaximum((value - low) / (high - low), 0.0f), 1.0f);
+    return t * t * (3.0f - 2.0f * t);
+}
+
+template<typename X>
+FfxCpuPromoted<X> abs(const X& x)
+{
+    typedef typename FfxCpuCommon<X>::ElementType E;
+    return ffxCpuApply<E, E>([](E v) { return v < E(0) ? E(-v) : v; }, x);
+}
+
+template<typename A, typename B>
+FfxCpuPromoted<A, B> min(const A& a, const B& b)
+{
+    typedef typename FfxCpuCommon<A, B>::ElementType E;
+    return ffxCpuApply<E, E>([](E x, E y) { return ffxCpuMinimum(x, y); }, a, b);
+}
+
+template<typename A, typename B>
+FfxCpuPromoted<A, B> max(const A& a, const B& b)
+{
+    typedef typename FfxCpuCommon<A, B>::ElementType E;
+    return ffxCpuApply<E, E>([](E x, E y) { return ffxCpuMaximum(x, y); }, a, b);
+}
+
+template<typename X, typename A, typename B>
+FfxCpuPromoted<X, A, B> clamp(const X& x, const A& a, const B& b)
+{
+    typedef typename FfxCpuCommon<X, A, B>::ElementType E;
+    return ffxCpuApply<E, E>([](E v, E low, E high) { return ffxCpuMinimum(ffxCpuMaximum(v, low), high); }, x, a, b);
+}
+
+template<typename X>
+FfxCpuShaped<FfxInt32, X> sign(const X& x)
+{
+    typedef typename FfxCpuCommon<X>::ElementType E;
+    return ffxCpuApply<FfxInt32, E>([](E v) { return FfxInt32(v > E(0)) - FfxInt32(v < E(0)); }, x);
+}
+
+#define FFX_CPU_FLOAT_INTRINSIC_1(name, expression)                                                 \
+    template<typename X>                                                                            \
+    FfxCpuShaped<FfxFloat32, X> name(const X& x)                                                    \
+    {                                                                                               \
+        return ffxCpuApply<FfxFloat32, FfxFloat32>([](FfxFloat32 v) { return expression; }, x);     \
+    }
+
+#define FFX_CPU_FLOAT_INTRINSIC_2(name, expression)                                                                 \
+    template<typename A, typename B>                                                                                \
+    FfxCpuShaped<FfxFloat32, A, B> name(const A& a, const B& b)                                                     \
+    {                                                                                                               \
+        return ffxCpuApply<FfxFloat32, FfxFloat32>([](FfxFloat32 x, FfxFloat32 y) { return expression; }, a, b);    \
+    }
+
+#define FFX_CPU_FLOAT_INTRINSIC_3(name, expression)                                                                                 \
+    template<typename A, typename B, typename C>                                                                                    \
+    FfxCpuShaped<FfxFloat32, A, B, C> name(const A& a, const B& b, const C& c)                                                      \
+    {                                                                                                                               \
+        return ffxCpuApply<FfxFloat32, FfxFloat32>([](FfxFloat32 x, FfxFloat32 y, FfxFloat32 z) { return expression; }, a, b, c);   \
+    }
+
+FFX_CPU_FLOAT_INTRINSIC_1(floor, std::floor(v))
+FFX_CPU_FLOAT_INTRINSIC_1(ceil, std::ceil(v))
+FFX_CPU_FLOAT_INTRINSIC_1(trunc, std::trunc(v))
+FFX_CPU_FLOAT_INTRINSIC_1(round, std::nearbyint(v))
+FFX_CPU_FLOAT_INTRINSIC_1(frac, v - std::floor(v))
+FFX_CPU_FLOAT_INTRINSIC_1(sqrt, std::sqrt(v))
+FFX_CPU_FLOAT_INTRINSIC_1(rsqrt, 1.0f / std::sqrt(v))
+FFX_CPU_FLOAT_INTRINSIC_1(rcp, 1.0f / v)
+FFX_CPU_FLOAT_INTRINSIC_1(exp, std::exp(v))
+FFX_CPU_FLOAT_INTRINSIC_1(exp2, std::exp2(v))
+FFX_CPU_FLOAT_INTRINSIC_1(log, std::log(v))
+FFX_CPU_FLOAT_INTRINSIC_1(log2, std::log2(v))
+FFX_CPU_FLOAT_INTRINSIC_1(log10, std::log10(v))
+FFX_CPU_FLOAT_INTRINSIC_1(sin, std::sin(v))
+FFX_CPU_FLOAT_INTRINSIC_1(cos, std::cos(v))
+FFX_CPU_FLOAT_INTRINSIC_1(tan, std::tan(v))
+FFX_CPU_FLOAT_INTRINSIC_1(asin, std::asin(v))
+FFX_CPU_FLOAT_INTRINSIC_1(acos, std::acos(v))
+FFX_CPU_FLOAT_INTRINSIC_1(atan, std::atan(v))
+FFX_CPU_FLOAT_INTRINSIC_1(saturate, ffxCpuMinimum(ffxCpuMaximum(v, 0.0f), 1.0f))
+FFX_CPU_FLOAT_INTRINSIC_2(pow, std::pow(x, y))
+FFX_CPU_FLOAT_INTRINSIC_2(atan2, std::atan2(x, y))
+FFX_CPU_FLOAT_INTRINSIC_2(fmod, std::fmod(x, y))
+FFX_CPU_FLOAT_INTRINSIC_2(step, y >= x ? 1.0f : 0.0f)
+FFX_CPU_FLOAT_INTRINSIC_3(lerp, x + z * (y - x))
+FFX_CPU_FLOAT_INTRINSIC_3(smoothstep, ffxCpuSmoothStep(x, y, z))
+
+#undef FFX_CPU_FLOAT_INTRINSIC_1
+#undef FFX_CPU_FLOAT_INTRINSIC_2
+#undef FFX_CPU_FLOAT_INTRINSIC_3
+
+template<typename A, typename B, typename C>
+FfxCpuPromoted<A, B, C> mad(const A& a, const B& b, const C& c)
+{
+    typedef typename FfxCpuCommon<A, B, C>::ElementType E;
+    return ffxCpuApply<E, E>([](E x, E y, E z) { return E(x * y + z); }, a, b, c);
+}
+
+template<typename X>
+FfxCpuShaped<FfxBoolean, X> isnan(const X& x)
+{
+    return ffxCpuApply<FfxBoolean, FfxFloat32>([](FfxFloat32 v) { return v != v; }, x);
+}
+
+template<typename X>
+FfxCpuShaped<FfxBoolean, X> isinf(const X& x)
+{
+    return ffxCpuApply<FfxBoolean, FfxFloat32>([](FfxFloat32 v) { return std::isinf(v); }, x);
+}
+
+template<typename X>
+FfxCpuShaped<FfxBoolean, X> isfinite(const X& x)
+{
+    return ffxCpuApply<FfxBoolean, FfxFloat32>([](FfxFloat32 v) { return std::isfinite(v); }, x);
+}
+
+template<typename X>
+typename std::enable_if<FfxCpuOperand<X>::IsValid, FfxBoolean>::type all(const X& x)
+{
+    for (int index = 0; index < FfxCpuOperand<X>::Size; ++index)
+        if (!FfxCpuOperand<X>::get(x, index))
+            return false;
+    return true;
+}
+
+template<typename X>
+typename std::enable_if<FfxCpuOperand<X>::IsValid, FfxBoolean>::type any(const X& x)
+{
+    for (int index = 0; index < FfxCpuOperand<X>::Size; ++index)
+        if (FfxCpuOperand<X>::get(x, index))
+            return true;
+    return false;
+}
+
+template<typename A, typename B>
+typename std::enable_if<FfxCpuCommon<A, B>::IsValid, typename FfxCpuCommon<A, B>::ElementType>::type dot(const A& a, const B& b)
+{
+    typedef typename FfxCpuCommon<A, B>::ElementType E;
+    const int size = FfxCpuCommon<A, B>::VectorSize == 0 ? 1 : FfxCpuCommon<A, B>::VectorSize;
+
+    E result = E(0);
+    for (int index = 0; index < size; ++index)
+        result += E(FfxCpuOperand<A>::get(a, index)) * E(FfxCpuOperand<B>::get(b, index));
+    return result;
+}
+
+template<typename X>
+typename std::enable_if<FfxCpuOperand<X>::IsValid, FfxFloat32>::type length(const X& x)
+{
+    return std::sqrt(FfxFloat32(dot(x, x)));
+}
+
+template<typename A, typename B>
+typename std::enable_if<FfxCpuCommon<A, B>::IsValid, FfxFloat32>::type distance(const A& a, const B& b)
+{
+    return length(b - a);
+}
+
+template<typename X>
+FfxCpuShaped<FfxFloat32, X> normalize(const X& x)
+{
+    return FfxCpuShaped<FfxFloat32, X>(x) * (1.0f / length(x));
+}
+
+template<typename A, typename B>
+FfxCpuVector<FfxFloat32, 3> cross(const A& a, const B& b)
+{
+    const FfxCpuVector<FfxFloat32, 3> u(a);
+    const FfxCpuVector<FfxFloat32, 3> v(b);
+    return FfxCpuVector<FfxFloat32, 3>(u.y * v.z - u.z * v.y, u.z * v.x - u.x * v.z, u.x * v.y - u.y * v.x);
+}
+
+template<typename X>
+FfxCpuShaped<FfxUInt32, X> asuint(const X& x)
+{
+    typedef typename FfxCpuOperand<X>::ElementType E;
+    return ffxCpuApply<FfxUInt32, E>([](E v) { return ffxCpuBitCast<FfxUInt32>(v); }, x);
+}
+
+template<typename X>
+FfxCpuShaped<FfxInt32, X> asint(const X& x)
+{
+    typedef typename FfxCpuOperand<X>::ElementType E;
+    return ffxCpuApply<FfxInt32, E>([](E v) { return ffxCpuBitCast<FfxInt32>(v); }, x);
+}
+
+template<typename X>
+FfxCpuShaped<FfxFloat32, X> asfloat(const X& x)
+{
+    typedef typename FfxCpuOperand<X>::ElementType E;
+    return ffxCpuApply<FfxFloat32, E>([](E v) { return ffxCpuBitCast<FfxFloat32>(v); }, x);
+}
+
+template<typename X>
+FfxCpuShaped<FfxUInt32, X> f32tof16(const X& x)
+{
+    return ffxCpuApply<FfxUInt32, FfxFloat32>([](FfxFloat32 v) { return ffxCpuFloat32ToFloat16(v); }, x);
+}
+
+template<typename X>
+FfxCpuShaped<FfxFloat32, X> f16tof32(const X& x)
+{
+    return ffxCpuApply<FfxFloat32, FfxUInt32>([](FfxUInt32 v) { return ffxCpuFloat16ToFloat32(v); }, x);
+}
+
+template<typename X>
+FfxCpuShaped<FfxUInt32, X> firstbithigh(const X& x)
+{
+    typedef typename FfxCpuCommon<X>::ElementType E;
+    return ffxCpuApply<FfxUInt32, E>([](E v) { return ffxCpuFirstBitHigh(v); }, x);
+}
+
+template<typename X>
+FfxCpuShaped<FfxUInt32, X> firstbitlow(const X& x)
+{
+    return ffxCpuApply<FfxUInt32, FfxUInt32>([](FfxUInt32 v) { return ffxCpuFirstBitLow(v); }, x);
+}
+
+template<typename X>
+FfxCpuShaped<FfxUInt32, X> countbits(const X& x)
+{
+    return ffxCpuApply<FfxUInt32, FfxUInt32>([](FfxUInt32 v) { return ffxCpuCountBits(v); }, x);
+}
+
+template<typename X>
+FfxCpuShaped<FfxUInt32, X> reversebits(const X& x)
+{
+    return ffxCpuApply<FfxUInt32, FfxUInt32>([](FfxUInt32 v) { return ffxCpuReverseBits(v); }, x);
+}
+
+/// Masked sum of absolute differences of a reference byte quad against the four byte
+/// alignments of a source pair, as the HLSL <c><i>msad4</i></c> intrinsic.
+///
+/// @ingroup CPUShader
+FFX_STATIC FfxUInt32x4 msad4(FfxUInt32 reference, FfxUInt32x2 source, FfxUInt32x4 accumulator)
+{
+    FfxUInt32x4 result = accumulator;
+    for (FfxUInt32 alignment = 0; alignment < 4; ++alignment)
+    {
+        const FfxUInt32 shifted = alignment == 0 ? source.x : ((source.x >> (8 * alignment)) | (source.y << (32 - 8 * alignment)));
+        for (FfxUInt32 byte = 0; byte < 4; ++byte)
+        {
+            const FfxInt32 referenceByte = FfxInt32((reference >> (8 * byte)) & 0xFFu);
+            const FfxInt32 sourceByte    = FfxInt32((shifted >> (8 * byte)) & 0xFFu);
+            if (referenceByte != 0)
+                result[alignment] += FfxUInt32(referenceByte > sourceByte ? referenceByte - sourceByte : sourceByte - referenceByte);
+        }
+    }
+    return result;
+}
+
+
+//==============================================================================================================================
+//                                                     RESOURCES
+//==============================================================================================================================
+
+/// The dispatch executed by the calling worker thread.
+///
+/// Set by the kernel entry point before any invocation of a workgroup runs.
+///
+/// @ingroup CPUShader
+FFX_STATIC const FfxCpuDispatchDescription*& ffxCpuDispatch()
+{
+    static thread_local const FfxCpuDispatchDescription* dispatch = nullptr;
+    return dispatch;
+}
+
+/// Synchronize the invocations of a workgroup.
+///
+/// @ingroup CPUShader
+FFX_STATIC void ffxCpuGroupMemoryBarrier()
+{
+    ffxWorkGroupBarrierCPU();
+}
+
+FFX_STATIC void GroupMemoryBarrier()
+{
+    ffxCpuGroupMemoryBarrier();
+}
+
+FFX_STATIC void GroupMemoryBarrierWithGroupSync()
+{
+    ffxCpuGroupMemoryBarrier();
+}
+
+/// Convert the 32-bit channels returned by <c><i>ffxLoadTexelCPU</i></c> to a shader value.
+///
+/// @ingroup CPUShader
+template<typename T>
+T ffxCpuTexelFromChannels(const FfxUInt32 channels[4])
+{
+    typedef typename FfxCpuOperand<T>::ElementType E;
+    T value;
+    for (int index = 0; index < FfxCpuOperand<T>::Size; ++index)
+    {
+        E element;
+        if constexpr (std::is_floating_point<E>::value)
+            element = ffxCpuBitCast<FfxFloat32>(channels[index]);
+        else
+            element = E(channels[index]);
+
+        if constexpr (FfxCpuOperand<T>::VectorSize == 0)
+            value = element;
+        else
+            value.data[index] = element;
+    }
+    return value;
+}
+
+/// Convert a shader value to the 32-bit channels expected by <c><i>ffxStoreTexelCPU</i></c>.
+///
+/// @ingroup CPUShader
+template<typename T>
+void ffxCpuTexelToChannels(const T& value, FfxUInt32 channels[4])
+{
+    typedef typename FfxCpuOperand<T>::ElementType E;
+    channels[0] = channels[1] = channels[2] = channels[3] = 0;
+    for (int index = 0; index < FfxCpuOperand<T>::Size; ++index)
+    {
+        const E element = FfxCpuOperand<T>::get(value, index);
+        if constexpr (std::is_floating_point<E>::value)
+            channels[index] = ffxCpuBitCast<FfxUInt32>(FfxFloat32(element));
+        else
+            channels[index] = FfxUInt32(element);
+    }
+}
+
+FFX_STATIC FfxUInt32 ffxCpuMipCount(const FfxCpuTextureView* view)
+{
+    const FfxResourceDescription& description = view->description;
+    FfxUInt32 mipCount = description.mipCount;
+    if (mipCount == 0)
+    {
+        const FfxUInt32 largest = description.width > description.height ? description.width : description.height;
+        while (largest >> mipCount)
+            ++mipCount;
+    }
+    mipCount = mipCount < FFX_CPU_MAX_MIP_LEVELS ? mipCount : FFX_CPU_MAX_MIP_LEVELS;
+    return mipCount > view->mip ? mipCount - view->mip : 1;
+}
+
+FFX_STATIC FfxUInt32 ffxCpuMipWidth(const FfxCpuTextureView* view, FfxUInt32 mip)
+{
+    const FfxUInt32 width = view->description.width >> (view->mip + mip);
+    return width ? width : 1;
+}
+
+FFX_STATIC FfxUInt32 ffxCpuMipHeight(const FfxCpuTextureView* view, FfxUInt32 mip)
+{
+    const FfxUInt32 height = view->description.height >> (view->mip + mip);
+    return height ? height : 1;
+}
+
+/// The filter of a sampler declared by the callbacks.
+///
+/// All samplers clamp to the edge of the texture.
+///
+/// @ingroup CPUShader
+typedef enum FfxCpuSamplerFilter {
+
+    FFX_CPU_SAMPLER_FILTER_POINT,                                   ///< Nearest texel of the nearest mip.
+    FFX_CPU_SAMPLER_FILTER_LINEAR                                   ///< Bilinear filtering between the two nearest mips.
+} FfxCpuSamplerFilter;
+
+/// A sampler declared by the callbacks, matching the static samplers of the HLSL root signatures.
+///
+/// @ingroup CPUShader
+struct FfxCpuSamplerState
+{
+    FfxCpuSamplerFilter filter;
+};
+
+template<typename T>
+T ffxCpuSampleLevel(const FfxCpuTextureView* view, FfxCpuSamplerState sampler, FfxFloat32 u, FfxFloat32 v, FfxInt32 slice, FfxFloat32 lod)
+{
+    const FfxFloat32 maxLod = FfxFloat32(ffxCpuMipCount(view) - 1);
+    lod = ffxCpuMinimum(ffxCpuMaximum(lod, 0.0f), maxLod);
+
+    if (sampler.filter == FFX_CPU_SAMPLER_FILTER_POINT)
+    {
+        const FfxUInt32 mip    = FfxUInt32(lod + 0.5f);
+        const FfxInt32  width  = FfxInt32(ffxCpuMipWidth(view, mip));
+        const FfxInt32  height = FfxInt32(ffxCpuMipHeight(view, mip));
+        const FfxInt32  x      = FfxInt32(std::floor(u * FfxFloat32(width)));
+        const FfxInt32  y      = FfxInt32(std::floor(v * FfxFloat32(height)));
+
+        FfxUInt32 channels[4];
+        ffxLoadTexelCPU(view, x < 0 ? 0 : (x < width ? x : width - 1), y < 0 ? 0 : (y < height ? y : height - 1), slice, mip, channels);
+        return ffxCpuTexelFromChannels<T>(channels);
+    }
+
+    const FfxUInt32  mip    = FfxUInt32(lod);
+    const FfxFloat32 weight = lod - FfxFloat32(mip);
+
+    FfxFloat32 texel[4];
+    ffxSampleLevelCPU(view, u, v, slice, mip, texel);
+    if (weight > 0.0f)
+    {
+        FfxFloat32 nextTexel[4];
+        ffxSampleLevelCPU(view, u, v, slice, mip + 1, nextTexel);
+        for (int channel = 0; channel < 4; ++channel)
+            texel[channel] += (nextTexel[channel] - texel[channel]) * weight;
+    }
+
+    FfxUInt32 channels[4];
+    for (int channel = 0; channel < 4; ++channel)
+        channels[channel] = ffxCpuBitCast<FfxUInt32>(texel[channel]);
+    return ffxCpuTexelFromChannels<T>(channels);
+}
+
+FFX_STATIC FfxFloat32x4 ffxCpuGather(const FfxCpuTextureView* view, FfxFloat32x2 uv, FfxInt32x2 offset, FfxUInt32 channel)
+{
+    const FfxInt32 width  = FfxInt32(ffxCpuMipWidth(view, 0));
+    const FfxInt32 height = FfxInt32(ffxCpuMipHeight(view, 0));
+    const FfxInt32 x0     = FfxInt32(std::floor(uv.x * FfxFloat32(width) - 0.5f)) + offset.x;
+    const FfxInt32 y0     = FfxInt32(std::floor(uv.y * FfxFloat32(height) - 0.5f)) + offset.y;
+
+    const FfxInt32 left   = x0 < 0 ? 0 : (x0 < width ? x0 : width - 1);
+    const FfxInt32 right  = x0 + 1 < 0 ? 0 : (x0 + 1 < width ? x0 + 1 : width - 1);
+    const FfxInt32 top    = y0 < 0 ? 0 : (y0 < height ? y0 : height - 1);
+    const FfxInt32 bottom = y0 + 1 < 0 ? 0 : (y0 + 1 < height ? y0 + 1 : height - 1);
+
+    // same component order as the HLSL Gather methods
+    FfxUInt32 channels[4][4];
+    ffxLoadTexelCPU(view, left, bottom, 0, 0, channels[0]);
+    ffxLoadTexelCPU(view, right, bottom, 0, 0, channels[1]);
+    ffxLoadTexelCPU(view, right, top, 0, 0, channels[2]);
+    ffxLoadTexelCPU(view, left, top, 0, 0, channels[3]);
+
+    FfxFloat32x4 result;
+    for (int index = 0; index < 4; ++index)
+        result.data[index] = ffxCpuBitCast<FfxFloat32>(channels[index][channel]);
+    return result;
+}
+
+/// A read-only 2D texture bound to an SRV slot.
+///
+/// @ingroup CPUShader
+template<typename T>
+struct FfxCpuTexture2D
+{
+    /// The <c><i>mips[level][location]</i></c> accessor of a texture.
+    struct MipLevels
+    {
+        struct MipLevel
+        {
+            FfxUInt32 slot;
+            FfxUInt32 mip;
+
+            T operator[](FfxUInt32x2 location) const
+            {
+                FfxUInt32 channels[4];
+                ffxLoadTexelCPU(&ffxCpuDispatch()->srvTextures[slot], FfxInt32(location.x), FfxInt32(location.y), 0, mip, channels);
+                return ffxCpuTexelFromChannels<T>(channels);
+            }
+        };
+
+        FfxUInt32 slot;
+
+        MipLevel operator[](FfxUInt32 mip) const
+        {
+            return { slot, mip };
+        }
+    };
+
+    FfxUInt32 slot;
+    MipLevels mips;
+
+    constexpr explicit FfxCpuTexture2D(FfxUInt32 slotIndex)
+        : slot(slotIndex)
+        , mips{ slotIndex }
+    {
+    }
+
+    const FfxCpuTextureView* view() const
+    {
+        return &ffxCpuDispatch()->srvTextures[slot];
+    }
+
+    T Load(FfxInt32x3 location, FfxInt32x2 offset = FfxInt32x2(0, 0)) const
+    {
+        FfxUInt32 channels[4];
+        ffxLoadTexelCPU(view(), location.x + offset.x, location.y + offset.y, 0, FfxUInt32(location.z), channels);
+        return ffxCpuTexelFromChannels<T>(channels);
+    }
+
+    T operator[](FfxUInt32x2 location) const
+    {
+        FfxUInt32 channels[4];
+        ffxLoadTexelCPU(view(), FfxInt32(location.x), FfxInt32(location.y), 0, 0, channels);
+        return ffxCpuTexelFromChannels<T>(channels);
+    }
+
+    T SampleLevel(FfxCpuSamplerState sampler, FfxFloat32x2 uv, FfxFloat32 lod) const
+    {
+        return ffxCpuSampleLevel<T>(view(), sampler, uv.x, uv.y, 0, lod);
+    }
+
+    FfxFloat32x4 GatherRed(FfxCpuSamplerState, FfxFloat32x2 uv, FfxInt32x2 offset = FfxInt32x2(0, 0)) const
+    {
+        return ffxCpuGather(view(), uv, offset, 0);
+    }
+
+    FfxFloat32x4 GatherGreen(FfxCpuSamplerState, FfxFloat32x2 uv, FfxInt32x2 offset = FfxInt32x2(0, 0)) const
+    {
+        return ffxCpuGather(view(), uv, offset, 1);
+    }
+
+    FfxFloat32x4 GatherBlue(FfxCpuSamplerState, FfxFloat32x2 uv, FfxInt32x2 offset = FfxInt32x2(0, 0)) const
+    {
+        return ffxCpuGather(view(), uv, offset, 2);
+    }
+
+    FfxFloat32x4 GatherAlpha(FfxCpuSamplerState, FfxFloat32x2 uv, FfxInt32x2 offset = FfxInt32x2(0, 0)) const
+    {
+        return ffxCpuGather(view(), uv, offset, 3);
+    }
+
+    template<typename U>
+    void GetDimensions(U& width, U& height) const
+    {
+        width  = U(ffxCpuMipWidth(view(), 0));
+        height = U(ffxCpuMipHeight(view(), 0));
+    }
+
+    template<typename U>
+    void GetDimensions(FfxUInt32 mip, U& width, U& height, U& levels) const
+    {
+        width  = U(ffxCpuMipWidth(view(), mip));
+        height = U(ffxCpuMipHeight(view(), mip));
+        levels = U(ffxCpuMipCount(view()));
+    }
+};
+
+/// A read-only 2D texture array bound to an SRV slot.
+///
+/// @ingroup CPUShader
+template<typename T>
+struct FfxCpuTexture2DArray
+{
+    FfxUInt32 slot;
+
+    constexpr explicit FfxCpuTexture2DArray(FfxUInt32 slotIndex)
+        : slot(slotIndex)
+    {
+    }
+
+    const FfxCpuTextureView* view() const
+    {
+        return &ffxCpuDispatch()->srvTextures[slot];
+    }
+
+    T Load(FfxInt32x4 location) const
+    {
+        FfxUInt32 channels[4];
+        ffxLoadTexelCPU(view(), location.x, location.y, location.z, FfxUInt32(location.w), channels);
+        return ffxCpuTexelFromChannels<T>(channels);
+    }
+
+    T operator[](FfxUInt32x3 location) const
+    {
+        FfxUInt32 channels[4];
+        ffxLoadTexelCPU(view(), FfxInt32(location.x), FfxInt32(location.y), FfxInt32(location.z), 0, channels);
+        return ffxCpuTexelFromChannels<T>(channels);
+    }
+
+    T SampleLevel(FfxCpuSamplerState sampler, FfxFloat32x3 uv, FfxFloat32 lod) const
+    {
+        return ffxCpuSampleLevel<T>(view(), sampler, uv.x, uv.y, FfxInt32(uv.z + 0.5f), lod);
+    }
+
+    template<typename U>
+    void GetDimensions(U& width, U& height, U& elements) const
+    {
+        width    = U(ffxCpuMipWidth(view(), 0));
+        height   = U(ffxCpuMipHeight(view(), 0));
+        elements = U(view()->description.depth);
+    }
+};
+
+/// A reference to a texel of a read-write texture, returned by the subscript operator.
+///
+/// @ingroup CPUShader
+template<typename T>
+struct FfxCpuTexelReference
+{
+    const FfxCpuTextureView* view;
+    FfxInt32                 x;
+    FfxInt32                 y;
+    FfxInt32                 z;
+
+    operator T() const
+    {
+        FfxUInt32 channels[4];
+        ffxLoadTexelCPU(view, x, y, z, 0, channels);
+        return ffxCpuTexelFromChannels<T>(channels);
+    }
+
+    const FfxCpuTexelReference& operator=(const T& value) const
+    {
+        FfxUInt32 channels[4];
+        ffxCpuTexelToChannels(value, channels);
+        ffxStoreTexelCPU(view, x, y, z, channels);
+        return *this;
+    }
+
+    const FfxCpuTexelReference& operator=(const FfxCpuTexelReference& other) const
+    {
+        return *this = T(other);
+    }
+
+    /// The address of a 32-bit single channel texel, for atomic operations.
+    FfxUInt32* address() const
+    {
+        FFX_ASSERT(view->description.format == FFX_SURFACE_FORMAT_R32_UINT || view->description.format == FFX_SURFACE_FORMAT_R32_TYPELESS);
+        return reinterpret_cast<FfxUInt32*>(ffxGetTexelAddressCPU(view, x, y, z, 0));
+    }
+};
+
+template<typename T>
+struct FfxCpuOperand<FfxCpuTexelReference<T>, void>
+{
+    static const bool IsValid    = FfxCpuOperand<T>::IsValid;
+    static const int  Size       = FfxCpuOperand<T>::Size;
+    static const int  VectorSize = FfxCpuOperand<T>::VectorSize;
+    typedef typename FfxCpuOperand<T>::ElementType ElementType;
+
+    static ElementType get(const FfxCpuTexelReference<T>& value, int index) { return FfxCpuOperand<T>::get(T(value), index); }
+};
+
+/// A read-write 2D texture bound to a UAV slot.
+///
+/// @ingroup CPUShader
+template<typename T>
+struct FfxCpuRWTexture2D
+{
+    FfxUInt32 slot;
+
+    constexpr explicit FfxCpuRWTexture2D(FfxUInt32 slotIndex)
+        : slot(slotIndex)
+    {
+    }
+
+    const FfxCpuTextureView* view() const
+    {
+        return &ffxCpuDispatch()->uavTextures[slot];
+    }
+
+    FfxCpuTexelReference<T> operator[](FfxUInt32x2 location) const
+    {
+        return { view(), FfxInt32(location.x), FfxInt32(location.y), 0 };
+    }
+
+    T Load(FfxInt32x2 location) const
+    {
+        return (*this)[FfxUInt32x2(location)];
+    }
+
+    template<typename U>
+    void GetDimensions(U& width, U& height) const
+    {
+        width  = U(ffxCpuMipWidth(view(), 0));
+        height = U(ffxCpuMipHeight(view(), 0));
+    }
+};
+
+/// A read-write 2D texture array bound to a UAV slot.
+///
+/// @ingroup CPUShader
+template<typename T>
+struct FfxCpuRWTexture2DArray
+{
+    FfxUInt32 slot;
+
+    constexpr explicit FfxCpuRWTexture2DArray(FfxUInt32 slotIndex)
+        : slot(slotIndex)
+    {
+    }
+
+    const FfxCpuTextureView* view() const
+    {
+        return &ffxCpuDispatch()->uavTextures[slot];
+    }
+
+    FfxCpuTexelReference<T> operator[](FfxUInt32x3 location) const
+    {
+        return { view(), FfxInt32(location.x), FfxInt32(location.y), FfxInt32(location.z) };
+    }
+
+    template<typename U>
+    void GetDimensions(U& width, U& height, U& elements) const
+    {
+        width    = U(ffxCpuMipWidth(view(), 0));
+        height   = U(ffxCpuMipHeight(view(), 0));
+        elements = U(view()->description.depth);
+    }
+};
+
+/// A read-only structured buffer bound to an SRV slot.
+///
+/// @ingroup CPUShader
+template<typename T>
+struct FfxCpuStructuredBuffer
+{
+    FfxUInt32 slot;
+
+    constexpr explicit FfxCpuStructuredBuffer(FfxUInt32 slotIndex)
+        : slot(slotIndex)
+    {
+    }
+
+    const T& operator[](FfxUInt32 index) const
+    {
+        const FfxCpuBufferView& view = ffxCpuDispatch()->srvBuffers[slot];
+        FFX_ASSERT(view.data && (index + 1) * sizeof(T) <= view.size);
+        return reinterpret_cast<const T*>(view.data)[index];
+    }
+
+    T Load(FfxUInt32 index) const
+    {
+        return (*this)[index];
+    }
+};
+
+/// A read-write structured buffer bound to a UAV slot.
+///
+/// @ingroup CPUShader
+template<typename T>
+struct FfxCpuRWStructuredBuffer
+{
+    FfxUInt32 slot;
+
+    constexpr explicit FfxCpuRWStructuredBuffer(FfxUInt32 slotIndex)
+        : slot(slotIndex)
+    {
+    }
+
+    T& operator[](FfxUInt32 index) const
+    {
+        const FfxCpuBufferView& view = ffxCpuDispatch()->uavBuffers[slot];
+        FFX_ASSERT(view.data && (index + 1) * sizeof(T) <= view.size);
+        return reinterpret_cast<T*>(view.data)[index];
+    }
+};
+
+/// An array of <c><i>N</i></c> resources bound to consecutive slots, starting at the slot of the first element.
+///
+/// @ingroup CPUShader
+template<typename R, int N>
+struct FfxCpuResourceArray
+{
+    FfxUInt32 slot;
+
+    constexpr explicit FfxCpuResourceArray(FfxUInt32 slotIndex)
+        : slot(slotIndex)
+    {
+    }
+
+    R operator[](FfxUInt32 index) const
+    {
+        FFX_ASSERT(index < FfxUInt32(N));
+        return R(slot + index);
+    }
+};
+
+/// A constant buffer bound to a CBV slot.
+///
+/// Unbound constant buffers read as zero, like the HLSL callbacks do when a pass does not declare them.
+///
+/// @ingroup CPUShader
+template<typename T>
+struct FfxCpuConstantBuffer
+{
+    FfxUInt32 slot;
+
+    constexpr FfxCpuConstantBuffer()
+        : slot(~0u)
+    {
+    }
+
+    constexpr explicit FfxCpuConstantBuffer(FfxUInt32 slotIndex)
+        : slot(slotIndex)
+    {
+    }
+
+    const T* operator->() const
+    {
+        static const T unbound = {};
+        if (slot >= FFX_MAX_NUM_CONST_BUFFERS)
+            return &unbound;
+
+        const FfxCpuDispatchDescription* dispatch = ffxCpuDispatch();
+        FFX_ASSERT(dispatch->constantBuffers[slot] && dispatch->constantBufferSizes[slot] * sizeof(FfxUInt32) >= sizeof(T));
+        return reinterpret_cast<const T*>(dispatch->constantBuffers[slot]);
+    }
+};
+
+#define FFX_CPU_INTERLOCKED_OPERATION(name, operation)                                                                              \
+    template<typename T, typename V>                                                                                                \
+    typename std::enable_if<std::is_integral<T>::value>::type name(T& destination, const V& value)                                  \
+    {                                                                                                                               \
+        ffxCpuAtomic##operation(&destination, T(value));                                                                            \
+    }                                                                                                                               \
+    template<typename T, typename V, typename O>                                                                                    \
+    typename std::enable_if<std::is_integral<T>::value>::type name(T& destination, const V& value, O& original)                     \
+    {                                                                                                                               \
+        original = O(ffxCpuAtomic##operation(&destination, T(value)));                                                              \
+    }                                                                                                                               \
+    template<typename T, typename V>                                                                                                \
+    void name(const FfxCpuTexelReference<T>& destination, const V& value)                                                           \
+    {                                                                                                                               \
+        if (FfxUInt32* address = destination.address())                                                                             \
+            ffxCpuAtomic##operation(address, FfxUInt32(value));                                                                     \
+    }                                                                                                                               \
+    template<typename T, typename V, typename O>                                                                                    \
+    void name(const FfxCpuTexelReference<T>& destination, const V& value, O& original)                                              \
+    {                                                                                                                               \
+        FfxUInt32* address = destination.address();                                                                                 \
+        original = O(address ? ffxCpuAtomic##operation(address, FfxUInt32(value)) : 0u);                                            \
+    }
+
+// Atomics acquire and release, so workgroups counting themselves through a global atomic (SPD, luminance pyramids)
+// see the writes of every workgroup that counted before them.
+template<typename T>
+std::atomic<T>* ffxCpuAtomicAddress(T* address)
+{
+    static_assert(sizeof(std::atomic<T>) == sizeof(T) && std::atomic<T>::is_always_lock_free, "Atomics must map onto plain 32-bit values.");
+    return reinterpret_cast<std::atomic<T>*>(address);
+}
+
+template<typename T>
+T ffxCpuAtomicAdd(T* address, T value)
+{
+    return ffxCpuAtomicAddress(address)->fetch_add(value, std::memory_order_acq_rel);
+}
+
+template<typename T>
+T ffxCpuAtomicAnd(T* address, T value)
+{
+    return ffxCpuAtomicAddress(address)->fetch_and(value, std::memory_order_acq_rel);
+}
+
+template<typename T>
+T ffxCpuAtomicOr(T* address, T value)
+{
+    return ffxCpuAtomicAddress(address)->fetch_or(value, std::memory_order_acq_rel);
+}
+
+template<typename T>
+T ffxCpuAtomicXor(T* address, T value)
+{
+    return ffxCpuAtomicAddress(address)->fetch_xor(value, std::memory_order_acq_rel);
+}
+
+template<typename T>
+T ffxCpuAtomicExchange(T* address, T value)
+{
+    return ffxCpuAtomicAddress(address)->exchange(value, std::memory_order_acq_rel);
+}
+
+template<typename T>
+T ffxCpuAtomicMin(T* address, T value)
+{
+    std::atomic<T>* atomic   = ffxCpuAtomicAddress(address);
+    T               original = atomic->load(std::memory_order_acquire);
+    while (value < original && !atomic->compare_exchange_weak(original, value, std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+    }
+    return original;
+}
+
+template<typename T>
+T ffxCpuAtomicMax(T* address, T value)
+{
+    std::atomic<T>* atomic   = ffxCpuAtomicAddress(address);
+    T               original = atomic->load(std::memory_order_acquire);
+    while (value > original && !atomic->compare_exchange_weak(original, value, std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+    }
+    return original;
+}
+
+FFX_CPU_INTERLOCKED_OPERATION(InterlockedAdd, Add)
+FFX_CPU_INTERLOCKED_OPERATION(InterlockedAnd, And)
+FFX_CPU_INTERLOCKED_OPERATION(InterlockedOr, Or)
+FFX_CPU_INTERLOCKED_OPERATION(InterlockedXor, Xor)
+FFX_CPU_INTERLOCKED_OPERATION(InterlockedMin, Min)
+FFX_CPU_INTERLOCKED_OPERATION(InterlockedMax, Max)
+FFX_CPU_INTERLOCKED_OPERATION(InterlockedExchange, Exchange)
+
+#undef FFX_CPU_INTERLOCKED_OPERATION
+
+
+//==============================================================================================================================
+//                                                 PLATFORM FUNCTIONS
+//==============================================================================================================================
+
+/// Convert FfxFloat32 to half (in lower 16-bits of output).
+///
+/// @ingroup CPUShader
+#define ffxF32ToF16 f32tof16
+
+/// Pack 2x32-bit floating point values in a single 32bit value.
+///
+/// @param [in] value               A 2-dimensional floating point value to convert and pack.
+///
+/// @returns
+/// A packed 32bit value containing 2 16bit floating point values.
+///
+/// @ingroup CPUShader
+FFX_STATIC FfxUInt32 ffxPackHalf2x16(FfxFloat32x2 value)
+{
+    return ffxF32ToF16(value.x) | (ffxF32ToF16(value.y) << 16);
+}
+
+FFX_STATIC FfxFloat32x2 ffxBroadcast2(FfxFloat32 value)
+{
+    return FfxFloat32x2(value, value);
+}
+
+FFX_STATIC FfxFloat32x3 ffxBroadcast3(FfxFloat32 value)
+{
+    return FfxFloat32x3(value, value, value);
+}
+
+FFX_STATIC FfxFloat32x4 ffxBroadcast4(FfxFloat32 value)
+{
+    return FfxFloat32x4(value, value, value, value);
+}
+
+// HLSL float literals are 32-bit, C++ ones are double
+FFX_STATIC FfxFloat32x2 ffxBroadcast2(double value)
+{
+    return ffxBroadcast2(FfxFloat32(value));
+}
+
+FFX_STATIC FfxFloat32x3 ffxBroadcast3(double value)
+{
+    return ffxBroadcast3(FfxFloat32(value));
+}
+
+FFX_STATIC FfxFloat32x4 ffxBroadcast4(double value)
+{
+    return ffxBroadcast4(FfxFloat32(value));
+}
+
+FFX_STATIC FfxInt32x2 ffxBroadcast2(FfxInt32 value)
+{
+    return FfxInt32x2(value, value);
+}
+
+FFX_STATIC FfxInt32x3 ffxBroadcast3(FfxInt32 value)
+{
+    return FfxInt32x3(value, value, value);
+}
+
+FFX_STATIC FfxInt32x4 ffxBroadcast4(FfxInt32 value)
+{
+    return FfxInt32x4(value, value, value, value);
+}
+
+FFX_STATIC FfxUInt32x2 ffxBroadcast2(FfxUInt32 value)
+{
+    return FfxUInt32x2(value, value);
+}
+
+FFX_STATIC FfxUInt32x3 ffxBroadcast3(FfxUInt32 value)
+{
+    return FfxUInt32x3(value, value, value);
+}
+
+FFX_STATIC FfxUInt32x4 ffxBroadcast4(FfxUInt32 value)
+{
+    return FfxUInt32x4(value, value, value, value);
+}
+
+FFX_STATIC FfxUInt32 ffxBitfieldExtract(FfxUInt32 src, FfxUInt32 off, FfxUInt32 bits)
+{
+    FfxUInt32 mask = (1u << bits) - 1;
+    return (src >> off) & mask;
+}
+
+FFX_STATIC FfxUInt32 ffxBitfieldInsert(FfxUInt32 src, FfxUInt32 ins, FfxUInt32 mask)
+{
+    return (ins & mask) | (src & (~mask));
+}
+
+FFX_STATIC FfxUInt32 ffxBitfieldInsertMask(FfxUInt32 src, FfxUInt32 ins, FfxUInt32 bits)
+{
+    FfxUInt32 mask = (1u << bits) - 1;
+    return (ins & mask) | (src & (~mask));
+}
+
+FFX_STATIC FfxUInt32 ffxAsUInt32(FfxFloat32 x)
+{
+    return asuint(x);
+}
+
+FFX_STATIC FfxUInt32x2 ffxAsUInt32(FfxFloat32x2 x)
+{
+    return asuint(x);
+}
+
+FFX_STATIC FfxUInt32x3 ffxAsUInt32(FfxFloat32x3 x)
+{
+    return asuint(x);
+}
+
+FFX_STATIC FfxUInt32x4 ffxAsUInt32(FfxFloat32x4 x)
+{
+    return asuint(x);
+}
+
+FFX_STATIC FfxFloat32 ffxAsFloat(FfxUInt32 x)
+{
+    return asfloat(x);
+}
+
+FFX_STATIC FfxFloat32x2 ffxAsFloat(FfxUInt32x2 x)
+{
+    return asfloat(x);
+}
+
+FFX_STATIC FfxFloat32x3 ffxAsFloat(FfxUInt32x3 x)
+{
+    return asfloat(x);
+}
+
+FFX_STATIC FfxFloat32x4 ffxAsFloat(FfxUInt32x4 x)
+{
+    return asfloat(x);
+}
+
+FFX_STATIC FfxFloat32 ffxReciprocal(FfxFloat32 x)
+{
+    return rcp(x);
+}
+
+FFX_STATIC FfxFloat32x2 ffxReciprocal(FfxFloat32x2 x)
+{
+    return rcp(x);
+}
+
+FFX_STATIC FfxFloat32x3 ffxReciprocal(FfxFloat32x3 x)
+{
+    return rcp(x);
+}
+
+FFX_STATIC FfxFloat32x4 ffxReciprocal(FfxFloat32x4 x)
+{
+    return rcp(x);
+}
+
+FFX_STATIC FfxFloat32 ffxRsqrt(FfxFloat32 x)
+{
+    return rsqrt(x);
+}
+
+FFX_STATIC FfxFloat32x2 ffxRsqrt(FfxFloat32x2 x)
+{
+    return rsqrt(x);
+}
+
+FFX_STATIC FfxFloat32x3 ffxRsqrt(FfxFloat32x3 x)
+{
+    return rsqrt(x);
+}
+
+FFX_STATIC FfxFloat32x4 ffxRsqrt(FfxFloat32x4 x)
+{
+    return rsqrt(x);
+}
+
+FFX_STATIC FfxFloat32 ffxLerp(FfxFloat32 x, FfxFloat32 y, FfxFloat32 t)
+{
+    return lerp(x, y, t);
+}
+
+FFX_STATIC FfxFloat32x2 ffxLerp(FfxFloat32x2 x, FfxFloat32x2 y, FfxFloat32 t)
+{
+    return lerp(x, y, t);
+}
+
+FFX_STATIC FfxFloat32x2 ffxLerp(FfxFloat32x2 x, FfxFloat32x2 y, FfxFloat32x2 t)
+{
+    return lerp(x, y, t);
+}
+
+FFX_STATIC FfxFloat32x3 ffxLerp(FfxFloat32x3 x, FfxFloat32x3 y, FfxFloat32 t)
+{
+    return lerp(x, y, t);
+}
+
+FFX_STATIC FfxFloat32x3 ffxLerp(FfxFloat32x3 x, FfxFloat32x3 y, FfxFloat32x3 t)
+{
+    return lerp(x, y, t);
+}
+
+FFX_STATIC FfxFloat32x4 ffxLerp(FfxFloat32x4 x, FfxFloat32x4 y, FfxFloat32 t)
+{
+    return lerp(x, y, t);
+}
+
+FFX_STATIC FfxFloat32x4 ffxLerp(FfxFloat32x4 x, FfxFloat32x4 y, FfxFloat32x4 t)
+{
+    return lerp(x, y, t);
+}
+
+FFX_STATIC FfxFloat32 ffxSaturate(FfxFloat32 x)
+{
+    return saturate(x);
+}
+
+FFX_STATIC FfxFloat32x2 ffxSaturate(FfxFloat32x2 x)
+{
+    return saturate(x);
+}
+
+FFX_STATIC FfxFloat32x3 ffxSaturate(FfxFloat32x3 x)
+{
+    return saturate(x);
+}
+
+FFX_STATIC FfxFloat32x4 ffxSaturate(FfxFloat32x4 x)
+{
+    return saturate(x);
+}
+
+FFX_STATIC FfxFloat32 ffxFract(FfxFloat32 x)
+{
+    return x - floor(x);
+}
+
+FFX_STATIC FfxFloat32x2 ffxFract(FfxFloat32x2 x)
+{
+    return x - floor(x);
+}
+
+FFX_STATIC FfxFloat32x3 ffxFract(FfxFloat32x3 x)
+{
+    return x - floor(x);
+}
+
+FFX_STATIC FfxFloat32x4 ffxFract(FfxFloat32x4 x)
+{
+    return x - floor(x);
+}
+
+FFX_STATIC FfxFloat32 ffxRound(FfxFloat32 x)
+{
+    return round(x);
+}
+
+FFX_STATIC FfxFloat32x2 ffxRound(FfxFloat32x2 x)
+{
+    return round(x);
+}
+
+FFX_STATIC FfxFloat32x3 ffxRound(FfxFloat32x3 x)
+{
+    return round(x);
+}
+
+FFX_STATIC FfxFloat32x4 ffxRound(FfxFloat32x4 x)
+{
+    return round(x);
+}
+
+FFX_STATIC FfxFloat32 ffxMax3(FfxFloat32 x, FfxFloat32 y, FfxFloat32 z)
+{
+    return max(x, max(y, z));
+}
+
+FFX_STATIC FfxFloat32x2 ffxMax3(FfxFloat32x2 x, FfxFloat32x2 y, FfxFloat32x2 z)
+{
+    return max(x, max(y, z));
+}
+
+FFX_STATIC FfxFloat32x3 ffxMax3(FfxFloat32x3 x, FfxFloat32x3 y, FfxFloat32x3 z)
+{
+    return max(x, max(y, z));
+}
+
+FFX_STATIC FfxFloat32x4 ffxMax3(FfxFloat32x4 x, FfxFloat32x4 y, FfxFloat32x4 z)
+{
+    return max(x, max(y, z));
+}
+
+FFX_STATIC FfxUInt32 ffxMax3(FfxUInt32 x, FfxUInt32 y, FfxUInt32 z)
+{
+    return max(x, max(y, z));
+}
+
+FFX_STATIC FfxUInt32x2 ffxMax3(FfxUInt32x2 x, FfxUInt32x2 y, FfxUInt32x2 z)
+{
+    return max(x, max(y, z));
+}
+
+FFX_STATIC FfxUInt32x3 ffxMax3(FfxUInt32x3 x, FfxUInt32x3 y, FfxUInt32x3 z)
+{
+    return max(x, max(y, z));
+}
+
+FFX_STATIC FfxUInt32x4 ffxMax3(FfxUInt32x4 x, FfxUInt32x4 y, FfxUInt32x4 z)
+{
+    return max(x, max(y, z));
+}
+
+FFX_STATIC FfxFloat32 ffxMed3(FfxFloat32 x, FfxFloat32 y, FfxFloat32 z)
+{
+    return max(min(x, y), min(max(x, y), z));
+}
+
+FFX_STATIC FfxFloat32x2 ffxMed3(FfxFloat32x2 x, FfxFloat32x2 y, FfxFloat32x2 z)
+{
+    return max(min(x, y), min(max(x, y), z));
+}
+
+FFX_STATIC FfxFloat32x3 ffxMed3(FfxFloat32x3 x, FfxFloat32x3 y, FfxFloat32x3 z)
+{
+    return max(min(x, y), min(max(x, y), z));
+}
+
+FFX_STATIC FfxFloat32x4 ffxMed3(FfxFloat32x4 x, FfxFloat32x4 y, FfxFloat32x4 z)
+{
+    return max(min(x, y), min(max(x, y), z));
+}
+
+FFX_STATIC FfxInt32 ffxMed3(FfxInt32 x, FfxInt32 y, FfxInt32 z)
+{
+    return max(min(x, y), min(max(x, y), z));
+}
+
+FFX_STATIC FfxInt32x2 ffxMed3(FfxInt32x2 x, FfxInt32x2 y, FfxInt32x2 z)
+{
+    return max(min(x, y), min(max(x, y), z));
+}
+
+FFX_STATIC FfxInt32x3 ffxMed3(FfxInt32x3 x, FfxInt32x3 y, FfxInt32x3 z)
+{
+    return max(min(x, y), min(max(x, y), z));
+}
+
+FFX_STATIC FfxInt32x4 ffxMed3(FfxInt32x4 x, FfxInt32x4 y, FfxInt32x4 z)
+{
+    return max(min(x, y), min(max(x, y), z));
+}
+
+FFX_STATIC FfxFloat32 ffxMin3(FfxFloat32 x, FfxFloat32 y, FfxFloat32 z)
+{
+    return min(x, min(y, z));
+}
+
+FFX_STATIC FfxFloat32x2 ffxMin3(FfxFloat32x2 x, FfxFloat32x2 y, FfxFloat32x2 z)
+{
+    return min(x, min(y, z));
+}
+
+FFX_STATIC FfxFloat32x3 ffxMin3(FfxFloat32x3 x, FfxFloat32x3 y, FfxFloat32x3 z)
+{
+    return min(x, min(y, z));
+}
+
+FFX_STATIC FfxFloat32x4 ffxMin3(FfxFloat32x4 x, FfxFloat32x4 y, FfxFloat32x4 z)
+{
+    return min(x, min(y, z));
+}
+
+FFX_STATIC FfxUInt32 ffxMin3(FfxUInt32 x, FfxUInt32 y, FfxUInt32 z)
+{
+    return min(x, min(y, z));
+}
+
+FFX_STATIC FfxUInt32x2 ffxMin3(FfxUInt32x2 x, FfxUInt32x2 y, FfxUInt32x2 z)
+{
+    return min(x, min(y, z));
+}
+
+FFX_STATIC FfxUInt32x3 ffxMin3(FfxUInt32x3 x, FfxUInt32x3 y, FfxUInt32x3 z)
+{
+    return min(x, min(y, z));
+}
+
+FFX_STATIC FfxUInt32x4 ffxMin3(FfxUInt32x4 x, FfxUInt32x4 y, FfxUInt32x4 z)
+{
+    return min(x, min(y, z));
+}
+
+FFX_STATIC FfxUInt32 ffxAShrSU1(FfxUInt32 a, FfxUInt32 b)
+{
+    return FfxUInt32(FfxInt32(a) >> FfxInt32(b));
+}
+
+FFX_STATIC FfxUInt32 ffxPackF32(FfxFloat32x2 v)
+{
+    FfxUInt32x2 p = FfxUInt32x2(ffxF32ToF16(v.x), ffxF32ToF16(v.y));
+    return p.x | (p.y << 16);
+}
+
+FFX_STATIC FfxFloat32x2 ffxUnpackF32(FfxUInt32 a)
+{
+    return f16tof32(FfxUInt32x2(a & 0xFFFF, a >> 16));
+}
+
+FFX_STATIC FfxUInt32x2 ffxPackF32x2(FfxFloat32x4 v)
+{
+    return FfxUInt32x2(ffxPackF32(v.xy), ffxPackF32(v.zw));
+}
+
+FFX_STATIC FfxFloat32x4 ffxUnpackF32x2(FfxUInt32x2 a)
+{
+    return FfxFloat32x4(ffxUnpackF32(a.x), ffxUnpackF32(a.y));
+}
+
+FFX_STATIC FFX_MIN16_F2 ffxUint32ToFloat16x2(FfxUInt32 x)
+{
+    FfxFloat32x2 t = f16tof32(FfxUInt32x2(x & 0xFFFF, x >> 16));
+    return FFX_MIN16_F2(t);
+}
+
+FFX_STATIC FFX_MIN16_F4 ffxUint32x2ToFloat16x4(FfxUInt32x2 x)
+{
+    return FFX_MIN16_F4(ffxUint32ToFloat16x2(x.x), ffxUint32ToFloat16x2(x.y));
+}
+
+FFX_STATIC FFX_MIN16_U2 ffxUint32ToUint16x2(FfxUInt32 x)
+{
+    FfxUInt32x2 t = FfxUInt32x2(x & 0xFFFF, x >> 16);
+    return FFX_MIN16_U2(t);
+}
+
+FFX_STATIC FFX_MIN16_U4 ffxUint32x2ToUint16x4(FfxUInt32x2 x)
+{
+    return FFX_MIN16_U4(ffxUint32ToUint16x2(x.x), ffxUint32ToUint16x2(x.y));
+}
+
+FFX_STATIC FfxUInt32x2 ffxFloat16x4ToUint32x2(FFX_MIN16_F4 v)
+{
+    FfxUInt32x2 result;
+    result.x = ffxF32ToF16(v.x) | (ffxF32ToF16(v.y) << 16);
+    result.y = ffxF32ToF16(v.z) | (ffxF32ToF16(v.w) << 16);
+    return result;
+}
+
+/// @brief Inverts the value while avoiding division by zero. If the value is zero, zero is returned.
+/// @param v Value to invert.
+/// @return If v = 0 returns 0. If v != 0 returns 1/v.
+FFX_STATIC FfxFloat32 ffxInvertSafe(FfxFloat32 v)
+{
+    FfxFloat32 s  = FfxFloat32(sign(v));
+    FfxFloat32 s2 = s * s;
+    return s2 / (v + s2 - 1.0f);
+}
+
+/// @brief Inverts the value while avoiding division by zero. If the value is zero, zero is returned.
+/// @param v Value to invert.
+/// @return If v = 0 returns 0. If v != 0 returns 1/v.
+FFX_STATIC FfxFloat32x2 ffxInvertSafe(FfxFloat32x2 v)
+{
+    FfxFloat32x2 s  = FfxFloat32x2(sign(v));
+    FfxFloat32x2 s2 = s * s;
+    return s2 / (v + s2 - FfxFloat32x2(1.0f, 1.0f));
+}
+
+/// @brief Inverts the value while avoiding division by zero. If the value is zero, zero is returned.
+/// @param v Value to invert.
+/// @return If v = 0 returns 0. If v != 0 returns 1/v.
+FFX_STATIC FfxFloat32x3 ffxInvertSafe(FfxFloat32x3 v)
+{
+    FfxFloat32x3 s  = FfxFloat32x3(sign(v));
+    FfxFloat32x3 s2 = s * s;
+    return s2 / (v + s2 - FfxFloat32x3(1.0f, 1.0f, 1.0f));
+}
+
+/// @brief Inverts the value while avoiding division by zero. If the value is zero, zero is returned.
+/// @param v Value to invert.
+/// @return If v = 0 returns 0. If v != 0 returns 1/v.
+FFX_STATIC FfxFloat32x4 ffxInvertSafe(FfxFloat32x4 v)
+{
+    FfxFloat32x4 s  = FfxFloat32x4(sign(v));
+    FfxFloat32x4 s2 = s * s;
+    return s2 / (v + s2 - FfxFloat32x4(1.0f, 1.0f, 1.0f, 1.0f));
+}
+
+#define FFX_UINT32_TO_FLOAT16X2(x) ffxUint32ToFloat16x2(FfxUInt32(x))
+
+//==============================================================================================================================
+//                                                   HLSL LANGUAGE
+//==============================================================================================================================
+
+typedef FfxUInt32    uint;
+typedef FfxUInt32x2  uint2;
+typedef FfxUInt32x3  uint3;
+typedef FfxUInt32x4  uint4;
+typedef FfxInt32x2   int2;
+typedef FfxInt32x3   int3;
+typedef FfxInt32x4   int4;
+typedef FfxFloat32x2 float2;
+typedef FfxFloat32x3 float3;
+typedef FfxFloat32x4 float4;
+
+/// Reference types used for <c><i>out</i></c> and <c><i>inout</i></c> parameters.
+///
+/// Effects add the structures they pass as <c><i>out</i></c> or <c><i>inout</i></c> parameters
+/// to this namespace in their <c><i>*_callbacks_cpp.h</i></c> file.
+///
+/// @ingroup CPUShader
+namespace FfxCpuInOut
+{
+    typedef FfxBoolean&                             FfxBoolean;
+    typedef FfxFloat32&                             FfxFloat32;
+    typedef FfxCpuVectorReference<::FfxFloat32, 2>  FfxFloat32x2;
+    typedef FfxCpuVectorReference<::FfxFloat32, 3>  FfxFloat32x3;
+    typedef FfxCpuVectorReference<::FfxFloat32, 4>  FfxFloat32x4;
+    typedef FfxInt32&                               FfxInt32;
+    typedef FfxCpuVectorReference<::FfxInt32, 2>    FfxInt32x2;
+    typedef FfxCpuVectorReference<::FfxInt32, 3>    FfxInt32x3;
+    typedef FfxCpuVectorReference<::FfxInt32, 4>    FfxInt32x4;
+    typedef FfxUInt32&                              FfxUInt32;
+    typedef FfxCpuVectorReference<::FfxUInt32, 2>   FfxUInt32x2;
+    typedef FfxCpuVectorReference<::FfxUInt32, 3>   FfxUInt32x3;
+    typedef FfxCpuVectorReference<::FfxUInt32, 4>   FfxUInt32x4;
+    typedef uint&                                   uint;
+    typedef FfxCpuVectorReference<::FfxUInt32, 2>   uint2;
+    typedef FfxCpuVectorReference<::FfxUInt32, 3>   uint3;
+    typedef FfxCpuVectorReference<::FfxUInt32, 4>   uint4;
+    typedef FfxCpuVectorReference<::FfxInt32, 2>    int2;
+    typedef FfxCpuVectorReference<::FfxInt32, 3>    int3;
+    typedef FfxCpuVectorReference<::FfxInt32, 4>    int4;
+    typedef FfxCpuVectorReference<::FfxFloat32, 2>  float2;
+    typedef FfxCpuVectorReference<::FfxFloat32, 3>  float3;
+    typedef FfxCpuVectorReference<::FfxFloat32, 4>  float4;
+} // namespace FfxCpuInOut
+
+#define in
+#define out             FfxCpuInOut::
+#define inout           FfxCpuInOut::
+#define groupshared     FFX_GROUPSHARED
+#define globallycoherent
+#define unorm
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif // #if defined(__clang__)
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif // #if defined(_MSC_VER)
+
+#endif // #if defined(FFX_GPU)
@@ -420,12 +420,12 @@ void SampleOpticalFlowMotionVectorField(FfxFloat32x2 fUv, out VectorFieldEntry v
 
 FfxFloat32x3 Tonemap(FfxFloat32x3 fRgb)
 {
-    return fRgb / (ffxMax(ffxMax(0.f, fRgb.r), ffxMax(fRgb.g, fRgb.b)) + 1.f).xxx;
+    return fRgb / (ffxMax(ffxMax(0.f, fRgb.r), ffxMax(fRgb.g, fRgb.b)) + 1.f);
 }
 
 FfxFloat32x3 InverseTonemap(FfxFloat32x3 fRgb)
 {
-    return fRgb / ffxMax(FFX_TONEMAP_EPSILON, 1.f - ffxMax(fRgb.r, ffxMax(fRgb.g, fRgb.b))).xxx;
+    return fRgb / ffxMax(FFX_TONEMAP_EPSILON, 1.f - ffxMax(fRgb.r, ffxMax(fRgb.g, fRgb.b)));
 }
 
 FfxInt32x2 ComputeHrPosFromLrPos(FfxInt32x2 iPxLrPos)
@@ -29,7 +29,7 @@ FfxUInt32 getPriorityFactorFromViewSpaceDepth(FfxFloat32 fViewSpaceDepthInMeters
 
     FfxUInt32 uPriorityFactor = FfxUInt32(FfxFloat32(1 - (fViewSpaceDepthInMeters * (1.0f / (1.0f + fViewSpaceDepthInMeters)))) * PRIORITY_HIGH_MAX);
 
-    return ffxMax(1, uPriorityFactor);
+    return ffxMax(1u, uPriorityFactor);
 }
 
 void computeGameFieldMvs(FfxInt32x2 iPxPos)
@@ -94,7 +94,7 @@ void computeGameFieldMvs(FfxInt32x2 iPxPos)
             BilinearSamplingData bilinearInfo = GetBilinearSamplingData(fSecondaryLocationUv, RenderSize());
 
             // Reverse depth prio for secondary vectors
-            FfxUInt32 uHighPriorityFactorSecondary = ffxMax(1, PRIORITY_HIGH_MAX - uHighPriorityFactorPrimary);
+            FfxUInt32 uHighPriorityFactorSecondary = ffxMax(1u, PRIORITY_HIGH_MAX - uHighPriorityFactorPrimary);
 
             const FfxFloat32x2 fToCenter = normalize(FfxFloat32x2(0.5f, 0.5f) - fSecondaryLocationUv);
             uLowPriorityFactor = FfxUInt32(ffxMax(0.0f, dot(fToCenter, fStepMv)) * PRIORITY_LOW_MAX);
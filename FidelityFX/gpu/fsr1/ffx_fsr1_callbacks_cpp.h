@@ -0,0 +1,156 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "ffx_fsr1_resources.h"
+
+#if defined(FFX_GPU)
+#include "ffx_core.h"
+
+struct cbFSR1
+{
+    FfxUInt32x4 const0;
+    FfxUInt32x4 const1;
+    FfxUInt32x4 const2;
+    FfxUInt32x4 const3;
+    FfxUInt32x4 sample;
+   #define FFX_FSR1_CONSTANT_BUFFER_1_SIZE 20  // Number of 32-bit values. This must be kept in sync with the cbFSR1 size.
+};
+
+static_assert(sizeof(cbFSR1) == FFX_FSR1_CONSTANT_BUFFER_1_SIZE * sizeof(FfxUInt32), "cbFSR1 must match the layout of the HLSL constant buffer.");
+
+#if defined(FSR1_BIND_CB_FSR1)
+    static const FfxCpuConstantBuffer<cbFSR1> cb_fsr1(FSR1_BIND_CB_FSR1);
+#else
+    static const FfxCpuConstantBuffer<cbFSR1> cb_fsr1;
+#endif
+
+FfxUInt32x4 Const0()
+{
+    return cb_fsr1->const0;
+}
+
+FfxUInt32x4 Const1()
+{
+    return cb_fsr1->const1;
+}
+
+FfxUInt32x4  Const2()
+{
+    return cb_fsr1->const2;
+}
+
+FfxUInt32x4 Const3()
+{
+    return cb_fsr1->const3;
+}
+
+FfxUInt32x4 EASUSample()
+{
+    return cb_fsr1->sample;
+}
+
+FfxUInt32x4 RCasSample()
+{
+    return cb_fsr1->sample;
+}
+
+FfxUInt32x4 RCasConfig()
+{
+    return cb_fsr1->const0;
+}
+
+static const FfxCpuSamplerState s_LinearClamp = { FFX_CPU_SAMPLER_FILTER_LINEAR };
+
+    // SRVs
+    #if defined FSR1_BIND_SRV_INPUT_COLOR
+        static const FfxCpuTexture2D<FfxFloat32x4>          r_input_color(FSR1_BIND_SRV_INPUT_COLOR);
+    #endif
+    #if defined FSR1_BIND_SRV_INTERNAL_UPSCALED_COLOR
+        static const FfxCpuTexture2D<FfxFloat32x4>          r_internal_upscaled_color(FSR1_BIND_SRV_INTERNAL_UPSCALED_COLOR);
+    #endif
+    #if defined FSR1_BIND_SRV_UPSCALED_OUTPUT
+        static const FfxCpuTexture2D<FfxFloat32x4>          r_upscaled_output(FSR1_BIND_SRV_UPSCALED_OUTPUT);
+    #endif
+
+    // UAV declarations
+    #if defined FSR1_BIND_UAV_INPUT_COLOR
+        static const FfxCpuRWTexture2D<FfxFloat32x4>        rw_input_color(FSR1_BIND_UAV_INPUT_COLOR);
+    #endif
+    #if defined FSR1_BIND_UAV_INTERNAL_UPSCALED_COLOR
+        static const FfxCpuRWTexture2D<FfxFloat32x4>        rw_internal_upscaled_color(FSR1_BIND_UAV_INTERNAL_UPSCALED_COLOR);
+    #endif
+    #if defined FSR1_BIND_UAV_UPSCALED_OUTPUT
+        static const FfxCpuRWTexture2D<FfxFloat32x4>        rw_upscaled_output(FSR1_BIND_UAV_UPSCALED_OUTPUT);
+    #endif
+
+#if defined(FSR1_BIND_SRV_INPUT_COLOR)
+        FfxFloat32x4 GatherEasuRed(FfxFloat32x2 fPxPos)
+        {
+            return r_input_color.GatherRed(s_LinearClamp, fPxPos, FfxInt32x2(0, 0));
+        }
+#endif // defined(FSR1_BIND_SRV_INPUT_COLOR)
+
+#if defined(FSR1_BIND_SRV_INPUT_COLOR)
+        FfxFloat32x4 GatherEasuGreen(FfxFloat32x2 fPxPos)
+        {
+            return r_input_color.GatherGreen(s_LinearClamp, fPxPos, FfxInt32x2(0, 0));
+        }
+#endif // defined(FSR1_BIND_SRV_INPUT_COLOR)
+
+#if defined(FSR1_BIND_SRV_INPUT_COLOR)
+        FfxFloat32x4 GatherEasuBlue(FfxFloat32x2 fPxPos)
+        {
+            return r_input_color.GatherBlue(s_LinearClamp, fPxPos, FfxInt32x2(0, 0));
+        }
+#endif // defined(FSR1_BIND_SRV_INPUT_COLOR)
+
+#if FFX_FSR1_OPTION_APPLY_RCAS
+    #if defined(FSR1_BIND_UAV_INTERNAL_UPSCALED_COLOR)
+        void StoreEASUOutput(FfxUInt32x2 iPxPos, FfxFloat32x3 fColor)
+        {
+            rw_internal_upscaled_color[iPxPos] = FfxFloat32x4(fColor, 1.f);
+        }
+    #endif // #if defined(FSR1_BIND_UAV_INTERNAL_UPSCALED_COLOR)
+#else
+    #if defined(FSR1_BIND_UAV_UPSCALED_OUTPUT)
+        void StoreEASUOutput(FfxUInt32x2 iPxPos, FfxFloat32x3 fColor)
+        {
+            rw_upscaled_output[iPxPos] = FfxFloat32x4(fColor, 1.f);
+        }
+    #endif // #if defined(FSR1_BIND_UAV_UPSCALED_OUTPUT)
+#endif // #if FFX_FSR1_OPTION_APPLY_RCAS
+
+#if defined(FSR1_BIND_SRV_INTERNAL_UPSCALED_COLOR)
+        FfxFloat32x4 LoadRCas_Input(FfxInt32x2 iPxPos)
+        {
+            return r_internal_upscaled_color[iPxPos];
+        }
+#endif // defined(FSR1_BIND_UAV_INTERNAL_UPSCALED_COLOR)
+
+#if defined(FSR1_BIND_UAV_UPSCALED_OUTPUT)
+        void StoreRCasOutput(FfxInt32x2 iPxPos, FfxFloat32x4 fColor)
+        {
+            rw_upscaled_output[iPxPos] = fColor;
+        }
+#endif // defined(FSR1_BIND_UAV_UPSCALED_OUTPUT)
+
+#endif // #if defined(FFX_GPU)
@@ -37,7 +37,7 @@ FFX_MIN16_F GetPxHrVelocity(FFX_MIN16_F2 fMotionVector)
 void Accumulate(const AccumulationPassCommonParams params, FFX_PARAMETER_INOUT FfxFloat32x3 fHistoryColor, FfxFloat32x3 fAccumulation, FFX_PARAMETER_IN FfxFloat32x4 fUpsampledColorAndWeight)
 {
     // Avoid invalid values when accumulation and upsampled weight is 0
-    fAccumulation = ffxMax(FSR2_EPSILON.xxx, fAccumulation + fUpsampledColorAndWeight.www);
+    fAccumulation = ffxMax(ffxBroadcast3(FSR2_EPSILON), fAccumulation + fUpsampledColorAndWeight.www);
 
 #if FFX_FSR2_OPTION_HDR_COLOR_INPUT
     //YCoCg -> RGB -> Tonemap -> YCoCg (Use RGB tonemapper to avoid color desaturation)
@@ -83,7 +83,7 @@ void RectifyHistory(
 
         const FfxFloat32x3 fClampedHistoryColor = clamp(fHistoryColor, boxMin, boxMax);
 
-        FfxFloat32x3 fHistoryContribution = ffxMax(fLumaInstabilityFactor, fLockContributionThisFrame).xxx;
+        FfxFloat32x3 fHistoryContribution = ffxBroadcast3(ffxMax(fLumaInstabilityFactor, fLockContributionThisFrame));
         
         const FfxFloat32 fReactiveFactor = params.fDilatedReactiveFactor;
         const FfxFloat32 fReactiveContribution = 1.0f - ffxPow(fReactiveFactor, 1.0f / 2.0f);
@@ -131,7 +131,7 @@ FfxFloat32x3 ComputeBaseAccumulationWeight(const AccumulationPassCommonParams pa
 
     fBaseAccumulation = ffxMin(fBaseAccumulation, ffxLerp(fBaseAccumulation, fUpsampledWeight, ffxSaturate(params.fHrVelocity / FfxFloat32(20))));
 
-    return fBaseAccumulation.xxx;
+    return ffxBroadcast3(fBaseAccumulation);
 }
 
 FfxFloat32 ComputeLumaInstabilityFactor(const AccumulationPassCommonParams params, RectificationBox clippingBox, FfxFloat32 fThisFrameReactiveFactor, FfxFloat32 fLuminanceDiff)
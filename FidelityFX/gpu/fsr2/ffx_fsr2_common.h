@@ -335,23 +335,23 @@ FFX_MIN16_F RGBToPerceivedLuma(FFX_MIN16_F3 fLinearRgb)
 
 FfxFloat32x3 Tonemap(FfxFloat32x3 fRgb)
 {
-    return fRgb / (ffxMax(ffxMax(0.f, fRgb.r), ffxMax(fRgb.g, fRgb.b)) + 1.f).xxx;
+    return fRgb / (ffxMax(ffxMax(0.f, fRgb.r), ffxMax(fRgb.g, fRgb.b)) + 1.f);
 }
 
 FfxFloat32x3 InverseTonemap(FfxFloat32x3 fRgb)
 {
-    return fRgb / ffxMax(FSR2_TONEMAP_EPSILON, 1.f - ffxMax(fRgb.r, ffxMax(fRgb.g, fRgb.b))).xxx;
+    return fRgb / ffxMax(FSR2_TONEMAP_EPSILON, 1.f - ffxMax(fRgb.r, ffxMax(fRgb.g, fRgb.b)));
 }
 
 #if FFX_HALF
 FFX_MIN16_F3 Tonemap(FFX_MIN16_F3 fRgb)
 {
-    return fRgb / (ffxMax(ffxMax(FFX_MIN16_F(0.f), fRgb.r), ffxMax(fRgb.g, fRgb.b)) + FFX_MIN16_F(1.f)).xxx;
+    return fRgb / (ffxMax(ffxMax(FFX_MIN16_F(0.f), fRgb.r), ffxMax(fRgb.g, fRgb.b)) + FFX_MIN16_F(1.f));
 }
 
 FFX_MIN16_F3 InverseTonemap(FFX_MIN16_F3 fRgb)
 {
-    return fRgb / ffxMax(FFX_MIN16_F(FSR2_TONEMAP_EPSILON), FFX_MIN16_F(1.f) - ffxMax(fRgb.r, ffxMax(fRgb.g, fRgb.b))).xxx;
+    return fRgb / ffxMax(FFX_MIN16_F(FSR2_TONEMAP_EPSILON), FFX_MIN16_F(1.f) - ffxMax(fRgb.r, ffxMax(fRgb.g, fRgb.b)));
 }
 #endif
 
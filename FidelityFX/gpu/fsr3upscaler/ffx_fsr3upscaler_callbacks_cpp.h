@@ -0,0 +1,951 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "ffx_fsr3upscaler_resources.h"
+
+#if defined(FFX_GPU)
+#include "ffx_core.h"
+
+// Structures the algorithm headers pass as out or inout parameters.
+struct RectificationBox;
+struct AccumulationPassCommonParams;
+struct AccumulationPassData;
+struct SampleSet;
+namespace FfxCpuInOut
+{
+    typedef RectificationBox& RectificationBox;
+    typedef AccumulationPassCommonParams& AccumulationPassCommonParams;
+    typedef AccumulationPassData& AccumulationPassData;
+    typedef SampleSet& SampleSet;
+} // namespace FfxCpuInOut
+#endif // #if defined(FFX_GPU)
+
+#if defined(FFX_GPU)
+
+#if defined(FSR3UPSCALER_BIND_CB_FSR3UPSCALER)
+struct cbFSR3Upscaler
+{
+    FfxInt32x2    iRenderSize;
+    FfxInt32x2    iPreviousFrameRenderSize;
+
+    FfxInt32x2    iUpscaleSize;
+    FfxInt32x2    iPreviousFrameUpscaleSize;
+
+    FfxInt32x2    iMaxRenderSize;
+    FfxInt32x2    iMaxUpscaleSize;
+
+    FfxFloat32x4  fDeviceToViewDepth;
+
+    FfxFloat32x2  fJitter;
+    FfxFloat32x2  fPreviousFrameJitter;
+
+    FfxFloat32x2  fMotionVectorScale;
+    FfxFloat32x2  fDownscaleFactor;
+
+    FfxFloat32x2  fMotionVectorJitterCancellation;
+    FfxFloat32    fTanHalfFOV;
+    FfxFloat32    fJitterSequenceLength;
+
+    FfxFloat32    fDeltaTime;
+    FfxFloat32    fDeltaPreExposure;
+    FfxFloat32    fViewSpaceToMetersFactor;
+    FfxFloat32    fFrameIndex;
+
+    FfxFloat32    fVelocityFactor;
+    FfxFloat32    fReactivenessScale;
+    FfxFloat32    fShadingChangeScale;
+    FfxFloat32    fAccumulationAddedPerFrame;
+    FfxFloat32    fMinDisocclusionAccumulation;
+};
+
+static const FfxCpuConstantBuffer<cbFSR3Upscaler> cb_fsr3_upscaler(FSR3UPSCALER_BIND_CB_FSR3UPSCALER);
+
+#define FFX_FSR3UPSCALER_CONSTANT_BUFFER_1_SIZE (sizeof(cbFSR3Upscaler) / 4)  // Number of 32-bit values. This must be kept in sync with the cbFSR3Upscaler size.
+
+/* Define getter functions in the order they are defined in the CB! */
+FfxInt32x2 RenderSize()
+{
+    return cb_fsr3_upscaler->iRenderSize;
+}
+
+FfxInt32x2 PreviousFrameRenderSize()
+{
+    return cb_fsr3_upscaler->iPreviousFrameRenderSize;
+}
+
+FfxInt32x2 MaxRenderSize()
+{
+    return cb_fsr3_upscaler->iMaxRenderSize;
+}
+
+FfxInt32x2 UpscaleSize()
+{
+    return cb_fsr3_upscaler->iUpscaleSize;
+}
+
+FfxInt32x2 PreviousFrameUpscaleSize()
+{
+    return cb_fsr3_upscaler->iPreviousFrameUpscaleSize;
+}
+
+FfxInt32x2 MaxUpscaleSize()
+{
+    return cb_fsr3_upscaler->iMaxUpscaleSize;
+}
+
+FfxFloat32x2 Jitter()
+{
+    return cb_fsr3_upscaler->fJitter;
+}
+
+FfxFloat32x2 PreviousFrameJitter()
+{
+    return cb_fsr3_upscaler->fPreviousFrameJitter;
+}
+
+FfxFloat32x4 DeviceToViewSpaceTransformFactors()
+{
+    return cb_fsr3_upscaler->fDeviceToViewDepth;
+}
+
+FfxFloat32x2 MotionVectorScale()
+{
+    return cb_fsr3_upscaler->fMotionVectorScale;
+}
+
+FfxFloat32x2 DownscaleFactor()
+{
+    return cb_fsr3_upscaler->fDownscaleFactor;
+}
+
+FfxFloat32x2 MotionVectorJitterCancellation()
+{
+    return cb_fsr3_upscaler->fMotionVectorJitterCancellation;
+}
+
+FfxFloat32 TanHalfFoV()
+{
+    return cb_fsr3_upscaler->fTanHalfFOV;
+}
+
+FfxFloat32 JitterSequenceLength()
+{
+    return cb_fsr3_upscaler->fJitterSequenceLength;
+}
+
+FfxFloat32 DeltaTime()
+{
+    return cb_fsr3_upscaler->fDeltaTime;
+}
+
+FfxFloat32 DeltaPreExposure()
+{
+    return cb_fsr3_upscaler->fDeltaPreExposure;
+}
+
+FfxFloat32 ViewSpaceToMetersFactor()
+{
+    return cb_fsr3_upscaler->fViewSpaceToMetersFactor;
+}
+
+FfxFloat32 FrameIndex()
+{
+    return cb_fsr3_upscaler->fFrameIndex;
+}
+
+FfxFloat32 VelocityFactor()
+{
+    return cb_fsr3_upscaler->fVelocityFactor;
+}
+
+FfxFloat32 AccumulationAddedPerFrame()
+{
+    return cb_fsr3_upscaler->fAccumulationAddedPerFrame;
+}
+
+FfxFloat32 MinDisocclusionAccumulation()
+{
+    return cb_fsr3_upscaler->fMinDisocclusionAccumulation;
+}
+
+#endif // #if defined(FSR3UPSCALER_BIND_CB_FSR3UPSCALER)
+
+#define FFX_FSR3UPSCALER_CONSTANT_BUFFER_2_SIZE 6  // Number of 32-bit values. This must be kept in sync with max( cbRCAS , cbSPD) size.
+
+#if defined(FSR3UPSCALER_BIND_CB_AUTOREACTIVE)
+struct cbGenerateReactive
+{
+    FfxFloat32   fTcThreshold; // 0.1 is a good starting value, lower will result in more TC pixels
+    FfxFloat32   fTcScale;
+    FfxFloat32   fReactiveScale;
+    FfxFloat32   fReactiveMax;
+};
+
+static const FfxCpuConstantBuffer<cbGenerateReactive> cb_generate_reactive(FSR3UPSCALER_BIND_CB_AUTOREACTIVE);
+
+FfxFloat32 TcThreshold()
+{
+    return cb_generate_reactive->fTcThreshold;
+}
+
+FfxFloat32 TcScale()
+{
+    return cb_generate_reactive->fTcScale;
+}
+
+FfxFloat32 ReactiveScale()
+{
+    return cb_generate_reactive->fReactiveScale;
+}
+
+FfxFloat32 ReactiveMax()
+{
+    return cb_generate_reactive->fReactiveMax;
+}
+#endif // #if defined(FSR3UPSCALER_BIND_CB_AUTOREACTIVE)
+
+#if defined(FSR3UPSCALER_BIND_CB_RCAS)
+struct cbRCAS
+{
+    FfxUInt32x4 rcasConfig;
+};
+
+static const FfxCpuConstantBuffer<cbRCAS> cb_rcas(FSR3UPSCALER_BIND_CB_RCAS);
+
+FfxUInt32x4 RCASConfig()
+{
+    return cb_rcas->rcasConfig;
+}
+#endif // #if defined(FSR3UPSCALER_BIND_CB_RCAS)
+
+#if defined(FSR3UPSCALER_BIND_CB_REACTIVE)
+struct cbGenerateReactive
+{
+    FfxFloat32   gen_reactive_scale;
+    FfxFloat32   gen_reactive_threshold;
+    FfxFloat32   gen_reactive_binaryValue;
+    FfxUInt32    gen_reactive_flags;
+};
+
+static const FfxCpuConstantBuffer<cbGenerateReactive> cb_generate_reactive(FSR3UPSCALER_BIND_CB_REACTIVE);
+
+FfxFloat32 GenReactiveScale()
+{
+    return cb_generate_reactive->gen_reactive_scale;
+}
+
+FfxFloat32 GenReactiveThreshold()
+{
+    return cb_generate_reactive->gen_reactive_threshold;
+}
+
+FfxFloat32 GenReactiveBinaryValue()
+{
+    return cb_generate_reactive->gen_reactive_binaryValue;
+}
+
+FfxUInt32 GenReactiveFlags()
+{
+    return cb_generate_reactive->gen_reactive_flags;
+}
+#endif // #if defined(FSR3UPSCALER_BIND_CB_REACTIVE)
+
+#if defined(FSR3UPSCALER_BIND_CB_SPD)
+struct cbSPD
+{
+    FfxUInt32   mips;
+    FfxUInt32   numWorkGroups;
+    FfxUInt32x2 workGroupOffset;
+    FfxUInt32x2 renderSize;
+};
+
+static const FfxCpuConstantBuffer<cbSPD> cb_spd(FSR3UPSCALER_BIND_CB_SPD);
+
+FfxUInt32 MipCount()
+{
+    return cb_spd->mips;
+}
+
+FfxUInt32 NumWorkGroups()
+{
+    return cb_spd->numWorkGroups;
+}
+
+FfxUInt32x2 WorkGroupOffset()
+{
+    return cb_spd->workGroupOffset;
+}
+
+FfxUInt32x2 SPD_RenderSize()
+{
+    return cb_spd->renderSize;
+}
+#endif // #if defined(FSR3UPSCALER_BIND_CB_SPD)
+
+static const FfxCpuSamplerState s_PointClamp = { FFX_CPU_SAMPLER_FILTER_POINT };
+static const FfxCpuSamplerState s_LinearClamp = { FFX_CPU_SAMPLER_FILTER_LINEAR };
+
+#if defined(FSR3UPSCALER_BIND_SRV_SPD_MIPS)
+static const FfxCpuTexture2D<FfxFloat32x2>              r_spd_mips(FSR3UPSCALER_BIND_SRV_SPD_MIPS);
+
+FfxInt32x2 GetSPDMipDimensions(FfxUInt32 uMipLevel)
+{
+    FfxUInt32 uWidth;
+    FfxUInt32 uHeight;
+    FfxUInt32 uLevels;
+    r_spd_mips.GetDimensions(uMipLevel, uWidth, uHeight, uLevels);
+
+    return FfxInt32x2(uWidth, uHeight);
+}
+
+FfxFloat32x2 SampleSPDMipLevel(FfxFloat32x2 fUV, FfxUInt32 mipLevel)
+{
+    return r_spd_mips.SampleLevel(s_LinearClamp, fUV, mipLevel);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_INPUT_DEPTH)
+static const FfxCpuTexture2D<FfxFloat32>                r_input_depth(FSR3UPSCALER_BIND_SRV_INPUT_DEPTH);
+
+FfxFloat32 LoadInputDepth(FfxUInt32x2 iPxPos)
+{
+    return r_input_depth[iPxPos];
+}
+
+FfxFloat32 SampleInputDepth(FfxFloat32x2 fUV)
+{
+    return r_input_depth.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_REACTIVE_MASK)
+static const FfxCpuTexture2D<FfxFloat32>                r_reactive_mask(FSR3UPSCALER_BIND_SRV_REACTIVE_MASK);
+
+FfxFloat32 LoadReactiveMask(FfxUInt32x2 iPxPos)
+{
+    return r_reactive_mask[iPxPos] * cb_fsr3_upscaler->fReactivenessScale;
+}
+
+FfxInt32x2 GetReactiveMaskResourceDimensions()
+{
+    FfxUInt32 uWidth;
+    FfxUInt32 uHeight;
+    r_reactive_mask.GetDimensions(uWidth, uHeight);
+
+    return FfxInt32x2(uWidth, uHeight);
+}
+
+FfxFloat32 SampleReactiveMask(FfxFloat32x2 fUV)
+{
+    return r_reactive_mask.SampleLevel(s_LinearClamp, fUV, 0) * cb_fsr3_upscaler->fReactivenessScale;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_TRANSPARENCY_AND_COMPOSITION_MASK)
+static const FfxCpuTexture2D<FfxFloat32>                r_transparency_and_composition_mask(FSR3UPSCALER_BIND_SRV_TRANSPARENCY_AND_COMPOSITION_MASK);
+
+FfxFloat32 LoadTransparencyAndCompositionMask(FfxUInt32x2 iPxPos)
+{
+    return r_transparency_and_composition_mask[iPxPos];
+}
+
+FfxInt32x2 GetTransparencyAndCompositionMaskResourceDimensions()
+{
+    FfxUInt32 uWidth;
+    FfxUInt32 uHeight;
+    r_transparency_and_composition_mask.GetDimensions(uWidth, uHeight);
+
+    return FfxInt32x2(uWidth, uHeight);
+}
+
+FfxFloat32 SampleTransparencyAndCompositionMask(FfxFloat32x2 fUV)
+{
+    return r_transparency_and_composition_mask.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_INPUT_COLOR)
+static const FfxCpuTexture2D<FfxFloat32x4>              r_input_color_jittered(FSR3UPSCALER_BIND_SRV_INPUT_COLOR);
+
+FfxFloat32x3 LoadInputColor(FfxUInt32x2 iPxPos)
+{
+    return r_input_color_jittered[iPxPos].rgb;
+}
+
+FfxFloat32x3 SampleInputColor(FfxFloat32x2 fUV)
+{
+    return r_input_color_jittered.SampleLevel(s_LinearClamp, fUV, 0).rgb;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_INPUT_MOTION_VECTORS)
+static const FfxCpuTexture2D<FfxFloat32x4>              r_input_motion_vectors(FSR3UPSCALER_BIND_SRV_INPUT_MOTION_VECTORS);
+
+FfxFloat32x2 LoadInputMotionVector(FfxUInt32x2 iPxDilatedMotionVectorPos)
+{
+    FfxFloat32x2 fSrcMotionVector = r_input_motion_vectors[iPxDilatedMotionVectorPos].xy;
+
+    FfxFloat32x2 fUvMotionVector = fSrcMotionVector * MotionVectorScale();
+
+#if FFX_FSR3UPSCALER_OPTION_JITTERED_MOTION_VECTORS
+    fUvMotionVector -= MotionVectorJitterCancellation();
+#endif
+
+    return fUvMotionVector;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_INTERNAL_UPSCALED)
+static const FfxCpuTexture2D<FfxFloat32x4>              r_internal_upscaled_color(FSR3UPSCALER_BIND_SRV_INTERNAL_UPSCALED);
+
+FfxFloat32x4 LoadHistory(FfxUInt32x2 iPxHistory)
+{
+    return r_internal_upscaled_color[iPxHistory];
+}
+
+FfxFloat32x4 SampleHistory(FfxFloat32x2 fUV)
+{
+    return r_internal_upscaled_color.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_LUMA_HISTORY)
+static const FfxCpuRWTexture2D<FfxFloat32x4>            rw_luma_history(FSR3UPSCALER_BIND_UAV_LUMA_HISTORY);
+
+void StoreLumaHistory(FfxUInt32x2 iPxPos, FfxFloat32x4 fLumaHistory)
+{
+    rw_luma_history[iPxPos] = fLumaHistory;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_LUMA_HISTORY)
+static const FfxCpuTexture2D<FfxFloat32x4>              r_luma_history(FSR3UPSCALER_BIND_SRV_LUMA_HISTORY);
+
+FfxFloat32x4 LoadLumaHistory(FfxInt32x2 iPxPos)
+{
+    return r_luma_history[iPxPos];
+}
+
+FfxFloat32x4 SampleLumaHistory(FfxFloat32x2 fUV)
+{
+    return r_luma_history.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_RCAS_INPUT)
+static const FfxCpuTexture2D<FfxFloat32x4>              r_rcas_input(FSR3UPSCALER_BIND_SRV_RCAS_INPUT);
+
+FfxFloat32x4 LoadRCAS_Input(FfxInt32x2 iPxPos)
+{
+    return r_rcas_input[iPxPos];
+}
+
+FfxFloat32x3 SampleRCAS_Input(FfxFloat32x2 fUV)
+{
+    return r_rcas_input.SampleLevel(s_LinearClamp, fUV, 0).rgb;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_INTERNAL_UPSCALED)
+static const FfxCpuRWTexture2D<FfxFloat32x4>            rw_internal_upscaled_color(FSR3UPSCALER_BIND_UAV_INTERNAL_UPSCALED);
+
+void StoreReprojectedHistory(FfxUInt32x2 iPxHistory, FfxFloat32x4 fHistory)
+{
+    rw_internal_upscaled_color[iPxHistory] = fHistory;
+}
+
+void StoreInternalColorAndWeight(FfxUInt32x2 iPxPos, FfxFloat32x4 fColorAndWeight)
+{
+    rw_internal_upscaled_color[iPxPos] = fColorAndWeight;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_UPSCALED_OUTPUT)
+static const FfxCpuRWTexture2D<FfxFloat32x4>            rw_upscaled_output(FSR3UPSCALER_BIND_UAV_UPSCALED_OUTPUT);
+
+void StoreUpscaledOutput(FfxUInt32x2 iPxPos, FfxFloat32x3 fColor)
+{
+    rw_upscaled_output[iPxPos] = FfxFloat32x4(fColor, 1.f);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_ACCUMULATION)
+static const FfxCpuTexture2D<FfxFloat32>                r_accumulation(FSR3UPSCALER_BIND_SRV_ACCUMULATION);
+
+FfxFloat32 SampleAccumulation(FfxFloat32x2 fUV)
+{
+    return r_accumulation.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_ACCUMULATION)
+static const FfxCpuRWTexture2D<FfxFloat32>              rw_accumulation(FSR3UPSCALER_BIND_UAV_ACCUMULATION);
+
+void StoreAccumulation(FfxUInt32x2 iPxPos, FfxFloat32 fAccumulation)
+{
+    rw_accumulation[iPxPos] = fAccumulation;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_SHADING_CHANGE)
+static const FfxCpuTexture2D<FfxFloat32>                r_shading_change(FSR3UPSCALER_BIND_SRV_SHADING_CHANGE);
+
+FfxFloat32 LoadShadingChange(FfxUInt32x2 iPxPos)
+{
+    return r_shading_change[iPxPos] * cb_fsr3_upscaler->fShadingChangeScale;
+}
+
+FfxFloat32 SampleShadingChange(FfxFloat32x2 fUV)
+{
+    return r_shading_change.SampleLevel(s_LinearClamp, fUV, 0) * cb_fsr3_upscaler->fShadingChangeScale;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_SHADING_CHANGE)
+static const FfxCpuRWTexture2D<FfxFloat32>              rw_shading_change(FSR3UPSCALER_BIND_UAV_SHADING_CHANGE);
+
+void StoreShadingChange(FfxUInt32x2 iPxPos, FfxFloat32 fShadingChange)
+{
+    rw_shading_change[iPxPos] = fShadingChange;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_FARTHEST_DEPTH)
+static const FfxCpuTexture2D<FfxFloat32>                r_farthest_depth(FSR3UPSCALER_BIND_SRV_FARTHEST_DEPTH);
+
+FfxInt32x2 GetFarthestDepthResourceDimensions()
+{
+    FfxUInt32 uWidth;
+    FfxUInt32 uHeight;
+    r_farthest_depth.GetDimensions(uWidth, uHeight);
+
+    return FfxInt32x2(uWidth, uHeight);
+}
+
+FfxFloat32 LoadFarthestDepth(FfxUInt32x2 iPxPos)
+{
+    return r_farthest_depth[iPxPos];
+}
+
+FfxFloat32 SampleFarthestDepth(FfxFloat32x2 fUV)
+{
+    return r_farthest_depth.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_FARTHEST_DEPTH)
+static const FfxCpuRWTexture2D<FfxFloat32>              rw_farthest_depth(FSR3UPSCALER_BIND_UAV_FARTHEST_DEPTH);
+
+void StoreFarthestDepth(FfxUInt32x2 iPxPos, FfxFloat32 fDepth)
+{
+    rw_farthest_depth[iPxPos] = fDepth;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_FARTHEST_DEPTH_MIP1)
+static const FfxCpuTexture2D<FfxFloat32>                r_farthest_depth_mip1(FSR3UPSCALER_BIND_SRV_FARTHEST_DEPTH_MIP1);
+
+FfxInt32x2 GetFarthestDepthMip1ResourceDimensions()
+{
+    FfxUInt32 uWidth;
+    FfxUInt32 uHeight;
+    r_farthest_depth_mip1.GetDimensions(uWidth, uHeight);
+
+    return FfxInt32x2(uWidth, uHeight);
+}
+
+FfxFloat32 LoadFarthestDepthMip1(FfxUInt32x2 iPxPos)
+{
+    return r_farthest_depth_mip1[iPxPos];
+}
+
+FfxFloat32 SampleFarthestDepthMip1(FfxFloat32x2 fUV)
+{
+    return r_farthest_depth_mip1.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_FARTHEST_DEPTH_MIP1)
+static const FfxCpuRWTexture2D<FfxFloat32>              rw_farthest_depth_mip1(FSR3UPSCALER_BIND_UAV_FARTHEST_DEPTH_MIP1);
+
+void StoreFarthestDepthMip1(FfxUInt32x2 iPxPos, FfxFloat32 fDepth)
+{
+    rw_farthest_depth_mip1[iPxPos] = fDepth;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_CURRENT_LUMA)
+static const FfxCpuTexture2D<FfxFloat32>                r_current_luma(FSR3UPSCALER_BIND_SRV_CURRENT_LUMA);
+
+FfxFloat32 LoadCurrentLuma(FfxUInt32x2 iPxPos)
+{
+    return r_current_luma[iPxPos];
+}
+
+FfxFloat32 SampleCurrentLuma(FfxFloat32x2 uv)
+{
+    return r_current_luma.SampleLevel(s_LinearClamp, uv, 0);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_CURRENT_LUMA)
+static const FfxCpuRWTexture2D<FfxFloat32>              rw_current_luma(FSR3UPSCALER_BIND_UAV_CURRENT_LUMA);
+
+void StoreCurrentLuma(FfxUInt32x2 iPxPos, FfxFloat32 fLuma)
+{
+    rw_current_luma[iPxPos] = fLuma;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_LUMA_INSTABILITY)
+static const FfxCpuTexture2D<FfxFloat32>                r_luma_instability(FSR3UPSCALER_BIND_SRV_LUMA_INSTABILITY);
+
+FfxFloat32 SampleLumaInstability(FfxFloat32x2 uv)
+{
+    return r_luma_instability.SampleLevel(s_LinearClamp, uv, 0);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_LUMA_INSTABILITY)
+static const FfxCpuRWTexture2D<FfxFloat32>              rw_luma_instability(FSR3UPSCALER_BIND_UAV_LUMA_INSTABILITY);
+
+void StoreLumaInstability(FfxUInt32x2 iPxPos, FfxFloat32 fLumaInstability)
+{
+    rw_luma_instability[iPxPos] = fLumaInstability;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_PREVIOUS_LUMA)
+static const FfxCpuTexture2D<FfxFloat32>                r_previous_luma(FSR3UPSCALER_BIND_SRV_PREVIOUS_LUMA);
+
+FfxFloat32 LoadPreviousLuma(FfxUInt32x2 iPxPos)
+{
+    return r_previous_luma[iPxPos];
+}
+
+FfxFloat32 SamplePreviousLuma(FfxFloat32x2 uv)
+{
+    return r_previous_luma.SampleLevel(s_LinearClamp, uv, 0);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_NEW_LOCKS)
+static const FfxCpuTexture2D<unorm FfxFloat32>          r_new_locks(FSR3UPSCALER_BIND_SRV_NEW_LOCKS);
+
+FfxFloat32 LoadNewLocks(FfxUInt32x2 iPxPos)
+{
+    return r_new_locks[iPxPos];
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_NEW_LOCKS)
+static const FfxCpuRWTexture2D<unorm FfxFloat32>        rw_new_locks(FSR3UPSCALER_BIND_UAV_NEW_LOCKS);
+
+FfxFloat32 LoadRwNewLocks(FfxUInt32x2 iPxPos)
+{
+    return rw_new_locks[iPxPos];
+}
+
+void StoreNewLocks(FfxUInt32x2 iPxPos, FfxFloat32 newLock)
+{
+    rw_new_locks[iPxPos] = newLock;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_RECONSTRUCTED_PREV_NEAREST_DEPTH)
+static const FfxCpuTexture2D<FfxUInt32>                 r_reconstructed_previous_nearest_depth(FSR3UPSCALER_BIND_SRV_RECONSTRUCTED_PREV_NEAREST_DEPTH);
+
+FfxFloat32 LoadReconstructedPrevDepth(FfxUInt32x2 iPxPos)
+{
+    return asfloat(r_reconstructed_previous_nearest_depth[iPxPos]);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH)
+static const FfxCpuRWTexture2D<FfxUInt32>               rw_reconstructed_previous_nearest_depth(FSR3UPSCALER_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH);
+
+void StoreReconstructedDepth(FfxUInt32x2 iPxSample, FfxFloat32 fDepth)
+{
+    FfxUInt32 uDepth = asuint(fDepth);
+
+#if FFX_FSR3UPSCALER_OPTION_INVERTED_DEPTH
+    InterlockedMax(rw_reconstructed_previous_nearest_depth[iPxSample], uDepth);
+#else
+    InterlockedMin(rw_reconstructed_previous_nearest_depth[iPxSample], uDepth); // min for standard, max for inverted depth
+#endif
+}
+
+void SetReconstructedDepth(FfxUInt32x2 iPxSample, const FfxUInt32 uValue)
+{
+    rw_reconstructed_previous_nearest_depth[iPxSample] = uValue;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_DILATED_DEPTH)
+static const FfxCpuRWTexture2D<FfxFloat32>              rw_dilated_depth(FSR3UPSCALER_BIND_UAV_DILATED_DEPTH);
+
+void StoreDilatedDepth(FFX_PARAMETER_IN FfxUInt32x2 iPxPos, FFX_PARAMETER_IN FfxFloat32 fDepth)
+{
+    rw_dilated_depth[iPxPos] = fDepth;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_DILATED_MOTION_VECTORS)
+static const FfxCpuRWTexture2D<FfxFloat32x2>            rw_dilated_motion_vectors(FSR3UPSCALER_BIND_UAV_DILATED_MOTION_VECTORS);
+
+void StoreDilatedMotionVector(FFX_PARAMETER_IN FfxUInt32x2 iPxPos, FFX_PARAMETER_IN FfxFloat32x2 fMotionVector)
+{
+    rw_dilated_motion_vectors[iPxPos] = fMotionVector;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_DILATED_MOTION_VECTORS)
+static const FfxCpuTexture2D<FfxFloat32x2>              r_dilated_motion_vectors(FSR3UPSCALER_BIND_SRV_DILATED_MOTION_VECTORS);
+
+FfxFloat32x2 LoadDilatedMotionVector(FfxUInt32x2 iPxInput)
+{
+    return r_dilated_motion_vectors[iPxInput];
+}
+
+FfxFloat32x2 SampleDilatedMotionVector(FfxFloat32x2 fUV)
+{
+    return r_dilated_motion_vectors.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_DILATED_DEPTH)
+static const FfxCpuTexture2D<FfxFloat32>                r_dilated_depth(FSR3UPSCALER_BIND_SRV_DILATED_DEPTH);
+
+FfxFloat32 LoadDilatedDepth(FfxUInt32x2 iPxInput)
+{
+    return r_dilated_depth[iPxInput];
+}
+
+FfxFloat32 SampleDilatedDepth(FfxFloat32x2 fUV)
+{
+    return r_dilated_depth.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_INPUT_EXPOSURE)
+static const FfxCpuTexture2D<FfxFloat32x2>              r_input_exposure(FSR3UPSCALER_BIND_SRV_INPUT_EXPOSURE);
+
+FfxFloat32 Exposure()
+{
+    FfxFloat32 exposure = r_input_exposure[FfxUInt32x2(0, 0)].x;
+
+#if defined(__XBOX_SCARLETT)
+    if (exposure < 0.000030517578/** 2^-15 */) {
+        exposure = 1.0f;
+    }
+#else
+    if (exposure == 0.0f) {
+        exposure = 1.0f;
+    }
+#endif // #if defined(__XBOX_SCARLETT)
+
+    return exposure;
+}
+#endif
+
+// BEGIN: FSR3UPSCALER_BIND_SRV_LANCZOS_LUT
+#if defined(FSR3UPSCALER_BIND_SRV_LANCZOS_LUT)
+static const FfxCpuTexture2D<FfxFloat32>                r_lanczos_lut(FSR3UPSCALER_BIND_SRV_LANCZOS_LUT);
+#endif
+
+FfxFloat32 SampleLanczos2Weight(FfxFloat32 x)
+{
+#if defined(FSR3UPSCALER_BIND_SRV_LANCZOS_LUT)
+    return r_lanczos_lut.SampleLevel(s_LinearClamp, FfxFloat32x2(x / 2, 0.5f), 0);
+#else
+    return 0.f;
+#endif
+}
+// END: FSR3UPSCALER_BIND_SRV_LANCZOS_LUT
+
+#if defined(FSR3UPSCALER_BIND_SRV_DILATED_REACTIVE_MASKS)
+static const FfxCpuTexture2D<unorm FfxFloat32x4>        r_dilated_reactive_masks(FSR3UPSCALER_BIND_SRV_DILATED_REACTIVE_MASKS);
+
+FfxFloat32x4 SampleDilatedReactiveMasks(FfxFloat32x2 fUV)
+{
+    return r_dilated_reactive_masks.SampleLevel(s_LinearClamp, fUV, 0);
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_DILATED_REACTIVE_MASKS)
+static const FfxCpuRWTexture2D<unorm FfxFloat32x4>      rw_dilated_reactive_masks(FSR3UPSCALER_BIND_UAV_DILATED_REACTIVE_MASKS);
+
+void StoreDilatedReactiveMasks(FFX_PARAMETER_IN FfxUInt32x2 iPxPos, FFX_PARAMETER_IN FfxFloat32x4 fDilatedReactiveMasks)
+{
+    rw_dilated_reactive_masks[iPxPos] = fDilatedReactiveMasks;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_INPUT_OPAQUE_ONLY)
+static const FfxCpuTexture2D<FfxFloat32x4>              r_input_opaque_only(FSR3UPSCALER_BIND_SRV_INPUT_OPAQUE_ONLY);
+
+FfxFloat32x3 LoadOpaqueOnly(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos)
+{
+    return r_input_opaque_only[iPxPos].xyz;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_PREV_PRE_ALPHA_COLOR)
+static const FfxCpuTexture2D<float3>                    r_input_prev_color_pre_alpha(FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_PREV_PRE_ALPHA_COLOR);
+
+FfxFloat32x3 LoadPrevPreAlpha(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos)
+{
+    return r_input_prev_color_pre_alpha[iPxPos];
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_PREV_POST_ALPHA_COLOR)
+static const FfxCpuTexture2D<float3>                    r_input_prev_color_post_alpha(FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_PREV_POST_ALPHA_COLOR);
+
+FfxFloat32x3 LoadPrevPostAlpha(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos)
+{
+    return r_input_prev_color_post_alpha[iPxPos];
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_AUTOREACTIVE) && \
+    defined(FSR3UPSCALER_BIND_UAV_AUTOCOMPOSITION)
+
+static const FfxCpuRWTexture2D<float>                   rw_output_autoreactive(FSR3UPSCALER_BIND_UAV_AUTOREACTIVE);
+static const FfxCpuRWTexture2D<float>                   rw_output_autocomposition(FSR3UPSCALER_BIND_UAV_AUTOCOMPOSITION);
+
+void StoreAutoReactive(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos, FFX_PARAMETER_IN FFX_MIN16_F2 fReactive)
+{
+    rw_output_autoreactive[iPxPos] = fReactive.x;
+
+    rw_output_autocomposition[iPxPos] = fReactive.y;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_PREV_PRE_ALPHA_COLOR)
+static const FfxCpuRWTexture2D<float3>                  rw_output_prev_color_pre_alpha(FSR3UPSCALER_BIND_UAV_PREV_PRE_ALPHA_COLOR);
+
+void StorePrevPreAlpha(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos, FFX_PARAMETER_IN FFX_MIN16_F3 color)
+{
+    rw_output_prev_color_pre_alpha[iPxPos] = color;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_PREV_POST_ALPHA_COLOR)
+static const FfxCpuRWTexture2D<float3>                  rw_output_prev_color_post_alpha(FSR3UPSCALER_BIND_UAV_PREV_POST_ALPHA_COLOR);
+
+void StorePrevPostAlpha(FFX_PARAMETER_IN FFX_MIN16_I2 iPxPos, FFX_PARAMETER_IN FFX_MIN16_F3 color)
+{
+    rw_output_prev_color_post_alpha[iPxPos] = color;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_FRAME_INFO)
+static const FfxCpuRWTexture2D<FfxFloat32x4>            rw_frame_info(FSR3UPSCALER_BIND_UAV_FRAME_INFO);
+
+FfxFloat32x4 LoadFrameInfo()
+{
+    return rw_frame_info[FfxInt32x2(0, 0)];
+}
+
+void StoreFrameInfo(FfxFloat32x4 fInfo)
+{
+    rw_frame_info[FfxInt32x2(0, 0)] = fInfo;
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_SRV_FRAME_INFO)
+static const FfxCpuTexture2D<FfxFloat32x4>              r_frame_info(FSR3UPSCALER_BIND_SRV_FRAME_INFO);
+
+FfxFloat32x4 FrameInfo()
+{
+    return r_frame_info[FfxInt32x2(0, 0)];
+}
+#endif
+
+#if defined(FSR3UPSCALER_BIND_UAV_SPD_MIPS_LEVEL_0)    && \
+    defined(FSR3UPSCALER_BIND_UAV_SPD_MIPS_LEVEL_1)    && \
+    defined(FSR3UPSCALER_BIND_UAV_SPD_MIPS_LEVEL_2)    && \
+    defined(FSR3UPSCALER_BIND_UAV_SPD_MIPS_LEVEL_3)    && \
+    defined(FSR3UPSCALER_BIND_UAV_SPD_MIPS_LEVEL_4)    && \
+    defined(FSR3UPSCALER_BIND_UAV_SPD_MIPS_LEVEL_5)
+
+static const FfxCpuRWTexture2D<FfxFloat32x2>            rw_spd_mip0(FSR3UPSCALER_BIND_UAV_SPD_MIPS_LEVEL_0);
+static const FfxCpuRWTexture2D<FfxFloat32x2>            rw_spd_mip1(FSR3UPSCALER_BIND_UAV_SPD_MIPS_LEVEL_1);
+static const FfxCpuRWTexture2D<FfxFloat32x2>            rw_spd_mip2(FSR3UPSCALER_BIND_UAV_SPD_MIPS_LEVEL_2);
+static const FfxCpuRWTexture2D<FfxFloat32x2>            rw_spd_mip3(FSR3UPSCALER_BIND_UAV_SPD_MIPS_LEVEL_3);
+static const FfxCpuRWTexture2D<FfxFloat32x2>            rw_spd_mip4(FSR3UPSCALER_BIND_UAV_SPD_MIPS_LEVEL_4);
+static const FfxCpuRWTexture2D<FfxFloat32x2>            rw_spd_mip5(FSR3UPSCALER_BIND_UAV_SPD_MIPS_LEVEL_5);
+
+FfxFloat32x2 RWLoadPyramid(FFX_PARAMETER_IN FfxInt32x2 iPxPos, FFX_PARAMETER_IN FfxUInt32 index)
+{
+#define LOAD(idx)                                 \
+            if (index == idx)                             \
+            {                                             \
+                return rw_spd_mip##idx[iPxPos]; \
+            }
+    LOAD(0);
+    LOAD(1);
+    LOAD(2);
+    LOAD(3);
+    LOAD(4);
+    LOAD(5);
+
+    return 0;
+
+#undef LOAD
+}
+
+void StorePyramid(FFX_PARAMETER_IN FfxInt32x2 iPxPos, FFX_PARAMETER_IN FfxFloat32x2 outValue, FFX_PARAMETER_IN FfxUInt32 index)
+{
+#define STORE(idx)                   \
+            if (index == idx)                \
+            {                                \
+                rw_spd_mip##idx[iPxPos] = outValue; \
+            }
+
+    STORE(0);
+    STORE(1);
+    STORE(2);
+    STORE(3);
+    STORE(4);
+    STORE(5);
+
+#undef STORE
+}
+#endif
+
+#if defined FSR3UPSCALER_BIND_UAV_SPD_GLOBAL_ATOMIC
+static const FfxCpuRWTexture2D<FfxUInt32>               rw_spd_global_atomic(FSR3UPSCALER_BIND_UAV_SPD_GLOBAL_ATOMIC);
+
+void SPD_IncreaseAtomicCounter(inout FfxUInt32 spdCounter)
+{
+    InterlockedAdd(rw_spd_global_atomic[FfxInt32x2(0, 0)], 1, spdCounter);
+}
+
+void SPD_ResetAtomicCounter()
+{
+    rw_spd_global_atomic[FfxInt32x2(0, 0)] = 0;
+}
+#endif
+
+#endif // #if defined(FFX_GPU)
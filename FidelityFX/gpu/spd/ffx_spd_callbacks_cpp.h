@@ -0,0 +1,137 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "ffx_spd_resources.h"
+
+#if defined(FFX_GPU)
+#include "ffx_core.h"
+
+struct cbSPD
+{
+    FfxUInt32       mips;
+    FfxUInt32       numWorkGroups;
+    FfxUInt32x2     workGroupOffset;
+    FfxFloat32x2    invInputSize;       // Only used for linear sampling mode
+    FfxFloat32x2    padding;
+
+   #define FFX_SPD_CONSTANT_BUFFER_1_SIZE 8  // Number of 32-bit values. This must be kept in sync with the cbSPD size.
+};
+
+static_assert(sizeof(cbSPD) == FFX_SPD_CONSTANT_BUFFER_1_SIZE * sizeof(FfxUInt32), "cbSPD must match the layout of the HLSL constant buffer.");
+
+#if defined(FFX_SPD_BIND_CB_SPD)
+    static const FfxCpuConstantBuffer<cbSPD> cb_spd(FFX_SPD_BIND_CB_SPD);
+#else
+    static const FfxCpuConstantBuffer<cbSPD> cb_spd;
+#endif
+
+FfxUInt32 Mips()
+{
+    return cb_spd->mips;
+}
+
+FfxUInt32 NumWorkGroups()
+{
+    return cb_spd->numWorkGroups;
+}
+
+FfxUInt32x2  WorkGroupOffset()
+{
+    return cb_spd->workGroupOffset;
+}
+
+FfxFloat32x2 InvInputSize()
+{
+    return cb_spd->invInputSize;
+}
+
+static const FfxCpuSamplerState s_LinearClamp = { FFX_CPU_SAMPLER_FILTER_LINEAR };
+
+    // SRVs
+    #if defined(FFX_SPD_BIND_SRV_INPUT_DOWNSAMPLE_SRC)
+        static const FfxCpuTexture2DArray<FfxFloat32x4>         r_input_downsample_src(FFX_SPD_BIND_SRV_INPUT_DOWNSAMPLE_SRC);
+    #endif
+
+    // UAV declarations
+    #if defined(FFX_SPD_BIND_UAV_INTERNAL_GLOBAL_ATOMIC)
+        struct SpdGlobalAtomicBuffer { FfxUInt32 counter[6]; };
+        static const FfxCpuRWStructuredBuffer<SpdGlobalAtomicBuffer> rw_internal_global_atomic(FFX_SPD_BIND_UAV_INTERNAL_GLOBAL_ATOMIC);
+    #endif
+    #if defined(FFX_SPD_BIND_UAV_INPUT_DOWNSAMPLE_SRC_MID_MIPMAP)
+        static const FfxCpuRWTexture2DArray<FfxFloat32x4>       rw_input_downsample_src_mid_mip(FFX_SPD_BIND_UAV_INPUT_DOWNSAMPLE_SRC_MID_MIPMAP);
+    #endif
+    #if defined(FFX_SPD_BIND_UAV_INPUT_DOWNSAMPLE_SRC_MIPS)
+        static const FfxCpuResourceArray<FfxCpuRWTexture2DArray<FfxFloat32x4>, SPD_MAX_MIP_LEVELS+1> rw_input_downsample_src_mips(FFX_SPD_BIND_UAV_INPUT_DOWNSAMPLE_SRC_MIPS);
+    #endif
+
+#if defined(FFX_SPD_BIND_SRV_INPUT_DOWNSAMPLE_SRC)
+    FfxFloat32x4 SampleSrcImage(FfxInt32x2 uv, FfxUInt32 slice)
+    {
+        FfxFloat32x2 textureCoord = FfxFloat32x2(uv) * InvInputSize() + InvInputSize();
+        FfxFloat32x4 result = r_input_downsample_src.SampleLevel(s_LinearClamp, FfxFloat32x3(textureCoord, slice), 0);
+        return FfxFloat32x4(ffxSrgbFromLinear(result.x), ffxSrgbFromLinear(result.y), ffxSrgbFromLinear(result.z), result.w);
+    }
+#endif // defined(FFX_SPD_BIND_SRV_INPUT_DOWNSAMPLE_SRC)
+
+#if defined(FFX_SPD_BIND_UAV_INPUT_DOWNSAMPLE_SRC_MIPS)
+    FfxFloat32x4 LoadSrcImage(FfxInt32x2 uv, FfxUInt32 slice)
+    {
+        return rw_input_downsample_src_mips[0][FfxUInt32x3(uv, slice)];
+    }
+#endif // defined(FFX_SPD_BIND_UAV_INPUT_DOWNSAMPLE_SRC_MIPS)
+
+#if defined(FFX_SPD_BIND_UAV_INPUT_DOWNSAMPLE_SRC_MIPS)
+    void StoreSrcMip(FfxFloat32x4 value, FfxInt32x2 uv, FfxUInt32 slice, FfxUInt32 mip)
+    {
+        rw_input_downsample_src_mips[mip][FfxUInt32x3(uv, slice)] = value;
+    }
+#endif // defined(FFX_SPD_BIND_UAV_INPUT_DOWNSAMPLE_SRC_MIPS)
+
+#if defined(FFX_SPD_BIND_UAV_INPUT_DOWNSAMPLE_SRC_MID_MIPMAP)
+    FfxFloat32x4 LoadMidMip(FfxInt32x2 uv, FfxUInt32 slice)
+    {
+        return rw_input_downsample_src_mid_mip[FfxUInt32x3(uv, slice)];
+    }
+#endif // defined(FFX_SPD_BIND_UAV_INPUT_DOWNSAMPLE_SRC_MID_MIPMAP)
+
+#if defined(FFX_SPD_BIND_UAV_INPUT_DOWNSAMPLE_SRC_MID_MIPMAP)
+    void StoreMidMip(FfxFloat32x4 value, FfxInt32x2 uv, FfxUInt32 slice)
+    {
+        rw_input_downsample_src_mid_mip[FfxUInt32x3(uv, slice)] = value;
+    }
+#endif // defined(FFX_SPD_BIND_UAV_INPUT_DOWNSAMPLE_SRC_MID_MIPMAP)
+
+#if defined(FFX_SPD_BIND_UAV_INTERNAL_GLOBAL_ATOMIC)
+void IncreaseAtomicCounter(FFX_PARAMETER_IN FfxUInt32 slice, FFX_PARAMETER_INOUT FfxUInt32 counter)
+{
+    InterlockedAdd(rw_internal_global_atomic[0].counter[slice], 1, counter);
+}
+#endif // defined(FFX_SPD_BIND_UAV_INTERNAL_GLOBAL_ATOMIC)
+
+#if defined(FFX_SPD_BIND_UAV_INTERNAL_GLOBAL_ATOMIC)
+void ResetAtomicCounter(FFX_PARAMETER_IN FfxUInt32 slice)
+{
+    rw_internal_global_atomic[0].counter[slice] = 0;
+}
+#endif // defined(FFX_SPD_BIND_UAV_INTERNAL_GLOBAL_ATOMIC)
+
+#endif // #if defined(FFX_GPU)
@@ -72,14 +72,17 @@ static FfxShaderBlob blurGetBlurPassPermutationBlobByKernelSize(
     // rw_output                             UAV  float4          2d             u0      1 
     // cbBLUR                            cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbBLUR" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbBLUR") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_input_src" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_src") };
     static const uint32_t boundSRVTextures[] = { 0 };
     static const uint32_t boundSRVTextureCounts[] = { 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0 };
     static const char* boundUAVTextureNames[] = { "rw_output" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_output") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -97,14 +100,17 @@ static FfxShaderBlob blurGetBlurPassPermutationBlobByKernelSize(
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -53,14 +53,17 @@ static FfxShaderBlob casGetSharpenPassPermutationBlobByIndex(uint32_t permutatio
     // rw_output_color                       UAV  float4          2d             u0      1 
     // cbCAS                             cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbCAS" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbCAS") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_input_color" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_color") };
     static const uint32_t boundSRVTextures[] = { 0 };
     static const uint32_t boundSRVTextureCounts[] = { 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0 };
     static const char* boundUAVTextureNames[] = { "rw_output_color" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_output_color") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -78,14 +81,17 @@ static FfxShaderBlob casGetSharpenPassPermutationBlobByIndex(uint32_t permutatio
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
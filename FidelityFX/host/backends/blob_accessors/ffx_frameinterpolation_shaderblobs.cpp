@@ -85,14 +85,17 @@ static FfxShaderBlob FrameInterpolationGetReconstructAndDilatePermutationBlobByI
     // rw_dilated_depth                             UAV   float          2d             u2      1 
     // cbFI                                     cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFI" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFI") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_input_motion_vectors", "r_input_depth" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_motion_vectors"), ffxHashBindingName("r_input_depth") };
     static const uint32_t boundSRVTextures[] = { 0, 1 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_reconstructed_depth_previous_frame", "rw_dilated_motion_vectors", "rw_dilated_depth" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_reconstructed_depth_previous_frame"), ffxHashBindingName("rw_dilated_motion_vectors"), ffxHashBindingName("rw_dilated_depth") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0 };
@@ -110,14 +113,17 @@ static FfxShaderBlob FrameInterpolationGetReconstructAndDilatePermutationBlobByI
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -145,14 +151,17 @@ static FfxShaderBlob FrameInterpolationGetSetupPermutationBlobByIndex(uint32_t p
     // rw_counters                                  UAV    uint          2d             u5      1 
     // cbFI                                     cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFI" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFI") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_optical_flow_scd" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_optical_flow_scd") };
     static const uint32_t boundSRVTextures[] = { 0 };
     static const uint32_t boundSRVTextureCounts[] = { 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0 };
     static const char* boundUAVTextureNames[] = { "rw_game_motion_vector_field_x", "rw_game_motion_vector_field_y", "rw_optical_flow_motion_vector_field_x", "rw_optical_flow_motion_vector_field_y", "rw_disocclusion_mask", "rw_counters" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_game_motion_vector_field_x"), ffxHashBindingName("rw_game_motion_vector_field_y"), ffxHashBindingName("rw_optical_flow_motion_vector_field_x"), ffxHashBindingName("rw_optical_flow_motion_vector_field_y"), ffxHashBindingName("rw_disocclusion_mask"), ffxHashBindingName("rw_counters") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2, 3, 4, 5 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1, 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0, 0, 0, 0 };
@@ -170,14 +179,17 @@ static FfxShaderBlob FrameInterpolationGetSetupPermutationBlobByIndex(uint32_t p
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -205,14 +217,17 @@ static FfxShaderBlob FrameInterpolationGetGameMotionVectorFieldPermutationBlobBy
     // rw_game_motion_vector_field_y          UAV    uint          2d             u1      1 
     // cbFI                               cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFI" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFI") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_dilated_motion_vectors", "r_dilated_depth", "r_previous_interpolation_source", "r_current_interpolation_source", "r_input_distortion_field" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_dilated_motion_vectors"), ffxHashBindingName("r_dilated_depth"), ffxHashBindingName("r_previous_interpolation_source"), ffxHashBindingName("r_current_interpolation_source"), ffxHashBindingName("r_input_distortion_field") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2, 3, 4 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_game_motion_vector_field_x", "rw_game_motion_vector_field_y" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_game_motion_vector_field_x"), ffxHashBindingName("rw_game_motion_vector_field_y") };
     static const uint32_t boundUAVTextures[] = { 0, 1 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0 };
@@ -230,14 +245,17 @@ static FfxShaderBlob FrameInterpolationGetGameMotionVectorFieldPermutationBlobBy
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -263,14 +281,17 @@ static FfxShaderBlob FrameInterpolationGetOpticalFlowVectorFieldPermutationBlobB
     // rw_optical_flow_motion_vector_field_y        UAV    uint          2d             u1      1 
     // cbFI                                     cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFI" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFI") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_optical_flow", "r_previous_interpolation_source", "r_current_interpolation_source" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_optical_flow"), ffxHashBindingName("r_previous_interpolation_source"), ffxHashBindingName("r_current_interpolation_source") };
     static const uint32_t boundSRVTextures[] = { 0, 3, 4 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_optical_flow_motion_vector_field_x", "rw_optical_flow_motion_vector_field_y" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_optical_flow_motion_vector_field_x"), ffxHashBindingName("rw_optical_flow_motion_vector_field_y") };
     static const uint32_t boundUAVTextures[] = { 0, 1 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0 };
@@ -288,14 +309,17 @@ static FfxShaderBlob FrameInterpolationGetOpticalFlowVectorFieldPermutationBlobB
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -320,14 +344,17 @@ static FfxShaderBlob FrameInterpolationGetReconstructPrevDepthPermutationBlobByI
     // rw_reconstructed_depth_interpolated_frame        UAV    uint          2d             u0      1 
     // cbFI                                         cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFI" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFI") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_dilated_motion_vectors", "r_dilated_depth", "r_input_distortion_field" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_dilated_motion_vectors"), ffxHashBindingName("r_dilated_depth"), ffxHashBindingName("r_input_distortion_field") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 3 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 1 };
     static const char* boundUAVTextureNames[] = { "rw_reconstructed_depth_interpolated_frame" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_reconstructed_depth_interpolated_frame") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -345,14 +372,17 @@ static FfxShaderBlob FrameInterpolationGetReconstructPrevDepthPermutationBlobByI
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -381,14 +411,17 @@ static FfxShaderBlob FrameInterpolationGetDisocclusionMaskPermutationBlobByIndex
     // rw_disocclusion_mask                            UAV  float2          2d             u0      1 
     // cbFI                                        cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFI" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFI") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_game_motion_vector_field_x", "r_game_motion_vector_field_y", "r_reconstructed_depth_previous_frame", "r_dilated_depth", "r_reconstructed_depth_interpolated_frame", "r_inpainting_pyramid", "r_input_distortion_field" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_game_motion_vector_field_x"), ffxHashBindingName("r_game_motion_vector_field_y"), ffxHashBindingName("r_reconstructed_depth_previous_frame"), ffxHashBindingName("r_dilated_depth"), ffxHashBindingName("r_reconstructed_depth_interpolated_frame"), ffxHashBindingName("r_inpainting_pyramid"), ffxHashBindingName("r_input_distortion_field") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2, 3, 4, 5, 6 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1, 1, 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0, 0, 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_disocclusion_mask" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_disocclusion_mask") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -406,14 +439,17 @@ static FfxShaderBlob FrameInterpolationGetDisocclusionMaskPermutationBlobByIndex
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -449,14 +485,17 @@ static FfxShaderBlob FrameInterpolationGetComputeInpaintingPyramidPassPermutatio
     // cbFI                              cbuffer      NA          NA            cb0      1 
     // cbInpaintingPyramid               cbuffer      NA          NA            cb1      1 
     static const char* boundConstantBufferNames[] = { "cbFI", "cbInpaintingPyramid" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFI"), ffxHashBindingName("cbInpaintingPyramid") };
     static const uint32_t boundConstantBuffers[] = { 0, 1 };
     static const uint32_t boundConstantBufferCounts[] = { 1, 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0, 0 };
     static const char* boundSRVTextureNames[] = { "r_output" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_output") };
     static const uint32_t boundSRVTextures[] = { 0 };
     static const uint32_t boundSRVTextureCounts[] = { 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0 };
     static const char* boundUAVTextureNames[] = { "rw_counters", "rw_inpainting_pyramid0", "rw_inpainting_pyramid1", "rw_inpainting_pyramid2", "rw_inpainting_pyramid3", "rw_inpainting_pyramid4", "rw_inpainting_pyramid5", "rw_inpainting_pyramid6", "rw_inpainting_pyramid7", "rw_inpainting_pyramid8", "rw_inpainting_pyramid9", "rw_inpainting_pyramid10", "rw_inpainting_pyramid11" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_counters"), ffxHashBindingName("rw_inpainting_pyramid0"), ffxHashBindingName("rw_inpainting_pyramid1"), ffxHashBindingName("rw_inpainting_pyramid2"), ffxHashBindingName("rw_inpainting_pyramid3"), ffxHashBindingName("rw_inpainting_pyramid4"), ffxHashBindingName("rw_inpainting_pyramid5"), ffxHashBindingName("rw_inpainting_pyramid6"), ffxHashBindingName("rw_inpainting_pyramid7"), ffxHashBindingName("rw_inpainting_pyramid8"), ffxHashBindingName("rw_inpainting_pyramid9"), ffxHashBindingName("rw_inpainting_pyramid10"), ffxHashBindingName("rw_inpainting_pyramid11") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
@@ -474,14 +513,17 @@ static FfxShaderBlob FrameInterpolationGetComputeInpaintingPyramidPassPermutatio
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -542,14 +584,17 @@ static FfxShaderBlob FrameInterpolationGetFiPassPermutationBlobByIndex(uint32_t
     // rw_output                                   UAV  float4          2d             u0      1 
     // cbFI                                    cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFI" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFI") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_game_motion_vector_field_x", "r_game_motion_vector_field_y", "r_optical_flow_motion_vector_field_x", "r_optical_flow_motion_vector_field_y", "r_previous_interpolation_source", "r_current_interpolation_source", "r_disocclusion_mask", "r_inpainting_pyramid", "r_counters" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_game_motion_vector_field_x"), ffxHashBindingName("r_game_motion_vector_field_y"), ffxHashBindingName("r_optical_flow_motion_vector_field_x"), ffxHashBindingName("r_optical_flow_motion_vector_field_y"), ffxHashBindingName("r_previous_interpolation_source"), ffxHashBindingName("r_current_interpolation_source"), ffxHashBindingName("r_disocclusion_mask"), ffxHashBindingName("r_inpainting_pyramid"), ffxHashBindingName("r_counters") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_output" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_output") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -567,14 +612,17 @@ static FfxShaderBlob FrameInterpolationGetFiPassPermutationBlobByIndex(uint32_t
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -611,14 +659,17 @@ static FfxShaderBlob FrameInterpolationGetComputeGameVectorFieldInpaintingPyrami
     // cbFI                              cbuffer      NA          NA            cb0      1 
     // cbInpaintingPyramid               cbuffer      NA          NA            cb1      1 
     static const char* boundConstantBufferNames[] = { "cbFI", "cbInpaintingPyramid" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFI"), ffxHashBindingName("cbInpaintingPyramid") };
     static const uint32_t boundConstantBuffers[] = { 0, 1 };
     static const uint32_t boundConstantBufferCounts[] = { 1, 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0, 0 };
     static const char* boundSRVTextureNames[] = { "r_game_motion_vector_field_x", "r_game_motion_vector_field_y" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_game_motion_vector_field_x"), ffxHashBindingName("r_game_motion_vector_field_y") };
     static const uint32_t boundSRVTextures[] = { 0, 1 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_counters", "rw_inpainting_pyramid0", "rw_inpainting_pyramid1", "rw_inpainting_pyramid2", "rw_inpainting_pyramid3", "rw_inpainting_pyramid4", "rw_inpainting_pyramid5", "rw_inpainting_pyramid6", "rw_inpainting_pyramid7", "rw_inpainting_pyramid8", "rw_inpainting_pyramid9", "rw_inpainting_pyramid10", "rw_inpainting_pyramid11" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_counters"), ffxHashBindingName("rw_inpainting_pyramid0"), ffxHashBindingName("rw_inpainting_pyramid1"), ffxHashBindingName("rw_inpainting_pyramid2"), ffxHashBindingName("rw_inpainting_pyramid3"), ffxHashBindingName("rw_inpainting_pyramid4"), ffxHashBindingName("rw_inpainting_pyramid5"), ffxHashBindingName("rw_inpainting_pyramid6"), ffxHashBindingName("rw_inpainting_pyramid7"), ffxHashBindingName("rw_inpainting_pyramid8"), ffxHashBindingName("rw_inpainting_pyramid9"), ffxHashBindingName("rw_inpainting_pyramid10"), ffxHashBindingName("rw_inpainting_pyramid11") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
@@ -636,14 +687,17 @@ static FfxShaderBlob FrameInterpolationGetComputeGameVectorFieldInpaintingPyrami
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -699,14 +753,17 @@ static FfxShaderBlob FrameInterpolationGetInpaintingPassPermutationBlobByIndex(u
     // rw_output                             UAV  float4          2d             u0      1 
     // cbFI                              cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFI" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFI") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_optical_flow_scd", "r_inpainting_pyramid", "r_present_backbuffer", "r_current_interpolation_source" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_optical_flow_scd"), ffxHashBindingName("r_inpainting_pyramid"), ffxHashBindingName("r_present_backbuffer"), ffxHashBindingName("r_current_interpolation_source") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2, 3 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_output" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_output") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -724,14 +781,17 @@ static FfxShaderBlob FrameInterpolationGetInpaintingPassPermutationBlobByIndex(u
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -762,14 +822,17 @@ static FfxShaderBlob FrameInterpolationGetDebugViewPassPermutationBlobByIndex(ui
     // rw_output                                   UAV  float4          2d             u0      1 
     // cbFI                                    cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFI" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFI") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_game_motion_vector_field_x", "r_game_motion_vector_field_y", "r_optical_flow_motion_vector_field_x", "r_optical_flow_motion_vector_field_y", "r_disocclusion_mask", "r_present_backbuffer", "r_inpainting_pyramid", "r_current_interpolation_source", "r_input_distortion_field" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_game_motion_vector_field_x"), ffxHashBindingName("r_game_motion_vector_field_y"), ffxHashBindingName("r_optical_flow_motion_vector_field_x"), ffxHashBindingName("r_optical_flow_motion_vector_field_y"), ffxHashBindingName("r_disocclusion_mask"), ffxHashBindingName("r_present_backbuffer"), ffxHashBindingName("r_inpainting_pyramid"), ffxHashBindingName("r_current_interpolation_source"), ffxHashBindingName("r_input_distortion_field") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_output" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_output") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -787,14 +850,17 @@ static FfxShaderBlob FrameInterpolationGetDebugViewPassPermutationBlobByIndex(ui
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
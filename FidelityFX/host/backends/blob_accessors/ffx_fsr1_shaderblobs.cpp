@@ -45,14 +45,17 @@ static FfxShaderBlob fsr1GetEasuPassPermutationBlobByIndex(uint32_t permutationO
     // rw_internal_upscaled_color            UAV  float4          2d             u0      1 
     // cbFSR1                            cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFSR1" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR1") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_input_color" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_color") };
     static const uint32_t boundSRVTextures[] = { 0 };
     static const uint32_t boundSRVTextureCounts[] = { 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0 };
     static const char* boundUAVTextureNames[2][1] = { { "rw_upscaled_output" }, { "rw_internal_upscaled_color" } };
+    static const uint32_t boundUAVTextureNameHashes[2][1] = { { ffxHashBindingName("rw_upscaled_output") }, { ffxHashBindingName("rw_internal_upscaled_color") } };
     static const uint32_t boundUAVTextures[2][1] = { { 1 }, { 0 } };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -70,14 +73,17 @@ static FfxShaderBlob fsr1GetEasuPassPermutationBlobByIndex(uint32_t permutationO
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames[APPLY_RCAS],
+        boundUAVTextureNameHashes[APPLY_RCAS],
         boundUAVTextures[APPLY_RCAS],
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -98,14 +104,17 @@ static FfxShaderBlob fsr1GetRcasPassPermutationBlobByIndex(uint32_t permutationO
     // rw_upscaled_output                    UAV  float4          2d             u0      1 
     // cbFSR1                            cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFSR1" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR1") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_internal_upscaled_color" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_internal_upscaled_color") };
     static const uint32_t boundSRVTextures[] = { 0 };
     static const uint32_t boundSRVTextureCounts[] = { 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0 };
     static const char* boundUAVTextureNames[] = { "rw_upscaled_output" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_upscaled_output") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -123,14 +132,17 @@ static FfxShaderBlob fsr1GetRcasPassPermutationBlobByIndex(uint32_t permutationO
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -71,14 +71,17 @@ static FfxShaderBlob fsr2GetTcrAutogenPassPermutationBlobByIndex(uint32_t permut
     // cbFSR2                                 cbuffer      NA          NA            cb0      1 
     // cbGenerateReactive                     cbuffer      NA          NA            cb1      1 
     static const char* boundConstantBufferNames[] = { "cbFSR2", "cbGenerateReactive"};
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR2"), ffxHashBindingName("cbGenerateReactive")};
     static const uint32_t boundConstantBuffers[] = { 0, 1 };
     static const uint32_t boundConstantBufferCounts[] = { 1, 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0, 0 };
     static const char* boundSRVTextureNames[] = { "r_input_opaque_only", "r_input_color_jittered", "r_input_motion_vectors", "r_reactive_mask", "r_transparency_and_composition_mask", "r_input_prev_color_pre_alpha", "r_input_prev_color_post_alpha" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_opaque_only"), ffxHashBindingName("r_input_color_jittered"), ffxHashBindingName("r_input_motion_vectors"), ffxHashBindingName("r_reactive_mask"), ffxHashBindingName("r_transparency_and_composition_mask"), ffxHashBindingName("r_input_prev_color_pre_alpha"), ffxHashBindingName("r_input_prev_color_post_alpha") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2, 4, 5, 46, 47 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1, 1, 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0, 0, 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_output_autoreactive", "rw_output_autocomposition", "rw_output_prev_color_pre_alpha", "rw_output_prev_color_post_alpha" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_output_autoreactive"), ffxHashBindingName("rw_output_autocomposition"), ffxHashBindingName("rw_output_prev_color_pre_alpha"), ffxHashBindingName("rw_output_prev_color_post_alpha") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2, 3 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0, 0 };
@@ -96,14 +99,17 @@ static FfxShaderBlob fsr2GetTcrAutogenPassPermutationBlobByIndex(uint32_t permut
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -138,14 +144,17 @@ static FfxShaderBlob fsr2GetDepthClipPassPermutationBlobByIndex(uint32_t permuta
     // rw_prepared_input_color                       UAV  float4          2d             u1      1 
     // cbFSR2                                    cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFSR2" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR2") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_reconstructed_previous_nearest_depth", "r_dilated_motion_vectors", "r_dilatedDepth", "r_reactive_mask", "r_transparency_and_composition_mask", "r_previous_dilated_motion_vectors", "r_input_motion_vectors", "r_input_color_jittered", "r_input_exposure" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_reconstructed_previous_nearest_depth"), ffxHashBindingName("r_dilated_motion_vectors"), ffxHashBindingName("r_dilatedDepth"), ffxHashBindingName("r_reactive_mask"), ffxHashBindingName("r_transparency_and_composition_mask"), ffxHashBindingName("r_previous_dilated_motion_vectors"), ffxHashBindingName("r_input_motion_vectors"), ffxHashBindingName("r_input_color_jittered"), ffxHashBindingName("r_input_exposure") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2, 3, 4, 5, 6, 7, 9 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_dilated_reactive_masks", "rw_prepared_input_color" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_dilated_reactive_masks"), ffxHashBindingName("rw_prepared_input_color") };
     static const uint32_t boundUAVTextures[] = { 0, 1 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0 };
@@ -163,14 +172,17 @@ static FfxShaderBlob fsr2GetDepthClipPassPermutationBlobByIndex(uint32_t permuta
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -202,14 +214,17 @@ static FfxShaderBlob fsr2GetReconstructPreviousDepthPassPermutationBlobByIndex(u
     // rw_lock_input_luma                             UAV   float          2d             u3      1 
     // cbFSR2                                     cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFSR2" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR2") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_input_motion_vectors", "r_input_depth", "r_input_color_jittered","r_input_exposure" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_motion_vectors"), ffxHashBindingName("r_input_depth"), ffxHashBindingName("r_input_color_jittered"),ffxHashBindingName("r_input_exposure") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2, 3 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_reconstructed_previous_nearest_depth", "rw_dilated_motion_vectors", "rw_dilatedDepth", "rw_lock_input_luma" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_reconstructed_previous_nearest_depth"), ffxHashBindingName("rw_dilated_motion_vectors"), ffxHashBindingName("rw_dilatedDepth"), ffxHashBindingName("rw_lock_input_luma") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2, 3 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0, 0 };
@@ -227,14 +242,17 @@ static FfxShaderBlob fsr2GetReconstructPreviousDepthPassPermutationBlobByIndex(u
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -261,14 +279,17 @@ static FfxShaderBlob fsr2GetLockPassPermutationBlobByIndex(uint32_t permutationO
     // rw_reconstructed_previous_nearest_depth        UAV    uint          2d             u1      1 
     // cbFSR2                                     cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFSR2" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR2") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_lock_input_luma" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_lock_input_luma") };
     static const uint32_t boundSRVTextures[] = { 0 };
     static const uint32_t boundSRVTextureCounts[] = { 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0 };
     static const char* boundUAVTextureNames[] = { "rw_new_locks", "rw_reconstructed_previous_nearest_depth" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_new_locks"), ffxHashBindingName("rw_reconstructed_previous_nearest_depth") };
     static const uint32_t boundUAVTextures[] = { 0, 1 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0 };
@@ -286,14 +307,17 @@ static FfxShaderBlob fsr2GetLockPassPermutationBlobByIndex(uint32_t permutationO
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -330,14 +354,17 @@ static FfxShaderBlob fsr2GetAccumulatePassPermutationBlobByIndex(uint32_t permut
     // rw_luma_history                       UAV  float4          2d             u4      1 
     // cbFSR2                            cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFSR2" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR2") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_input_exposure", "r_dilated_reactive_masks", "r_input_motion_vectors", "r_internal_upscaled_color", "r_lock_status", "r_prepared_input_color", "r_imgMips", "r_luma_history" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_exposure"), ffxHashBindingName("r_dilated_reactive_masks"), ffxHashBindingName("r_input_motion_vectors"), ffxHashBindingName("r_internal_upscaled_color"), ffxHashBindingName("r_lock_status"), ffxHashBindingName("r_prepared_input_color"), ffxHashBindingName("r_imgMips"), ffxHashBindingName("r_luma_history") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2, 3, 4, 5, 8, 10 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1, 1, 1, 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0, 0, 0, 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_internal_upscaled_color", "rw_lock_status", "rw_upscaled_output", "rw_new_locks", "rw_luma_history" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_internal_upscaled_color"), ffxHashBindingName("rw_lock_status"), ffxHashBindingName("rw_upscaled_output"), ffxHashBindingName("rw_new_locks"), ffxHashBindingName("rw_luma_history") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2, 3, 4 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0, 0, 0 };
@@ -355,14 +382,17 @@ static FfxShaderBlob fsr2GetAccumulatePassPermutationBlobByIndex(uint32_t permut
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -390,14 +420,17 @@ static FfxShaderBlob fsr2GetRCASPassPermutationBlobByIndex(uint32_t permutationO
     // cbFSR2                            cbuffer      NA          NA            cb0      1 
     // cbRCAS                            cbuffer      NA          NA            cb1      1 
     static const char* boundConstantBufferNames[] = { "cbFSR2", "cbRCAS" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR2"), ffxHashBindingName("cbRCAS") };
     static const uint32_t boundConstantBuffers[] = { 0, 1 };
     static const uint32_t boundConstantBufferCounts[] = { 1, 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0, 0 };
     static const char* boundSRVTextureNames[] = { "r_input_exposure", "r_rcas_input" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_exposure"), ffxHashBindingName("r_rcas_input") };
     static const uint32_t boundSRVTextures[] = { 0, 1 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_upscaled_output" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_upscaled_output") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -415,14 +448,17 @@ static FfxShaderBlob fsr2GetRCASPassPermutationBlobByIndex(uint32_t permutationO
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -452,14 +488,17 @@ static FfxShaderBlob fsr2GetComputeLuminancePyramidPassPermutationBlobByIndex(ui
     // cbFSR2                            cbuffer      NA          NA            cb0      1 
     // cbSPD                             cbuffer      NA          NA            cb1      1 
     static const char* boundConstantBufferNames[] = { "cbFSR2", "cbSPD" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR2"), ffxHashBindingName("cbSPD") };
     static const uint32_t boundConstantBuffers[] = { 0, 1 };
     static const uint32_t boundConstantBufferCounts[] = { 1, 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0, 0 };
     static const char* boundSRVTextureNames[] = { "r_input_color_jittered" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_color_jittered") };
     static const uint32_t boundSRVTextures[] = { 0 };
     static const uint32_t boundSRVTextureCounts[] = { 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0 };
     static const char* boundUAVTextureNames[] = {  "rw_spd_global_atomic", "rw_img_mip_shading_change", "rw_img_mip_5", "rw_auto_exposure" };
+    static const uint32_t boundUAVTextureNameHashes[] = {  ffxHashBindingName("rw_spd_global_atomic"), ffxHashBindingName("rw_img_mip_shading_change"), ffxHashBindingName("rw_img_mip_5"), ffxHashBindingName("rw_auto_exposure") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2, 3 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0, 0 };
@@ -477,14 +516,17 @@ static FfxShaderBlob fsr2GetComputeLuminancePyramidPassPermutationBlobByIndex(ui
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -513,14 +555,17 @@ static FfxShaderBlob fsr2GetAutogenReactivePassPermutationBlobByIndex(
     // rw_output_autoreactive                UAV   float          2d             u0      1 
     // cbGenerateReactive                cbuffer      NA          NA            cb1      1 
     static const char* boundConstantBufferNames[] = { "cbGenerateReactive" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbGenerateReactive") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_input_opaque_only", "r_input_color_jittered" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_opaque_only"), ffxHashBindingName("r_input_color_jittered") };
     static const uint32_t boundSRVTextures[] = { 0, 1 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_output_autoreactive" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_output_autoreactive") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -538,14 +583,17 @@ static FfxShaderBlob fsr2GetAutogenReactivePassPermutationBlobByIndex(
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
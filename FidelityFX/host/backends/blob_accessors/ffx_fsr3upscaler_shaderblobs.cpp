@@ -92,14 +92,17 @@ static FfxShaderBlob fsr3UpscalerGetPrepareReactivityPassPermutationBlobByIndex(
     // rw_accumulation                               UAV   float          2d             u2      1 
     // cbFSR3Upscaler                            cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFSR3Upscaler" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR3Upscaler") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_reconstructed_previous_nearest_depth", "r_dilated_motion_vectors", "r_dilated_depth", "r_reactive_mask", "r_transparency_and_composition_mask", "r_accumulation", "r_shading_change", "r_current_luma", "r_input_exposure" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_reconstructed_previous_nearest_depth"), ffxHashBindingName("r_dilated_motion_vectors"), ffxHashBindingName("r_dilated_depth"), ffxHashBindingName("r_reactive_mask"), ffxHashBindingName("r_transparency_and_composition_mask"), ffxHashBindingName("r_accumulation"), ffxHashBindingName("r_shading_change"), ffxHashBindingName("r_current_luma"), ffxHashBindingName("r_input_exposure") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_dilated_reactive_masks", "rw_new_locks", "rw_accumulation" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_dilated_reactive_masks"), ffxHashBindingName("rw_new_locks"), ffxHashBindingName("rw_accumulation") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0 };
@@ -117,14 +120,17 @@ static FfxShaderBlob fsr3UpscalerGetPrepareReactivityPassPermutationBlobByIndex(
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -150,14 +156,17 @@ static FfxShaderBlob fsr3UpscalerGetShadingChangePassPermutationBlobByIndex(uint
     // rw_shading_change                     UAV   float          2d             u0      1 
     // cbFSR3Upscaler                    cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFSR3Upscaler" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR3Upscaler") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_spd_mips" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_spd_mips") };
     static const uint32_t boundSRVTextures[] = { 0 };
     static const uint32_t boundSRVTextureCounts[] = { 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0 };
     static const char* boundUAVTextureNames[] = { "rw_shading_change" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_shading_change") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -175,14 +184,17 @@ static FfxShaderBlob fsr3UpscalerGetShadingChangePassPermutationBlobByIndex(uint
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -214,14 +226,17 @@ static FfxShaderBlob fsr3UpscalerGetPrepareInputsPassPermutationBlobByIndex(uint
     // rw_current_luma                                UAV   float          2d             u4      1 
     // cbFSR3Upscaler                             cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFSR3Upscaler" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR3Upscaler") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_input_motion_vectors", "r_input_depth", "r_input_color_jittered" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_motion_vectors"), ffxHashBindingName("r_input_depth"), ffxHashBindingName("r_input_color_jittered") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_dilated_motion_vectors", "rw_dilated_depth", "rw_reconstructed_previous_nearest_depth", "rw_farthest_depth", "rw_current_luma" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_dilated_motion_vectors"), ffxHashBindingName("rw_dilated_depth"), ffxHashBindingName("rw_reconstructed_previous_nearest_depth"), ffxHashBindingName("rw_farthest_depth"), ffxHashBindingName("rw_current_luma") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2, 3, 4 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0, 0, 0 };
@@ -239,14 +254,17 @@ static FfxShaderBlob fsr3UpscalerGetPrepareInputsPassPermutationBlobByIndex(uint
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -280,14 +298,17 @@ static FfxShaderBlob fsr3UpscalerGetAccumulatePassPermutationBlobByIndex(uint32_
     // rw_new_locks                          UAV   unorm          2d             u2      1 
     // cbFSR3Upscaler                    cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFSR3Upscaler" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR3Upscaler") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_input_exposure", "r_dilated_reactive_masks", "r_input_motion_vectors", "r_internal_upscaled_color", "r_farthest_depth_mip1", "r_luma_instability", "r_input_color_jittered" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_exposure"), ffxHashBindingName("r_dilated_reactive_masks"), ffxHashBindingName("r_input_motion_vectors"), ffxHashBindingName("r_internal_upscaled_color"), ffxHashBindingName("r_farthest_depth_mip1"), ffxHashBindingName("r_luma_instability"), ffxHashBindingName("r_input_color_jittered") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2, 3, 5, 7, 8 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1, 1, 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0, 0, 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_internal_upscaled_color", "rw_upscaled_output", "rw_new_locks" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_internal_upscaled_color"), ffxHashBindingName("rw_upscaled_output"), ffxHashBindingName("rw_new_locks") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0 };
@@ -305,14 +326,17 @@ static FfxShaderBlob fsr3UpscalerGetAccumulatePassPermutationBlobByIndex(uint32_
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -339,14 +363,17 @@ static FfxShaderBlob fsr3UpscalerGetRCASPassPermutationBlobByIndex(uint32_t perm
     // rw_upscaled_output                    UAV  float4          2d             u0      1 
     // cbRCAS                            cbuffer      NA          NA            cb1      1 
     static const char* boundConstantBufferNames[] = { "cbFSR3Upscaler" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR3Upscaler") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_input_exposure", "r_rcas_input" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_exposure"), ffxHashBindingName("r_rcas_input") };
     static const uint32_t boundSRVTextures[] = { 0, 1 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_upscaled_output" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_upscaled_output") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -364,14 +391,17 @@ static FfxShaderBlob fsr3UpscalerGetRCASPassPermutationBlobByIndex(uint32_t perm
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -402,14 +432,17 @@ static FfxShaderBlob fsr3UpscalerGetLumaPyramidPassPermutationBlobByIndex(uint32
     // cbFSR3Upscaler                    cbuffer      NA          NA            cb0      1 
     // cbSPD                             cbuffer      NA          NA            cb1      1 
     static const char* boundConstantBufferNames[] = { "cbFSR3Upscaler", "cbSPD" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR3Upscaler"), ffxHashBindingName("cbSPD") };
     static const uint32_t boundConstantBuffers[] = { 0, 1 };
     static const uint32_t boundConstantBufferCounts[] = { 1, 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0, 0 };
     static const char* boundSRVTextureNames[] = { "r_current_luma", "r_farthest_depth" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_current_luma"), ffxHashBindingName("r_farthest_depth") };
     static const uint32_t boundSRVTextures[] = { 0, 1 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_spd_global_atomic", "rw_frame_info", "rw_spd_mip5", "rw_farthest_depth_mip1" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_spd_global_atomic"), ffxHashBindingName("rw_frame_info"), ffxHashBindingName("rw_spd_mip5"), ffxHashBindingName("rw_farthest_depth_mip1") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 7, 8 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0, 0 };
@@ -427,14 +460,17 @@ static FfxShaderBlob fsr3UpscalerGetLumaPyramidPassPermutationBlobByIndex(uint32
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -491,14 +527,17 @@ static FfxShaderBlob fsr3UpscalerGetAutogenReactivePassPermutationBlobByIndex(ui
     // rw_output_autoreactive                UAV   float          2d             u0      1 
     // cbGenerateReactive                cbuffer      NA          NA            cb1      1 
     static const char* boundConstantBufferNames[] = { "cbGenerateReactive" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbGenerateReactive") };
     static const uint32_t boundConstantBuffers[] = { 1 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_input_opaque_only", "r_input_color_jittered" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_opaque_only"), ffxHashBindingName("r_input_color_jittered") };
     static const uint32_t boundSRVTextures[] = { 0, 1 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_output_autoreactive" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_output_autoreactive") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -516,14 +555,17 @@ static FfxShaderBlob fsr3UpscalerGetAutogenReactivePassPermutationBlobByIndex(ui
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -559,14 +601,17 @@ static FfxShaderBlob fsr3UpscalerGetShadingChangePyramidPassPermutationBlobByInd
     // cbFSR3Upscaler                    cbuffer      NA          NA            cb0      1 
     // cbSPD                             cbuffer      NA          NA            cb1      1 
     static const char* boundConstantBufferNames[] = { "cbFSR3Upscaler", "cbSPD" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR3Upscaler"), ffxHashBindingName("cbSPD") };
     static const uint32_t boundConstantBuffers[] = { 0, 1 };
     static const uint32_t boundConstantBufferCounts[] = { 1, 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0, 0 };
     static const char* boundSRVTextureNames[] = { "r_current_luma", "r_previous_luma", "r_dilated_motion_vectors", "r_input_exposure" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_current_luma"), ffxHashBindingName("r_previous_luma"), ffxHashBindingName("r_dilated_motion_vectors"), ffxHashBindingName("r_input_exposure") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2, 3 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_spd_global_atomic", "rw_spd_mip0", "rw_spd_mip1", "rw_spd_mip2", "rw_spd_mip3", "rw_spd_mip4", "rw_spd_mip5" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_spd_global_atomic"), ffxHashBindingName("rw_spd_mip0"), ffxHashBindingName("rw_spd_mip1"), ffxHashBindingName("rw_spd_mip2"), ffxHashBindingName("rw_spd_mip3"), ffxHashBindingName("rw_spd_mip4"), ffxHashBindingName("rw_spd_mip5") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2, 3, 4, 5, 6 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1, 1, 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0, 0, 0, 0, 0 };
@@ -584,14 +629,17 @@ static FfxShaderBlob fsr3UpscalerGetShadingChangePyramidPassPermutationBlobByInd
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -652,14 +700,17 @@ static FfxShaderBlob fsr3UpscalerGetLumaInstabilityPassPermutationBlobByIndex(ui
     // rw_luma_instability                   UAV   float          2d             u1      1 
     // cbFSR3Upscaler                    cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFSR3Upscaler" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR3Upscaler") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_input_exposure", "r_dilated_reactive_masks", "r_dilated_motion_vectors", "r_luma_history", "r_current_luma" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_exposure"), ffxHashBindingName("r_dilated_reactive_masks"), ffxHashBindingName("r_dilated_motion_vectors"), ffxHashBindingName("r_luma_history"), ffxHashBindingName("r_current_luma") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2, 4, 6 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_luma_history", "rw_luma_instability" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_luma_history"), ffxHashBindingName("rw_luma_instability") };
     static const uint32_t boundUAVTextures[] = { 0, 1 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0 };
@@ -677,14 +728,17 @@ static FfxShaderBlob fsr3UpscalerGetLumaInstabilityPassPermutationBlobByIndex(ui
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -713,14 +767,17 @@ static FfxShaderBlob fsr3UpscalerGetDebugViewPassPermutationBlobByIndex(uint32_t
     // rw_upscaled_output                    UAV  float4          2d             u0      1 
     // cbFSR3Upscaler                    cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbFSR3Upscaler" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbFSR3Upscaler") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_dilated_reactive_masks", "r_dilated_motion_vectors", "r_dilated_depth", "r_internal_upscaled_color" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_dilated_reactive_masks"), ffxHashBindingName("r_dilated_motion_vectors"), ffxHashBindingName("r_dilated_depth"), ffxHashBindingName("r_internal_upscaled_color") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2, 3 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_upscaled_output" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_upscaled_output") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -738,14 +795,17 @@ static FfxShaderBlob fsr3UpscalerGetDebugViewPassPermutationBlobByIndex(uint32_t
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
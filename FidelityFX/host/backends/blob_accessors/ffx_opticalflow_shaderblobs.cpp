@@ -80,6 +80,7 @@ static FfxShaderBlob opticalflowGetComputeLuminancePyramidPassPermutationBlobByI
     // rw_optical_flow_input_level_5         UAV    uint          2d             u5      1 
     // rw_optical_flow_input_level_6         UAV    uint          2d             u6      1 
     static const char* boundUAVTextureNames[] = { "rw_optical_flow_input", "rw_optical_flow_input_level_1", "rw_optical_flow_input_level_2", "rw_optical_flow_input_level_3", "rw_optical_flow_input_level_4", "rw_optical_flow_input_level_5", "rw_optical_flow_input_level_6" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_optical_flow_input"), ffxHashBindingName("rw_optical_flow_input_level_1"), ffxHashBindingName("rw_optical_flow_input_level_2"), ffxHashBindingName("rw_optical_flow_input_level_3"), ffxHashBindingName("rw_optical_flow_input_level_4"), ffxHashBindingName("rw_optical_flow_input_level_5"), ffxHashBindingName("rw_optical_flow_input_level_6") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2, 3, 4, 5, 6 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1, 1, 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0, 0, 0, 0, 0 };
@@ -104,7 +105,10 @@ static FfxShaderBlob opticalflowGetComputeLuminancePyramidPassPermutationBlobByI
         nullptr,
         nullptr,
         nullptr,
+        nullptr,
+        nullptr,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -156,6 +160,7 @@ static FfxShaderBlob opticalflowGetComputeScdDivergencePassPermutationBlobByInde
     // rw_optical_flow_scd_temp                      UAV    uint          2d             u2      1 
     // rw_optical_flow_scd_output                    UAV    uint          2d             u3      1 
     static const char* boundUAVTextureNames[] = { "rw_optical_flow_scd_histogram", "rw_optical_flow_scd_previous_histogram", "rw_optical_flow_scd_temp", "rw_optical_flow_scd_output" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_optical_flow_scd_histogram"), ffxHashBindingName("rw_optical_flow_scd_previous_histogram"), ffxHashBindingName("rw_optical_flow_scd_temp"), ffxHashBindingName("rw_optical_flow_scd_output") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2, 3 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0, 0 };
@@ -180,7 +185,10 @@ static FfxShaderBlob opticalflowGetComputeScdDivergencePassPermutationBlobByInde
         nullptr,
         nullptr,
         nullptr,
+        nullptr,
+        nullptr,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -201,14 +209,17 @@ static FfxShaderBlob opticalflowGetGenerateScdHistogramPassPermutationBlobByInde
     // rw_optical_flow_scd_histogram         UAV    uint          2d             u0      1 
     // cbOF                              cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbOF" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbOF") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_optical_flow_input" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_optical_flow_input") };
     static const uint32_t boundSRVTextures[] = { 0 };
     static const uint32_t boundSRVTextureCounts[] = { 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0 };
     static const char* boundUAVTextureNames[] = { "rw_optical_flow_scd_histogram" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_optical_flow_scd_histogram") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -226,14 +237,17 @@ static FfxShaderBlob opticalflowGetGenerateScdHistogramPassPermutationBlobByInde
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -254,14 +268,17 @@ static FfxShaderBlob opticalflowGetPrepareLumaPassPermutationBlobByIndex(uint32_
     // rw_optical_flow_input                 UAV    uint          2d             u0      1 
     // cbOF                              cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbOF" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbOF") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_input_color" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_input_color") };
     static const uint32_t boundSRVTextures[] = { 0 };
     static const uint32_t boundSRVTextureCounts[] = { 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0 };
     static const char* boundUAVTextureNames[] = { "rw_optical_flow_input" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_optical_flow_input") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -279,14 +296,17 @@ static FfxShaderBlob opticalflowGetPrepareLumaPassPermutationBlobByIndex(uint32_
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -309,14 +329,17 @@ static FfxShaderBlob opticalflowGetComputeOpticalFlowAdvancedPassV5PermutationBl
     // rw_optical_flow_scd_output            UAV    uint          2d             u1      1 
     // cbOF                              cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbOF" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbOF") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_optical_flow_input", "r_optical_flow_previous_input" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_optical_flow_input"), ffxHashBindingName("r_optical_flow_previous_input") };
     static const uint32_t boundSRVTextures[] = { 0, 1 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_optical_flow", "rw_optical_flow_scd_output" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_optical_flow"), ffxHashBindingName("rw_optical_flow_scd_output") };
     static const uint32_t boundUAVTextures[] = { 0, 1 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0 };
@@ -334,14 +357,17 @@ static FfxShaderBlob opticalflowGetComputeOpticalFlowAdvancedPassV5PermutationBl
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -391,10 +417,12 @@ static FfxShaderBlob opticalflowGetFilterOpticalFlowPassV5PermutationBlobByIndex
     // r_optical_flow_previous           texture   sint2          2d             t0      1 
     // rw_optical_flow                       UAV   sint2          2d             u0      1 
     static const char* boundSRVTextureNames[] = { "r_optical_flow_previous" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_optical_flow_previous") };
     static const uint32_t boundSRVTextures[] = { 0 };
     static const uint32_t boundSRVTextureCounts[] = { 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0 };
     static const char* boundUAVTextureNames[] = { "rw_optical_flow" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_optical_flow") };
     static const uint32_t boundUAVTextures[] = { 0 };
     static const uint32_t boundUAVTextureCounts[] = { 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0 };
@@ -415,11 +443,14 @@ static FfxShaderBlob opticalflowGetFilterOpticalFlowPassV5PermutationBlobByIndex
         nullptr,
         nullptr,
         nullptr,
+        nullptr,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
@@ -443,14 +474,17 @@ static FfxShaderBlob opticalflowGetScaleOpticalFlowAdvancedPassV5PermutationBlob
     // rw_optical_flow_scd_output            UAV    uint          2d             u1      1 
     // cbOF                              cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbOF" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbOF") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundSRVTextureNames[] = { "r_optical_flow_input", "r_optical_flow_previous_input", "r_optical_flow" };
+    static const uint32_t boundSRVTextureNameHashes[] = { ffxHashBindingName("r_optical_flow_input"), ffxHashBindingName("r_optical_flow_previous_input"), ffxHashBindingName("r_optical_flow") };
     static const uint32_t boundSRVTextures[] = { 0, 1, 2 };
     static const uint32_t boundSRVTextureCounts[] = { 1, 1, 1 };
     static const uint32_t boundSRVTextureSpaces[] = { 0, 0, 0 };
     static const char* boundUAVTextureNames[] = { "rw_optical_flow_next_level", "rw_optical_flow_scd_output" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_optical_flow_next_level"), ffxHashBindingName("rw_optical_flow_scd_output") };
     static const uint32_t boundUAVTextures[] = { 0, 1 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0 };
@@ -468,14 +502,17 @@ static FfxShaderBlob opticalflowGetScaleOpticalFlowAdvancedPassV5PermutationBlob
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
         boundSRVTextureNames,
+        boundSRVTextureNameHashes,
         boundSRVTextures,
         boundSRVTextureCounts,
         boundSRVTextureSpaces,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
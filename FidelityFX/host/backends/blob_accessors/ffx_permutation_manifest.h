@@ -0,0 +1,70 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+// Permutation manifest: the option values a product ships blobs for. The permutation headers generated for
+// FSR2, the FSR3 upscaler and frame interpolation include this file and only reference the blobs it keeps,
+// the others are left out of the binary and requesting them fails in ffxGetPermutationBlobByIndex.
+//
+// Each option lists the values it may take, edit this file or define the options for the project to prune.
+// For example a title with HDR output and inverted depth only would use
+//     FFX_PERMUTATION_MANIFEST_HDR_COLOR_INPUT    FFX_PERMUTATION_ON
+//     FFX_PERMUTATION_MANIFEST_DEPTH_INVERTED     FFX_PERMUTATION_ON
+
+#define FFX_PERMUTATION_OFF     (1 << 0)
+#define FFX_PERMUTATION_ON      (1 << 1)
+#define FFX_PERMUTATION_ANY     (FFX_PERMUTATION_OFF | FFX_PERMUTATION_ON)
+
+// 16 bit blobs, used when the permutation allows FP16 and the device supports it
+#ifndef FFX_PERMUTATION_MANIFEST_FP16
+#define FFX_PERMUTATION_MANIFEST_FP16                   FFX_PERMUTATION_ANY
+#endif
+
+// LUT based Lanczos reprojection
+#ifndef FFX_PERMUTATION_MANIFEST_USE_LANCZOS_TYPE
+#define FFX_PERMUTATION_MANIFEST_USE_LANCZOS_TYPE       FFX_PERMUTATION_ANY
+#endif
+
+#ifndef FFX_PERMUTATION_MANIFEST_HDR_COLOR_INPUT
+#define FFX_PERMUTATION_MANIFEST_HDR_COLOR_INPUT        FFX_PERMUTATION_ANY
+#endif
+
+#ifndef FFX_PERMUTATION_MANIFEST_LOW_RES_MOTION_VECTORS
+#define FFX_PERMUTATION_MANIFEST_LOW_RES_MOTION_VECTORS FFX_PERMUTATION_ANY
+#endif
+
+#ifndef FFX_PERMUTATION_MANIFEST_JITTER_MOTION_VECTORS
+#define FFX_PERMUTATION_MANIFEST_JITTER_MOTION_VECTORS  FFX_PERMUTATION_ANY
+#endif
+
+// inverted and inverted infinite depth
+#ifndef FFX_PERMUTATION_MANIFEST_DEPTH_INVERTED
+#define FFX_PERMUTATION_MANIFEST_DEPTH_INVERTED         FFX_PERMUTATION_ANY
+#endif
+
+#ifndef FFX_PERMUTATION_MANIFEST_ENABLE_SHARPENING
+#define FFX_PERMUTATION_MANIFEST_ENABLE_SHARPENING      FFX_PERMUTATION_ANY
+#endif
+
+// non zero when the manifest keeps the blobs with the option set to value (0 or 1)
+#define FFX_PERMUTATION_ALLOWED(option, value)          ((FFX_PERMUTATION_MANIFEST_##option >> (value)) & 1)
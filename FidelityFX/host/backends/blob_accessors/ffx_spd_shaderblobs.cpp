@@ -63,10 +63,12 @@ static FfxShaderBlob spdGetDownsamplePassPermutationBlobByIndex(uint32_t permuta
     // rw_input_downsample_src_mips[12]        UAV  float4     2darray            u14      1 
     // cbSPD                               cbuffer      NA          NA            cb0      1 
     static const char* boundConstantBufferNames[] = { "cbSPD" };
+    static const uint32_t boundConstantBufferNameHashes[] = { ffxHashBindingName("cbSPD") };
     static const uint32_t boundConstantBuffers[] = { 0 };
     static const uint32_t boundConstantBufferCounts[] = { 1 };
     static const uint32_t boundConstantBufferSpaces[] = { 0 };
     static const char* boundUAVTextureNames[] = { "rw_internal_global_atomic", "rw_input_downsample_src_mid_mip", "rw_input_downsample_src_mips" };
+    static const uint32_t boundUAVTextureNameHashes[] = { ffxHashBindingName("rw_internal_global_atomic"), ffxHashBindingName("rw_input_downsample_src_mid_mip"), ffxHashBindingName("rw_input_downsample_src_mips") };
     static const uint32_t boundUAVTextures[] = { 0, 1, 2 };
     static const uint32_t boundUAVTextureCounts[] = { 1, 1, 13 };
     static const uint32_t boundUAVTextureSpaces[] = { 0, 0, 0 };
@@ -84,6 +86,7 @@ static FfxShaderBlob spdGetDownsamplePassPermutationBlobByIndex(uint32_t permuta
         0,
         0,
         boundConstantBufferNames,
+        boundConstantBufferNameHashes,
         boundConstantBuffers,
         boundConstantBufferCounts,
         boundConstantBufferSpaces,
@@ -91,7 +94,9 @@ static FfxShaderBlob spdGetDownsamplePassPermutationBlobByIndex(uint32_t permuta
         nullptr,
         nullptr,
         nullptr,
+        nullptr,
         boundUAVTextureNames,
+        boundUAVTextureNameHashes,
         boundUAVTextures,
         boundUAVTextureCounts,
         boundUAVTextureSpaces,
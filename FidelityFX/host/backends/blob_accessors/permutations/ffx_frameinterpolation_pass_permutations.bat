@@ -65,16 +65,27 @@ goto :eof
 :header
 setlocal
 set file=ffx_frameinterpolation%1pass%2permutations.h
-if exist %file% goto :eof
+rem rewrite the header when the manifest is newer than it
+if exist %file% (
+  xcopy /d /l /y ..\ffx_permutation_manifest.h %file% | findstr /b /c:"0 " >nul && goto :eof
+  del %file%
+)
 echo %file%
 
+set fp16=0
+if /i %2==_16bit_ set fp16=1
+
 call ffx_license.bat %file%
 echo typedef unsigned char BYTE;>>%file%
 echo.>>%file%
+echo #include "../ffx_permutation_manifest.h">>%file%
+echo.>>%file%
 for %%c in (0,1) do (
   for %%d in (0,1) do (
     for %%e in (0,1) do (
+      call :condition %%c %%d %%e
       echo #include "ffx_frameinterpolation%1pass%2permutations_%%c_%%d_%%e.h">>%file%
+      echo #endif>>%file%
     )
   )
 )
@@ -86,7 +97,9 @@ for %%c in (0,1) do (
     echo         {>>%file%
     for %%e in (0,1) do (
       echo             {>>%file%
+      call :condition %%c %%d %%e
       echo                 g_ffx_frameinterpolation%1pass%2permutations_%%c_%%d_%%e, sizeof^(g_ffx_frameinterpolation%1pass%2permutations_%%c_%%d_%%e^)>>%file%
+      echo #endif>>%file%
       echo             },>>%file%
     )
     echo         },>>%file%
@@ -95,3 +108,7 @@ for %%c in (0,1) do (
 )
 echo };>>%file%
 goto :eof
+
+:condition
+echo #if FFX_PERMUTATION_ALLOWED(FP16, %fp16%) ^&^& FFX_PERMUTATION_ALLOWED(LOW_RES_MOTION_VECTORS, %1) ^&^& FFX_PERMUTATION_ALLOWED(JITTER_MOTION_VECTORS, %2) ^&^& FFX_PERMUTATION_ALLOWED(DEPTH_INVERTED, %3)>>%file%
+goto :eof
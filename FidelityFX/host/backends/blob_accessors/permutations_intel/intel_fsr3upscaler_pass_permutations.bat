@@ -97,19 +97,30 @@ goto :eof
 :header
 setlocal
 set file=intel_fsr3upscaler%1pass%2permutations.h
-if exist %file% goto :eof
+rem rewrite the header when the manifest is newer than it
+if exist %file% (
+  xcopy /d /l /y ..\ffx_permutation_manifest.h %file% | findstr /b /c:"0 " >nul && goto :eof
+  del %file%
+)
 echo %file%
 
+set fp16=0
+if /i %2==_16bit_ set fp16=1
+
 call ..\permutations\ffx_license.bat %file%
 echo typedef unsigned char BYTE;>>%file%
 echo.>>%file%
+echo #include "../ffx_permutation_manifest.h">>%file%
+echo.>>%file%
 for %%c in (0,1) do (
   for %%d in (0,1) do (
     for %%e in (0,1) do (
       for %%f in (0,1) do (
         for %%g in (0,1) do (
           for %%h in (0,1) do (
+            call :condition %%c %%d %%e %%f %%g %%h
             echo #include "intel_fsr3upscaler%1pass%2permutations_%%c_%%d_%%e_%%f_%%g_%%h.h">>%file%
+            echo #endif>>%file%
           )
         )
       )
@@ -130,7 +141,9 @@ for %%c in (0,1) do (
           echo                     {>>%file%
           for %%h in (0,1) do (
             echo                         {>>%file%
+            call :condition %%c %%d %%e %%f %%g %%h
             echo                             g_intel_fsr3upscaler%1pass%2permutations_%%c_%%d_%%e_%%f_%%g_%%h, sizeof^(g_intel_fsr3upscaler%1pass%2permutations_%%c_%%d_%%e_%%f_%%g_%%h^)>>%file%
+            echo #endif>>%file%
             echo                         },>>%file%
           )
           echo                     },>>%file%
@@ -145,3 +158,7 @@ for %%c in (0,1) do (
 )
 echo };>>%file%
 goto :eof
+
+:condition
+echo #if FFX_PERMUTATION_ALLOWED(FP16, %fp16%) ^&^& FFX_PERMUTATION_ALLOWED(USE_LANCZOS_TYPE, %1) ^&^& FFX_PERMUTATION_ALLOWED(HDR_COLOR_INPUT, %2) ^&^& FFX_PERMUTATION_ALLOWED(LOW_RES_MOTION_VECTORS, %3) ^&^& FFX_PERMUTATION_ALLOWED(JITTER_MOTION_VECTORS, %4) ^&^& FFX_PERMUTATION_ALLOWED(DEPTH_INVERTED, %5) ^&^& FFX_PERMUTATION_ALLOWED(ENABLE_SHARPENING, %6)>>%file%
+goto :eof
@@ -0,0 +1,59 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// BLUR pass
+// SRV  0 : BLUR_InputSrc : r_input_src
+// UAV  0 : BLUR_Output   : rw_output
+// CB   0 : cbBLUR
+
+#include <host/backends/cpu/ffx_cpu_kernel.h>
+#include <host/ffx_blur.h>
+#include <host/components/blur/ffx_blur_private.h>
+
+#define FFX_BLUR_BIND_SRV_INPUT_SRC             0
+#define FFX_BLUR_BIND_UAV_OUTPUT                0
+#define FFX_BLUR_BIND_CB_BLUR                   0
+
+// the kernel size and weights are compile time constants, so only the 5x5 kernel with sigma 1.6 is built
+#define FFX_BLUR_OPTION_KERNEL_DIMENSION        5
+#define FFX_BLUR_OPTION_KERNEL_PERMUTATION      0
+
+namespace
+{
+#include "blur/ffx_blur_callbacks_cpp.h"
+#include "blur/ffx_blur_blur.h"
+
+void CS(uint3 LocalThreadId, uint3 WorkGroupId, uint3 Dtid, uint LocalIndex)
+{
+    ffxBlurPass(FfxInt32x2(Dtid.xy), FfxInt32x2(LocalThreadId.xy), FfxInt32x2(WorkGroupId.xy));
+}
+
+// the wave64 flag only selects a different blob table
+FFX_CPU_COMPUTE_KERNEL(ffxBlurKernelCPU, CS, FFX_BLUR_TILE_SIZE_X, FFX_BLUR_TILE_SIZE_Y, 1,
+                       BLUR_SHADER_PERMUTATION_3x3_KERNEL | BLUR_SHADER_PERMUTATION_5x5_KERNEL | BLUR_SHADER_PERMUTATION_7x7_KERNEL |
+                       BLUR_SHADER_PERMUTATION_9x9_KERNEL | BLUR_SHADER_PERMUTATION_11x11_KERNEL | BLUR_SHADER_PERMUTATION_13x13_KERNEL |
+                       BLUR_SHADER_PERMUTATION_15x15_KERNEL | BLUR_SHADER_PERMUTATION_17x17_KERNEL | BLUR_SHADER_PERMUTATION_19x19_KERNEL |
+                       BLUR_SHADER_PERMUTATION_21x21_KERNEL | BLUR_SHADER_PERMUTATION_ALLOW_FP16 |
+                       BLUR_SHADER_PERMUTATION_KERNEL_0 | BLUR_SHADER_PERMUTATION_KERNEL_1 | BLUR_SHADER_PERMUTATION_KERNEL_2,
+                       BLUR_SHADER_PERMUTATION_5x5_KERNEL | BLUR_SHADER_PERMUTATION_KERNEL_0)
+FFX_CPU_REGISTER_COMPUTE_KERNEL(FFX_EFFECT_BLUR, FFX_BLUR_PASS_BLUR, ffxBlurKernelCPU)
+} // namespace
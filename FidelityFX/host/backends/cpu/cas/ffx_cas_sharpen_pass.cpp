@@ -0,0 +1,54 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// CAS pass
+// SRV  0 : CAS_InputColor             : r_input_color
+// UAV  0 : CAS_OutputColor            : rw__output_color
+// CB   0 : cbCAS
+
+#include <host/backends/cpu/ffx_cpu_kernel.h>
+#include <host/ffx_cas.h>
+#include <host/components/cas/ffx_cas_private.h>
+
+#define CAS_BIND_SRV_INPUT_COLOR               0
+#define CAS_BIND_UAV_OUTPUT_COLOR              0
+#define CAS_BIND_CB_CAS                        0
+
+#define FFX_CAS_OPTION_SHARPEN_ONLY            1
+#define FFX_CAS_COLOR_SPACE_CONVERSION         0
+
+namespace
+{
+#include "cas/ffx_cas_callbacks_cpp.h"
+#include "cas/ffx_cas_sharpen.h"
+
+void CS(uint3 LocalThreadId, uint3 WorkGroupId, uint3 Dtid, uint LocalIndex)
+{
+    Sharpen(LocalThreadId, WorkGroupId, Dtid);
+}
+
+FFX_CPU_COMPUTE_KERNEL(ffxCasSharpenKernelCPU, CS, 64, 1, 1,
+                       CAS_SHADER_PERMUTATION_SHARPEN_ONLY | CAS_SHADER_PERMUTATION_COLOR_SPACE_LINEAR | CAS_SHADER_PERMUTATION_COLOR_SPACE_GAMMA20 |
+                       CAS_SHADER_PERMUTATION_COLOR_SPACE_GAMMA22 | CAS_SHADER_PERMUTATION_COLOR_SPACE_SRGB_OUTPUT | CAS_SHADER_PERMUTATION_COLOR_SPACE_SRGB_INPUT_OUTPUT,
+                       CAS_SHADER_PERMUTATION_SHARPEN_ONLY | CAS_SHADER_PERMUTATION_COLOR_SPACE_LINEAR)
+FFX_CPU_REGISTER_COMPUTE_KERNEL(FFX_EFFECT_CAS, FFX_CAS_PASS_SHARPEN, ffxCasSharpenKernelCPU)
+} // namespace
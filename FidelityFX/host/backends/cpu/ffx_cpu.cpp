@@ -0,0 +1,2065 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <host/ffx_interface.h>
+#include <host/ffx_util.h>
+#include <host/ffx_assert.h>
+#include <host/backends/cpu/ffx_cpu.h>
+#include <host/backends/ffx_shader_blobs.h>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>  // required for fibers
+#else
+#include <ucontext.h> // required for invocation contexts
+#endif // #if defined(_WIN32)
+
+// CPU prototypes for functions in the backend interface
+FfxUInt32 GetSDKVersionCPU(FfxInterface* backendInterface);
+FfxErrorCode GetEffectGpuMemoryUsageCPU(FfxInterface* backendInterface, FfxUInt32 effectContextId, FfxEffectMemoryUsage* outVramUsage);
+FfxErrorCode CreateBackendContextCPU(FfxInterface* backendInterface, FfxEffect effect, FfxEffectBindlessConfig* bindlessConfig, FfxUInt32* effectContextId);
+FfxErrorCode GetDeviceCapabilitiesCPU(FfxInterface* backendInterface, FfxDeviceCapabilities* deviceCapabilities);
+FfxErrorCode DestroyBackendContextCPU(FfxInterface* backendInterface, FfxUInt32 effectContextId);
+FfxErrorCode CreateResourceCPU(FfxInterface* backendInterface, const FfxCreateResourceDescription* desc, FfxUInt32 effectContextId, FfxResourceInternal* outTexture);
+FfxErrorCode DestroyResourceCPU(FfxInterface* backendInterface, FfxResourceInternal resource, FfxUInt32 effectContextId);
+FfxErrorCode MapResourceCPU(FfxInterface* backendInterface, FfxResourceInternal resource, void** ptr);
+FfxErrorCode UnmapResourceCPU(FfxInterface* backendInterface, FfxResourceInternal resource);
+FfxErrorCode RegisterResourceCPU(FfxInterface* backendInterface, const FfxResource* inResource, FfxUInt32 effectContextId, FfxResourceInternal* outResourceInternal);
+FfxResource GetResourceCPU(FfxInterface* backendInterface, FfxResourceInternal resource);
+FfxErrorCode UnregisterResourcesCPU(FfxInterface* backendInterface, FfxCommandList commandList, FfxUInt32 effectContextId);
+FfxResourceDescription GetResourceDescriptorCPU(FfxInterface* backendInterface, FfxResourceInternal resource);
+FfxErrorCode StageConstantBufferDataCPU(FfxInterface* backendInterface, void* data, FfxUInt32 size, FfxConstantBuffer* constantBuffer);
+FfxErrorCode CreatePipelineCPU(FfxInterface* backendInterface, FfxEffect effect, FfxPass passId, uint32_t permutationOptions, const FfxPipelineDescription*  desc, FfxUInt32 effectContextId, FfxPipelineState* outPass);
+FfxErrorCode DestroyPipelineCPU(FfxInterface* backendInterface, FfxPipelineState* pipeline, FfxUInt32 effectContextId);
+FfxErrorCode ScheduleGpuJobCPU(FfxInterface* backendInterface, const FfxGpuJobDescription* job);
+FfxErrorCode ExecuteGpuJobsCPU(FfxInterface* backendInterface, FfxCommandList commandList, FfxUInt32 effectContextId);
+FfxErrorCode BreadcrumbsAllocBlockCPU(FfxInterface* backendInterface, uint64_t blockBytes, FfxBreadcrumbsBlockData* blockData);
+void BreadcrumbsFreeBlockCPU(FfxInterface* backendInterface, FfxBreadcrumbsBlockData* blockData);
+void BreadcrumbsWriteCPU(FfxInterface* backendInterface, FfxCommandList commandList, uint32_t value, uint64_t gpuLocation, void* gpuBuffer, bool isBegin);
+void BreadcrumbsPrintDeviceInfoCPU(FfxInterface* backendInterface, FfxAllocationCallbacks* allocs, bool extendedInfo, char** printBuffer, size_t* printSize);
+
+// pool of threads executing the workgroups of a dispatch
+typedef struct WorkerPool_CPU {
+
+    std::vector<std::thread>            threads;
+    std::mutex                          mutex;
+    std::condition_variable             wakeCondition;
+    std::condition_variable             doneCondition;
+
+    FfxCpuComputeKernelFunc             kernel = nullptr;
+    const FfxCpuDispatchDescription*    dispatch = nullptr;
+    uint32_t                            workGroupCount = 0;
+    std::atomic<uint32_t>               nextWorkGroup{ 0 };
+    uint32_t                            busyWorkers = 0;
+    uint64_t                            generation = 0;
+    bool                                shutdown = false;
+
+} WorkerPool_CPU;
+
+// compute pipeline handed out through FfxPipelineState::pipeline
+typedef struct Pipeline_CPU {
+
+    FfxCpuComputeKernelFunc kernel;
+    FfxEffect               effect;
+    FfxPass                 pass;
+    uint32_t                permutationOptions;
+
+} Pipeline_CPU;
+
+typedef struct BackendContext_CPU {
+
+    // store for resources and their layout
+    typedef struct Resource
+    {
+#ifdef _DEBUG
+        wchar_t                     resourceName[64] = {};
+#endif
+        uint8_t*                    resourcePtr;
+        FfxResourceDescription      resourceDescription;
+        uint32_t                    mipOffsets[FFX_CPU_MAX_MIP_LEVELS];
+        uint64_t                    memorySize;
+        bool                        ownsMemory;
+    } Resource;
+
+    uint32_t refCount;
+    uint32_t maxEffectContexts;
+
+    FfxCpuDeviceDescription*    device;
+    WorkerPool_CPU*             pWorkerPool;
+
+    FfxGpuJobDescription*       pGpuJobs;
+    uint32_t                    gpuJobCount;
+
+    FfxCpuDispatchDescription   dispatch;
+
+    uint8_t*                    pStagingRingBuffer;
+    uint32_t                    stagingRingBufferBase;
+
+    typedef struct EffectContext {
+
+        // Resource allocation
+        uint32_t            nextStaticResource;
+        uint32_t            nextDynamicResource;
+
+        // Usage
+        bool                active;
+
+        // Memory usage
+        FfxEffectMemoryUsage vramUsage;
+
+    } EffectContext;
+
+    // Resource holder
+    Resource*               pResources;
+    EffectContext*          pEffectContexts;
+
+} BackendContext_CPU;
+
+typedef struct ComputeKernel_CPU {
+
+    FfxEffect               effect;
+    FfxPass                 pass;
+    uint32_t                permutationMask;
+    uint32_t                permutationValue;
+    FfxCpuComputeKernelFunc kernel;
+
+} ComputeKernel_CPU;
+
+static ComputeKernel_CPU    s_ComputeKernels[FFX_CPU_MAX_KERNELS];
+static uint32_t             s_ComputeKernelCount = 0;
+static std::mutex           s_ComputeKernelMutex;
+
+FFX_API size_t ffxGetScratchMemorySizeCPU(size_t maxContexts)
+{
+    uint32_t resourceArraySize          = FFX_ALIGN_UP(maxContexts * FFX_MAX_RESOURCE_COUNT * sizeof(BackendContext_CPU::Resource), sizeof(uint64_t));
+    uint32_t contextArraySize           = FFX_ALIGN_UP(maxContexts * sizeof(BackendContext_CPU::EffectContext), sizeof(uint32_t));
+    uint32_t stagingRingBufferArraySize = FFX_ALIGN_UP(maxContexts * FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE, sizeof(uint32_t));
+    uint32_t gpuJobDescArraySize        = FFX_ALIGN_UP(maxContexts * FFX_MAX_GPU_JOBS * sizeof(FfxGpuJobDescription), sizeof(uint32_t));
+
+    return FFX_ALIGN_UP(sizeof(BackendContext_CPU) + resourceArraySize + contextArraySize + stagingRingBufferArraySize + gpuJobDescArraySize, sizeof(uint64_t));
+}
+
+// Create a FfxDevice from a FfxCpuDeviceDescription*
+FfxDevice ffxGetDeviceCPU(FfxCpuDeviceDescription* deviceDescription)
+{
+    FFX_ASSERT(NULL != deviceDescription);
+    return reinterpret_cast<FfxDevice>(deviceDescription);
+}
+
+// populate interface with CPU pointers.
+FfxErrorCode ffxGetInterfaceCPU(
+    FfxInterface* backendInterface,
+    FfxDevice device,
+    void* scratchBuffer,
+    size_t scratchBufferSize,
+    uint32_t maxContexts) {
+
+    FFX_RETURN_ON_ERROR(
+        backendInterface,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        scratchBuffer,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        scratchBufferSize >= ffxGetScratchMemorySizeCPU(maxContexts),
+        FFX_ERROR_INSUFFICIENT_MEMORY);
+
+    backendInterface->fpGetSDKVersion = GetSDKVersionCPU;
+    backendInterface->fpGetEffectGpuMemoryUsage = GetEffectGpuMemoryUsageCPU;
+    backendInterface->fpCreateBackendContext = CreateBackendContextCPU;
+    backendInterface->fpGetDeviceCapabilities = GetDeviceCapabilitiesCPU;
+    backendInterface->fpDestroyBackendContext = DestroyBackendContextCPU;
+    backendInterface->fpCreateResource = CreateResourceCPU;
+    backendInterface->fpDestroyResource = DestroyResourceCPU;
+    backendInterface->fpMapResource = MapResourceCPU;
+    backendInterface->fpUnmapResource = UnmapResourceCPU;
+    backendInterface->fpGetResource = GetResourceCPU;
+    backendInterface->fpRegisterResource = RegisterResourceCPU;
+    backendInterface->fpUnregisterResources = UnregisterResourcesCPU;
+    backendInterface->fpRegisterStaticResource = [](FfxInterface*, const FfxStaticResourceDescription*, FfxUInt32) -> FfxErrorCode { return FFX_ERROR_BACKEND_API_ERROR; };
+    backendInterface->fpGetResourceDescription = GetResourceDescriptorCPU;
+    backendInterface->fpStageConstantBufferDataFunc = StageConstantBufferDataCPU;
+    backendInterface->fpCreatePipeline = CreatePipelineCPU;
+    backendInterface->fpGetPermutationBlobByIndex = ffxGetPermutationBlobByIndex;
+    backendInterface->fpReleasePermutationBlob = ffxReleasePermutationBlob;
+    backendInterface->fpDestroyPipeline = DestroyPipelineCPU;
+    backendInterface->fpScheduleGpuJob = ScheduleGpuJobCPU;
+    backendInterface->fpExecuteGpuJobs = ExecuteGpuJobsCPU;
+    backendInterface->fpBreadcrumbsAllocBlock = BreadcrumbsAllocBlockCPU;
+    backendInterface->fpBreadcrumbsFreeBlock = BreadcrumbsFreeBlockCPU;
+    backendInterface->fpBreadcrumbsWrite = BreadcrumbsWriteCPU;
+    backendInterface->fpBreadcrumbsPrintDeviceInfo = BreadcrumbsPrintDeviceInfoCPU;
+    backendInterface->fpSwapChainConfigureFrameGeneration = [](FfxFrameGenerationConfig const*) -> FfxErrorCode { return FFX_OK; };
+    backendInterface->fpRegisterConstantBufferAllocator = [](FfxInterface*, FfxConstantBufferAllocator) {};
+
+    // Memory assignments
+    backendInterface->scratchBuffer = scratchBuffer;
+    backendInterface->scratchBufferSize = scratchBufferSize;
+
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    FFX_RETURN_ON_ERROR(
+        !backendContext->refCount,
+        FFX_ERROR_BACKEND_API_ERROR);
+
+    // Clear everything out
+    memset(backendContext, 0, sizeof(*backendContext));
+
+    // Set the device
+    backendInterface->device = device;
+
+    // Assign the max number of contexts we'll be using
+    backendContext->maxEffectContexts = maxContexts;
+
+    return FFX_OK;
+}
+
+FfxCommandList ffxGetCommandListCPU(FfxDevice device)
+{
+    FFX_ASSERT(NULL != device);
+    return reinterpret_cast<FfxCommandList>(device);
+}
+
+// copy a resource name, truncating it to FFX_RESOURCE_NAME_SIZE
+static void copyResourceNameCPU(wchar_t* dst, const wchar_t* src)
+{
+    size_t index = 0;
+    for (; src && src[index] && index + 1 < FFX_RESOURCE_NAME_SIZE; ++index)
+        dst[index] = src[index];
+    dst[index] = 0;
+}
+
+// register a host memory resource to the backend
+FfxResource ffxGetResourceCPU(void* data,
+    FfxResourceDescription                     ffxResDescription,
+    wchar_t const*                             ffxResName,
+    FfxResourceStates                          state /*=FFX_RESOURCE_STATE_COMPUTE_READ*/)
+{
+    FfxResource resource = {};
+    resource.resource    = data;
+    resource.state = state;
+    resource.description = ffxResDescription;
+
+#ifdef _DEBUG
+    if (ffxResName) {
+        copyResourceNameCPU(resource.name, ffxResName);
+    }
+#endif
+
+    return resource;
+}
+
+FfxErrorCode ffxRegisterComputeKernelCPU(FfxEffect effect, FfxPass pass, uint32_t permutationMask, uint32_t permutationValue, FfxCpuComputeKernelFunc kernel)
+{
+    FFX_RETURN_ON_ERROR(
+        (permutationValue & ~permutationMask) == 0,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> kernelLock{ s_ComputeKernelMutex };
+
+    for (uint32_t kernelIndex = 0; kernelIndex < s_ComputeKernelCount; ++kernelIndex) {
+        ComputeKernel_CPU& entry = s_ComputeKernels[kernelIndex];
+        if (entry.effect == effect && entry.pass == pass && entry.permutationMask == permutationMask && entry.permutationValue == permutationValue) {
+            entry.kernel = kernel;
+            return FFX_OK;
+        }
+    }
+
+    FFX_RETURN_ON_ERROR(
+        s_ComputeKernelCount < FFX_CPU_MAX_KERNELS,
+        FFX_ERROR_OUT_OF_RANGE);
+
+    s_ComputeKernels[s_ComputeKernelCount].effect = effect;
+    s_ComputeKernels[s_ComputeKernelCount].pass = pass;
+    s_ComputeKernels[s_ComputeKernelCount].permutationMask = permutationMask;
+    s_ComputeKernels[s_ComputeKernelCount].permutationValue = permutationValue;
+    s_ComputeKernels[s_ComputeKernelCount].kernel = kernel;
+    ++s_ComputeKernelCount;
+
+    return FFX_OK;
+}
+
+// the kernel compiled for this permutation of the pass, null when there is none
+static FfxCpuComputeKernelFunc findComputeKernelCPU(FfxEffect effect, FfxPass pass, uint32_t permutationOptions)
+{
+    std::lock_guard<std::mutex> kernelLock{ s_ComputeKernelMutex };
+
+    for (uint32_t kernelIndex = 0; kernelIndex < s_ComputeKernelCount; ++kernelIndex) {
+        const ComputeKernel_CPU& entry = s_ComputeKernels[kernelIndex];
+        if (entry.effect == effect && entry.pass == pass && (permutationOptions & entry.permutationMask) == entry.permutationValue)
+            return entry.kernel;
+    }
+
+    return nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Texel formats
+
+static uint32_t ffxGetSurfaceFormatSizeCPU(FfxSurfaceFormat format)
+{
+    switch (format) {
+
+    case FFX_SURFACE_FORMAT_R32G32B32A32_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32G32B32A32_UINT:
+    case FFX_SURFACE_FORMAT_R32G32B32A32_FLOAT:
+        return 16;
+    case FFX_SURFACE_FORMAT_R32G32B32_FLOAT:
+        return 12;
+    case FFX_SURFACE_FORMAT_R16G16B16A16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT:
+    case FFX_SURFACE_FORMAT_R32G32_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32G32_FLOAT:
+        return 8;
+    case FFX_SURFACE_FORMAT_R32_UINT:
+    case FFX_SURFACE_FORMAT_R32_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32_FLOAT:
+    case FFX_SURFACE_FORMAT_R8G8B8A8_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8G8B8A8_UNORM:
+    case FFX_SURFACE_FORMAT_R8G8B8A8_SNORM:
+    case FFX_SURFACE_FORMAT_R8G8B8A8_SRGB:
+    case FFX_SURFACE_FORMAT_B8G8R8A8_TYPELESS:
+    case FFX_SURFACE_FORMAT_B8G8R8A8_UNORM:
+    case FFX_SURFACE_FORMAT_B8G8R8A8_SRGB:
+    case FFX_SURFACE_FORMAT_R11G11B10_FLOAT:
+    case FFX_SURFACE_FORMAT_R10G10B10A2_TYPELESS:
+    case FFX_SURFACE_FORMAT_R10G10B10A2_UNORM:
+    case FFX_SURFACE_FORMAT_R16G16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R16G16_FLOAT:
+    case FFX_SURFACE_FORMAT_R16G16_UINT:
+    case FFX_SURFACE_FORMAT_R16G16_SINT:
+    case FFX_SURFACE_FORMAT_R9G9B9E5_SHAREDEXP:
+        return 4;
+    case FFX_SURFACE_FORMAT_R16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R16_FLOAT:
+    case FFX_SURFACE_FORMAT_R16_UINT:
+    case FFX_SURFACE_FORMAT_R16_UNORM:
+    case FFX_SURFACE_FORMAT_R16_SNORM:
+    case FFX_SURFACE_FORMAT_R8G8_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8G8_UNORM:
+    case FFX_SURFACE_FORMAT_R8G8_UINT:
+        return 2;
+    case FFX_SURFACE_FORMAT_R8_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8_UNORM:
+    case FFX_SURFACE_FORMAT_R8_UINT:
+        return 1;
+
+    case FFX_SURFACE_FORMAT_UNKNOWN:
+        return 1;
+
+    default:
+        FFX_ASSERT_MESSAGE(false, "Format not yet supported");
+        return 0;
+    }
+}
+
+static float asFloatCPU(uint32_t bits)
+{
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static uint32_t asUIntCPU(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// decode a float with a 5 bit exponent (f16, f11 and f10)
+static float unpackSmallFloatCPU(uint32_t bits, uint32_t mantissaBits, bool hasSign)
+{
+    const uint32_t exponent = (bits >> mantissaBits) & 0x1f;
+    const uint32_t mantissa = bits & ((1u << mantissaBits) - 1);
+    const float    sign     = (hasSign && (bits >> (mantissaBits + 5)) & 1) ? -1.0f : 1.0f;
+
+    if (exponent == 0)
+        return sign * std::ldexp(float(mantissa), -14 - int32_t(mantissaBits));
+    if (exponent == 0x1f)
+        return mantissa ? NAN : sign * INFINITY;
+
+    return sign * std::ldexp(float(mantissa | (1u << mantissaBits)), int32_t(exponent) - 15 - int32_t(mantissaBits));
+}
+
+// encode a float with a 5 bit exponent (f16, f11 and f10), rounding to nearest even
+static uint32_t packSmallFloatCPU(float value, uint32_t mantissaBits, bool hasSign)
+{
+    const uint32_t infinity = 0x1fu << mantissaBits;
+
+    if (std::isnan(value))
+        return infinity | 1;
+
+    uint32_t sign = 0;
+    if (std::signbit(value)) {
+        if (!hasSign)
+            return 0;
+        sign  = 1u << (mantissaBits + 5);
+        value = -value;
+    }
+
+    if (value == 0.0f)
+        return sign;
+    if (std::isinf(value))
+        return sign | infinity;
+
+    int32_t exponent = 0;
+    float   fraction = std::frexp(value, &exponent);
+    int32_t biased   = exponent - 1 + 15;
+
+    uint32_t bits = 0;
+    if (biased <= 0) {
+        bits = uint32_t(std::nearbyint(std::ldexp(value, 14 + int32_t(mantissaBits))));
+    }
+    else {
+        // a rounding carry out of the mantissa correctly bumps the exponent
+        bits = (uint32_t(biased) << mantissaBits) + uint32_t(std::nearbyint(std::ldexp(fraction * 2.0f - 1.0f, int32_t(mantissaBits))));
+    }
+
+    return sign | (bits > infinity ? infinity : bits);
+}
+
+static float srgbToLinearCPU(float value)
+{
+    return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+}
+
+static float linearToSrgbCPU(float value)
+{
+    return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+}
+
+static float unpackUnormCPU(uint32_t bits, uint32_t bitCount)
+{
+    return float(bits) / float((1u << bitCount) - 1);
+}
+
+static uint32_t packUnormCPU(float value, uint32_t bitCount)
+{
+    value = std::isnan(value) ? 0.0f : (value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value));
+    return uint32_t(value * float((1u << bitCount) - 1) + 0.5f);
+}
+
+static float unpackSnormCPU(uint32_t bits, uint32_t bitCount)
+{
+    const int32_t signedBits = int32_t(bits << (32 - bitCount)) >> (32 - bitCount);
+    const float   value      = float(signedBits) / float((1u << (bitCount - 1)) - 1);
+    return value < -1.0f ? -1.0f : value;
+}
+
+static uint32_t packSnormCPU(float value, uint32_t bitCount)
+{
+    value = std::isnan(value) ? 0.0f : (value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value));
+    return uint32_t(int32_t(std::nearbyint(value * float((1u << (bitCount - 1)) - 1)))) & ((1u << bitCount) - 1);
+}
+
+static void decodeTexelCPU(FfxSurfaceFormat format, const uint8_t* src, uint32_t texel[4])
+{
+    uint32_t packed32 = 0;
+    uint16_t packed16[4] = {};
+
+    // missing channels read as (0, 0, 0, 1)
+    texel[0] = 0;
+    texel[1] = 0;
+    texel[2] = 0;
+    texel[3] = asUIntCPU(1.0f);
+
+    switch (format) {
+
+    case FFX_SURFACE_FORMAT_R32G32B32A32_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32G32B32A32_UINT:
+    case FFX_SURFACE_FORMAT_R32G32B32A32_FLOAT:
+        memcpy(texel, src, 16);
+        break;
+    case FFX_SURFACE_FORMAT_R32G32B32_FLOAT:
+        memcpy(texel, src, 12);
+        break;
+    case FFX_SURFACE_FORMAT_R32G32_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32G32_FLOAT:
+        memcpy(texel, src, 8);
+        break;
+    case FFX_SURFACE_FORMAT_R32_UINT:
+        memcpy(texel, src, 4);
+        texel[3] = 1;
+        break;
+    case FFX_SURFACE_FORMAT_R32_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32_FLOAT:
+        memcpy(texel, src, 4);
+        break;
+
+    case FFX_SURFACE_FORMAT_R16G16B16A16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT:
+        memcpy(packed16, src, 8);
+        for (uint32_t channel = 0; channel < 4; ++channel)
+            texel[channel] = asUIntCPU(unpackSmallFloatCPU(packed16[channel], 10, true));
+        break;
+    case FFX_SURFACE_FORMAT_R16G16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R16G16_FLOAT:
+        memcpy(packed16, src, 4);
+        texel[0] = asUIntCPU(unpackSmallFloatCPU(packed16[0], 10, true));
+        texel[1] = asUIntCPU(unpackSmallFloatCPU(packed16[1], 10, true));
+        break;
+    case FFX_SURFACE_FORMAT_R16G16_UINT:
+        memcpy(packed16, src, 4);
+        texel[0] = packed16[0];
+        texel[1] = packed16[1];
+        texel[3] = 1;
+        break;
+    case FFX_SURFACE_FORMAT_R16G16_SINT:
+        memcpy(packed16, src, 4);
+        texel[0] = uint32_t(int32_t(int16_t(packed16[0])));
+        texel[1] = uint32_t(int32_t(int16_t(packed16[1])));
+        texel[3] = 1;
+        break;
+    case FFX_SURFACE_FORMAT_R16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R16_FLOAT:
+        memcpy(packed16, src, 2);
+        texel[0] = asUIntCPU(unpackSmallFloatCPU(packed16[0], 10, true));
+        break;
+    case FFX_SURFACE_FORMAT_R16_UINT:
+        memcpy(packed16, src, 2);
+        texel[0] = packed16[0];
+        texel[3] = 1;
+        break;
+    case FFX_SURFACE_FORMAT_R16_UNORM:
+        memcpy(packed16, src, 2);
+        texel[0] = asUIntCPU(unpackUnormCPU(packed16[0], 16));
+        break;
+    case FFX_SURFACE_FORMAT_R16_SNORM:
+        memcpy(packed16, src, 2);
+        texel[0] = asUIntCPU(unpackSnormCPU(packed16[0], 16));
+        break;
+
+    case FFX_SURFACE_FORMAT_R8G8B8A8_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8G8B8A8_UNORM:
+    case FFX_SURFACE_FORMAT_B8G8R8A8_TYPELESS:
+    case FFX_SURFACE_FORMAT_B8G8R8A8_UNORM:
+        for (uint32_t channel = 0; channel < 4; ++channel)
+            texel[channel] = asUIntCPU(unpackUnormCPU(src[channel], 8));
+        break;
+    case FFX_SURFACE_FORMAT_R8G8B8A8_SRGB:
+    case FFX_SURFACE_FORMAT_B8G8R8A8_SRGB:
+        for (uint32_t channel = 0; channel < 3; ++channel)
+            texel[channel] = asUIntCPU(srgbToLinearCPU(unpackUnormCPU(src[channel], 8)));
+        texel[3] = asUIntCPU(unpackUnormCPU(src[3], 8));
+        break;
+    case FFX_SURFACE_FORMAT_R8G8B8A8_SNORM:
+        for (uint32_t channel = 0; channel < 4; ++channel)
+            texel[channel] = asUIntCPU(unpackSnormCPU(src[channel], 8));
+        break;
+    case FFX_SURFACE_FORMAT_R8G8_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8G8_UNORM:
+        texel[0] = asUIntCPU(unpackUnormCPU(src[0], 8));
+        texel[1] = asUIntCPU(unpackUnormCPU(src[1], 8));
+        break;
+    case FFX_SURFACE_FORMAT_R8G8_UINT:
+        texel[0] = src[0];
+        texel[1] = src[1];
+        texel[3] = 1;
+        break;
+    case FFX_SURFACE_FORMAT_R8_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8_UNORM:
+        texel[0] = asUIntCPU(unpackUnormCPU(src[0], 8));
+        break;
+    case FFX_SURFACE_FORMAT_R8_UINT:
+        texel[0] = src[0];
+        texel[3] = 1;
+        break;
+
+    case FFX_SURFACE_FORMAT_R11G11B10_FLOAT:
+        memcpy(&packed32, src, 4);
+        texel[0] = asUIntCPU(unpackSmallFloatCPU(packed32 & 0x7ff, 6, false));
+        texel[1] = asUIntCPU(unpackSmallFloatCPU((packed32 >> 11) & 0x7ff, 6, false));
+        texel[2] = asUIntCPU(unpackSmallFloatCPU((packed32 >> 22) & 0x3ff, 5, false));
+        break;
+    case FFX_SURFACE_FORMAT_R10G10B10A2_TYPELESS:
+    case FFX_SURFACE_FORMAT_R10G10B10A2_UNORM:
+        memcpy(&packed32, src, 4);
+        texel[0] = asUIntCPU(unpackUnormCPU(packed32 & 0x3ff, 10));
+        texel[1] = asUIntCPU(unpackUnormCPU((packed32 >> 10) & 0x3ff, 10));
+        texel[2] = asUIntCPU(unpackUnormCPU((packed32 >> 20) & 0x3ff, 10));
+        texel[3] = asUIntCPU(unpackUnormCPU(packed32 >> 30, 2));
+        break;
+    case FFX_SURFACE_FORMAT_R9G9B9E5_SHAREDEXP:
+        memcpy(&packed32, src, 4);
+        for (uint32_t channel = 0; channel < 3; ++channel)
+            texel[channel] = asUIntCPU(std::ldexp(float((packed32 >> (9 * channel)) & 0x1ff), int32_t(packed32 >> 27) - 15 - 9));
+        break;
+
+    default:
+        FFX_ASSERT_MESSAGE(false, "Format not yet supported");
+        break;
+    }
+
+    // swizzle BGRA back to RGBA
+    if (format == FFX_SURFACE_FORMAT_B8G8R8A8_TYPELESS || format == FFX_SURFACE_FORMAT_B8G8R8A8_UNORM || format == FFX_SURFACE_FORMAT_B8G8R8A8_SRGB) {
+        uint32_t red = texel[0];
+        texel[0] = texel[2];
+        texel[2] = red;
+    }
+}
+
+static void encodeTexelCPU(FfxSurfaceFormat format, uint8_t* dst, const uint32_t texel[4])
+{
+    uint32_t packed32 = 0;
+    uint16_t packed16[4] = {};
+    float    value[4] = { asFloatCPU(texel[0]), asFloatCPU(texel[1]), asFloatCPU(texel[2]), asFloatCPU(texel[3]) };
+
+    // swizzle RGBA to BGRA
+    if (format == FFX_SURFACE_FORMAT_B8G8R8A8_TYPELESS || format == FFX_SURFACE_FORMAT_B8G8R8A8_UNORM || format == FFX_SURFACE_FORMAT_B8G8R8A8_SRGB) {
+        float red = value[0];
+        value[0] = value[2];
+        value[2] = red;
+    }
+
+    switch (format) {
+
+    case FFX_SURFACE_FORMAT_R32G32B32A32_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32G32B32A32_UINT:
+    case FFX_SURFACE_FORMAT_R32G32B32A32_FLOAT:
+        memcpy(dst, texel, 16);
+        break;
+    case FFX_SURFACE_FORMAT_R32G32B32_FLOAT:
+        memcpy(dst, texel, 12);
+        break;
+    case FFX_SURFACE_FORMAT_R32G32_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32G32_FLOAT:
+        memcpy(dst, texel, 8);
+        break;
+    case FFX_SURFACE_FORMAT_R32_UINT:
+    case FFX_SURFACE_FORMAT_R32_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32_FLOAT:
+        memcpy(dst, texel, 4);
+        break;
+
+    case FFX_SURFACE_FORMAT_R16G16B16A16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT:
+        for (uint32_t channel = 0; channel < 4; ++channel)
+            packed16[channel] = uint16_t(packSmallFloatCPU(value[channel], 10, true));
+        memcpy(dst, packed16, 8);
+        break;
+    case FFX_SURFACE_FORMAT_R16G16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R16G16_FLOAT:
+        packed16[0] = uint16_t(packSmallFloatCPU(value[0], 10, true));
+        packed16[1] = uint16_t(packSmallFloatCPU(value[1], 10, true));
+        memcpy(dst, packed16, 4);
+        break;
+    case FFX_SURFACE_FORMAT_R16G16_UINT:
+    case FFX_SURFACE_FORMAT_R16G16_SINT:
+        packed16[0] = uint16_t(texel[0]);
+        packed16[1] = uint16_t(texel[1]);
+        memcpy(dst, packed16, 4);
+        break;
+    case FFX_SURFACE_FORMAT_R16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R16_FLOAT:
+        packed16[0] = uint16_t(packSmallFloatCPU(value[0], 10, true));
+        memcpy(dst, packed16, 2);
+        break;
+    case FFX_SURFACE_FORMAT_R16_UINT:
+        packed16[0] = uint16_t(texel[0]);
+        memcpy(dst, packed16, 2);
+        break;
+    case FFX_SURFACE_FORMAT_R16_UNORM:
+        packed16[0] = uint16_t(packUnormCPU(value[0], 16));
+        memcpy(dst, packed16, 2);
+        break;
+    case FFX_SURFACE_FORMAT_R16_SNORM:
+        packed16[0] = uint16_t(packSnormCPU(value[0], 16));
+        memcpy(dst, packed16, 2);
+        break;
+
+    case FFX_SURFACE_FORMAT_R8G8B8A8_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8G8B8A8_UNORM:
+    case FFX_SURFACE_FORMAT_B8G8R8A8_TYPELESS:
+    case FFX_SURFACE_FORMAT_B8G8R8A8_UNORM:
+        for (uint32_t channel = 0; channel < 4; ++channel)
+            dst[channel] = uint8_t(packUnormCPU(value[channel], 8));
+        break;
+    case FFX_SURFACE_FORMAT_R8G8B8A8_SRGB:
+    case FFX_SURFACE_FORMAT_B8G8R8A8_SRGB:
+        for (uint32_t channel = 0; channel < 3; ++channel)
+            dst[channel] = uint8_t(packUnormCPU(linearToSrgbCPU(value[channel]), 8));
+        dst[3] = uint8_t(packUnormCPU(value[3], 8));
+        break;
+    case FFX_SURFACE_FORMAT_R8G8B8A8_SNORM:
+        for (uint32_t channel = 0; channel < 4; ++channel)
+            dst[channel] = uint8_t(packSnormCPU(value[channel], 8));
+        break;
+    case FFX_SURFACE_FORMAT_R8G8_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8G8_UNORM:
+        dst[0] = uint8_t(packUnormCPU(value[0], 8));
+        dst[1] = uint8_t(packUnormCPU(value[1], 8));
+        break;
+    case FFX_SURFACE_FORMAT_R8G8_UINT:
+        dst[0] = uint8_t(texel[0]);
+        dst[1] = uint8_t(texel[1]);
+        break;
+    case FFX_SURFACE_FORMAT_R8_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8_UNORM:
+        dst[0] = uint8_t(packUnormCPU(value[0], 8));
+        break;
+    case FFX_SURFACE_FORMAT_R8_UINT:
+        dst[0] = uint8_t(texel[0]);
+        break;
+
+    case FFX_SURFACE_FORMAT_R11G11B10_FLOAT:
+        packed32 = packSmallFloatCPU(value[0], 6, false) | (packSmallFloatCPU(value[1], 6, false) << 11) | (packSmallFloatCPU(value[2], 5, false) << 22);
+        memcpy(dst, &packed32, 4);
+        break;
+    case FFX_SURFACE_FORMAT_R10G10B10A2_TYPELESS:
+    case FFX_SURFACE_FORMAT_R10G10B10A2_UNORM:
+        packed32 = packUnormCPU(value[0], 10) | (packUnormCPU(value[1], 10) << 10) | (packUnormCPU(value[2], 10) << 20) | (packUnormCPU(value[3], 2) << 30);
+        memcpy(dst, &packed32, 4);
+        break;
+    case FFX_SURFACE_FORMAT_R9G9B9E5_SHAREDEXP:
+    {
+        const float maximum  = std::ldexp(511.0f / 512.0f, 16);
+        float       clamped[3];
+        float       largest  = 0.0f;
+        for (uint32_t channel = 0; channel < 3; ++channel) {
+            clamped[channel] = std::isnan(value[channel]) ? 0.0f : (value[channel] < 0.0f ? 0.0f : (value[channel] > maximum ? maximum : value[channel]));
+            largest          = clamped[channel] > largest ? clamped[channel] : largest;
+        }
+        int32_t exponent = 0;
+        std::frexp(largest, &exponent);
+        int32_t sharedExponent = (exponent < -15 ? -15 : exponent) + 15;
+        if (int32_t(std::nearbyint(std::ldexp(largest, 9 - (sharedExponent - 15)))) == 512)
+            ++sharedExponent;
+        packed32 = uint32_t(sharedExponent) << 27;
+        for (uint32_t channel = 0; channel < 3; ++channel)
+            packed32 |= uint32_t(std::nearbyint(std::ldexp(clamped[channel], 9 - (sharedExponent - 15)))) << (9 * channel);
+        memcpy(dst, &packed32, 4);
+        break;
+    }
+
+    default:
+        FFX_ASSERT_MESSAGE(false, "Format not yet supported");
+        break;
+    }
+}
+
+// compute the layout of a resource in host memory, returns the total size in bytes
+static uint64_t getResourceLayoutCPU(const FfxResourceDescription& description, uint32_t mipOffsets[FFX_CPU_MAX_MIP_LEVELS])
+{
+    if (description.type == FFX_RESOURCE_TYPE_BUFFER) {
+        if (mipOffsets)
+            memset(mipOffsets, 0, sizeof(uint32_t) * FFX_CPU_MAX_MIP_LEVELS);
+        return description.size;
+    }
+
+    const uint32_t texelSize = ffxGetSurfaceFormatSizeCPU(description.format);
+    const uint32_t width     = FFX_MAXIMUM(description.width, 1u);
+    const uint32_t height    = description.type == FFX_RESOURCE_TYPE_TEXTURE1D ? 1 : FFX_MAXIMUM(description.height, 1u);
+    const uint32_t depth     = FFX_MAXIMUM(description.depth, 1u);
+
+    // 0 requests the full mip chain
+    uint32_t mipCount = description.mipCount;
+    if (mipCount == 0) {
+        uint32_t largest = FFX_MAXIMUM(width, height);
+        if (description.type == FFX_RESOURCE_TYPE_TEXTURE3D)
+            largest = FFX_MAXIMUM(largest, depth);
+        while (largest >> mipCount)
+            ++mipCount;
+    }
+    mipCount = FFX_MINIMUM(mipCount, uint32_t(FFX_CPU_MAX_MIP_LEVELS));
+
+    uint64_t offset = 0;
+    for (uint32_t mip = 0; mip < FFX_CPU_MAX_MIP_LEVELS; ++mip) {
+
+        if (mipOffsets)
+            mipOffsets[mip] = uint32_t(offset);
+
+        if (mip < mipCount) {
+            const uint64_t mipWidth  = FFX_MAXIMUM(width >> mip, 1u);
+            const uint64_t mipHeight = FFX_MAXIMUM(height >> mip, 1u);
+            const uint64_t mipDepth  = description.type == FFX_RESOURCE_TYPE_TEXTURE3D ? FFX_MAXIMUM(depth >> mip, 1u) : depth;
+            offset += mipWidth * mipHeight * mipDepth * texelSize;
+        }
+    }
+
+    return offset;
+}
+
+size_t ffxGetResourceMemorySizeCPU(FfxResourceDescription ffxResDescription)
+{
+    return size_t(getResourceLayoutCPU(ffxResDescription, nullptr));
+}
+
+static uint8_t* getTexelAddressCPU(const FfxCpuTextureView* view, int32_t x, int32_t y, int32_t z, uint32_t mip)
+{
+    if (view == nullptr || view->data == nullptr || view->mipOffsets == nullptr || mip >= FFX_CPU_MAX_MIP_LEVELS)
+        return nullptr;
+
+    const FfxResourceDescription& description = view->description;
+    const bool     is3D   = description.type == FFX_RESOURCE_TYPE_TEXTURE3D;
+    const int32_t  width  = int32_t(FFX_MAXIMUM(description.width >> mip, 1u));
+    const int32_t  height = description.type == FFX_RESOURCE_TYPE_TEXTURE1D ? 1 : int32_t(FFX_MAXIMUM(description.height >> mip, 1u));
+    const int32_t  depth  = is3D ? int32_t(FFX_MAXIMUM(description.depth >> mip, 1u)) : int32_t(FFX_MAXIMUM(description.depth, 1u));
+
+    if (x < 0 || y < 0 || z < 0 || x >= width || y >= height || z >= depth)
+        return nullptr;
+
+    const uint64_t texelIndex = (uint64_t(z) * uint64_t(height) + uint64_t(y)) * uint64_t(width) + uint64_t(x);
+    return view->data + view->mipOffsets[mip] + texelIndex * ffxGetSurfaceFormatSizeCPU(description.format);
+}
+
+uint8_t* ffxGetTexelAddressCPU(const FfxCpuTextureView* view, int32_t x, int32_t y, int32_t z, uint32_t mip)
+{
+    return getTexelAddressCPU(view, x, y, z, view ? view->mip + mip : mip);
+}
+
+void ffxLoadTexelCPU(const FfxCpuTextureView* view, int32_t x, int32_t y, int32_t z, uint32_t mip, uint32_t texel[4])
+{
+    const uint8_t* src = getTexelAddressCPU(view, x, y, z, view ? view->mip + mip : mip);
+    if (src == nullptr) {
+        texel[0] = texel[1] = texel[2] = texel[3] = 0;
+        return;
+    }
+
+    decodeTexelCPU(view->description.format, src, texel);
+}
+
+void ffxStoreTexelCPU(const FfxCpuTextureView* view, int32_t x, int32_t y, int32_t z, const uint32_t texel[4])
+{
+    uint8_t* dst = getTexelAddressCPU(view, x, y, z, view ? view->mip : 0);
+    if (dst == nullptr)
+        return;
+
+    encodeTexelCPU(view->description.format, dst, texel);
+}
+
+void ffxSampleLevelCPU(const FfxCpuTextureView* view, float u, float v, int32_t z, uint32_t mip, float texel[4])
+{
+    texel[0] = texel[1] = texel[2] = texel[3] = 0.0f;
+    if (view == nullptr || view->data == nullptr)
+        return;
+
+    const uint32_t viewMip = view->mip + mip;
+    const int32_t  width   = int32_t(FFX_MAXIMUM(view->description.width >> viewMip, 1u));
+    const int32_t  height  = view->description.type == FFX_RESOURCE_TYPE_TEXTURE1D ? 1 : int32_t(FFX_MAXIMUM(view->description.height >> viewMip, 1u));
+
+    const float   x  = u * float(width) - 0.5f;
+    const float   y  = v * float(height) - 0.5f;
+    const float   x0 = std::floor(x);
+    const float   y0 = std::floor(y);
+    const float   fx = x - x0;
+    const float   fy = y - y0;
+
+    // clamp addressing
+    const int32_t left   = FFX_MINIMUM(FFX_MAXIMUM(int32_t(x0), 0), width - 1);
+    const int32_t right  = FFX_MINIMUM(FFX_MAXIMUM(int32_t(x0) + 1, 0), width - 1);
+    const int32_t top    = FFX_MINIMUM(FFX_MAXIMUM(int32_t(y0), 0), height - 1);
+    const int32_t bottom = FFX_MINIMUM(FFX_MAXIMUM(int32_t(y0) + 1, 0), height - 1);
+
+    uint32_t topLeft[4], topRight[4], bottomLeft[4], bottomRight[4];
+    ffxLoadTexelCPU(view, left, top, z, mip, topLeft);
+    ffxLoadTexelCPU(view, right, top, z, mip, topRight);
+    ffxLoadTexelCPU(view, left, bottom, z, mip, bottomLeft);
+    ffxLoadTexelCPU(view, right, bottom, z, mip, bottomRight);
+
+    for (uint32_t channel = 0; channel < 4; ++channel) {
+        const float upper = asFloatCPU(topLeft[channel]) + (asFloatCPU(topRight[channel]) - asFloatCPU(topLeft[channel])) * fx;
+        const float lower = asFloatCPU(bottomLeft[channel]) + (asFloatCPU(bottomRight[channel]) - asFloatCPU(bottomLeft[channel])) * fx;
+        texel[channel] = upper + (lower - upper) * fy;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Workgroup emulation
+
+// invocation of a workgroup with its own stack, to be suspended at barriers
+typedef struct Invocation_CPU {
+
+#if defined(_WIN32)
+    void*                           fiber;
+#else
+    ucontext_t                      context;
+    uint8_t*                        stack;
+#endif // #if defined(_WIN32)
+    uint32_t                        localIndex;
+    bool                            finished;
+
+} Invocation_CPU;
+
+// invocations of the workgroup executed by a thread, their fibers are reused by every workgroup of the thread
+typedef struct WorkGroup_CPU {
+
+#if defined(_WIN32)
+    void*                           schedulerFiber = nullptr;
+#else
+    ucontext_t                      schedulerContext;
+#endif // #if defined(_WIN32)
+    std::vector<Invocation_CPU*>    invocations;
+    Invocation_CPU*                 current = nullptr;
+    bool                            direct = false;
+    FfxCpuInvocationFunc            function = nullptr;
+    void*                           userData = nullptr;
+
+    ~WorkGroup_CPU();
+
+} WorkGroup_CPU;
+
+static thread_local WorkGroup_CPU s_WorkGroup;
+
+WorkGroup_CPU::~WorkGroup_CPU()
+{
+    for (Invocation_CPU* invocation : invocations) {
+#if defined(_WIN32)
+        DeleteFiber(invocation->fiber);
+#else
+        delete[] invocation->stack;
+#endif // #if defined(_WIN32)
+        delete invocation;
+    }
+}
+
+static void switchToInvocationCPU(Invocation_CPU* invocation)
+{
+    s_WorkGroup.current = invocation;
+#if defined(_WIN32)
+    SwitchToFiber(invocation->fiber);
+#else
+    swapcontext(&s_WorkGroup.schedulerContext, &invocation->context);
+#endif // #if defined(_WIN32)
+    s_WorkGroup.current = nullptr;
+}
+
+static void switchToSchedulerCPU(Invocation_CPU* invocation)
+{
+#if defined(_WIN32)
+    (void)invocation;
+    SwitchToFiber(s_WorkGroup.schedulerFiber);
+#else
+    swapcontext(&invocation->context, &s_WorkGroup.schedulerContext);
+#endif // #if defined(_WIN32)
+}
+
+// entry point of the fibers, which loop over the invocations they are switched to
+#if defined(_WIN32)
+static void WINAPI invocationFiberCPU(void* parameter)
+{
+    Invocation_CPU* invocation = static_cast<Invocation_CPU*>(parameter);
+#else
+static void invocationFiberCPU()
+{
+    Invocation_CPU* invocation = s_WorkGroup.current;
+#endif // #if defined(_WIN32)
+
+    for (;;) {
+        s_WorkGroup.function(s_WorkGroup.userData, invocation->localIndex);
+        invocation->finished = true;
+        switchToSchedulerCPU(invocation);
+    }
+}
+
+static Invocation_CPU* createInvocationCPU()
+{
+    Invocation_CPU* invocation = new Invocation_CPU;
+#if defined(_WIN32)
+    invocation->fiber = CreateFiberEx(0, FFX_CPU_INVOCATION_STACK_SIZE, FIBER_FLAG_FLOAT_SWITCH, invocationFiberCPU, invocation);
+    FFX_ASSERT_MESSAGE(invocation->fiber != nullptr, "Failed to create a workgroup invocation fiber");
+#else
+    invocation->stack = new uint8_t[FFX_CPU_INVOCATION_STACK_SIZE];
+    getcontext(&invocation->context);
+    invocation->context.uc_stack.ss_sp   = invocation->stack;
+    invocation->context.uc_stack.ss_size = FFX_CPU_INVOCATION_STACK_SIZE;
+    invocation->context.uc_link          = nullptr;
+    makecontext(&invocation->context, invocationFiberCPU, 0);
+#endif // #if defined(_WIN32)
+    return invocation;
+}
+
+// threads need to be fibers themselves to switch to the invocations, returns whether the thread was converted
+static bool beginFiberThreadCPU()
+{
+#if defined(_WIN32)
+    if (IsThreadAFiber())
+        return false;
+    ConvertThreadToFiber(nullptr);
+    return true;
+#else
+    return false;
+#endif // #if defined(_WIN32)
+}
+
+static void endFiberThreadCPU(bool converted)
+{
+#if defined(_WIN32)
+    if (converted)
+        ConvertFiberToThread();
+#else
+    (void)converted;
+#endif // #if defined(_WIN32)
+}
+
+void ffxExecuteWorkGroupCPU(uint32_t invocationCount, FfxCpuInvocationFunc invocation, void* userData)
+{
+    FFX_ASSERT_MESSAGE(invocationCount <= FFX_CPU_MAX_WORKGROUP_SIZE, "Workgroup exceeds FFX_CPU_MAX_WORKGROUP_SIZE invocations");
+    FFX_ASSERT_MESSAGE(s_WorkGroup.function == nullptr, "Workgroups cannot be executed from a workgroup invocation");
+    if (invocationCount == 0)
+        return;
+
+    const bool converted = beginFiberThreadCPU();
+#if defined(_WIN32)
+    s_WorkGroup.schedulerFiber = GetCurrentFiber();
+#endif // #if defined(_WIN32)
+
+    while (s_WorkGroup.invocations.size() < invocationCount)
+        s_WorkGroup.invocations.push_back(createInvocationCPU());
+
+    s_WorkGroup.function = invocation;
+    s_WorkGroup.userData = userData;
+    for (uint32_t localIndex = 0; localIndex < invocationCount; ++localIndex) {
+        s_WorkGroup.invocations[localIndex]->localIndex = localIndex;
+        s_WorkGroup.invocations[localIndex]->finished   = false;
+    }
+
+    // the first invocation tells whether the workgroup synchronizes at all
+    switchToInvocationCPU(s_WorkGroup.invocations[0]);
+
+    if (s_WorkGroup.invocations[0]->finished) {
+
+        s_WorkGroup.direct = true;
+        for (uint32_t localIndex = 1; localIndex < invocationCount; ++localIndex)
+            invocation(userData, localIndex);
+        s_WorkGroup.direct = false;
+
+    } else {
+
+        // every pass over the invocations moves all of them past one barrier
+        uint32_t remaining = invocationCount;
+        for (uint32_t localIndex = 1; remaining > 0; localIndex = (localIndex + 1) % invocationCount) {
+
+            Invocation_CPU* current = s_WorkGroup.invocations[localIndex];
+            if (current->finished)
+                continue;
+
+            switchToInvocationCPU(current);
+            if (current->finished)
+                --remaining;
+        }
+    }
+
+    s_WorkGroup.function = nullptr;
+    s_WorkGroup.userData = nullptr;
+    endFiberThreadCPU(converted);
+}
+
+void ffxWorkGroupBarrierCPU(void)
+{
+    FFX_ASSERT_MESSAGE(!s_WorkGroup.direct, "Barrier reached in control flow that is not uniform across the workgroup");
+    FFX_ASSERT_MESSAGE(s_WorkGroup.current != nullptr, "Barriers must be reached from a workgroup invocation");
+    switchToSchedulerCPU(s_WorkGroup.current);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Worker pool
+
+static void runWorkGroupsCPU(WorkerPool_CPU* workerPool)
+{
+    const FfxCpuDispatchDescription* dispatch = workerPool->dispatch;
+    const uint32_t groupsX = dispatch->dimensions[0];
+    const uint32_t groupsY = dispatch->dimensions[1];
+
+    for (uint32_t workGroupIndex = workerPool->nextWorkGroup++; workGroupIndex < workerPool->workGroupCount; workGroupIndex = workerPool->nextWorkGroup++) {
+
+        const uint32_t workGroupId[3] = {
+            workGroupIndex % groupsX,
+            (workGroupIndex / groupsX) % groupsY,
+            workGroupIndex / (groupsX * groupsY) };
+
+        workerPool->kernel(dispatch, workGroupId);
+    }
+}
+
+static void workerThreadCPU(WorkerPool_CPU* workerPool)
+{
+    uint64_t generation = 0;
+
+    // workers stay fibers for their whole life, so workgroups do not convert them every time
+    const bool converted = beginFiberThreadCPU();
+
+    for (;;) {
+
+        {
+            std::unique_lock<std::mutex> poolLock{ workerPool->mutex };
+            workerPool->wakeCondition.wait(poolLock, [&] { return workerPool->shutdown || workerPool->generation != generation; });
+
+            if (workerPool->shutdown)
+                break;
+
+            generation = workerPool->generation;
+        }
+
+        runWorkGroupsCPU(workerPool);
+
+        {
+            std::lock_guard<std::mutex> poolLock{ workerPool->mutex };
+            if (--workerPool->busyWorkers == 0)
+                workerPool->doneCondition.notify_one();
+        }
+    }
+
+    endFiberThreadCPU(converted);
+}
+
+static WorkerPool_CPU* createWorkerPoolCPU(uint32_t workerThreadCount)
+{
+    WorkerPool_CPU* workerPool = new WorkerPool_CPU;
+
+    if (workerThreadCount == 0)
+        workerThreadCount = FFX_MAXIMUM(std::thread::hardware_concurrency(), 1u);
+
+    // the thread calling ExecuteGpuJobs takes part in every dispatch
+    for (uint32_t workerIndex = 1; workerIndex < workerThreadCount; ++workerIndex)
+        workerPool->threads.emplace_back(workerThreadCPU, workerPool);
+
+    return workerPool;
+}
+
+static void destroyWorkerPoolCPU(WorkerPool_CPU* workerPool)
+{
+    {
+        std::lock_guard<std::mutex> poolLock{ workerPool->mutex };
+        workerPool->shutdown = true;
+    }
+    workerPool->wakeCondition.notify_all();
+
+    for (std::thread& thread : workerPool->threads)
+        thread.join();
+
+    delete workerPool;
+}
+
+static void dispatchWorkGroupsCPU(WorkerPool_CPU* workerPool, FfxCpuComputeKernelFunc kernel, const FfxCpuDispatchDescription* dispatch)
+{
+    const uint32_t workGroupCount = dispatch->dimensions[0] * dispatch->dimensions[1] * dispatch->dimensions[2];
+    if (workGroupCount == 0)
+        return;
+
+    {
+        std::lock_guard<std::mutex> poolLock{ workerPool->mutex };
+        workerPool->kernel         = kernel;
+        workerPool->dispatch       = dispatch;
+        workerPool->workGroupCount = workGroupCount;
+        workerPool->nextWorkGroup  = 0;
+        workerPool->busyWorkers    = uint32_t(workerPool->threads.size());
+        ++workerPool->generation;
+    }
+    workerPool->wakeCondition.notify_all();
+
+    const bool converted = beginFiberThreadCPU();
+    runWorkGroupsCPU(workerPool);
+    endFiberThreadCPU(converted);
+
+    // dispatches are serialized, wait until every worker is done with this one
+    std::unique_lock<std::mutex> poolLock{ workerPool->mutex };
+    workerPool->doneCondition.wait(poolLock, [&] { return workerPool->busyWorkers == 0; });
+}
+
+//////////////////////////////////////////////////////////////////////////
+// CPU back end implementation
+
+FfxUInt32 GetSDKVersionCPU(FfxInterface* backendInterface)
+{
+    return FFX_SDK_MAKE_VERSION(FFX_SDK_VERSION_MAJOR, FFX_SDK_VERSION_MINOR, FFX_SDK_VERSION_PATCH);
+}
+
+FfxErrorCode GetEffectGpuMemoryUsageCPU(FfxInterface* backendInterface, FfxUInt32 effectContextId, FfxEffectMemoryUsage* outVramUsage)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != outVramUsage);
+
+    BackendContext_CPU*                backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+    BackendContext_CPU::EffectContext& effectContext  = backendContext->pEffectContexts[effectContextId];
+
+    *outVramUsage = effectContext.vramUsage;
+
+    return FFX_OK;
+}
+
+// initialize the CPU backend
+FfxErrorCode CreateBackendContextCPU(FfxInterface* backendInterface, FfxEffect effect, FfxEffectBindlessConfig* bindlessConfig, FfxUInt32* effectContextId)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != backendInterface->device);
+
+    // set up some internal resources we need (space for resources and staging constants)
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    // Set things up if this is the first invocation
+    if (!backendContext->refCount) {
+
+        backendContext->device = reinterpret_cast<FfxCpuDeviceDescription*>(backendInterface->device);
+        backendContext->pWorkerPool = createWorkerPoolCPU(backendContext->device->workerThreadCount);
+
+        // Map all of our pointers
+        uint32_t gpuJobDescArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_MAX_GPU_JOBS * sizeof(FfxGpuJobDescription), sizeof(uint32_t));
+        uint32_t resourceArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_MAX_RESOURCE_COUNT * sizeof(BackendContext_CPU::Resource), sizeof(uint64_t));
+        uint32_t stagingRingBufferArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE, sizeof(uint32_t));
+        uint32_t contextArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * sizeof(BackendContext_CPU::EffectContext), sizeof(uint32_t));
+
+        uint8_t* pMem = (uint8_t*)((BackendContext_CPU*)(backendContext + 1));
+
+        // Map gpu job array
+        backendContext->pGpuJobs = (FfxGpuJobDescription*)pMem;
+        memset(backendContext->pGpuJobs, 0, gpuJobDescArraySize);
+        pMem += gpuJobDescArraySize;
+
+        // Map the resources
+        backendContext->pResources = (BackendContext_CPU::Resource*)(pMem);
+        memset(backendContext->pResources, 0, resourceArraySize);
+        pMem += resourceArraySize;
+
+        // Map the staging buffer
+        backendContext->pStagingRingBuffer = (uint8_t*)(pMem);
+        memset(backendContext->pStagingRingBuffer, 0, stagingRingBufferArraySize);
+        pMem += stagingRingBufferArraySize;
+
+        // Map the effect contexts
+        backendContext->pEffectContexts = reinterpret_cast<BackendContext_CPU::EffectContext*>(pMem);
+        memset(backendContext->pEffectContexts, 0, contextArraySize);
+    }
+
+    // Increment the ref count
+    ++backendContext->refCount;
+
+    // Get an available context id
+    for (uint32_t i = 0; i < backendContext->maxEffectContexts; ++i) {
+        if (!backendContext->pEffectContexts[i].active) {
+            *effectContextId = i;
+
+            // Reset everything accordingly
+            BackendContext_CPU::EffectContext& effectContext = backendContext->pEffectContexts[i];
+            effectContext.active = true;
+            effectContext.nextStaticResource = (i * FFX_MAX_RESOURCE_COUNT) + 1;
+            effectContext.nextDynamicResource = (i * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT - 1;
+            break;
+        }
+    }
+
+    return FFX_OK;
+}
+
+// query device capabilities to select the optimal shader permutation
+FfxErrorCode GetDeviceCapabilitiesCPU(FfxInterface* backendInterface, FfxDeviceCapabilities* deviceCapabilities)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != deviceCapabilities);
+
+    // kernels run with full precision and without wave operations, every invocation is a lane of its own
+    memset(deviceCapabilities, 0, sizeof(*deviceCapabilities));
+    deviceCapabilities->maximumSupportedShaderModel = FFX_SHADER_MODEL_5_1;
+    deviceCapabilities->waveLaneCountMin = 1;
+    deviceCapabilities->waveLaneCountMax = 1;
+
+    return FFX_OK;
+}
+
+// deinitialize the CPU backend
+FfxErrorCode DestroyBackendContextCPU(FfxInterface* backendInterface, FfxUInt32 effectContextId)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+    FFX_ASSERT(backendContext->refCount > 0);
+
+    // Delete any resources allocated by this context
+    BackendContext_CPU::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+    for (uint32_t currentStaticResourceIndex = effectContextId * FFX_MAX_RESOURCE_COUNT; currentStaticResourceIndex < effectContext.nextStaticResource; ++currentStaticResourceIndex) {
+        if (backendContext->pResources[currentStaticResourceIndex].resourcePtr) {
+            FFX_ASSERT_MESSAGE(false, "FFXInterface: CPU: SDK Resource was not destroyed prior to destroying the backend context. There is a resource leak.");
+            FfxResourceInternal internalResource = { static_cast<int32_t>(currentStaticResourceIndex) };
+            DestroyResourceCPU(backendInterface, internalResource, effectContextId);
+        }
+    }
+    for (uint32_t currentResourceIndex = effectContextId * FFX_MAX_RESOURCE_COUNT; currentResourceIndex < effectContextId * FFX_MAX_RESOURCE_COUNT + FFX_MAX_RESOURCE_COUNT; ++currentResourceIndex) {
+        if (backendContext->pResources[currentResourceIndex].resourcePtr) {
+            FfxResourceInternal internalResource = { static_cast<int32_t>(currentResourceIndex) };
+            DestroyResourceCPU(backendInterface, internalResource, effectContextId);
+        }
+    }
+
+    // Free up for use by another context
+    effectContext.nextStaticResource = 0;
+    effectContext.active = false;
+
+    // Decrement ref count
+    --backendContext->refCount;
+
+    if (!backendContext->refCount) {
+
+        backendContext->gpuJobCount = 0;
+
+        if (backendContext->pWorkerPool != NULL) {
+            destroyWorkerPoolCPU(backendContext->pWorkerPool);
+            backendContext->pWorkerPool = NULL;
+        }
+        backendContext->device = NULL;
+    }
+
+    return FFX_OK;
+}
+
+// create a internal resource that will stay alive until effect gets shut down
+FfxErrorCode CreateResourceCPU(
+    FfxInterface* backendInterface,
+    const FfxCreateResourceDescription* createResourceDescription,
+    FfxUInt32 effectContextId,
+    FfxResourceInternal* outTexture
+)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != createResourceDescription);
+    FFX_ASSERT(NULL != outTexture);
+    FFX_ASSERT_MESSAGE(createResourceDescription->initData.type != FFX_RESOURCE_INIT_DATA_TYPE_INVALID,
+                       "InitData type cannot be FFX_RESOURCE_INIT_DATA_TYPE_INVALID. Please explicitly specify the resource initialization type.");
+
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+    BackendContext_CPU::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    FFX_ASSERT(effectContext.nextStaticResource + 1 < effectContext.nextDynamicResource);
+
+    outTexture->internalIndex = effectContext.nextStaticResource++;
+    BackendContext_CPU::Resource* backendResource = &backendContext->pResources[outTexture->internalIndex];
+    backendResource->resourceDescription = createResourceDescription->resourceDescription;
+
+    const uint64_t resourceSize = getResourceLayoutCPU(backendResource->resourceDescription, backendResource->mipOffsets);
+
+    uint8_t* resourcePtr = new (std::nothrow) uint8_t[size_t(resourceSize ? resourceSize : 1)];
+    if (resourcePtr == nullptr)
+        return FFX_ERROR_OUT_OF_MEMORY;
+
+    switch (createResourceDescription->initData.type) {
+
+    case FFX_RESOURCE_INIT_DATA_TYPE_BUFFER:
+        memset(resourcePtr, 0, size_t(resourceSize));
+        if (createResourceDescription->initData.buffer)
+            memcpy(resourcePtr, createResourceDescription->initData.buffer, size_t(FFX_MINIMUM(uint64_t(createResourceDescription->initData.size), resourceSize)));
+        break;
+
+    case FFX_RESOURCE_INIT_DATA_TYPE_VALUE:
+        memset(resourcePtr, createResourceDescription->initData.value, size_t(resourceSize));
+        break;
+
+    default:
+        memset(resourcePtr, 0, size_t(resourceSize));
+        break;
+    }
+
+    backendResource->resourcePtr = resourcePtr;
+    backendResource->memorySize = resourceSize;
+    backendResource->ownsMemory = true;
+
+#ifdef _DEBUG
+    copyResourceNameCPU(backendResource->resourceName, createResourceDescription->name);
+#endif
+
+    effectContext.vramUsage.totalUsageInBytes += resourceSize;
+    if ((createResourceDescription->resourceDescription.flags & FFX_RESOURCE_FLAGS_ALIASABLE) == FFX_RESOURCE_FLAGS_ALIASABLE)
+    {
+        effectContext.vramUsage.aliasableUsageInBytes += resourceSize;
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode DestroyResourceCPU(
+    FfxInterface* backendInterface,
+    FfxResourceInternal resource,
+    FfxUInt32 effectContextId)
+{
+    FFX_ASSERT(NULL != backendInterface);
+
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+    BackendContext_CPU::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+    if ((resource.internalIndex >= int32_t(effectContextId * FFX_MAX_RESOURCE_COUNT)) && (resource.internalIndex < int32_t(effectContextId * FFX_MAX_RESOURCE_COUNT + FFX_MAX_RESOURCE_COUNT))) {
+
+        BackendContext_CPU::Resource& backendResource = backendContext->pResources[resource.internalIndex];
+        if (backendResource.resourcePtr) {
+
+            if (backendResource.ownsMemory) {
+
+                // update effect memory usage
+                effectContext.vramUsage.totalUsageInBytes -= backendResource.memorySize;
+                if ((backendResource.resourceDescription.flags & FFX_RESOURCE_FLAGS_ALIASABLE) == FFX_RESOURCE_FLAGS_ALIASABLE)
+                {
+                    effectContext.vramUsage.aliasableUsageInBytes -= backendResource.memorySize;
+                }
+
+                delete[] backendResource.resourcePtr;
+            }
+
+            backendResource.resourcePtr = nullptr;
+            backendResource.memorySize = 0;
+            backendResource.ownsMemory = false;
+        }
+
+        return FFX_OK;
+    }
+
+    return FFX_ERROR_OUT_OF_RANGE;
+}
+
+FfxErrorCode MapResourceCPU(FfxInterface* backendInterface, FfxResourceInternal resource, void** ptr)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != ptr);
+
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    // host memory is always visible
+    *ptr = backendContext->pResources[resource.internalIndex].resourcePtr;
+
+    return *ptr ? FFX_OK : FFX_ERROR_INVALID_ARGUMENT;
+}
+
+FfxErrorCode UnmapResourceCPU(FfxInterface* backendInterface, FfxResourceInternal resource)
+{
+    FFX_ASSERT(NULL != backendInterface);
+
+    return FFX_OK;
+}
+
+FfxErrorCode RegisterResourceCPU(
+    FfxInterface* backendInterface,
+    const FfxResource* inFfxResource,
+    FfxUInt32 effectContextId,
+    FfxResourceInternal* outFfxResourceInternal
+)
+{
+    FFX_ASSERT(NULL != backendInterface);
+
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)(backendInterface->scratchBuffer);
+    uint8_t* resourcePtr = reinterpret_cast<uint8_t*>(inFfxResource->resource);
+    BackendContext_CPU::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    if (resourcePtr == nullptr) {
+
+        outFfxResourceInternal->internalIndex = 0; // Always maps to FFX_<feature>_RESOURCE_IDENTIFIER_NULL;
+        return FFX_OK;
+    }
+
+    FFX_ASSERT(effectContext.nextDynamicResource > effectContext.nextStaticResource);
+    outFfxResourceInternal->internalIndex = effectContext.nextDynamicResource--;
+
+    BackendContext_CPU::Resource* backendResource = &backendContext->pResources[outFfxResourceInternal->internalIndex];
+
+    DestroyResourceCPU(backendInterface, *outFfxResourceInternal, effectContextId);
+
+    backendResource->resourcePtr = resourcePtr;
+    backendResource->resourceDescription = inFfxResource->description;
+    backendResource->memorySize = getResourceLayoutCPU(backendResource->resourceDescription, backendResource->mipOffsets);
+    backendResource->ownsMemory = false;
+
+#ifdef _DEBUG
+    copyResourceNameCPU(backendResource->resourceName, inFfxResource->name);
+#endif
+
+    return FFX_OK;
+}
+
+FfxResource GetResourceCPU(FfxInterface* backendInterface, FfxResourceInternal inResource)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    FfxResourceDescription ffxResDescription = backendInterface->fpGetResourceDescription(backendInterface, inResource);
+
+    FfxResource resource = {};
+    resource.resource = reinterpret_cast<void*>(backendContext->pResources[inResource.internalIndex].resourcePtr);
+    resource.state = FFX_RESOURCE_STATE_COMMON;
+    resource.description = ffxResDescription;
+
+#ifdef _DEBUG
+    copyResourceNameCPU(resource.name, backendContext->pResources[inResource.internalIndex].resourceName);
+#endif
+
+    return resource;
+}
+
+// dispose dynamic resources: This should be called at the end of the frame
+FfxErrorCode UnregisterResourcesCPU(FfxInterface* backendInterface, FfxCommandList commandList, FfxUInt32 effectContextId)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)(backendInterface->scratchBuffer);
+    BackendContext_CPU::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    // Walk back all the resources that don't belong to us and forget about them
+    for (uint32_t resourceIndex = ++effectContext.nextDynamicResource; resourceIndex < (effectContextId * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT; ++resourceIndex)
+    {
+        backendContext->pResources[resourceIndex].resourcePtr = nullptr;
+        backendContext->pResources[resourceIndex].ownsMemory = false;
+    }
+
+    effectContext.nextDynamicResource      = (effectContextId * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT - 1;
+
+    return FFX_OK;
+}
+
+FfxResourceDescription GetResourceDescriptorCPU(
+    FfxInterface* backendInterface,
+    FfxResourceInternal resource)
+{
+    FFX_ASSERT(NULL != backendInterface);
+
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    FfxResourceDescription resourceDescription = backendContext->pResources[resource.internalIndex].resourceDescription;
+    return resourceDescription;
+}
+
+FfxErrorCode StageConstantBufferDataCPU(FfxInterface* backendInterface, void* data, FfxUInt32 size, FfxConstantBuffer* constantBuffer)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    if (data && constantBuffer)
+    {
+        if ((backendContext->stagingRingBufferBase + FFX_ALIGN_UP(size, 256)) >= FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE)
+            backendContext->stagingRingBufferBase = 0;
+
+        uint32_t* dstPtr = (uint32_t*)(backendContext->pStagingRingBuffer + backendContext->stagingRingBufferBase);
+
+        memcpy(dstPtr, data, size);
+
+        constantBuffer->data            = dstPtr;
+        constantBuffer->num32BitEntries = size / sizeof(uint32_t);
+
+        backendContext->stagingRingBufferBase += FFX_ALIGN_UP(size, 256);
+
+        return FFX_OK;
+    }
+    else
+        return FFX_ERROR_INVALID_POINTER;
+}
+
+#ifdef FFX_DEBUG
+static void copyBindingNameCPU(wchar_t* dst, size_t dstSize, const char* src)
+{
+    size_t index = 0;
+    for (; src && src[index] && index + 1 < dstSize; ++index)
+        dst[index] = wchar_t(static_cast<unsigned char>(src[index]));
+    dst[index] = 0;
+}
+#endif
+
+// Blobs from the accessors carry precomputed name hashes, fall back to hashing the name otherwise
+static uint32_t getBindingNameHashCPU(const char** names, const uint32_t* nameHashes, uint32_t index)
+{
+    return nameHashes ? nameHashes[index] : ffxHashBindingName(names[index]);
+}
+
+FfxErrorCode CreatePipelineCPU(
+    FfxInterface* backendInterface,
+    FfxEffect effect,
+    FfxPass pass,
+    uint32_t permutationOptions,
+    const FfxPipelineDescription* pipelineDescription,
+    FfxUInt32                     effectContextId,
+    FfxPipelineState* outPipeline)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != pipelineDescription);
+
+    // the bytecode is not used, only the reflection of the pass
+    FfxShaderBlob shaderBlob = { };
+    FFX_VALIDATE(ffxGetPermutationBlobByIndex(effect, pass, FFX_BIND_COMPUTE_SHADER_STAGE, permutationOptions, &shaderBlob));
+    ffxReleasePermutationBlob(shaderBlob.data);
+
+    // kernels bake their permutation in, so one built for other options would give wrong results
+    FfxCpuComputeKernelFunc kernel = findComputeKernelCPU(effect, pass, permutationOptions);
+    FFX_RETURN_ON_ERROR(
+        kernel,
+        FFX_ERROR_BACKEND_API_ERROR);
+
+    // Only set the command signature if this is setup as an indirect workload
+    outPipeline->cmdSignature = nullptr;
+
+    uint32_t flattenedSrvTextureCount = 0;
+
+    for (uint32_t srvIndex = 0; srvIndex < shaderBlob.srvTextureCount; ++srvIndex)
+    {
+        uint32_t slotIndex = shaderBlob.boundSRVTextures[srvIndex];
+        uint32_t bindCount = shaderBlob.boundSRVTextureCounts[srvIndex];
+
+        for (uint32_t arrayIndex = 0; arrayIndex < bindCount; arrayIndex++)
+        {
+            uint32_t bindingIndex = flattenedSrvTextureCount++;
+
+            outPipeline->srvTextureBindings[bindingIndex].slotIndex = slotIndex;
+            outPipeline->srvTextureBindings[bindingIndex].arrayIndex = arrayIndex;
+            outPipeline->srvTextureBindings[bindingIndex].nameHash = getBindingNameHashCPU(shaderBlob.boundSRVTextureNames, shaderBlob.boundSRVTextureNameHashes, srvIndex);
+#ifdef FFX_DEBUG
+            copyBindingNameCPU(outPipeline->srvTextureBindings[bindingIndex].name,
+                               FFX_RESOURCE_NAME_SIZE,
+                               shaderBlob.boundSRVTextureNames[srvIndex]);
+#endif
+        }
+    }
+
+    outPipeline->srvTextureCount = flattenedSrvTextureCount;
+    FFX_ASSERT(outPipeline->srvTextureCount < FFX_MAX_NUM_SRVS);
+
+    uint32_t flattenedUavTextureCount = 0;
+
+    for (uint32_t uavIndex = 0; uavIndex < shaderBlob.uavTextureCount; ++uavIndex)
+    {
+        uint32_t slotIndex = shaderBlob.boundUAVTextures[uavIndex];
+        uint32_t bindCount = shaderBlob.boundUAVTextureCounts[uavIndex];
+
+        for (uint32_t arrayIndex = 0; arrayIndex < bindCount; arrayIndex++)
+        {
+            uint32_t bindingIndex = flattenedUavTextureCount++;
+
+            outPipeline->uavTextureBindings[bindingIndex].slotIndex = slotIndex;
+            outPipeline->uavTextureBindings[bindingIndex].arrayIndex = arrayIndex;
+            outPipeline->uavTextureBindings[bindingIndex].nameHash = getBindingNameHashCPU(shaderBlob.boundUAVTextureNames, shaderBlob.boundUAVTextureNameHashes, uavIndex);
+#ifdef FFX_DEBUG
+            copyBindingNameCPU(outPipeline->uavTextureBindings[bindingIndex].name,
+                               FFX_RESOURCE_NAME_SIZE,
+                               shaderBlob.boundUAVTextureNames[uavIndex]);
+#endif
+        }
+    }
+
+    outPipeline->uavTextureCount = flattenedUavTextureCount;
+    FFX_ASSERT(outPipeline->uavTextureCount < FFX_MAX_NUM_UAVS);
+
+    uint32_t flattenedSrvBufferCount = 0;
+
+    for (uint32_t srvIndex = 0; srvIndex < shaderBlob.srvBufferCount; ++srvIndex)
+    {
+        uint32_t slotIndex = shaderBlob.boundSRVBuffers[srvIndex];
+        uint32_t bindCount = shaderBlob.boundSRVBufferCounts[srvIndex];
+
+        for (uint32_t arrayIndex = 0; arrayIndex < bindCount; arrayIndex++)
+        {
+            uint32_t bindingIndex = flattenedSrvBufferCount++;
+
+            outPipeline->srvBufferBindings[bindingIndex].slotIndex = slotIndex;
+            outPipeline->srvBufferBindings[bindingIndex].arrayIndex = arrayIndex;
+            outPipeline->srvBufferBindings[bindingIndex].nameHash = getBindingNameHashCPU(shaderBlob.boundSRVBufferNames, shaderBlob.boundSRVBufferNameHashes, srvIndex);
+#ifdef FFX_DEBUG
+            copyBindingNameCPU(outPipeline->srvBufferBindings[bindingIndex].name,
+                               FFX_RESOURCE_NAME_SIZE,
+                               shaderBlob.boundSRVBufferNames[srvIndex]);
+#endif
+        }
+    }
+
+    outPipeline->srvBufferCount = flattenedSrvBufferCount;
+    FFX_ASSERT(outPipeline->srvBufferCount < FFX_MAX_NUM_SRVS);
+
+    uint32_t flattenedUavBufferCount = 0;
+
+    for (uint32_t uavIndex = 0; uavIndex < shaderBlob.uavBufferCount; ++uavIndex)
+    {
+        uint32_t slotIndex = shaderBlob.boundUAVBuffers[uavIndex];
+        uint32_t bindCount = shaderBlob.boundUAVBufferCounts[uavIndex];
+
+        for (uint32_t arrayIndex = 0; arrayIndex < bindCount; arrayIndex++)
+        {
+            uint32_t bindingIndex = flattenedUavBufferCount++;
+
+            outPipeline->uavBufferBindings[bindingIndex].slotIndex = slotIndex;
+            outPipeline->uavBufferBindings[bindingIndex].arrayIndex = arrayIndex;
+            outPipeline->uavBufferBindings[bindingIndex].nameHash = getBindingNameHashCPU(shaderBlob.boundUAVBufferNames, shaderBlob.boundUAVBufferNameHashes, uavIndex);
+#ifdef FFX_DEBUG
+            copyBindingNameCPU(outPipeline->uavBufferBindings[bindingIndex].name,
+                               FFX_RESOURCE_NAME_SIZE,
+                               shaderBlob.boundUAVBufferNames[uavIndex]);
+#endif
+        }
+    }
+
+    outPipeline->uavBufferCount = flattenedUavBufferCount;
+    FFX_ASSERT(outPipeline->uavBufferCount < FFX_MAX_NUM_UAVS);
+
+    for (uint32_t cbIndex = 0; cbIndex < shaderBlob.cbvCount; ++cbIndex)
+    {
+        outPipeline->constantBufferBindings[cbIndex].slotIndex = shaderBlob.boundConstantBuffers[cbIndex];
+        outPipeline->constantBufferBindings[cbIndex].arrayIndex = 1;
+        outPipeline->constantBufferBindings[cbIndex].nameHash = getBindingNameHashCPU(shaderBlob.boundConstantBufferNames, shaderBlob.boundConstantBufferNameHashes, cbIndex);
+#ifdef FFX_DEBUG
+        copyBindingNameCPU(outPipeline->constantBufferBindings[cbIndex].name,
+                           FFX_RESOURCE_NAME_SIZE,
+                           shaderBlob.boundConstantBufferNames[cbIndex]);
+#endif
+    }
+
+    outPipeline->constCount = shaderBlob.cbvCount;
+    FFX_ASSERT(outPipeline->constCount < FFX_MAX_NUM_CONST_BUFFERS);
+
+    outPipeline->staticTextureSrvCount = 0;
+    outPipeline->staticBufferSrvCount = 0;
+    outPipeline->staticTextureUavCount = 0;
+    outPipeline->staticBufferUavCount = 0;
+
+    // create the pipeline
+    Pipeline_CPU* cpuPipeline = new (std::nothrow) Pipeline_CPU;
+    if (cpuPipeline == nullptr)
+        return FFX_ERROR_OUT_OF_MEMORY;
+
+    cpuPipeline->kernel = kernel;
+    cpuPipeline->effect = effect;
+    cpuPipeline->pass = pass;
+    cpuPipeline->permutationOptions = permutationOptions;
+
+    outPipeline->pipeline = reinterpret_cast<FfxPipeline>(cpuPipeline);
+
+    return FFX_OK;
+}
+
+FfxErrorCode DestroyPipelineCPU(
+    FfxInterface* backendInterface,
+    FfxPipelineState* pipeline,
+    FfxUInt32 effectContextId)
+{
+    FFX_ASSERT(backendInterface != nullptr);
+    if (!pipeline) {
+        return FFX_OK;
+    }
+
+    // destroy pipeline
+    Pipeline_CPU* cpuPipeline = reinterpret_cast<Pipeline_CPU*>(pipeline->pipeline);
+    delete cpuPipeline;
+    pipeline->pipeline = nullptr;
+
+    return FFX_OK;
+}
+
+FfxErrorCode ScheduleGpuJobCPU(
+    FfxInterface* backendInterface,
+    const FfxGpuJobDescription* job
+)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != job);
+
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    FFX_ASSERT(backendContext->gpuJobCount < FFX_MAX_GPU_JOBS);
+
+    backendContext->pGpuJobs[backendContext->gpuJobCount] = *job;
+    backendContext->gpuJobCount++;
+
+    return FFX_OK;
+}
+
+static FfxCpuTextureView getTextureViewCPU(BackendContext_CPU* backendContext, FfxResourceInternal resource, uint32_t mip)
+{
+    BackendContext_CPU::Resource& backendResource = backendContext->pResources[resource.internalIndex];
+
+    FfxCpuTextureView view = {};
+    view.data = backendResource.resourcePtr;
+    view.description = backendResource.resourceDescription;
+    view.mipOffsets = backendResource.mipOffsets;
+    view.mip = mip;
+    return view;
+}
+
+static FfxCpuBufferView getBufferViewCPU(BackendContext_CPU* backendContext, FfxResourceInternal resource, uint32_t offset, uint32_t size, uint32_t stride)
+{
+    BackendContext_CPU::Resource& backendResource = backendContext->pResources[resource.internalIndex];
+
+    FfxCpuBufferView view = {};
+    if (backendResource.resourcePtr && offset < backendResource.memorySize) {
+        view.data = backendResource.resourcePtr + offset;
+        view.size = size ? size : uint32_t(backendResource.memorySize - offset);
+        view.stride = stride;
+    }
+    return view;
+}
+
+static FfxErrorCode executeGpuJobCompute(BackendContext_CPU* backendContext, FfxGpuJobDescription* job)
+{
+    const FfxComputeJobDescription& computeJob = job->computeJobDescriptor;
+    Pipeline_CPU* cpuPipeline = reinterpret_cast<Pipeline_CPU*>(computeJob.pipeline.pipeline);
+    FFX_RETURN_ON_ERROR(
+        cpuPipeline && cpuPipeline->kernel,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    FfxCpuDispatchDescription* dispatch = &backendContext->dispatch;
+    memset(dispatch, 0, sizeof(*dispatch));
+
+    dispatch->effect = cpuPipeline->effect;
+    dispatch->pass = cpuPipeline->pass;
+    dispatch->permutationOptions = cpuPipeline->permutationOptions;
+    dispatch->dimensions[0] = computeJob.dimensions[0];
+    dispatch->dimensions[1] = computeJob.dimensions[1];
+    dispatch->dimensions[2] = computeJob.dimensions[2];
+
+    // bind texture & buffer UAVs by slot
+    for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < computeJob.pipeline.uavTextureCount; ++currentPipelineUavIndex) {
+
+        const FfxResourceBinding& binding = computeJob.pipeline.uavTextureBindings[currentPipelineUavIndex];
+        const uint32_t slotIndex = binding.slotIndex + binding.arrayIndex;
+        FFX_ASSERT(slotIndex < FFX_MAX_NUM_UAVS);
+
+        dispatch->uavTextures[slotIndex] = getTextureViewCPU(backendContext, computeJob.uavTextures[currentPipelineUavIndex].resource, computeJob.uavTextures[currentPipelineUavIndex].mip);
+    }
+
+    for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < computeJob.pipeline.uavBufferCount; ++currentPipelineUavIndex) {
+
+        const FfxBufferUAV& uavBuffer = computeJob.uavBuffers[currentPipelineUavIndex];
+
+        // continue if this is a null resource.
+        if (uavBuffer.resource.internalIndex == 0)
+            continue;
+
+        const FfxResourceBinding& binding = computeJob.pipeline.uavBufferBindings[currentPipelineUavIndex];
+        const uint32_t slotIndex = binding.slotIndex + binding.arrayIndex;
+        FFX_ASSERT(slotIndex < FFX_MAX_NUM_UAVS);
+
+        dispatch->uavBuffers[slotIndex] = getBufferViewCPU(backendContext, uavBuffer.resource, uavBuffer.offset, uavBuffer.size, uavBuffer.stride);
+    }
+
+    // bind texture & buffer SRVs by slot
+    for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < computeJob.pipeline.srvTextureCount; ++currentPipelineSrvIndex) {
+
+        const FfxResourceBinding& binding = computeJob.pipeline.srvTextureBindings[currentPipelineSrvIndex];
+        const uint32_t slotIndex = binding.slotIndex + binding.arrayIndex;
+        FFX_ASSERT(slotIndex < FFX_MAX_NUM_SRVS);
+
+        dispatch->srvTextures[slotIndex] = getTextureViewCPU(backendContext, computeJob.srvTextures[currentPipelineSrvIndex].resource, 0);
+    }
+
+    for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < computeJob.pipeline.srvBufferCount; ++currentPipelineSrvIndex) {
+
+        const FfxBufferSRV& srvBuffer = computeJob.srvBuffers[currentPipelineSrvIndex];
+
+        // continue if this is a null resource.
+        if (srvBuffer.resource.internalIndex == 0)
+            continue;
+
+        const FfxResourceBinding& binding = computeJob.pipeline.srvBufferBindings[currentPipelineSrvIndex];
+        const uint32_t slotIndex = binding.slotIndex + binding.arrayIndex;
+        FFX_ASSERT(slotIndex < FFX_MAX_NUM_SRVS);
+
+        dispatch->srvBuffers[slotIndex] = getBufferViewCPU(backendContext, srvBuffer.resource, srvBuffer.offset, srvBuffer.size, srvBuffer.stride);
+    }
+
+    // constant buffers are read straight from the staging ring
+    for (uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < computeJob.pipeline.constCount; ++currentRootConstantIndex) {
+
+        const uint32_t slotIndex = computeJob.pipeline.constantBufferBindings[currentRootConstantIndex].slotIndex;
+        FFX_ASSERT(slotIndex < FFX_MAX_NUM_CONST_BUFFERS);
+
+        dispatch->constantBuffers[slotIndex] = computeJob.cbs[currentRootConstantIndex].data;
+        dispatch->constantBufferSizes[slotIndex] = computeJob.cbs[currentRootConstantIndex].num32BitEntries;
+    }
+
+    // dispatch
+    dispatchWorkGroupsCPU(backendContext->pWorkerPool, cpuPipeline->kernel, dispatch);
+
+    return FFX_OK;
+}
+
+static FfxErrorCode executeGpuJobCopy(BackendContext_CPU* backendContext, FfxGpuJobDescription* job)
+{
+    const BackendContext_CPU::Resource& src = backendContext->pResources[job->copyJobDescriptor.src.internalIndex];
+    const BackendContext_CPU::Resource& dst = backendContext->pResources[job->copyJobDescriptor.dst.internalIndex];
+
+    FFX_RETURN_ON_ERROR(
+        src.resourcePtr && dst.resourcePtr,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    const uint64_t srcOffset = job->copyJobDescriptor.srcOffset;
+    const uint64_t dstOffset = job->copyJobDescriptor.dstOffset;
+    FFX_RETURN_ON_ERROR(
+        srcOffset <= src.memorySize && dstOffset <= dst.memorySize,
+        FFX_ERROR_OUT_OF_RANGE);
+
+    uint64_t size = FFX_MINIMUM(src.memorySize - srcOffset, dst.memorySize - dstOffset);
+    if (job->copyJobDescriptor.size)
+        size = FFX_MINIMUM(size, uint64_t(job->copyJobDescriptor.size));
+
+    memmove(dst.resourcePtr + dstOffset, src.resourcePtr + srcOffset, size_t(size));
+
+    return FFX_OK;
+}
+
+static FfxErrorCode executeGpuJobClearFloat(BackendContext_CPU* backendContext, FfxGpuJobDescription* job)
+{
+    uint32_t idx = job->clearJobDescriptor.target.internalIndex;
+    const BackendContext_CPU::Resource& ffxResource = backendContext->pResources[idx];
+
+    if (ffxResource.resourcePtr == nullptr)
+        return FFX_OK;
+
+    uint32_t clearColorAsUint[4];
+    clearColorAsUint[0] = asUIntCPU(job->clearJobDescriptor.color[0]);
+    clearColorAsUint[1] = asUIntCPU(job->clearJobDescriptor.color[1]);
+    clearColorAsUint[2] = asUIntCPU(job->clearJobDescriptor.color[2]);
+    clearColorAsUint[3] = asUIntCPU(job->clearJobDescriptor.color[3]);
+
+    // buffers are cleared per 32-bit element
+    if (ffxResource.resourceDescription.type == FFX_RESOURCE_TYPE_BUFFER) {
+        for (uint64_t offset = 0; offset + sizeof(uint32_t) <= ffxResource.memorySize; offset += sizeof(uint32_t))
+            memcpy(ffxResource.resourcePtr + offset, &clearColorAsUint[0], sizeof(uint32_t));
+        return FFX_OK;
+    }
+
+    // textures clear the first mip, encoding the color once
+    const uint32_t texelSize = ffxGetSurfaceFormatSizeCPU(ffxResource.resourceDescription.format);
+    const uint64_t mipSize   = ffxResource.mipOffsets[1] ? ffxResource.mipOffsets[1] : ffxResource.memorySize;
+
+    uint8_t encoded[16] = {};
+    encodeTexelCPU(ffxResource.resourceDescription.format, encoded, clearColorAsUint);
+
+    for (uint64_t offset = 0; offset + texelSize <= mipSize; offset += texelSize)
+        memcpy(ffxResource.resourcePtr + offset, encoded, texelSize);
+
+    return FFX_OK;
+}
+
+static FfxErrorCode executeGpuJobDiscard(BackendContext_CPU* backendContext, FfxGpuJobDescription* job)
+{
+    // contents of discarded resources are undefined, keeping them is valid
+    return FFX_OK;
+}
+
+FfxErrorCode ExecuteGpuJobsCPU(
+    FfxInterface* backendInterface,
+    FfxCommandList commandList,
+    FfxUInt32 effectContextId)
+{
+    FFX_ASSERT(NULL != backendInterface);
+
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    FfxErrorCode errorCode = FFX_OK;
+
+    // execute all GpuJobs
+    for (uint32_t currentGpuJobIndex = 0; currentGpuJobIndex < backendContext->gpuJobCount; ++currentGpuJobIndex) {
+
+        FfxGpuJobDescription* GpuJob = &backendContext->pGpuJobs[currentGpuJobIndex];
+
+        switch (GpuJob->jobType) {
+
+            case FFX_GPU_JOB_CLEAR_FLOAT:
+                errorCode = executeGpuJobClearFloat(backendContext, GpuJob);
+                break;
+
+            case FFX_GPU_JOB_COPY:
+                errorCode = executeGpuJobCopy(backendContext, GpuJob);
+                break;
+
+            case FFX_GPU_JOB_COMPUTE:
+                errorCode = executeGpuJobCompute(backendContext, GpuJob);
+                break;
+
+            case FFX_GPU_JOB_BARRIER:
+                break;
+
+            case FFX_GPU_JOB_DISCARD:
+                errorCode = executeGpuJobDiscard(backendContext, GpuJob);
+                break;
+
+            default:
+                break;
+        }
+
+        if (errorCode != FFX_OK)
+            break;
+    }
+
+    // check the execute function returned cleanly.
+    FFX_RETURN_ON_ERROR(
+        errorCode == FFX_OK,
+        FFX_ERROR_BACKEND_API_ERROR);
+
+    backendContext->gpuJobCount = 0;
+
+    return FFX_OK;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Breadcrumbs on host memory
+
+FfxErrorCode BreadcrumbsAllocBlockCPU(FfxInterface* backendInterface, uint64_t blockBytes, FfxBreadcrumbsBlockData* blockData)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != blockData);
+
+    uint8_t* memory = new (std::nothrow) uint8_t[size_t(blockBytes)];
+    FFX_RETURN_ON_ERROR(
+        memory,
+        FFX_ERROR_OUT_OF_MEMORY);
+    memset(memory, 0, size_t(blockBytes));
+
+    blockData->memory = memory;
+    blockData->heap = nullptr;
+    blockData->buffer = memory;
+    blockData->baseAddress = reinterpret_cast<uint64_t>(memory);
+
+    return FFX_OK;
+}
+
+void BreadcrumbsFreeBlockCPU(FfxInterface* backendInterface, FfxBreadcrumbsBlockData* blockData)
+{
+    FFX_ASSERT(NULL != blockData);
+
+    delete[] reinterpret_cast<uint8_t*>(blockData->memory);
+    blockData->memory = nullptr;
+    blockData->heap = nullptr;
+    blockData->buffer = nullptr;
+    blockData->baseAddress = 0;
+}
+
+void BreadcrumbsWriteCPU(FfxInterface* backendInterface, FfxCommandList commandList, uint32_t value, uint64_t gpuLocation, void* gpuBuffer, bool isBegin)
+{
+    // jobs execute in order, so the marker can be written immediately
+    *reinterpret_cast<uint32_t*>(gpuLocation) = value;
+}
+
+void BreadcrumbsPrintDeviceInfoCPU(FfxInterface* backendInterface, FfxAllocationCallbacks* allocs, bool extendedInfo, char** printBuffer, size_t* printSize)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != allocs);
+    FFX_ASSERT(NULL != printBuffer);
+    FFX_ASSERT(NULL != printSize);
+
+    BackendContext_CPU* backendContext = (BackendContext_CPU*)backendInterface->scratchBuffer;
+
+    char deviceInfo[128] = {};
+    int  length = snprintf(deviceInfo, sizeof(deviceInfo), "[DEVICE]\n - Name: CPU\n - Worker threads: %u\n",
+                           backendContext->pWorkerPool ? uint32_t(backendContext->pWorkerPool->threads.size() + 1) : 0u);
+    if (length <= 0)
+        return;
+
+    char* buffer = reinterpret_cast<char*>(allocs->fpRealloc(*printBuffer, *printSize + size_t(length) + 1));
+    if (buffer == nullptr)
+        return;
+
+    memcpy(buffer + *printSize, deviceInfo, size_t(length) + 1);
+    *printBuffer = buffer;
+    *printSize += size_t(length);
+}
@@ -0,0 +1,330 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/// @defgroup CPUBackend CPU Backend
+/// FidelityFX SDK reference backend implementation running on host memory.
+///
+/// Resources are plain host allocations and compute jobs are executed by
+/// kernels registered per effect pass, with workgroups spread across a
+/// pool of worker threads. The backend is meant for validation and for
+/// running effects on machines without a Direct3D 11 device.
+///
+/// Kernels ship for FSR1 (EASU, RCAS and EASU+RCAS), CAS sharpen-only in
+/// linear colour space, SPD mean downsampling without linear sampling, the
+/// 5x5 Blur with sigma 1.6, and every FSR2 and FSR3 upscaler pass for LDR
+/// input, low resolution unjittered motion vectors, standard depth and the
+/// reference Lanczos reprojection, without FP16. Creating a
+/// context for any other effect or permutation fails with
+/// <c><i>FFX_ERROR_BACKEND_API_ERROR</i></c> until kernels for its passes are
+/// registered with <c><i>ffxRegisterComputeKernelCPU</i></c>.
+/// The backend is compiled into the Windows projects of those effects, and
+/// into the <c><i>ffx_backend_cpu</i></c> CMake target on other hosts.
+///
+/// @ingroup Backends
+
+#pragma once
+
+#include <host/ffx_interface.h>
+
+/// The maximum number of mip levels tracked per resource by the CPU backend.
+///
+/// @ingroup CPUBackend
+#define FFX_CPU_MAX_MIP_LEVELS      (16)
+
+/// The maximum number of compute kernels that can be registered with the CPU backend.
+///
+/// @ingroup CPUBackend
+#define FFX_CPU_MAX_KERNELS         (256)
+
+/// The maximum number of invocations in a workgroup executed by the CPU backend.
+///
+/// @ingroup CPUBackend
+#define FFX_CPU_MAX_WORKGROUP_SIZE  (1024)
+
+/// The stack size of every workgroup invocation waiting on a barrier.
+///
+/// @ingroup CPUBackend
+#define FFX_CPU_INVOCATION_STACK_SIZE   (256 * 1024)
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // #if defined(__cplusplus)
+
+/// A structure describing the host device used by the CPU backend.
+///
+/// @ingroup CPUBackend
+typedef struct FfxCpuDeviceDescription {
+    uint32_t                        workerThreadCount;                      ///< The number of worker threads executing workgroups (0 to use all hardware threads).
+} FfxCpuDeviceDescription;
+
+/// A view of a texture resource as seen by a CPU compute kernel.
+///
+/// Texels are tightly packed, rows follow each other, then slices, then mips.
+///
+/// @ingroup CPUBackend
+typedef struct FfxCpuTextureView {
+    uint8_t*                        data;                                   ///< Pointer to the first texel of the most detailed mip.
+    FfxResourceDescription          description;                            ///< The description of the viewed resource.
+    const uint32_t*                 mipOffsets;                             ///< Byte offsets of every mip level, relative to <c><i>data</i></c>.
+    uint32_t                        mip;                                    ///< The mip level bound to a UAV, or 0 for SRVs.
+} FfxCpuTextureView;
+
+/// A view of a buffer resource as seen by a CPU compute kernel.
+///
+/// @ingroup CPUBackend
+typedef struct FfxCpuBufferView {
+    uint8_t*                        data;                                   ///< Pointer to the first byte of the view.
+    uint32_t                        size;                                   ///< Size of the view in bytes.
+    uint32_t                        stride;                                 ///< Size of a structured element in bytes, or 0 for raw buffers.
+} FfxCpuBufferView;
+
+/// A structure describing the state bound to a CPU compute dispatch.
+///
+/// All views are indexed by the register slot reported by the pass reflection,
+/// so kernels use the same slot numbers as the HLSL pass declarations.
+///
+/// @ingroup CPUBackend
+typedef struct FfxCpuDispatchDescription {
+    FfxEffect                       effect;                                 ///< The effect the dispatched pass belongs to.
+    FfxPass                         pass;                                   ///< The dispatched pass.
+    uint32_t                        permutationOptions;                     ///< The permutation flags the pipeline was created with.
+    uint32_t                        dimensions[3];                          ///< Number of workgroups dispatched in each dimension.
+    FfxCpuTextureView               srvTextures[FFX_MAX_NUM_SRVS];          ///< Texture SRVs, indexed by slot.
+    FfxCpuTextureView               uavTextures[FFX_MAX_NUM_UAVS];          ///< Texture UAVs, indexed by slot.
+    FfxCpuBufferView                srvBuffers[FFX_MAX_NUM_SRVS];           ///< Buffer SRVs, indexed by slot.
+    FfxCpuBufferView                uavBuffers[FFX_MAX_NUM_UAVS];           ///< Buffer UAVs, indexed by slot.
+    const uint32_t*                 constantBuffers[FFX_MAX_NUM_CONST_BUFFERS];     ///< Constant buffer data, indexed by slot.
+    uint32_t                        constantBufferSizes[FFX_MAX_NUM_CONST_BUFFERS]; ///< Constant buffer sizes in 32-bit entries, indexed by slot.
+} FfxCpuDispatchDescription;
+
+/// A function executing a single workgroup of a compute pass on the host.
+///
+/// Workgroups of the same dispatch may run concurrently on different worker threads.
+///
+/// @param [in] dispatch                    The state bound to the dispatch.
+/// @param [in] workGroupId                 The index of the workgroup to execute.
+///
+/// @ingroup CPUBackend
+typedef void (*FfxCpuComputeKernelFunc)(const FfxCpuDispatchDescription* dispatch, const uint32_t workGroupId[3]);
+
+/// A function executing a single invocation of a workgroup.
+///
+/// @param [in] userData                    The pointer passed to <c><i>ffxExecuteWorkGroupCPU</i></c>.
+/// @param [in] localIndex                  The flattened index of the invocation in its workgroup.
+///
+/// @ingroup CPUBackend
+typedef void (*FfxCpuInvocationFunc)(void* userData, uint32_t localIndex);
+
+/// Query how much memory is required for the CPU backend's scratch buffer.
+///
+/// @param [in] maxContexts                 The maximum number of simultaneous effect contexts that will share the backend.
+///                                         (Note that some effects contain internal contexts which count towards this maximum)
+///
+/// @returns
+/// The size (in bytes) of the required scratch memory buffer for the CPU backend.
+/// @ingroup CPUBackend
+FFX_API size_t ffxGetScratchMemorySizeCPU(size_t maxContexts);
+
+/// Create a <c><i>FfxDevice</i></c> from a <c><i>FfxCpuDeviceDescription</i></c>.
+///
+/// The description must stay alive until the first effect context has been created.
+///
+/// @param [in] deviceDescription           A pointer to the host device description.
+///
+/// @returns
+/// An abstract FidelityFX device.
+///
+/// @ingroup CPUBackend
+FFX_API FfxDevice ffxGetDeviceCPU(FfxCpuDeviceDescription* deviceDescription);
+
+/// Populate an interface with pointers for the CPU backend.
+///
+/// @param [out] backendInterface           A pointer to a <c><i>FfxInterface</i></c> structure to populate with pointers.
+/// @param [in] device                      A device created with <c><i>ffxGetDeviceCPU</i></c>.
+/// @param [in] scratchBuffer               A pointer to a buffer of memory which can be used by the CPU backend.
+/// @param [in] scratchBufferSize           The size (in bytes) of the buffer pointed to by <c><i>scratchBuffer</i></c>.
+/// @param [in] maxContexts                 The maximum number of simultaneous effect contexts that will share the backend.
+///                                         (Note that some effects contain internal contexts which count towards this maximum)
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_CODE_INVALID_POINTER          The <c><i>interface</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup CPUBackend
+FFX_API FfxErrorCode ffxGetInterfaceCPU(
+    FfxInterface* backendInterface,
+    FfxDevice device,
+    void* scratchBuffer,
+    size_t scratchBufferSize,
+    uint32_t maxContexts);
+
+/// Create a <c><i>FfxCommandList</i></c> for a CPU device.
+///
+/// Jobs are executed synchronously by <c><i>fpExecuteGpuJobs</i></c>, so the command list only
+/// identifies the device the work is recorded for.
+///
+/// @param [in] device                      A device created with <c><i>ffxGetDeviceCPU</i></c>.
+///
+/// @returns
+/// An abstract FidelityFX command list.
+///
+/// @ingroup CPUBackend
+FFX_API FfxCommandList ffxGetCommandListCPU(FfxDevice device);
+
+/// Fetch a <c><i>FfxResource</i></c> from host memory.
+///
+/// The memory must be laid out as described for <c><i>FfxCpuTextureView</i></c>
+/// and be at least <c><i>ffxGetResourceMemorySizeCPU</i></c> bytes large.
+///
+/// @param [in] data                        A pointer to the host memory backing the resource.
+/// @param [in] ffxResDescription           An <c><i>FfxResourceDescription</i></c> for the resource representation.
+/// @param [in] ffxResName                  (optional) A name string to identify the resource in debug mode.
+/// @param [in] state                       The state the resource is currently in.
+///
+/// @returns
+/// An abstract FidelityFX resources.
+///
+/// @ingroup CPUBackend
+FFX_API FfxResource ffxGetResourceCPU(void* data,
+    FfxResourceDescription       ffxResDescription,
+    wchar_t const*               ffxResName,
+    FfxResourceStates            state = FFX_RESOURCE_STATE_COMPUTE_READ);
+
+/// Query how much host memory a resource occupies in the CPU backend layout.
+///
+/// @param [in] ffxResDescription           An <c><i>FfxResourceDescription</i></c> for the resource representation.
+///
+/// @returns
+/// The size (in bytes) of the resource including all of its mips.
+///
+/// @ingroup CPUBackend
+FFX_API size_t ffxGetResourceMemorySizeCPU(FfxResourceDescription ffxResDescription);
+
+/// Register the compute kernel implementing a pass of an effect.
+///
+/// A kernel implements the permutations whose options in <c><i>permutationMask</i></c> equal
+/// <c><i>permutationValue</i></c>, several kernels may be registered for the same pass. Pipelines
+/// created for a permutation no registered kernel implements fail with
+/// <c><i>FFX_ERROR_BACKEND_API_ERROR</i></c>. Registering the same pass, mask and value twice
+/// replaces the kernel.
+///
+/// @param [in] effect                      The effect the pass belongs to.
+/// @param [in] pass                        The pass implemented by the kernel.
+/// @param [in] permutationMask             The permutation options the kernel depends on.
+/// @param [in] permutationValue            The value of the options in <c><i>permutationMask</i></c>.
+/// @param [in] kernel                      The function executing one workgroup of the pass.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT              <c><i>permutationValue</i></c> has options outside of <c><i>permutationMask</i></c>.
+/// @retval
+/// FFX_ERROR_OUT_OF_RANGE                  Too many kernels were registered.
+///
+/// @ingroup CPUBackend
+FFX_API FfxErrorCode ffxRegisterComputeKernelCPU(FfxEffect effect, FfxPass pass, uint32_t permutationMask, uint32_t permutationValue, FfxCpuComputeKernelFunc kernel);
+
+/// Execute every invocation of a workgroup on the calling thread.
+///
+/// Invocations run as cooperative fibers in order of their local index. Each one runs until it
+/// returns or calls <c><i>ffxWorkGroupBarrierCPU</i></c>, and a barrier is released once every
+/// invocation has reached it or returned. When the first invocation returns without reaching a
+/// barrier, the others are called directly since uniform control flow means none of them will.
+///
+/// Group shared memory is thread local, so the invocations of a workgroup share it and workgroups
+/// running on other worker threads get their own copy.
+///
+/// @param [in] invocationCount             The number of invocations in the workgroup.
+/// @param [in] invocation                  The function executing one invocation.
+/// @param [in] userData                    A pointer passed to every invocation.
+///
+/// @ingroup CPUBackend
+FFX_API void ffxExecuteWorkGroupCPU(uint32_t invocationCount, FfxCpuInvocationFunc invocation, void* userData);
+
+/// Wait until every invocation of the current workgroup has reached the barrier.
+///
+/// Must be called from an invocation executed by <c><i>ffxExecuteWorkGroupCPU</i></c>,
+/// in control flow that is uniform across the workgroup.
+///
+/// @ingroup CPUBackend
+FFX_API void ffxWorkGroupBarrierCPU(void);
+
+/// Load a texel from a texture view.
+///
+/// Float and normalized formats return the bits of 32-bit floats, integer formats
+/// return the integer values. Out of range coordinates return zero.
+///
+/// @param [in] view                        The texture view to load from.
+/// @param [in] x                           The horizontal texel coordinate.
+/// @param [in] y                           The vertical texel coordinate.
+/// @param [in] z                           The slice or depth coordinate.
+/// @param [in] mip                         The mip level, relative to the view.
+/// @param [out] texel                      Four 32-bit channels receiving the texel.
+///
+/// @ingroup CPUBackend
+FFX_API void ffxLoadTexelCPU(const FfxCpuTextureView* view, int32_t x, int32_t y, int32_t z, uint32_t mip, uint32_t texel[4]);
+
+/// Store a texel to a texture view.
+///
+/// The channels are interpreted as for <c><i>ffxLoadTexelCPU</i></c>. Out of range coordinates are ignored.
+///
+/// @param [in] view                        The texture view to store to.
+/// @param [in] x                           The horizontal texel coordinate.
+/// @param [in] y                           The vertical texel coordinate.
+/// @param [in] z                           The slice or depth coordinate.
+/// @param [in] texel                       Four 32-bit channels to store.
+///
+/// @ingroup CPUBackend
+FFX_API void ffxStoreTexelCPU(const FfxCpuTextureView* view, int32_t x, int32_t y, int32_t z, const uint32_t texel[4]);
+
+/// Get the address of a texel in a texture view.
+///
+/// Used for atomic operations on textures with a single 32-bit channel.
+///
+/// @param [in] view                        The texture view.
+/// @param [in] x                           The horizontal texel coordinate.
+/// @param [in] y                           The vertical texel coordinate.
+/// @param [in] z                           The slice or depth coordinate.
+/// @param [in] mip                         The mip level, relative to the view.
+///
+/// @returns
+/// A pointer to the texel, or <c><i>NULL</i></c> for out of range coordinates.
+///
+/// @ingroup CPUBackend
+FFX_API uint8_t* ffxGetTexelAddressCPU(const FfxCpuTextureView* view, int32_t x, int32_t y, int32_t z, uint32_t mip);
+
+/// Sample a texture view with a clamped bilinear filter.
+///
+/// @param [in] view                        The texture view to sample.
+/// @param [in] u                           The horizontal normalized coordinate.
+/// @param [in] v                           The vertical normalized coordinate.
+/// @param [in] z                           The slice coordinate.
+/// @param [in] mip                         The mip level to sample.
+/// @param [out] texel                      Four floats receiving the filtered texel.
+///
+/// @ingroup CPUBackend
+FFX_API void ffxSampleLevelCPU(const FfxCpuTextureView* view, float u, float v, int32_t z, uint32_t mip, float texel[4]);
+
+#if defined(__cplusplus)
+}
+#endif // #if defined(__cplusplus)
@@ -0,0 +1,121 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/// @defgroup CPUKernels CPU Kernels
+/// Helpers compiling the FidelityFX HLSL passes as CPU backend kernels.
+///
+/// A kernel translation unit includes this file, defines the bind slots of its pass like the
+/// matching HLSL pass file does, then includes the <c><i>*_callbacks_cpp.h</i></c> file and the
+/// algorithm headers inside an anonymous namespace, so every pass gets its own copy of the
+/// shader functions. The entry point is then wrapped with <c><i>FFX_CPU_COMPUTE_KERNEL</i></c>
+/// and registered with <c><i>FFX_CPU_REGISTER_COMPUTE_KERNEL</i></c>, both still inside the
+/// namespace since the host headers declare array types with the same names as the shader vectors.
+///
+/// @ingroup CPUBackend
+
+#pragma once
+
+// The shader headers are included inside a namespace, so every standard header
+// they depend on has to be included at global scope first.
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <host/backends/cpu/ffx_cpu.h>
+
+#if !defined(FFX_GPU)
+#define FFX_GPU
+#endif // #if !defined(FFX_GPU)
+
+#if !defined(FFX_HALF)
+#define FFX_HALF 0
+#endif // #if !defined(FFX_HALF)
+
+#if !defined(FFX_PREFER_WAVE64)
+#define FFX_PREFER_WAVE64
+#endif // #if !defined(FFX_PREFER_WAVE64)
+
+// Kernels follow the shader model 5.0 permutations, which share data through group shared memory instead of waves.
+#if !defined(FFX_SPD_NO_WAVE_OPERATIONS)
+#define FFX_SPD_NO_WAVE_OPERATIONS
+#endif // #if !defined(FFX_SPD_NO_WAVE_OPERATIONS)
+
+#define FFX_CPU_CONCATENATE_IMPL(a, b) a##b
+#define FFX_CPU_CONCATENATE(a, b) FFX_CPU_CONCATENATE_IMPL(a, b)
+
+/// Define a kernel executing every invocation of a workgroup with the entry point of a pass.
+///
+/// The entry point receives the HLSL system values in the order <c><i>SV_GroupThreadID</i></c>,
+/// <c><i>SV_GroupID</i></c>, <c><i>SV_DispatchThreadID</i></c> and <c><i>SV_GroupIndex</i></c>.
+/// Invocations are executed by <c><i>ffxExecuteWorkGroupCPU</i></c>, so passes may synchronize
+/// through group shared memory and barriers.
+/// Permutation options map to compile time defines in the algorithm headers, so a kernel only
+/// implements the permutations whose flags in <c><i>permutationMask</i></c> equal <c><i>permutationValue</i></c>.
+/// Both are passed on by <c><i>FFX_CPU_REGISTER_COMPUTE_KERNEL</i></c>, so pipelines for any other
+/// permutation fail to create instead of running this kernel.
+///
+/// @param [in] name                        The name of the kernel function.
+/// @param [in] entry                       The entry point of the pass.
+/// @param [in] width                       The number of invocations of a workgroup in X.
+/// @param [in] height                      The number of invocations of a workgroup in Y.
+/// @param [in] depth                       The number of invocations of a workgroup in Z.
+/// @param [in] permutationMask             The permutation flags the kernel was compiled for.
+/// @param [in] permutationValue            The value of the flags in <c><i>permutationMask</i></c>.
+///
+/// @ingroup CPUKernels
+#define FFX_CPU_COMPUTE_KERNEL(name, entry, width, height, depth, permutationMask, permutationValue)                         \
+    static const uint32_t FFX_CPU_CONCATENATE(name, PermutationMask)  = (permutationMask);                                  \
+    static const uint32_t FFX_CPU_CONCATENATE(name, PermutationValue) = (permutationValue);                                 \
+                                                                                                                            \
+    static void FFX_CPU_CONCATENATE(name, Invocation)(void* userData, uint32_t localIndex)                                  \
+    {                                                                                                                       \
+        const FfxUInt32x3& groupId = *static_cast<const FfxUInt32x3*>(userData);                                            \
+        const FfxUInt32x3  groupSize(width, height, depth);                                                                 \
+        const FfxUInt32x3  groupThreadId(localIndex % FfxUInt32(width),                                                     \
+                                         (localIndex / FfxUInt32(width)) % FfxUInt32(height),                               \
+                                         localIndex / (FfxUInt32(width) * FfxUInt32(height)));                              \
+        entry(groupThreadId, groupId, groupId * groupSize + groupThreadId, localIndex);                                     \
+    }                                                                                                                       \
+                                                                                                                            \
+    static void name(const FfxCpuDispatchDescription* dispatch, const uint32_t workGroupId[3])                              \
+    {                                                                                                                       \
+        FFX_ASSERT_MESSAGE((dispatch->permutationOptions & (permutationMask)) == (permutationValue),                        \
+                           "Pass permutation is not available on the CPU backend");                                         \
+        ffxCpuDispatch() = dispatch;                                                                                        \
+                                                                                                                            \
+        FfxUInt32x3 groupId(workGroupId[0], workGroupId[1], workGroupId[2]);                                                \
+        ffxExecuteWorkGroupCPU(FfxUInt32((width) * (height) * (depth)), FFX_CPU_CONCATENATE(name, Invocation), &groupId);   \
+    }
+
+/// Register a kernel defined with <c><i>FFX_CPU_COMPUTE_KERNEL</i></c> for a pass when the library is loaded.
+///
+/// @param [in] effect                      The effect the pass belongs to.
+/// @param [in] pass                        The pass implemented by the kernel.
+/// @param [in] kernel                      The kernel function, registered with the permutations it was defined for.
+///
+/// @ingroup CPUKernels
+#define FFX_CPU_REGISTER_COMPUTE_KERNEL(effect, pass, kernel)                                                               \
+    static const FfxErrorCode FFX_CPU_CONCATENATE(s_ComputeKernelRegistration, __LINE__) =                                  \
+        ffxRegisterComputeKernelCPU(effect, pass, FFX_CPU_CONCATENATE(kernel, PermutationMask),                             \
+                                    FFX_CPU_CONCATENATE(kernel, PermutationValue), kernel);
@@ -0,0 +1,53 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// FSR1 pass 2 (optional RCAS)
+// SRV  0 : FSR1_InternalUpscaled       : r_internal_upscaled_color
+// UAV  0 : FSR1_UpscaledOutput         : rw_upscaled_output
+// CB   0 : cbFSR1
+
+#include <host/backends/cpu/ffx_cpu_kernel.h>
+#include <host/ffx_fsr1.h>
+#include <host/components/fsr1/ffx_fsr1_private.h>
+
+#define FSR1_BIND_SRV_INTERNAL_UPSCALED_COLOR   0
+#define FSR1_BIND_UAV_UPSCALED_OUTPUT           0
+#define FSR1_BIND_CB_FSR1                       0
+
+#define FFX_FSR1_OPTION_APPLY_RCAS              1
+#define FFX_FSR1_OPTION_RCAS_PASSTHROUGH_ALPHA  0
+#define FFX_FSR1_OPTION_SRGB_CONVERSIONS        0
+
+namespace
+{
+#include "fsr1/ffx_fsr1_callbacks_cpp.h"
+#include "fsr1/ffx_fsr1_rcas.h"
+
+void CS(uint3 LocalThreadId, uint3 WorkGroupId, uint3 Dtid, uint LocalIndex)
+{
+    RCAS(LocalThreadId, WorkGroupId, Dtid);
+}
+
+FFX_CPU_COMPUTE_KERNEL(ffxFsr1RcasKernelCPU, CS, 64, 1, 1,
+                       FSR1_SHADER_PERMUTATION_RCAS_PASSTHROUGH_ALPHA | FSR1_SHADER_PERMUTATION_SRGB_CONVERSIONS, 0)
+FFX_CPU_REGISTER_COMPUTE_KERNEL(FFX_EFFECT_FSR1, FFX_FSR1_PASS_RCAS, ffxFsr1RcasKernelCPU)
+} // namespace
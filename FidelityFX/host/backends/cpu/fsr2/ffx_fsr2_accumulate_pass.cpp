@@ -0,0 +1,103 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// FSR2 pass 5 (without RCAS)
+// SRV  0 : FSR2_InputExposure                  : r_input_exposure
+// SRV  1 : FSR2_DilatedReactiveMasks           : r_dilated_reactive_masks
+// SRV  2 : FSR2_InternalDilatedVelocity        : r_dilated_motion_vectors
+// SRV  3 : FSR2_InternalUpscaled               : r_internal_upscaled_color
+// SRV  4 : FSR2_LockStatus                     : r_lock_status
+// SRV  5 : FSR2_PreparedInputColor             : r_prepared_input_color
+// SRV  6 : FSR2_LanczosLutData                 : r_lanczos_lut
+// SRV  7 : FSR2_MaximumUpsampleBias            : r_upsample_maximum_bias_lut
+// SRV  8 : FSR2_ExposureMips                   : r_imgMips
+// SRV  9 : FSR2_AutoExposure                   : r_auto_exposure
+// SRV 10 : FSR2_LumaHistory                    : r_luma_history
+// UAV  0 : FSR2_InternalUpscaled               : rw_internal_upscaled_color
+// UAV  1 : FSR2_LockStatus                     : rw_lock_status
+// UAV  2 : FSR2_OutputUpscaledColor            : rw_upscaled_output
+// UAV  3 : FSR2_NewLocks                       : rw_new_locks
+// UAV  4 : FSR2_LumaHistory                    : rw_luma_history
+// CB   0 : cbFSR2
+
+#include <host/backends/cpu/ffx_cpu_kernel.h>
+#include <host/ffx_fsr2.h>
+#include <host/components/fsr2/ffx_fsr2_private.h>
+
+#define FSR2_BIND_SRV_INPUT_EXPOSURE                    0
+#define FSR2_BIND_SRV_DILATED_REACTIVE_MASKS            1
+#define FSR2_BIND_SRV_DILATED_MOTION_VECTORS            2
+#define FSR2_BIND_SRV_INTERNAL_UPSCALED                 3
+#define FSR2_BIND_SRV_LOCK_STATUS                       4
+#define FSR2_BIND_SRV_PREPARED_INPUT_COLOR              5
+#define FSR2_BIND_SRV_LANCZOS_LUT                       6
+#define FSR2_BIND_SRV_UPSCALE_MAXIMUM_BIAS_LUT          7
+#define FSR2_BIND_SRV_SCENE_LUMINANCE_MIPS              8
+#define FSR2_BIND_SRV_AUTO_EXPOSURE                     9
+#define FSR2_BIND_SRV_LUMA_HISTORY                      10
+
+#define FSR2_BIND_UAV_INTERNAL_UPSCALED                 0
+#define FSR2_BIND_UAV_LOCK_STATUS                       1
+#define FSR2_BIND_UAV_UPSCALED_OUTPUT                   2
+#define FSR2_BIND_UAV_NEW_LOCKS                         3
+#define FSR2_BIND_UAV_LUMA_HISTORY                      4
+
+#define FSR2_BIND_CB_FSR2                               0
+
+#define FFX_FSR2_OPTION_UPSAMPLE_SAMPLERS_USE_DATA_HALF         0
+#define FFX_FSR2_OPTION_ACCUMULATE_SAMPLERS_USE_DATA_HALF       0
+#define FFX_FSR2_OPTION_REPROJECT_SAMPLERS_USE_DATA_HALF        1
+#define FFX_FSR2_OPTION_POSTPROCESSLOCKSTATUS_SAMPLERS_USE_DATA_HALF 0
+#define FFX_FSR2_OPTION_UPSAMPLE_USE_LANCZOS_TYPE               2
+
+#define FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE              0
+#define FFX_FSR2_OPTION_HDR_COLOR_INPUT                         0
+#define FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS           1
+#define FFX_FSR2_OPTION_JITTERED_MOTION_VECTORS                 0
+#define FFX_FSR2_OPTION_INVERTED_DEPTH                          0
+#define FFX_FSR2_OPTION_APPLY_SHARPENING                        0
+
+namespace
+{
+#include "fsr2/ffx_fsr2_callbacks_cpp.h"
+#include "fsr2/ffx_fsr2_common.h"
+#include "fsr2/ffx_fsr2_sample.h"
+#include "fsr2/ffx_fsr2_upsample.h"
+#include "fsr2/ffx_fsr2_postprocess_lock_status.h"
+#include "fsr2/ffx_fsr2_reproject.h"
+#include "fsr2/ffx_fsr2_accumulate.h"
+
+void CS(uint3 LocalThreadId, uint3 WorkGroupId, uint3 Dtid, uint LocalIndex)
+{
+    // workgroups run bottom to top, as in the HLSL pass
+    const FfxUInt32 groupRows = (FfxUInt32(DisplaySize().y) + 8 - 1) / 8;
+    const FfxUInt32x2 groupId(WorkGroupId.x, groupRows - WorkGroupId.y - 1);
+
+    Accumulate(groupId * FfxUInt32x2(8, 8) + LocalThreadId.xy);
+}
+
+FFX_CPU_COMPUTE_KERNEL(ffxFsr2AccumulateKernelCPU, CS, 8, 8, 1,
+                       FSR2_SHADER_PERMUTATION_USE_LANCZOS_TYPE | FSR2_SHADER_PERMUTATION_HDR_COLOR_INPUT | FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS | FSR2_SHADER_PERMUTATION_JITTER_MOTION_VECTORS | FSR2_SHADER_PERMUTATION_DEPTH_INVERTED |
+                       FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING | FSR2_SHADER_PERMUTATION_ALLOW_FP16,
+                       FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS)
+FFX_CPU_REGISTER_COMPUTE_KERNEL(FFX_EFFECT_FSR2, FFX_FSR2_PASS_ACCUMULATE, ffxFsr2AccumulateKernelCPU)
+} // namespace
@@ -0,0 +1,92 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// FSR2 reactive mask generation
+// SRV  0 : FSR2_InputOpaqueOnly                : r_input_opaque_only
+// SRV  1 : FSR2_InputColor                     : r_input_color_jittered
+// UAV  0 : FSR2_AutoReactive                   : rw_output_autoreactive
+// CB   0 : cbFSR2
+// CB   1 : cbGenerateReactive
+
+#include <host/backends/cpu/ffx_cpu_kernel.h>
+#include <host/ffx_fsr2.h>
+#include <host/components/fsr2/ffx_fsr2_private.h>
+
+#define FSR2_BIND_SRV_INPUT_OPAQUE_ONLY                 0
+#define FSR2_BIND_SRV_INPUT_COLOR                       1
+
+#define FSR2_BIND_UAV_AUTOREACTIVE                      0
+
+#define FSR2_BIND_CB_FSR2                               0
+#define FSR2_BIND_CB_REACTIVE                           1
+
+#define FFX_FSR2_OPTION_UPSAMPLE_SAMPLERS_USE_DATA_HALF         0
+#define FFX_FSR2_OPTION_ACCUMULATE_SAMPLERS_USE_DATA_HALF       0
+#define FFX_FSR2_OPTION_REPROJECT_SAMPLERS_USE_DATA_HALF        1
+#define FFX_FSR2_OPTION_POSTPROCESSLOCKSTATUS_SAMPLERS_USE_DATA_HALF 0
+#define FFX_FSR2_OPTION_UPSAMPLE_USE_LANCZOS_TYPE               2
+
+#define FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE              0
+#define FFX_FSR2_OPTION_HDR_COLOR_INPUT                         0
+#define FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS           1
+#define FFX_FSR2_OPTION_JITTERED_MOTION_VECTORS                 0
+#define FFX_FSR2_OPTION_INVERTED_DEPTH                          0
+#define FFX_FSR2_OPTION_APPLY_SHARPENING                        0
+
+namespace
+{
+#include "fsr2/ffx_fsr2_callbacks_cpp.h"
+#include "fsr2/ffx_fsr2_common.h"
+
+// the body of the HLSL pass, which has no algorithm header
+void CS(uint3 LocalThreadId, uint3 WorkGroupId, uint3 Dtid, uint LocalIndex)
+{
+    const FfxUInt32x2 uDispatchThreadId = Dtid.xy;
+
+    FfxFloat32x3 ColorPreAlpha  = LoadOpaqueOnly(FFX_MIN16_I2(uDispatchThreadId));
+    FfxFloat32x3 ColorPostAlpha = LoadInputColor(uDispatchThreadId);
+
+    if (GenReactiveFlags() & FFX_FSR2_AUTOREACTIVEFLAGS_APPLY_TONEMAP)
+    {
+        ColorPreAlpha  = Tonemap(ColorPreAlpha);
+        ColorPostAlpha = Tonemap(ColorPostAlpha);
+    }
+
+    if (GenReactiveFlags() & FFX_FSR2_AUTOREACTIVEFLAGS_APPLY_INVERSETONEMAP)
+    {
+        ColorPreAlpha  = InverseTonemap(ColorPreAlpha);
+        ColorPostAlpha = InverseTonemap(ColorPostAlpha);
+    }
+
+    const FfxFloat32x3 delta = abs(ColorPostAlpha - ColorPreAlpha);
+
+    FfxFloat32 out_reactive_value = (GenReactiveFlags() & FFX_FSR2_AUTOREACTIVEFLAGS_USE_COMPONENTS_MAX) ? ffxMax(delta.x, ffxMax(delta.y, delta.z)) : length(delta);
+    out_reactive_value *= GenReactiveScale();
+
+    out_reactive_value = (GenReactiveFlags() & FFX_FSR2_AUTOREACTIVEFLAGS_APPLY_THRESHOLD) ? (out_reactive_value < GenReactiveThreshold() ? 0 : GenReactiveBinaryValue()) : out_reactive_value;
+
+    rw_output_autoreactive[uDispatchThreadId] = out_reactive_value;
+}
+
+FFX_CPU_COMPUTE_KERNEL(ffxFsr2GenerateReactiveKernelCPU, CS, 8, 8, 1, FSR2_SHADER_PERMUTATION_ALLOW_FP16, 0)
+FFX_CPU_REGISTER_COMPUTE_KERNEL(FFX_EFFECT_FSR2, FFX_FSR2_PASS_GENERATE_REACTIVE, ffxFsr2GenerateReactiveKernelCPU)
+} // namespace
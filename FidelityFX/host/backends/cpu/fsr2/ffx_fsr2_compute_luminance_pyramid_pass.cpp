@@ -0,0 +1,60 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// FSR2 pass 1
+// SRV  0 : FSR2_InputColor                     : r_input_color_jittered
+// UAV  0 : FSR2_SpdAtomicCounter               : rw_spd_global_atomic
+// UAV  1 : FSR2_ExposureMips                   : rw_img_mip_shading_change
+// UAV  2 : FSR2_ExposureMips                   : rw_img_mip_5
+// UAV  3 : FSR2_AutoExposure                   : rw_auto_exposure
+// CB   0 : cbFSR2
+// CB   1 : cbSPD
+
+#include <host/backends/cpu/ffx_cpu_kernel.h>
+#include <host/ffx_fsr2.h>
+#include <host/components/fsr2/ffx_fsr2_private.h>
+
+#define FSR2_BIND_SRV_INPUT_COLOR                     0
+
+#define FSR2_BIND_UAV_SPD_GLOBAL_ATOMIC               0
+#define FSR2_BIND_UAV_EXPOSURE_MIP_LUMA_CHANGE        1
+#define FSR2_BIND_UAV_EXPOSURE_MIP_5                  2
+#define FSR2_BIND_UAV_AUTO_EXPOSURE                   3
+
+#define FSR2_BIND_CB_FSR2                             0
+#define FSR2_BIND_CB_SPD                              1
+
+namespace
+{
+#include "fsr2/ffx_fsr2_callbacks_cpp.h"
+#include "fsr2/ffx_fsr2_common.h"
+#include "fsr2/ffx_fsr2_compute_luminance_pyramid.h"
+
+void CS(uint3 LocalThreadId, uint3 WorkGroupId, uint3 Dtid, uint LocalIndex)
+{
+    ComputeAutoExposure(WorkGroupId, LocalIndex);
+}
+
+// the pass reads none of the colour, motion vector and depth options, so it implements every permutation without fp16
+FFX_CPU_COMPUTE_KERNEL(ffxFsr2ComputeLuminancePyramidKernelCPU, CS, 256, 1, 1, FSR2_SHADER_PERMUTATION_ALLOW_FP16, 0)
+FFX_CPU_REGISTER_COMPUTE_KERNEL(FFX_EFFECT_FSR2, FFX_FSR2_PASS_COMPUTE_LUMINANCE_PYRAMID, ffxFsr2ComputeLuminancePyramidKernelCPU)
+} // namespace
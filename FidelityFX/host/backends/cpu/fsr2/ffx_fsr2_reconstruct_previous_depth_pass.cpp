@@ -0,0 +1,79 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// FSR2 pass 2
+// SRV  0 : FSR2_InputMotionVectors             : r_input_motion_vectors
+// SRV  1 : FSR2_InputDepth                     : r_input_depth
+// SRV  2 : FSR2_InputColor                     : r_input_color_jittered
+// SRV  3 : FSR2_InputExposure                  : r_input_exposure
+// UAV  0 : FSR2_ReconstructedPrevNearestDepth  : rw_reconstructed_previous_nearest_depth
+// UAV  1 : FSR2_InternalDilatedVelocity        : rw_dilated_motion_vectors
+// UAV  2 : FSR2_DilatedDepth                   : rw_dilatedDepth
+// UAV  3 : FSR2_LockInputLuma                  : rw_lock_input_luma
+// CB   0 : cbFSR2
+
+#include <host/backends/cpu/ffx_cpu_kernel.h>
+#include <host/ffx_fsr2.h>
+#include <host/components/fsr2/ffx_fsr2_private.h>
+
+#define FSR2_BIND_SRV_INPUT_MOTION_VECTORS              0
+#define FSR2_BIND_SRV_INPUT_DEPTH                       1
+#define FSR2_BIND_SRV_INPUT_COLOR                       2
+#define FSR2_BIND_SRV_INPUT_EXPOSURE                    3
+
+#define FSR2_BIND_UAV_RECONSTRUCTED_PREV_NEAREST_DEPTH  0
+#define FSR2_BIND_UAV_DILATED_MOTION_VECTORS            1
+#define FSR2_BIND_UAV_DILATED_DEPTH                     2
+#define FSR2_BIND_UAV_LOCK_INPUT_LUMA                   3
+
+#define FSR2_BIND_CB_FSR2                               0
+
+#define FFX_FSR2_OPTION_UPSAMPLE_SAMPLERS_USE_DATA_HALF         0
+#define FFX_FSR2_OPTION_ACCUMULATE_SAMPLERS_USE_DATA_HALF       0
+#define FFX_FSR2_OPTION_REPROJECT_SAMPLERS_USE_DATA_HALF        1
+#define FFX_FSR2_OPTION_POSTPROCESSLOCKSTATUS_SAMPLERS_USE_DATA_HALF 0
+#define FFX_FSR2_OPTION_UPSAMPLE_USE_LANCZOS_TYPE               2
+
+#define FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE              0
+#define FFX_FSR2_OPTION_HDR_COLOR_INPUT                         0
+#define FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS           1
+#define FFX_FSR2_OPTION_JITTERED_MOTION_VECTORS                 0
+#define FFX_FSR2_OPTION_INVERTED_DEPTH                          0
+#define FFX_FSR2_OPTION_APPLY_SHARPENING                        0
+
+namespace
+{
+#include "fsr2/ffx_fsr2_callbacks_cpp.h"
+#include "fsr2/ffx_fsr2_common.h"
+#include "fsr2/ffx_fsr2_sample.h"
+#include "fsr2/ffx_fsr2_reconstruct_dilated_velocity_and_previous_depth.h"
+
+void CS(uint3 LocalThreadId, uint3 WorkGroupId, uint3 Dtid, uint LocalIndex)
+{
+    ReconstructAndDilate(FfxInt32x2(Dtid.xy));
+}
+
+FFX_CPU_COMPUTE_KERNEL(ffxFsr2ReconstructPreviousDepthKernelCPU, CS, 8, 8, 1,
+                       FSR2_SHADER_PERMUTATION_HDR_COLOR_INPUT | FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS | FSR2_SHADER_PERMUTATION_JITTER_MOTION_VECTORS | FSR2_SHADER_PERMUTATION_DEPTH_INVERTED | FSR2_SHADER_PERMUTATION_ALLOW_FP16,
+                       FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS)
+FFX_CPU_REGISTER_COMPUTE_KERNEL(FFX_EFFECT_FSR2, FFX_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH, ffxFsr2ReconstructPreviousDepthKernelCPU)
+} // namespace
@@ -0,0 +1,115 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// FSR2 transparency and composition mask generation
+// SRV  0 : FSR2_InputOpaqueOnly                : r_input_opaque_only
+// SRV  1 : FSR2_InputColor                     : r_input_color_jittered
+// SRV  2 : FSR2_InputMotionVectors             : r_input_motion_vectors
+// SRV  4 : FSR2_InputReactiveMask              : r_reactive_mask
+// SRV  5 : FSR2_InputTransparencyAndCompositionMask : r_transparency_and_composition_mask
+// SRV 46 : FSR2_PrevPreAlpha                   : r_input_prev_color_pre_alpha
+// SRV 47 : FSR2_PrevPostAlpha                  : r_input_prev_color_post_alpha
+// UAV  0 : FSR2_AutoReactive                   : rw_output_autoreactive
+// UAV  1 : FSR2_AutoComposition                : rw_output_autocomposition
+// UAV  2 : FSR2_PrevPreAlpha                   : rw_output_prev_color_pre_alpha
+// UAV  3 : FSR2_PrevPostAlpha                  : rw_output_prev_color_post_alpha
+// CB   0 : cbFSR2
+// CB   1 : cbGenerateReactive
+
+#include <host/backends/cpu/ffx_cpu_kernel.h>
+#include <host/ffx_fsr2.h>
+#include <host/components/fsr2/ffx_fsr2_private.h>
+
+// the previous colours are declared at their resource identifiers rather than at the slots below, as in the HLSL pass
+#define FSR2_BIND_SRV_INPUT_OPAQUE_ONLY                 0
+#define FSR2_BIND_SRV_INPUT_COLOR                       1
+#define FSR2_BIND_SRV_INPUT_MOTION_VECTORS              2
+#define FSR2_BIND_SRV_PREV_PRE_ALPHA_COLOR              3
+#define FSR2_BIND_SRV_PREV_POST_ALPHA_COLOR             4
+#define FSR2_BIND_SRV_REACTIVE_MASK                     4
+#define FSR2_BIND_SRV_TRANSPARENCY_AND_COMPOSITION_MASK 5
+
+#define FSR2_BIND_UAV_AUTOREACTIVE                      0
+#define FSR2_BIND_UAV_AUTOCOMPOSITION                   1
+#define FSR2_BIND_UAV_PREV_PRE_ALPHA_COLOR              2
+#define FSR2_BIND_UAV_PREV_POST_ALPHA_COLOR             3
+
+#define FSR2_BIND_CB_FSR2                               0
+#define FSR2_BIND_CB_AUTOREACTIVE                       1
+
+#define FFX_FSR2_OPTION_UPSAMPLE_SAMPLERS_USE_DATA_HALF         0
+#define FFX_FSR2_OPTION_ACCUMULATE_SAMPLERS_USE_DATA_HALF       0
+#define FFX_FSR2_OPTION_REPROJECT_SAMPLERS_USE_DATA_HALF        1
+#define FFX_FSR2_OPTION_POSTPROCESSLOCKSTATUS_SAMPLERS_USE_DATA_HALF 0
+#define FFX_FSR2_OPTION_UPSAMPLE_USE_LANCZOS_TYPE               2
+
+#define FFX_FSR2_OPTION_REPROJECT_USE_LANCZOS_TYPE              0
+#define FFX_FSR2_OPTION_HDR_COLOR_INPUT                         0
+#define FFX_FSR2_OPTION_LOW_RESOLUTION_MOTION_VECTORS           1
+#define FFX_FSR2_OPTION_JITTERED_MOTION_VECTORS                 0
+#define FFX_FSR2_OPTION_INVERTED_DEPTH                          0
+#define FFX_FSR2_OPTION_APPLY_SHARPENING                        0
+
+namespace
+{
+#include "fsr2/ffx_fsr2_callbacks_cpp.h"
+#include "fsr2/ffx_fsr2_common.h"
+#include "fsr2/ffx_fsr2_tcr_autogen.h"
+
+// the body of the HLSL pass around the algorithm header
+void CS(uint3 LocalThreadId, uint3 WorkGroupId, uint3 Dtid, uint LocalIndex)
+{
+    const FFX_MIN16_I2 uDispatchThreadId = FFX_MIN16_I2(Dtid.xy);
+
+    // fetch pre- and post-alpha color values
+    const FFX_MIN16_F2 fUv     = (FFX_MIN16_F2(uDispatchThreadId) + FFX_MIN16_F2(0.5f, 0.5f)) / FFX_MIN16_F2(RenderSize());
+    const FFX_MIN16_F2 fPrevUV = fUv + FFX_MIN16_F2(LoadInputMotionVector(uDispatchThreadId));
+    const FFX_MIN16_I2 iPrevIdx = FFX_MIN16_I2(fPrevUV * FFX_MIN16_F2(RenderSize()) - 0.5f);
+
+    const FFX_MIN16_F3 colorPreAlpha  = FFX_MIN16_F3(LoadOpaqueOnly(uDispatchThreadId));
+    const FFX_MIN16_F3 colorPostAlpha = FFX_MIN16_F3(LoadInputColor(uDispatchThreadId));
+
+    FFX_MIN16_F2 outReactiveMask = FFX_MIN16_F2(0, 0);
+
+    outReactiveMask.y = ComputeTransparencyAndComposition(uDispatchThreadId, iPrevIdx);
+
+    if (outReactiveMask.y > 0.5f)
+    {
+        outReactiveMask.x = ComputeReactive(uDispatchThreadId, iPrevIdx);
+        outReactiveMask.x *= FFX_MIN16_F(ReactiveScale());
+        outReactiveMask.x = outReactiveMask.x < ReactiveMax() ? outReactiveMask.x : FFX_MIN16_F(ReactiveMax());
+    }
+
+    outReactiveMask.y *= FFX_MIN16_F(TcScale());
+
+    outReactiveMask.x = ffxMax(outReactiveMask.x, FFX_MIN16_F(LoadReactiveMask(uDispatchThreadId)));
+    outReactiveMask.y = ffxMax(outReactiveMask.y, FFX_MIN16_F(LoadTransparencyAndCompositionMask(uDispatchThreadId)));
+
+    StoreAutoReactive(uDispatchThreadId, outReactiveMask);
+
+    StorePrevPreAlpha(uDispatchThreadId, colorPreAlpha);
+    StorePrevPostAlpha(uDispatchThreadId, colorPostAlpha);
+}
+
+FFX_CPU_COMPUTE_KERNEL(ffxFsr2TcrAutogenerateKernelCPU, CS, 8, 8, 1, FSR2_SHADER_PERMUTATION_JITTER_MOTION_VECTORS | FSR2_SHADER_PERMUTATION_ALLOW_FP16, 0)
+FFX_CPU_REGISTER_COMPUTE_KERNEL(FFX_EFFECT_FSR2, FFX_FSR2_PASS_TCR_AUTOGENERATE, ffxFsr2TcrAutogenerateKernelCPU)
+} // namespace
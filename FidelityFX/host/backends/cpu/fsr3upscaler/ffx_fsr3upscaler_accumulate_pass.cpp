@@ -0,0 +1,90 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// FSR3 upscaler pass 7 (without RCAS)
+// SRV  0 : FSR3UPSCALER_InputExposure              : r_input_exposure
+// SRV  1 : FSR3UPSCALER_DilatedReactiveMasks       : r_dilated_reactive_masks
+// SRV  2 : FSR3UPSCALER_DilatedVelocity            : r_dilated_motion_vectors
+// SRV  3 : FSR3UPSCALER_InternalUpscaled           : r_internal_upscaled_color
+// SRV  4 : FSR3UPSCALER_LanczosLutData             : r_lanczos_lut
+// SRV  5 : FSR3UPSCALER_FarthestDepthMip1          : r_farthest_depth_mip1
+// SRV  6 : FSR3UPSCALER_Luma                       : r_current_luma
+// SRV  7 : FSR3UPSCALER_IntermediateFp16x1         : r_luma_instability
+// SRV  8 : FSR3UPSCALER_InputColor                 : r_input_color_jittered
+// UAV  0 : FSR3UPSCALER_InternalUpscaled           : rw_internal_upscaled_color
+// UAV  1 : FSR3UPSCALER_OutputUpscaledColor        : rw_upscaled_output
+// UAV  2 : FSR3UPSCALER_NewLocks                   : rw_new_locks
+// CB   0 : cbFSR3Upscaler
+
+#include <host/backends/cpu/ffx_cpu_kernel.h>
+#include <host/ffx_fsr3upscaler.h>
+#include <host/components/fsr3upscaler/ffx_fsr3upscaler_private.h>
+
+#define FSR3UPSCALER_BIND_SRV_INPUT_EXPOSURE                          0
+#define FSR3UPSCALER_BIND_SRV_DILATED_REACTIVE_MASKS                  1
+#define FSR3UPSCALER_BIND_SRV_DILATED_MOTION_VECTORS                  2
+#define FSR3UPSCALER_BIND_SRV_INTERNAL_UPSCALED                       3
+#define FSR3UPSCALER_BIND_SRV_LANCZOS_LUT                             4
+#define FSR3UPSCALER_BIND_SRV_FARTHEST_DEPTH_MIP1                     5
+#define FSR3UPSCALER_BIND_SRV_CURRENT_LUMA                            6
+#define FSR3UPSCALER_BIND_SRV_LUMA_INSTABILITY                        7
+#define FSR3UPSCALER_BIND_SRV_INPUT_COLOR                             8
+
+#define FSR3UPSCALER_BIND_UAV_INTERNAL_UPSCALED                       0
+#define FSR3UPSCALER_BIND_UAV_UPSCALED_OUTPUT                         1
+#define FSR3UPSCALER_BIND_UAV_NEW_LOCKS                               2
+
+#define FSR3UPSCALER_BIND_CB_FSR3UPSCALER                            0
+
+#define FFX_FSR3UPSCALER_OPTION_UPSAMPLE_SAMPLERS_USE_DATA_HALF          0
+#define FFX_FSR3UPSCALER_OPTION_ACCUMULATE_SAMPLERS_USE_DATA_HALF        0
+#define FFX_FSR3UPSCALER_OPTION_REPROJECT_SAMPLERS_USE_DATA_HALF         1
+#define FFX_FSR3UPSCALER_OPTION_POSTPROCESSLOCKSTATUS_SAMPLERS_USE_DATA_HALF 0
+#define FFX_FSR3UPSCALER_OPTION_UPSAMPLE_USE_LANCZOS_TYPE                2
+
+#define FFX_FSR3UPSCALER_OPTION_REPROJECT_USE_LANCZOS_TYPE               0
+#define FFX_FSR3UPSCALER_OPTION_HDR_COLOR_INPUT                          0
+#define FFX_FSR3UPSCALER_OPTION_LOW_RESOLUTION_MOTION_VECTORS            1
+#define FFX_FSR3UPSCALER_OPTION_JITTERED_MOTION_VECTORS                  0
+#define FFX_FSR3UPSCALER_OPTION_INVERTED_DEPTH                           0
+#define FFX_FSR3UPSCALER_OPTION_APPLY_SHARPENING                         0
+
+namespace
+{
+#include "fsr3upscaler/ffx_fsr3upscaler_callbacks_cpp.h"
+#include "fsr3upscaler/ffx_fsr3upscaler_common.h"
+#include "fsr3upscaler/ffx_fsr3upscaler_sample.h"
+#include "fsr3upscaler/ffx_fsr3upscaler_upsample.h"
+#include "fsr3upscaler/ffx_fsr3upscaler_reproject.h"
+#include "fsr3upscaler/ffx_fsr3upscaler_accumulate.h"
+
+void CS(uint3 LocalThreadId, uint3 WorkGroupId, uint3 Dtid, uint LocalIndex)
+{
+    Accumulate(FfxInt32x2(Dtid.xy));
+}
+
+FFX_CPU_COMPUTE_KERNEL(ffxFsr3UpscalerAccumulateKernelCPU, CS, 8, 8, 1,
+                       FSR3UPSCALER_SHADER_PERMUTATION_USE_LANCZOS_TYPE | FSR3UPSCALER_SHADER_PERMUTATION_HDR_COLOR_INPUT | FSR3UPSCALER_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS |
+                       FSR3UPSCALER_SHADER_PERMUTATION_ENABLE_SHARPENING | FSR3UPSCALER_SHADER_PERMUTATION_ALLOW_FP16,
+                       FSR3UPSCALER_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS)
+FFX_CPU_REGISTER_COMPUTE_KERNEL(FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_ACCUMULATE, ffxFsr3UpscalerAccumulateKernelCPU)
+} // namespace
@@ -0,0 +1,80 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// FSR3 upscaler pass 6
+// SRV  0 : FSR3UPSCALER_InputExposure              : r_input_exposure
+// SRV  1 : FSR3UPSCALER_DilatedReactiveMasks       : r_dilated_reactive_masks
+// SRV  2 : FSR3UPSCALER_DilatedVelocity            : r_dilated_motion_vectors
+// SRV  3 : FSR3UPSCALER_FrameInfo                  : r_frame_info
+// SRV  4 : FSR3UPSCALER_LumaHistory                : r_luma_history
+// SRV  5 : FSR3UPSCALER_FarthestDepthMip1          : r_farthest_depth_mip1
+// SRV  6 : FSR3UPSCALER_Luma                       : r_current_luma
+// UAV  0 : FSR3UPSCALER_LumaHistory                : rw_luma_history
+// UAV  1 : FSR3UPSCALER_IntermediateFp16x1         : rw_luma_instability
+// CB   0 : cbFSR3Upscaler
+
+#include <host/backends/cpu/ffx_cpu_kernel.h>
+#include <host/ffx_fsr3upscaler.h>
+#include <host/components/fsr3upscaler/ffx_fsr3upscaler_private.h>
+
+#define FSR3UPSCALER_BIND_SRV_INPUT_EXPOSURE                          0
+#define FSR3UPSCALER_BIND_SRV_DILATED_REACTIVE_MASKS                  1
+#define FSR3UPSCALER_BIND_SRV_DILATED_MOTION_VECTORS                  2
+#define FSR3UPSCALER_BIND_SRV_FRAME_INFO                              3
+#define FSR3UPSCALER_BIND_SRV_LUMA_HISTORY                            4
+#define FSR3UPSCALER_BIND_SRV_FARTHEST_DEPTH_MIP1                     5
+#define FSR3UPSCALER_BIND_SRV_CURRENT_LUMA                            6
+
+#define FSR3UPSCALER_BIND_UAV_LUMA_HISTORY                            0
+#define FSR3UPSCALER_BIND_UAV_LUMA_INSTABILITY                        1
+
+#define FSR3UPSCALER_BIND_CB_FSR3UPSCALER                            0
+
+#define FFX_FSR3UPSCALER_OPTION_UPSAMPLE_SAMPLERS_USE_DATA_HALF          0
+#define FFX_FSR3UPSCALER_OPTION_ACCUMULATE_SAMPLERS_USE_DATA_HALF        0
+#define FFX_FSR3UPSCALER_OPTION_REPROJECT_SAMPLERS_USE_DATA_HALF         1
+#define FFX_FSR3UPSCALER_OPTION_POSTPROCESSLOCKSTATUS_SAMPLERS_USE_DATA_HALF 0
+#define FFX_FSR3UPSCALER_OPTION_UPSAMPLE_USE_LANCZOS_TYPE                2
+
+#define FFX_FSR3UPSCALER_OPTION_REPROJECT_USE_LANCZOS_TYPE               0
+#define FFX_FSR3UPSCALER_OPTION_HDR_COLOR_INPUT                          0
+#define FFX_FSR3UPSCALER_OPTION_LOW_RESOLUTION_MOTION_VECTORS            1
+#define FFX_FSR3UPSCALER_OPTION_JITTERED_MOTION_VECTORS                  0
+#define FFX_FSR3UPSCALER_OPTION_INVERTED_DEPTH                           0
+#define FFX_FSR3UPSCALER_OPTION_APPLY_SHARPENING                         0
+
+namespace
+{
+#include "fsr3upscaler/ffx_fsr3upscaler_callbacks_cpp.h"
+#include "fsr3upscaler/ffx_fsr3upscaler_common.h"
+#include "fsr3upscaler/ffx_fsr3upscaler_luma_instability.h"
+
+void CS(uint3 LocalThreadId, uint3 WorkGroupId, uint3 Dtid, uint LocalIndex)
+{
+    LumaInstability(FfxInt32x2(Dtid.xy));
+}
+
+FFX_CPU_COMPUTE_KERNEL(ffxFsr3UpscalerLumaInstabilityKernelCPU, CS, 8, 8, 1,
+                       FSR3UPSCALER_SHADER_PERMUTATION_ALLOW_FP16,
+                       0)
+FFX_CPU_REGISTER_COMPUTE_KERNEL(FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_LUMA_INSTABILITY, ffxFsr3UpscalerLumaInstabilityKernelCPU)
+} // namespace
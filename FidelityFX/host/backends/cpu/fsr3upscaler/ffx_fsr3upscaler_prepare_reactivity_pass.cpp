@@ -0,0 +1,86 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// FSR3 upscaler pass 5
+// SRV  0 : FSR3UPSCALER_ReconstructedPrevNearestDepth: r_reconstructed_previous_nearest_depth
+// SRV  1 : FSR3UPSCALER_DilatedVelocity            : r_dilated_motion_vectors
+// SRV  2 : FSR3UPSCALER_DilatedDepth               : r_dilated_depth
+// SRV  3 : FSR3UPSCALER_InputReactiveMask          : r_reactive_mask
+// SRV  4 : FSR3UPSCALER_InputTransparencyAndCompositionMask: r_transparency_and_composition_mask
+// SRV  5 : FSR3UPSCALER_Accumulation               : r_accumulation
+// SRV  6 : FSR3UPSCALER_ShadingChange              : r_shading_change
+// SRV  7 : FSR3UPSCALER_Luma                       : r_current_luma
+// SRV  8 : FSR3UPSCALER_InputExposure              : r_input_exposure
+// UAV  0 : FSR3UPSCALER_DilatedReactiveMasks       : rw_dilated_reactive_masks
+// UAV  1 : FSR3UPSCALER_NewLocks                   : rw_new_locks
+// UAV  2 : FSR3UPSCALER_Accumulation               : rw_accumulation
+// CB   0 : cbFSR3Upscaler
+
+#include <host/backends/cpu/ffx_cpu_kernel.h>
+#include <host/ffx_fsr3upscaler.h>
+#include <host/components/fsr3upscaler/ffx_fsr3upscaler_private.h>
+
+#define FSR3UPSCALER_BIND_SRV_RECONSTRUCTED_PREV_NEAREST_DEPTH        0
+#define FSR3UPSCALER_BIND_SRV_DILATED_MOTION_VECTORS                  1
+#define FSR3UPSCALER_BIND_SRV_DILATED_DEPTH                           2
+#define FSR3UPSCALER_BIND_SRV_REACTIVE_MASK                           3
+#define FSR3UPSCALER_BIND_SRV_TRANSPARENCY_AND_COMPOSITION_MASK       4
+#define FSR3UPSCALER_BIND_SRV_ACCUMULATION                            5
+#define FSR3UPSCALER_BIND_SRV_SHADING_CHANGE                          6
+#define FSR3UPSCALER_BIND_SRV_CURRENT_LUMA                            7
+#define FSR3UPSCALER_BIND_SRV_INPUT_EXPOSURE                          8
+
+#define FSR3UPSCALER_BIND_UAV_DILATED_REACTIVE_MASKS                  0
+#define FSR3UPSCALER_BIND_UAV_NEW_LOCKS                               1
+#define FSR3UPSCALER_BIND_UAV_ACCUMULATION                            2
+
+#define FSR3UPSCALER_BIND_CB_FSR3UPSCALER                            0
+
+#define FFX_FSR3UPSCALER_OPTION_UPSAMPLE_SAMPLERS_USE_DATA_HALF          0
+#define FFX_FSR3UPSCALER_OPTION_ACCUMULATE_SAMPLERS_USE_DATA_HALF        0
+#define FFX_FSR3UPSCALER_OPTION_REPROJECT_SAMPLERS_USE_DATA_HALF         1
+#define FFX_FSR3UPSCALER_OPTION_POSTPROCESSLOCKSTATUS_SAMPLERS_USE_DATA_HALF 0
+#define FFX_FSR3UPSCALER_OPTION_UPSAMPLE_USE_LANCZOS_TYPE                2
+
+#define FFX_FSR3UPSCALER_OPTION_REPROJECT_USE_LANCZOS_TYPE               0
+#define FFX_FSR3UPSCALER_OPTION_HDR_COLOR_INPUT                          0
+#define FFX_FSR3UPSCALER_OPTION_LOW_RESOLUTION_MOTION_VECTORS            1
+#define FFX_FSR3UPSCALER_OPTION_JITTERED_MOTION_VECTORS                  0
+#define FFX_FSR3UPSCALER_OPTION_INVERTED_DEPTH                           0
+#define FFX_FSR3UPSCALER_OPTION_APPLY_SHARPENING                         0
+
+namespace
+{
+#include "fsr3upscaler/ffx_fsr3upscaler_callbacks_cpp.h"
+#include "fsr3upscaler/ffx_fsr3upscaler_common.h"
+#include "fsr3upscaler/ffx_fsr3upscaler_prepare_reactivity.h"
+
+void CS(uint3 LocalThreadId, uint3 WorkGroupId, uint3 Dtid, uint LocalIndex)
+{
+    PrepareReactivity(FfxInt32x2(Dtid.xy));
+}
+
+FFX_CPU_COMPUTE_KERNEL(ffxFsr3UpscalerPrepareReactivityKernelCPU, CS, 8, 8, 1,
+                       FSR3UPSCALER_SHADER_PERMUTATION_ALLOW_FP16,
+                       0)
+FFX_CPU_REGISTER_COMPUTE_KERNEL(FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_PREPARE_REACTIVITY, ffxFsr3UpscalerPrepareReactivityKernelCPU)
+} // namespace
@@ -0,0 +1,62 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// SPD pass
+// SRV  0 : SPD_InputDownsampleSrc          : r_input_downsample_src
+// UAV  0 : SPD_InternalGlobalAtomic        : rw_internal_global_atomic
+// UAV  1 : SPD_InputDownsampleSrcMidMip    : rw_input_downsample_src_mid_mip
+// UAV  2 : SPD_InputDownsampleSrcMips      : rw_input_downsample_src_mips
+// CB   0 : cbSPD
+
+#include <host/backends/cpu/ffx_cpu_kernel.h>
+#include <host/ffx_spd.h>
+#include <host/components/spd/ffx_spd_private.h>
+
+#define FFX_SPD_BIND_SRV_INPUT_DOWNSAMPLE_SRC               0
+
+#define FFX_SPD_BIND_UAV_INTERNAL_GLOBAL_ATOMIC             0
+#define FFX_SPD_BIND_UAV_INPUT_DOWNSAMPLE_SRC_MID_MIPMAP    1
+#define FFX_SPD_BIND_UAV_INPUT_DOWNSAMPLE_SRC_MIPS          2
+
+#define FFX_SPD_BIND_CB_SPD                                 0
+
+#define FFX_SPD_OPTION_LINEAR_SAMPLE                        0
+#define FFX_SPD_OPTION_WAVE_INTEROP_LDS                     0
+#define FFX_SPD_OPTION_DOWNSAMPLE_FILTER                    0
+
+namespace
+{
+#include "spd/ffx_spd_callbacks_cpp.h"
+#include "spd/ffx_spd_downsample.h"
+
+void CS(uint3 LocalThreadId, uint3 WorkGroupId, uint3 Dtid, uint LocalIndex)
+{
+    DOWNSAMPLE(LocalIndex, WorkGroupId);
+}
+
+// wave operations always go through group shared memory, so SPD_SHADER_PERMUTATION_WAVE_INTEROP_LDS is implied
+FFX_CPU_COMPUTE_KERNEL(ffxSpdDownsampleKernelCPU, CS, 256, 1, 1,
+                       SPD_SHADER_PERMUTATION_LINEAR_SAMPLE | SPD_SHADER_PERMUTATION_DOWNSAMPLE_FILTER_MEAN |
+                       SPD_SHADER_PERMUTATION_DOWNSAMPLE_FILTER_MIN | SPD_SHADER_PERMUTATION_DOWNSAMPLE_FILTER_MAX,
+                       SPD_SHADER_PERMUTATION_DOWNSAMPLE_FILTER_MEAN)
+FFX_CPU_REGISTER_COMPUTE_KERNEL(FFX_EFFECT_SPD, FFX_SPD_PASS_DOWNSAMPLE, ffxSpdDownsampleKernelCPU)
+} // namespace
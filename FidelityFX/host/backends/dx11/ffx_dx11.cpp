@@ -27,10 +27,14 @@
 #include <host/ffx_assert.h>
 #include <host/backends/dx11/ffx_dx11.h>
 #include <host/backends/ffx_shader_blobs.h>
+#include <DXBC/DXBCPatch.h>
+#include <algorithm>  // for copy_n
+#include <atomic>
 #include <codecvt>  // convert string to wstring
+#include <cwchar>
 #include <mutex>
+#include <vector>
 
-extern "C" void CalculateDXBCChecksum(const DWORD* pData, DWORD dwSize, DWORD dwHash[4]);
 
 // DX11 prototypes for functions in the backend interface
 FfxUInt32 GetSDKVersionDX11(FfxInterface* backendInterface);
@@ -52,6 +56,162 @@ FfxErrorCode ExecuteGpuJobsDX11(FfxInterface* backendInterface, FfxCommandList c
 
 #define FFX_MAX_RESOURCE_IDENTIFIER_COUNT   (128)
 
+// Scheduled GPU jobs are stored as variable length records holding only what the execute path reads,
+// rather than whole FfxGpuJobDescription structures with their pipeline state and debug names.
+typedef struct GpuJob_DX11 {
+
+    FfxGpuJobType                   jobType;
+    uint32_t                        size;                                   // size of the record in bytes, including its bindings
+#ifdef FFX_DEBUG
+    wchar_t                         jobLabel[FFX_RESOURCE_NAME_SIZE];
+#endif
+
+} GpuJob_DX11;
+
+// a view bound by a compute job, already resolved to its register slot
+typedef struct GpuJobBinding_DX11 {
+
+    uint32_t                        slot;
+    FfxResourceInternal             resource;
+    uint32_t                        offset;                                 // mip of texture UAVs, byte offset of buffers
+    uint32_t                        size;
+    uint32_t                        stride;
+
+} GpuJobBinding_DX11;
+
+// followed by uavTextureCount, uavBufferCount, srvTextureCount and srvBufferCount bindings, in that order
+typedef struct ComputeJob_DX11 {
+
+    GpuJob_DX11                     header;
+    ID3D11ComputeShader*            pipeline;
+    uint32_t                        dimensions[3];
+    uint16_t                        uavTextureCount;
+    uint16_t                        uavBufferCount;
+    uint16_t                        srvTextureCount;
+    uint16_t                        srvBufferCount;
+    uint32_t                        constCount;
+    FfxConstantBuffer               cbs[FFX_MAX_NUM_CONST_BUFFERS];
+
+} ComputeJob_DX11;
+
+typedef struct ClearFloatJob_DX11 {
+
+    GpuJob_DX11                     header;
+    FfxClearFloatJobDescription     clearJobDescriptor;
+
+} ClearFloatJob_DX11;
+
+typedef struct CopyJob_DX11 {
+
+    GpuJob_DX11                     header;
+    FfxCopyJobDescription           copyJobDescriptor;
+
+} CopyJob_DX11;
+
+typedef struct DiscardJob_DX11 {
+
+    GpuJob_DX11                     header;
+    FfxDiscardJobDescription        discardJobDescriptor;
+
+} DiscardJob_DX11;
+
+#define FFX_DX11_GPU_JOB_ALIGNMENT          (sizeof(uint64_t))
+#define FFX_DX11_MAX_GPU_JOB_SIZE           FFX_ALIGN_UP(sizeof(ComputeJob_DX11) + (FFX_MAX_NUM_UAVS + FFX_MAX_NUM_SRVS) * 2 * sizeof(GpuJobBinding_DX11), FFX_DX11_GPU_JOB_ALIGNMENT)
+
+#define FFX_DX11_VIEW_CACHE_BUCKET_COUNT    (256)
+#define FFX_DX11_VIEW_CACHE_CAPACITY        (1024)
+#define FFX_DX11_VIEW_CACHE_MAX_AGE         (2)
+
+#define FFX_DX11_CONSTANT_BUFFER_REUSE_COUNT    (64)
+#define FFX_DX11_CONSTANT_BUFFER_REUSE_MAX_SIZE (256)
+
+// The compute state ExecuteGpuJobsDX11 has set on the immediate context, so each job only sets what changes.
+// Views stay bound after their dispatch and are only unbound when the next job uses their resource the other
+// way round, or once all jobs have run. The [begin, end) ranges cover every view slot written meanwhile.
+typedef struct ComputeState_DX11 {
+
+    ID3D11ComputeShader*                shader;
+    bool                                shaderKnown;
+    uint32_t                            constantBufferKnownMask;
+    ID3D11Buffer*                       constantBuffers[FFX_MAX_NUM_CONST_BUFFERS];
+    uint32_t                            constantBufferFirst[FFX_MAX_NUM_CONST_BUFFERS];
+    uint32_t                            constantBufferNum[FFX_MAX_NUM_CONST_BUFFERS];
+
+    ID3D11UnorderedAccessView*          uavs[D3D11_1_UAV_SLOT_COUNT];
+    ID3D11Resource*                     uavResources[D3D11_1_UAV_SLOT_COUNT];
+    uint32_t                            uavBegin;
+    uint32_t                            uavEnd;
+
+    ID3D11ShaderResourceView*           srvs[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT];
+    ID3D11Resource*                     srvResources[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT];
+    uint32_t                            srvBegin;
+    uint32_t                            srvEnd;
+
+} ComputeState_DX11;
+
+// A constant block recently written to the Direct3D 11.1 ring, so staging the same contents again can bind it
+// instead of allocating. The mapped ring is write-only, so the entry keeps its own copy of the contents and a block
+// is only reused when the bytes match, never on the hash alone. Each entry is a seqlock: a writer makes the sequence
+// odd while it updates the entry, a reader that sees it odd or changed treats the lookup as a miss.
+typedef struct ConstantBufferReuse_DX11 {
+
+    std::atomic<uint32_t>               sequence;
+    std::atomic<uint32_t>               size;                                               // 0 while the entry is empty
+    std::atomic<uint64_t>               hash;
+    std::atomic<uint64_t>               position;                                           // in bytes allocated from the ring
+    std::atomic<uint32_t>               contents[FFX_DX11_CONSTANT_BUFFER_REUSE_MAX_SIZE / sizeof(uint32_t)];
+
+} ConstantBufferReuse_DX11;
+
+// A view of a dynamically registered resource created by a DX11 backend, such as the resources one effect
+// shares with another. It is keyed by the resource and the whole view description (format, dimension, mip)
+// rather than by the dynamic slot it was first registered in, so inputs that are registered in another order,
+// or optional inputs that come and go, do not rebuild the views of the others. Resources of the application
+// are never cached: their views are released when they are unregistered, so nothing keeps them alive.
+typedef struct ViewCacheEntry_DX11 {
+
+    ID3D11Resource*                     resource;
+    bool                                uav;
+    union {
+        D3D11_SHADER_RESOURCE_VIEW_DESC     srvDescription;
+        D3D11_UNORDERED_ACCESS_VIEW_DESC    uavDescription;
+    };
+    uint32_t                            hash;
+    ID3D11View*                         view;
+    uint64_t                            lastUsedFrame;
+
+    ViewCacheEntry_DX11*                bucketNext;
+    ViewCacheEntry_DX11*                lruPrev;                                // towards more recently used entries
+    ViewCacheEntry_DX11*                lruNext;                                // towards less recently used entries
+
+} ViewCacheEntry_DX11;
+
+// A frame of the cache starts when an effect context registers resources again after it already did
+// in the current frame, so several effect contexts dispatched in one application frame share it.
+// Entries of resources which are not registered for FFX_DX11_VIEW_CACHE_MAX_AGE frames are evicted,
+// which drops the reference the cached views keep on resources whose effect stopped sharing them.
+// Two frames rather than one lets an effect context dispatched twice in a frame keep the views of
+// the contexts dispatched between its dispatches.
+typedef struct ViewCache_DX11 {
+
+    ViewCacheEntry_DX11*                buckets[FFX_DX11_VIEW_CACHE_BUCKET_COUNT];
+    ViewCacheEntry_DX11*                lruHead;
+    ViewCacheEntry_DX11*                lruTail;
+    uint32_t                            entryCount;
+    uint64_t                            frameIndex;
+
+    uint32_t                            frameHitCount;
+    uint32_t                            frameMissCount;
+    uint32_t                            lastFrameHitCount;
+    uint32_t                            lastFrameMissCount;
+    uint64_t                            hitCount;
+    uint64_t                            missCount;
+    uint64_t                            evictionCount;
+
+    std::mutex                          mutex;
+
+} ViewCache_DX11;
+
 typedef struct BackendContext_DX11 {
 
     // store for resources and resourceViews
@@ -64,6 +224,7 @@ typedef struct BackendContext_DX11 {
         FfxResourceDescription      resourceDescription;
         ID3D11ShaderResourceView*   srvPtr[16];
         ID3D11UnorderedAccessView*  uavPtr[16];
+        bool                        applicationOwned;   // registered resource not created by a DX11 backend, released on unregister
     } Resource;
 
     uint32_t refCount;
@@ -75,11 +236,19 @@ typedef struct BackendContext_DX11 {
 #if HAVE_NVIDIA
     HRESULT               (*NvAPI_D3D11_SetNvShaderExtnSlot)(IUnknown*, uint32_t) = nullptr;
 #endif
-    FfxGpuJobDescription*   pGpuJobs;
+    uint8_t*                pGpuJobs;
     uint32_t                gpuJobCount;
+    uint32_t                gpuJobSize;
+    uint32_t                gpuJobCapacity;
+    uint32_t                executedGpuJobCount;                            // jobs run by the last execution
+    uint32_t                executedGpuJobSize;                             // bytes of records walked by the last execution
+    uint32_t                maxExecutedGpuJobSize;
 
     ID3D11ShaderResourceView* srvs[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT];
     ID3D11UnorderedAccessView* uavs[D3D11_1_UAV_SLOT_COUNT];
+    ID3D11Resource*         srvResources[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT];
+    ID3D11Resource*         uavResources[D3D11_1_UAV_SLOT_COUNT];
+    ComputeState_DX11       computeState;
 
     uint8_t*                pStagingRingBuffer;
     uint32_t                stagingRingBufferBase;
@@ -92,6 +261,7 @@ typedef struct BackendContext_DX11 {
 
         // Usage
         bool                active;
+        uint64_t            viewCacheFrame;                                 // frame of the view cache this context last registered resources in
 
         // VRAM usage
         FfxEffectMemoryUsage vramUsage;
@@ -101,12 +271,25 @@ typedef struct BackendContext_DX11 {
     // Resource holder
     Resource*               pResources;
     EffectContext*          pEffectContexts;
+    ViewCache_DX11*         pViewCache;
 
     void*                   constantBufferMem[FFX_MAX_NUM_CONST_BUFFERS];
     ID3D11Buffer*           constantBufferResource[FFX_MAX_NUM_CONST_BUFFERS];
     uint32_t                constantBufferSize[FFX_MAX_NUM_CONST_BUFFERS];
-    uint32_t                constantBufferOffset[FFX_MAX_NUM_CONST_BUFFERS];
-    std::mutex              constantBufferMutex;
+    std::atomic<uint64_t>   constantBufferHead;                             // bytes allocated from the Direct3D 11.1 ring since it was created
+    std::mutex              constantBufferMutex;                            // only guards the Direct3D 11.0 per slot buffers
+    uint32_t                constantBufferContentSize[FFX_MAX_NUM_CONST_BUFFERS];  // contents of the Direct3D 11.0 per slot buffers, 0 when unknown
+    uint8_t                 constantBufferContents[FFX_MAX_NUM_CONST_BUFFERS][FFX_DX11_CONSTANT_BUFFER_REUSE_MAX_SIZE];
+    ConstantBufferReuse_DX11 constantBufferReuse[FFX_DX11_CONSTANT_BUFFER_REUSE_COUNT];
+
+    std::atomic<uint64_t>   constantBufferStagedBytes;
+    std::atomic<uint64_t>   constantBufferCopiedBytes;
+    std::atomic<uint64_t>   constantBufferAllocationCount;
+    std::atomic<uint64_t>   constantBufferMapCount;
+    std::atomic<uint64_t>   constantBufferWrapCount;
+    std::atomic<uint64_t>   constantBufferReusedCount;
+    std::atomic<uint64_t>   constantBufferReusedBytes;
+    std::atomic<uint64_t>   constantBufferLockCount;
 
 } BackendContext_DX11;
 
@@ -117,7 +300,7 @@ FFX_API size_t ffxGetScratchMemorySizeDX11(size_t maxContexts)
     uint32_t resourceArraySize          = FFX_ALIGN_UP(maxContexts * FFX_MAX_RESOURCE_COUNT * sizeof(BackendContext_DX11::Resource), sizeof(uint64_t));
     uint32_t contextArraySize           = FFX_ALIGN_UP(maxContexts * sizeof(BackendContext_DX11::EffectContext), sizeof(uint32_t));
     uint32_t stagingRingBufferArraySize = FFX_ALIGN_UP(maxContexts * FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE, sizeof(uint32_t));
-    uint32_t gpuJobDescArraySize        = FFX_ALIGN_UP(maxContexts * FFX_MAX_GPU_JOBS * sizeof(FfxGpuJobDescription), sizeof(uint32_t));
+    uint32_t gpuJobDescArraySize        = FFX_ALIGN_UP(maxContexts * FFX_MAX_GPU_JOBS * FFX_DX11_MAX_GPU_JOB_SIZE, sizeof(uint32_t));
 
     return FFX_ALIGN_UP(sizeof(BackendContext_DX11) + resourceArraySize + contextArraySize + stagingRingBufferArraySize + gpuJobDescArraySize, sizeof(uint64_t));
 }
@@ -164,6 +347,7 @@ FfxErrorCode ffxGetInterfaceDX11(
     backendInterface->fpStageConstantBufferDataFunc = StageConstantBufferDataDX11;
     backendInterface->fpCreatePipeline = CreatePipelineDX11;
     backendInterface->fpGetPermutationBlobByIndex = ffxGetPermutationBlobByIndex;
+    backendInterface->fpReleasePermutationBlob = ffxReleasePermutationBlob;
     backendInterface->fpDestroyPipeline = DestroyPipelineDX11;
     backendInterface->fpScheduleGpuJob = ScheduleGpuJobDX11;
     backendInterface->fpExecuteGpuJobs = ExecuteGpuJobsDX11;
@@ -222,6 +406,17 @@ FfxResource ffxGetResourceDX11(ID3D11Resource* dx11Resource,
     return resource;
 }
 
+// tags the resources every DX11 backend creates, so that a backend they are registered with can tell them
+// from the resources of the application {6C4B3E2A-9D1F-4A57-B8E0-3F2D71C5A964}
+static const GUID s_internalResourceGuidDX11 = { 0x6c4b3e2a, 0x9d1f, 0x4a57, { 0xb8, 0xe0, 0x3f, 0x2d, 0x71, 0xc5, 0xa9, 0x64 } };
+
+static bool isInternalResourceDX11(ID3D11Resource* resource)
+{
+    uint32_t tag = 0;
+    UINT tagSize = sizeof(tag);
+    return SUCCEEDED(resource->GetPrivateData(s_internalResourceGuidDX11, &tagSize, &tag)) && tagSize == sizeof(tag) && tag == 1;
+}
+
 static void SetNameDX11(ID3D11DeviceChild* resource, wchar_t const* name)
 {
     if (resource)
@@ -717,6 +912,191 @@ FfxErrorCode GetEffectGpuMemoryUsageDX11(FfxInterface* backendInterface, FfxUInt
     return FFX_OK;
 }
 
+static uint32_t hashViewDX11(const ID3D11Resource* resource, bool uav, const void* description, size_t descriptionSize)
+{
+    // FNV-1a over the resource pointer and the view description
+    uint32_t hash = 2166136261u;
+    auto hashBytes = [&hash](const void* data, size_t size) {
+        for (size_t byteIndex = 0; byteIndex < size; ++byteIndex)
+            hash = (hash ^ static_cast<const uint8_t*>(data)[byteIndex]) * 16777619u;
+    };
+    hashBytes(&resource, sizeof(resource));
+    hashBytes(&uav, sizeof(uav));
+    hashBytes(description, descriptionSize);
+    return hash;
+}
+
+// all views of a resource land in the same bucket
+static ViewCacheEntry_DX11*& viewCacheBucketDX11(ViewCache_DX11* viewCache, const ID3D11Resource* resource)
+{
+    return viewCache->buckets[(reinterpret_cast<uintptr_t>(resource) >> 4) % FFX_DX11_VIEW_CACHE_BUCKET_COUNT];
+}
+
+static void unlinkViewCacheEntryDX11(ViewCache_DX11* viewCache, ViewCacheEntry_DX11* entry)
+{
+    if (entry->lruPrev)
+        entry->lruPrev->lruNext = entry->lruNext;
+    else
+        viewCache->lruHead = entry->lruNext;
+    if (entry->lruNext)
+        entry->lruNext->lruPrev = entry->lruPrev;
+    else
+        viewCache->lruTail = entry->lruPrev;
+    entry->lruPrev = entry->lruNext = nullptr;
+}
+
+static void touchViewCacheEntryDX11(ViewCache_DX11* viewCache, ViewCacheEntry_DX11* entry)
+{
+    // move to the front of the LRU list
+    unlinkViewCacheEntryDX11(viewCache, entry);
+    entry->lruNext = viewCache->lruHead;
+    if (viewCache->lruHead)
+        viewCache->lruHead->lruPrev = entry;
+    viewCache->lruHead = entry;
+    if (!viewCache->lruTail)
+        viewCache->lruTail = entry;
+
+    entry->lastUsedFrame = viewCache->frameIndex;
+}
+
+static void evictViewCacheEntryDX11(ViewCache_DX11* viewCache, ViewCacheEntry_DX11* entry)
+{
+    ViewCacheEntry_DX11** link = &viewCacheBucketDX11(viewCache, entry->resource);
+    while (*link != entry)
+        link = &(*link)->bucketNext;
+    *link = entry->bucketNext;
+
+    unlinkViewCacheEntryDX11(viewCache, entry);
+    entry->view->Release();
+    delete entry;
+
+    viewCache->entryCount--;
+    viewCache->evictionCount++;
+}
+
+static void flushViewCacheDX11(ViewCache_DX11* viewCache)
+{
+    if (!viewCache)
+        return;
+
+    std::lock_guard<std::mutex> cacheLock{ viewCache->mutex };
+    while (viewCache->lruTail)
+        evictViewCacheEntryDX11(viewCache, viewCache->lruTail);
+}
+
+// called before the first resource an effect context registers for a dispatch: when the context already
+// registered resources in the current frame of the cache, the application has moved on to its next frame,
+// so latch the counters and evict what has not been registered for a while
+static void beginViewCacheFrameDX11(ViewCache_DX11* viewCache, uint64_t& effectContextFrame)
+{
+    std::lock_guard<std::mutex> cacheLock{ viewCache->mutex };
+
+    if (effectContextFrame != viewCache->frameIndex) {
+        effectContextFrame = viewCache->frameIndex;
+        return;
+    }
+
+    viewCache->lastFrameHitCount = viewCache->frameHitCount;
+    viewCache->lastFrameMissCount = viewCache->frameMissCount;
+    viewCache->frameHitCount = 0;
+    viewCache->frameMissCount = 0;
+    viewCache->frameIndex++;
+
+    while (viewCache->lruTail && viewCache->lruTail->lastUsedFrame + FFX_DX11_VIEW_CACHE_MAX_AGE < viewCache->frameIndex)
+        evictViewCacheEntryDX11(viewCache, viewCache->lruTail);
+
+    effectContextFrame = viewCache->frameIndex;
+}
+
+// a resource registered again in the slot it already occupies keeps its views, refresh their entries
+static void touchCachedViewsDX11(ViewCache_DX11* viewCache, const ID3D11Resource* dx11Resource)
+{
+    std::lock_guard<std::mutex> cacheLock{ viewCache->mutex };
+
+    for (ViewCacheEntry_DX11* entry = viewCacheBucketDX11(viewCache, dx11Resource); entry; entry = entry->bucketNext)
+    {
+        if (entry->resource != dx11Resource)
+            continue;
+
+        touchViewCacheEntryDX11(viewCache, entry);
+        viewCache->frameHitCount++;
+        viewCache->hitCount++;
+    }
+}
+
+// find or create a view of a resource, the caller receives its own reference on the view. Without a cache,
+// for resources of the application, the view is only created.
+static HRESULT acquireCachedViewDX11(ViewCache_DX11* viewCache, ID3D11Device* dx11Device, ID3D11Resource* dx11Resource, const D3D11_SHADER_RESOURCE_VIEW_DESC* srvDescription, const D3D11_UNORDERED_ACCESS_VIEW_DESC* uavDescription, ID3D11View** outView)
+{
+    if (!viewCache) {
+        if (uavDescription)
+            return dx11Device->CreateUnorderedAccessView(dx11Resource, uavDescription, reinterpret_cast<ID3D11UnorderedAccessView**>(outView));
+        return dx11Device->CreateShaderResourceView(dx11Resource, srvDescription, reinterpret_cast<ID3D11ShaderResourceView**>(outView));
+    }
+
+    const bool uav = uavDescription != nullptr;
+    const void* description = uav ? static_cast<const void*>(uavDescription) : static_cast<const void*>(srvDescription);
+    const size_t descriptionSize = uav ? sizeof(D3D11_UNORDERED_ACCESS_VIEW_DESC) : sizeof(D3D11_SHADER_RESOURCE_VIEW_DESC);
+    const uint32_t hash = hashViewDX11(dx11Resource, uav, description, descriptionSize);
+
+    std::lock_guard<std::mutex> cacheLock{ viewCache->mutex };
+
+    ViewCacheEntry_DX11*& bucket = viewCacheBucketDX11(viewCache, dx11Resource);
+    for (ViewCacheEntry_DX11* entry = bucket; entry; entry = entry->bucketNext)
+    {
+        if (entry->hash != hash || entry->resource != dx11Resource || entry->uav != uav)
+            continue;
+        if (memcmp(uav ? static_cast<const void*>(&entry->uavDescription) : static_cast<const void*>(&entry->srvDescription), description, descriptionSize) != 0)
+            continue;
+
+        touchViewCacheEntryDX11(viewCache, entry);
+        entry->view->AddRef();
+        *outView = entry->view;
+        viewCache->frameHitCount++;
+        viewCache->hitCount++;
+        return S_OK;
+    }
+
+    HRESULT result = S_OK;
+    ID3D11View* view = nullptr;
+    if (uav)
+        result = dx11Device->CreateUnorderedAccessView(dx11Resource, uavDescription, reinterpret_cast<ID3D11UnorderedAccessView**>(&view));
+    else
+        result = dx11Device->CreateShaderResourceView(dx11Resource, srvDescription, reinterpret_cast<ID3D11ShaderResourceView**>(&view));
+    viewCache->frameMissCount++;
+    viewCache->missCount++;
+    if (FAILED(result))
+        return result;
+
+    if (viewCache->entryCount == FFX_DX11_VIEW_CACHE_CAPACITY)
+        evictViewCacheEntryDX11(viewCache, viewCache->lruTail);
+
+    ViewCacheEntry_DX11* entry = new ViewCacheEntry_DX11();
+    entry->resource = dx11Resource;
+    entry->uav = uav;
+    if (uav)
+        entry->uavDescription = *uavDescription;
+    else
+        entry->srvDescription = *srvDescription;
+    entry->hash = hash;
+    entry->view = view;
+    entry->lastUsedFrame = viewCache->frameIndex;
+    entry->bucketNext = bucket;
+    bucket = entry;
+    entry->lruNext = viewCache->lruHead;
+    if (viewCache->lruHead)
+        viewCache->lruHead->lruPrev = entry;
+    viewCache->lruHead = entry;
+    if (!viewCache->lruTail)
+        viewCache->lruTail = entry;
+    viewCache->entryCount++;
+
+    // one reference stays with the cache
+    view->AddRef();
+    *outView = view;
+    return S_OK;
+}
+
 // initialize the DX11 backend
 FfxErrorCode CreateBackendContextDX11(FfxInterface* backendInterface, FfxEffect effect, FfxEffectBindlessConfig* bindlessConfig, FfxUInt32* effectContextId)
 {
@@ -733,6 +1113,18 @@ FfxErrorCode CreateBackendContextDX11(FfxInterface* backendInterface, FfxEffect
     if (!backendContext->refCount) {
 
         new (&backendContext->constantBufferMutex) std::mutex();
+        new (&backendContext->constantBufferHead) std::atomic<uint64_t>(0);
+        new (&backendContext->constantBufferStagedBytes) std::atomic<uint64_t>(0);
+        new (&backendContext->constantBufferCopiedBytes) std::atomic<uint64_t>(0);
+        new (&backendContext->constantBufferAllocationCount) std::atomic<uint64_t>(0);
+        new (&backendContext->constantBufferMapCount) std::atomic<uint64_t>(0);
+        new (&backendContext->constantBufferWrapCount) std::atomic<uint64_t>(0);
+        new (&backendContext->constantBufferReusedCount) std::atomic<uint64_t>(0);
+        new (&backendContext->constantBufferReusedBytes) std::atomic<uint64_t>(0);
+        new (&backendContext->constantBufferLockCount) std::atomic<uint64_t>(0);
+        memset(backendContext->constantBufferContentSize, 0, sizeof(backendContext->constantBufferContentSize));
+        for (ConstantBufferReuse_DX11& reuse : backendContext->constantBufferReuse)
+            new (&reuse) ConstantBufferReuse_DX11();
 
         if (dx11Device != NULL) {
 
@@ -781,7 +1173,7 @@ FfxErrorCode CreateBackendContextDX11(FfxInterface* backendInterface, FfxEffect
 #endif
 
         // Map all of our pointers
-        uint32_t gpuJobDescArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_MAX_GPU_JOBS * sizeof(FfxGpuJobDescription), sizeof(uint32_t));
+        uint32_t gpuJobDescArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_MAX_GPU_JOBS * FFX_DX11_MAX_GPU_JOB_SIZE, sizeof(uint32_t));
         uint32_t resourceArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_MAX_RESOURCE_COUNT * sizeof(BackendContext_DX11::Resource), sizeof(uint64_t));
         uint32_t stagingRingBufferArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE, sizeof(uint32_t));
         uint32_t contextArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * sizeof(BackendContext_DX11::EffectContext), sizeof(uint32_t));
@@ -789,7 +1181,9 @@ FfxErrorCode CreateBackendContextDX11(FfxInterface* backendInterface, FfxEffect
         uint8_t* pMem = (uint8_t*)((BackendContext_DX11*)(backendContext + 1));
 
         // Map gpu job array
-        backendContext->pGpuJobs = (FfxGpuJobDescription*)pMem;
+        backendContext->pGpuJobs = pMem;
+        backendContext->gpuJobSize = 0;
+        backendContext->gpuJobCapacity = gpuJobDescArraySize;
         memset(backendContext->pGpuJobs, 0, gpuJobDescArraySize);
         pMem += gpuJobDescArraySize;
 
@@ -806,14 +1200,14 @@ FfxErrorCode CreateBackendContextDX11(FfxInterface* backendInterface, FfxEffect
         // Map the effect contexts
         backendContext->pEffectContexts = reinterpret_cast<BackendContext_DX11::EffectContext*>(pMem);
         memset(backendContext->pEffectContexts, 0, contextArraySize);
+
+        backendContext->pViewCache = new ViewCache_DX11();
     }
 
     // Direct3D 11.1
     if (!backendContext->refCount && backendContext->deviceContext1 != NULL) {
 
-        std::lock_guard<std::mutex> cbLock{ backendContext->constantBufferMutex };
-
-        // create dynamic ring buffer for constant uploads
+        // create dynamic ring buffer for constant uploads, it stays mapped and constants are staged straight into it
         backendContext->constantBufferSize[0] = FFX_ALIGN_UP(256/*FFX_MAX_CONST_SIZE*/, 256) *
             backendContext->maxEffectContexts * FFX_MAX_PASS_COUNT * FFX_MAX_QUEUED_FRAMES; // Size aligned to 256
 
@@ -830,7 +1224,7 @@ FfxErrorCode CreateBackendContextDX11(FfxInterface* backendInterface, FfxEffect
         TIF(backendContext->deviceContext->Map(backendContext->constantBufferResource[0], 0,
             D3D11_MAP_WRITE_NO_OVERWRITE, 0, &mappedSubresource));
         backendContext->constantBufferMem[0] = mappedSubresource.pData;
-        backendContext->constantBufferOffset[0] = 0;
+        backendContext->constantBufferHead = 0;
     }
 
     // Increment the ref count
@@ -846,6 +1240,7 @@ FfxErrorCode CreateBackendContextDX11(FfxInterface* backendInterface, FfxEffect
             effectContext.active = true;
             effectContext.nextStaticResource = (i * FFX_MAX_RESOURCE_COUNT) + 1;
             effectContext.nextDynamicResource = (i * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT - 1;
+            effectContext.viewCacheFrame = UINT64_MAX;
             break;
         }
     }
@@ -939,11 +1334,19 @@ FfxErrorCode DestroyBackendContextDX11(FfxInterface* backendInterface, FfxUInt32
                 backendContext->constantBufferResource[i]->Release();
                 backendContext->constantBufferResource[i] = NULL;
                 backendContext->constantBufferMem[i] = nullptr;
-                backendContext->constantBufferOffset[i] = 0;
                 backendContext->constantBufferSize[i] = 0;
             }
         }
+        backendContext->constantBufferHead = 0;
+        for (ConstantBufferReuse_DX11& reuse : backendContext->constantBufferReuse)
+            reuse.size.store(0, std::memory_order_relaxed);
         backendContext->gpuJobCount = 0;
+        backendContext->gpuJobSize = 0;
+
+        // release the cached views, the dynamic slots holding them were destroyed with their effect contexts
+        flushViewCacheDX11(backendContext->pViewCache);
+        delete backendContext->pViewCache;
+        backendContext->pViewCache = nullptr;
 
         if (backendContext->deviceContext1 != NULL) {
             backendContext->deviceContext1->Release();
@@ -1092,6 +1495,8 @@ FfxErrorCode CreateResourceDX11(
         resourceSize = GetResourceGpuMemorySizeDX11(dx11Resource);
 
         SetNameDX11(dx11Resource, createResourceDescription->name);
+        const uint32_t internalTag = 1;
+        dx11Resource->SetPrivateData(s_internalResourceGuidDX11, sizeof(internalTag), &internalTag);
         backendResource->resourcePtr = dx11Resource;
 
 #ifdef _DEBUG
@@ -1313,12 +1718,15 @@ FfxErrorCode RegisterResourceDX11(
     }
 
     FFX_ASSERT(effectContext.nextDynamicResource > effectContext.nextStaticResource);
+    if (effectContext.nextDynamicResource == (effectContextId * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT - 1)
+        beginViewCacheFrameDX11(backendContext->pViewCache, effectContext.viewCacheFrame);
     outFfxResourceInternal->internalIndex = effectContext.nextDynamicResource--;
 
     BackendContext_DX11::Resource* backendResource = &backendContext->pResources[outFfxResourceInternal->internalIndex];
 
     if (backendResource->resourcePtr == dx11Resource)
     {
+        touchCachedViewsDX11(backendContext->pViewCache, dx11Resource);
         return FFX_OK;
     }
 
@@ -1327,6 +1735,8 @@ FfxErrorCode RegisterResourceDX11(
     backendResource->resourcePtr = dx11Resource;
     if (backendResource->resourcePtr)
         backendResource->resourcePtr->AddRef();
+    backendResource->applicationOwned = !isInternalResourceDX11(dx11Resource);
+    ViewCache_DX11* viewCache = backendResource->applicationOwned ? nullptr : backendContext->pViewCache;
 
 #ifdef _DEBUG
     const wchar_t* name = inFfxResource->name;
@@ -1470,18 +1880,18 @@ FfxErrorCode RegisterResourceDX11(
                 dx11UavDescription.Buffer.FirstElement = 0;
                 dx11UavDescription.Buffer.NumElements = backendResource->resourceDescription.size / backendResource->resourceDescription.stride;
 
-                TIF(dx11Device->CreateUnorderedAccessView(dx11Resource, &dx11UavDescription, &backendResource->uavPtr[0]));
+                TIF(acquireCachedViewDX11(viewCache, dx11Device, dx11Resource, nullptr, &dx11UavDescription, reinterpret_cast<ID3D11View**>(&backendResource->uavPtr[0])));
             }
 
             dx11SrvDescription.Buffer.FirstElement = 0;
             dx11SrvDescription.Buffer.NumElements = backendResource->resourceDescription.size / backendResource->resourceDescription.stride;
 
-            TIF(dx11Device->CreateShaderResourceView(dx11Resource, &dx11SrvDescription, &backendResource->srvPtr[0]));
+            TIF(acquireCachedViewDX11(viewCache, dx11Device, dx11Resource, &dx11SrvDescription, nullptr, reinterpret_cast<ID3D11View**>(&backendResource->srvPtr[0])));
         }
         else {
 
             // CPU readable
-            TIF(dx11Device->CreateShaderResourceView(dx11Resource, &dx11SrvDescription, &backendResource->srvPtr[0]));
+            TIF(acquireCachedViewDX11(viewCache, dx11Device, dx11Resource, &dx11SrvDescription, nullptr, reinterpret_cast<ID3D11View**>(&backendResource->srvPtr[0])));
 
             // UAV
             if (dx11Texture1DDesc.BindFlags & D3D11_BIND_UNORDERED_ACCESS ||
@@ -1509,7 +1919,7 @@ FfxErrorCode RegisterResourceDX11(
                         break;
                     }
 
-                    dx11Device->CreateUnorderedAccessView(dx11Resource, &dx11UavDescription, &backendResource->uavPtr[currentMipIndex]);
+                    acquireCachedViewDX11(viewCache, dx11Device, dx11Resource, nullptr, &dx11UavDescription, reinterpret_cast<ID3D11View**>(&backendResource->uavPtr[currentMipIndex]));
                 }
             }
         }
@@ -1548,11 +1958,28 @@ FfxErrorCode UnregisterResourcesDX11(FfxInterface* backendInterface, FfxCommandL
     BackendContext_DX11* backendContext = (BackendContext_DX11*)(backendInterface->scratchBuffer);
     BackendContext_DX11::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
 
-    // Walk back all the resources that don't belong to us and reset them to their initial state
+    // Walk back all the resources that don't belong to us and reset them to their initial state. Those of the
+    // application are released with their views, so the application can release or resize them, e.g. with
+    // IDXGISwapChain::ResizeBuffers, as soon as the dispatch returns.
     for (uint32_t resourceIndex = ++effectContext.nextDynamicResource; resourceIndex < (effectContextId * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT; ++resourceIndex)
     {
-        FfxResourceInternal internalResource;
-        internalResource.internalIndex = resourceIndex;
+        BackendContext_DX11::Resource& backendResource = backendContext->pResources[resourceIndex];
+        if (!backendResource.applicationOwned)
+            continue;
+
+        for (int32_t currentMipIndex = 0; currentMipIndex < 16; ++currentMipIndex) {
+            if (backendResource.srvPtr[currentMipIndex]) {
+                backendResource.srvPtr[currentMipIndex]->Release();
+                backendResource.srvPtr[currentMipIndex] = nullptr;
+            }
+            if (backendResource.uavPtr[currentMipIndex]) {
+                backendResource.uavPtr[currentMipIndex]->Release();
+                backendResource.uavPtr[currentMipIndex] = nullptr;
+            }
+        }
+        backendResource.resourcePtr->Release();
+        backendResource.resourcePtr = nullptr;
+        backendResource.applicationOwned = false;
     }
 
     effectContext.nextDynamicResource      = (effectContextId * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT - 1;
@@ -1560,6 +1987,62 @@ FfxErrorCode UnregisterResourcesDX11(FfxInterface* backendInterface, FfxCommandL
     return FFX_OK;
 }
 
+FFX_API void ffxGetViewCacheStatsDX11(FfxInterface* backendInterface, FfxViewCacheStatsDX11* stats)
+{
+    FFX_ASSERT(backendInterface != nullptr);
+    FFX_ASSERT(stats != nullptr);
+
+    memset(stats, 0, sizeof(FfxViewCacheStatsDX11));
+
+    BackendContext_DX11* backendContext = (BackendContext_DX11*)backendInterface->scratchBuffer;
+    ViewCache_DX11* viewCache = backendContext->pViewCache;
+    if (!viewCache)
+        return;
+
+    std::lock_guard<std::mutex> cacheLock{ viewCache->mutex };
+    stats->frameHitCount = viewCache->lastFrameHitCount;
+    stats->frameMissCount = viewCache->lastFrameMissCount;
+    stats->hitCount = viewCache->hitCount;
+    stats->missCount = viewCache->missCount;
+    stats->evictionCount = viewCache->evictionCount;
+    stats->entryCount = viewCache->entryCount;
+}
+
+FFX_API void ffxFlushViewCacheDX11(FfxInterface* backendInterface)
+{
+    FFX_ASSERT(backendInterface != nullptr);
+
+    BackendContext_DX11* backendContext = (BackendContext_DX11*)backendInterface->scratchBuffer;
+    flushViewCacheDX11(backendContext->pViewCache);
+}
+
+FFX_API void ffxGetConstantBufferStatsDX11(FfxInterface* backendInterface, FfxConstantBufferStatsDX11* stats)
+{
+    FFX_ASSERT(backendInterface != nullptr);
+    FFX_ASSERT(stats != nullptr);
+
+    BackendContext_DX11* backendContext = (BackendContext_DX11*)backendInterface->scratchBuffer;
+    stats->stagedBytes = backendContext->constantBufferStagedBytes;
+    stats->copiedBytes = backendContext->constantBufferCopiedBytes;
+    stats->allocationCount = backendContext->constantBufferAllocationCount;
+    stats->mapCount = backendContext->constantBufferMapCount;
+    stats->wrapCount = backendContext->constantBufferWrapCount;
+    stats->reusedCount = backendContext->constantBufferReusedCount;
+    stats->reusedBytes = backendContext->constantBufferReusedBytes;
+    stats->lockCount = backendContext->constantBufferLockCount;
+}
+
+FFX_API void ffxGetGpuJobStatsDX11(FfxInterface* backendInterface, FfxGpuJobStatsDX11* stats)
+{
+    FFX_ASSERT(backendInterface != nullptr);
+    FFX_ASSERT(stats != nullptr);
+
+    BackendContext_DX11* backendContext = (BackendContext_DX11*)backendInterface->scratchBuffer;
+    stats->jobCount = backendContext->executedGpuJobCount;
+    stats->recordSize = backendContext->executedGpuJobSize;
+    stats->maxRecordSize = backendContext->maxExecutedGpuJobSize;
+}
+
 FfxResourceDescription GetResourceDescriptorDX11(
     FfxInterface* backendInterface,
     FfxResourceInternal resource)
@@ -1572,6 +2055,87 @@ FfxResourceDescription GetResourceDescriptorDX11(
     return resourceDescription;
 }
 
+// bump allocate a 256 byte aligned region of the Direct3D 11.1 ring, wrapping to the start when it does not fit.
+// The ring holds FFX_MAX_PASS_COUNT constant blocks per effect context for each of FFX_MAX_QUEUED_FRAMES frames,
+// so a region is only reused once the frames that referenced it are out of flight. The returned position counts
+// every byte allocated since the ring was created, its offset in the ring is the position modulo the ring size.
+static uint64_t allocateConstantBufferDX11(BackendContext_DX11* backendContext, uint32_t size)
+{
+    const uint64_t ringSize = backendContext->constantBufferSize[0];
+    FFX_ASSERT(size <= ringSize);
+
+    uint64_t head = backendContext->constantBufferHead.load(std::memory_order_relaxed);
+    uint64_t first = 0;
+    do {
+        first = head % ringSize + size > ringSize ? head - head % ringSize + ringSize : head;
+    } while (!backendContext->constantBufferHead.compare_exchange_weak(head, first + size, std::memory_order_relaxed));
+
+    if (first && first % ringSize == 0)
+        backendContext->constantBufferWrapCount++;
+    backendContext->constantBufferAllocationCount++;
+    return first;
+}
+
+static uint64_t hashConstantBufferDX11(const void* data, uint32_t size)
+{
+    // FNV-1a over the size and the contents
+    uint64_t hash = 14695981039346656037ull;
+    auto hashBytes = [&hash](const void* bytes, size_t count) {
+        for (size_t byteIndex = 0; byteIndex < count; ++byteIndex)
+            hash = (hash ^ static_cast<const uint8_t*>(bytes)[byteIndex]) * 1099511628211ull;
+    };
+    hashBytes(&size, sizeof(size));
+    hashBytes(data, size);
+    return hash;
+}
+
+// bind a block with the same contents if one is still live in the Direct3D 11.1 ring, otherwise write the data to a
+// new region and remember it. Only blocks written within the last frame's worth of the ring are reused, so they are
+// not overwritten before FFX_MAX_QUEUED_FRAMES - 1 more frames. No lock is taken: a lookup racing with a writer of
+// the same entry misses, and a writer that finds the entry claimed by another leaves it as it is.
+static bool stageReusableConstantBufferDX11(BackendContext_DX11* backendContext, const void* data, uint32_t size, uint64_t* outPosition)
+{
+    uint32_t words[FFX_DX11_CONSTANT_BUFFER_REUSE_MAX_SIZE / sizeof(uint32_t)] = {};
+    memcpy(words, data, size);
+    const uint32_t wordCount = (size + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    const uint64_t hash = hashConstantBufferDX11(data, size);
+    const uint64_t ringSize = backendContext->constantBufferSize[0];
+    ConstantBufferReuse_DX11& reuse = backendContext->constantBufferReuse[hash % FFX_DX11_CONSTANT_BUFFER_REUSE_COUNT];
+
+    uint32_t sequence = reuse.sequence.load(std::memory_order_acquire);
+    if (!(sequence & 1) && reuse.size.load(std::memory_order_relaxed) == size && reuse.hash.load(std::memory_order_relaxed) == hash) {
+
+        const uint64_t position = reuse.position.load(std::memory_order_relaxed);
+        bool match = true;
+        for (uint32_t wordIndex = 0; match && wordIndex < wordCount; ++wordIndex)
+            match = reuse.contents[wordIndex].load(std::memory_order_relaxed) == words[wordIndex];
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t head = backendContext->constantBufferHead.load(std::memory_order_relaxed);
+        if (match && reuse.sequence.load(std::memory_order_relaxed) == sequence && head - position <= ringSize / FFX_MAX_QUEUED_FRAMES) {
+            *outPosition = position;
+            return true;
+        }
+    }
+
+    *outPosition = allocateConstantBufferDX11(backendContext, FFX_ALIGN_UP(size, 256));
+    memcpy((uint8_t*)backendContext->constantBufferMem[0] + *outPosition % ringSize, data, size);
+
+    sequence = reuse.sequence.load(std::memory_order_relaxed);
+    if (!(sequence & 1) && reuse.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_relaxed)) {
+
+        std::atomic_thread_fence(std::memory_order_release);
+        reuse.hash.store(hash, std::memory_order_relaxed);
+        reuse.position.store(*outPosition, std::memory_order_relaxed);
+        reuse.size.store(size, std::memory_order_relaxed);
+        for (uint32_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+            reuse.contents[wordIndex].store(words[wordIndex], std::memory_order_relaxed);
+        reuse.sequence.store(sequence + 2, std::memory_order_release);
+    }
+    return false;
+}
+
 FfxErrorCode StageConstantBufferDataDX11(FfxInterface* backendInterface, void* data, FfxUInt32 size, FfxConstantBuffer* constantBuffer)
 {
     FFX_ASSERT(NULL != backendInterface);
@@ -1579,18 +2143,53 @@ FfxErrorCode StageConstantBufferDataDX11(FfxInterface* backendInterface, void* d
 
     if (data && constantBuffer)
     {
-        if ((backendContext->stagingRingBufferBase + FFX_ALIGN_UP(size, 256)) >= FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE)
-            backendContext->stagingRingBufferBase = 0;
+        uint32_t* dstPtr = nullptr;
+
+        // Direct3D 11.1: write straight into the mapped ring, the job only binds the offset
+        if (backendContext->constantBufferMem[0] != nullptr) {
+
+            // larger blocks are always written to a new region, the reuse table only keeps copies of small ones
+            uint64_t position = 0;
+            if (size <= FFX_DX11_CONSTANT_BUFFER_REUSE_MAX_SIZE) {
+
+                if (stageReusableConstantBufferDX11(backendContext, data, size, &position)) {
 
-        uint32_t* dstPtr = (uint32_t*)(backendContext->pStagingRingBuffer + backendContext->stagingRingBufferBase);
+                    backendContext->constantBufferStagedBytes += size;
+                    backendContext->constantBufferReusedCount++;
+                    backendContext->constantBufferReusedBytes += size;
 
-        memcpy(dstPtr, data, size);
+                    constantBuffer->data            = (uint32_t*)((uint8_t*)backendContext->constantBufferMem[0] + position % backendContext->constantBufferSize[0]);
+                    constantBuffer->num32BitEntries = size / sizeof(uint32_t);
+
+                    return FFX_OK;
+                }
+                dstPtr = (uint32_t*)((uint8_t*)backendContext->constantBufferMem[0] + position % backendContext->constantBufferSize[0]);
+            }
+            else {
+
+                position = allocateConstantBufferDX11(backendContext, FFX_ALIGN_UP(size, 256));
+                dstPtr = (uint32_t*)((uint8_t*)backendContext->constantBufferMem[0] + position % backendContext->constantBufferSize[0]);
+                memcpy(dstPtr, data, size);
+            }
+        }
+        else {
+
+            if ((backendContext->stagingRingBufferBase + FFX_ALIGN_UP(size, 256)) >= FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE)
+                backendContext->stagingRingBufferBase = 0;
+
+            dstPtr = (uint32_t*)(backendContext->pStagingRingBuffer + backendContext->stagingRingBufferBase);
+
+            backendContext->stagingRingBufferBase += FFX_ALIGN_UP(size, 256);
+
+            memcpy(dstPtr, data, size);
+        }
+
+        backendContext->constantBufferStagedBytes += size;
+        backendContext->constantBufferCopiedBytes += size;
 
         constantBuffer->data            = dstPtr;
         constantBuffer->num32BitEntries = size / sizeof(uint32_t);
 
-        backendContext->stagingRingBufferBase += FFX_ALIGN_UP(size, 256);
-
         return FFX_OK;
     }
     else
@@ -1618,38 +2217,20 @@ D3D11_TEXTURE_ADDRESS_MODE FfxGetAddressModeDX11(const FfxAddressMode& addressMo
     }
 }
 
-FfxErrorCode CreatePipelineDX11(
-    FfxInterface* backendInterface,
-    FfxEffect effect,
-    FfxPass pass,
-    uint32_t permutationOptions,
-    const FfxPipelineDescription* pipelineDescription,
-    FfxUInt32                     effectContextId,
-    FfxPipelineState* outPipeline)
+// Blobs from the accessors carry precomputed name hashes, fall back to hashing the name otherwise
+static uint32_t getBindingNameHashDX11(const char** names, const uint32_t* nameHashes, uint32_t index)
 {
-    FFX_ASSERT(NULL != backendInterface);
-    FFX_ASSERT(NULL != pipelineDescription);
-
-    BackendContext_DX11* backendContext = (BackendContext_DX11*)backendInterface->scratchBuffer;
-    ID3D11Device* dx11Device = backendContext->device;
-
-    FfxShaderBlob shaderBlob = { };
-    ffxGetPermutationBlobByIndex(effect, pass, FFX_BIND_COMPUTE_SHADER_STAGE, permutationOptions, &shaderBlob);
-    FFX_ASSERT(shaderBlob.data && shaderBlob.size);
-
-    int32_t staticTextureSrvCount = 0;
-    int32_t staticBufferSrvCount = 0;
-    int32_t staticTextureUavCount = 0;
-    int32_t staticBufferUavCount = 0;
+    return nameHashes ? nameHashes[index] : ffxHashBindingName(names[index]);
+}
 
+// flatten the bindings reflected in the blob into the pipeline
+static void reflectPipelineLayoutDX11(const FfxShaderBlob& shaderBlob, FfxPipelineState* outPipeline)
+{
     int32_t staticTextureSrvSpace = -1;
     int32_t staticBufferSrvSpace = -1;
     int32_t staticTextureUavSpace = -1;
     int32_t staticBufferUavSpace = -1;
 
-    // Only set the command signature if this is setup as an indirect workload
-    outPipeline->cmdSignature = nullptr;
-
     uint32_t flattenedSrvTextureCount = 0;
 
     for (uint32_t srvIndex = 0; srvIndex < shaderBlob.srvTextureCount; ++srvIndex)
@@ -1668,12 +2249,15 @@ FfxErrorCode CreatePipelineDX11(
 
             outPipeline->srvTextureBindings[bindingIndex].slotIndex = slotIndex;
             outPipeline->srvTextureBindings[bindingIndex].arrayIndex = arrayIndex;
+            outPipeline->srvTextureBindings[bindingIndex].nameHash = getBindingNameHashDX11(shaderBlob.boundSRVTextureNames, shaderBlob.boundSRVTextureNameHashes, srvIndex);
+#ifdef FFX_DEBUG
             MultiByteToWideChar(CP_UTF8,
                 0,
                 shaderBlob.boundSRVTextureNames[srvIndex],
                 -1,
                 outPipeline->srvTextureBindings[bindingIndex].name,
                 int(std::size(outPipeline->srvTextureBindings[bindingIndex].name)));
+#endif
         }
     }
 
@@ -1698,12 +2282,15 @@ FfxErrorCode CreatePipelineDX11(
 
             outPipeline->uavTextureBindings[bindingIndex].slotIndex = slotIndex;
             outPipeline->uavTextureBindings[bindingIndex].arrayIndex = arrayIndex;
+            outPipeline->uavTextureBindings[bindingIndex].nameHash = getBindingNameHashDX11(shaderBlob.boundUAVTextureNames, shaderBlob.boundUAVTextureNameHashes, uavIndex);
+#ifdef FFX_DEBUG
             MultiByteToWideChar(CP_UTF8,
                 0,
                 shaderBlob.boundUAVTextureNames[uavIndex],
                 -1,
                 outPipeline->uavTextureBindings[bindingIndex].name,
                 int(std::size(outPipeline->uavTextureBindings[bindingIndex].name)));
+#endif
         }
     }
 
@@ -1728,12 +2315,15 @@ FfxErrorCode CreatePipelineDX11(
 
             outPipeline->srvBufferBindings[bindingIndex].slotIndex = slotIndex;
             outPipeline->srvBufferBindings[bindingIndex].arrayIndex = arrayIndex;
+            outPipeline->srvBufferBindings[bindingIndex].nameHash = getBindingNameHashDX11(shaderBlob.boundSRVBufferNames, shaderBlob.boundSRVBufferNameHashes, srvIndex);
+#ifdef FFX_DEBUG
             MultiByteToWideChar(CP_UTF8,
                 0,
                 shaderBlob.boundSRVBufferNames[srvIndex],
                 -1,
                 outPipeline->srvBufferBindings[bindingIndex].name,
                 int(std::size(outPipeline->srvBufferBindings[bindingIndex].name)));
+#endif
         }
     }
 
@@ -1758,12 +2348,15 @@ FfxErrorCode CreatePipelineDX11(
 
             outPipeline->uavBufferBindings[bindingIndex].slotIndex = slotIndex;
             outPipeline->uavBufferBindings[bindingIndex].arrayIndex = arrayIndex;
+            outPipeline->uavBufferBindings[bindingIndex].nameHash = getBindingNameHashDX11(shaderBlob.boundUAVBufferNames, shaderBlob.boundUAVBufferNameHashes, uavIndex);
+#ifdef FFX_DEBUG
             MultiByteToWideChar(CP_UTF8,
                 0,
                 shaderBlob.boundUAVBufferNames[uavIndex],
                 -1,
                 outPipeline->uavBufferBindings[bindingIndex].name,
                 int(std::size(outPipeline->uavBufferBindings[bindingIndex].name)));
+#endif
         }
     }
 
@@ -1774,76 +2367,624 @@ FfxErrorCode CreatePipelineDX11(
     {
         outPipeline->constantBufferBindings[cbIndex].slotIndex = shaderBlob.boundConstantBuffers[cbIndex];
         outPipeline->constantBufferBindings[cbIndex].arrayIndex = 1;
+        outPipeline->constantBufferBindings[cbIndex].nameHash = getBindingNameHashDX11(shaderBlob.boundConstantBufferNames, shaderBlob.boundConstantBufferNameHashes, cbIndex);
+#ifdef FFX_DEBUG
         MultiByteToWideChar(CP_UTF8,
             0,
             shaderBlob.boundConstantBufferNames[cbIndex],
             -1,
             outPipeline->constantBufferBindings[cbIndex].name,
             int(std::size(outPipeline->constantBufferBindings[cbIndex].name)));
+#endif
     }
 
     outPipeline->constCount = shaderBlob.cbvCount;
     FFX_ASSERT(outPipeline->constCount < FFX_MAX_NUM_CONST_BUFFERS);
 
-    outPipeline->staticTextureSrvCount = staticTextureSrvCount;
-    outPipeline->staticBufferSrvCount = staticBufferSrvCount;
-    outPipeline->staticTextureUavCount = staticTextureUavCount;
-    outPipeline->staticBufferUavCount = staticBufferUavCount;
-
     // Todo when needed
     //outPipeline->samplerCount      = shaderBlob.samplerCount;
     //outPipeline->rtAccelStructCount= shaderBlob.rtAccelStructCount;
+}
 
-    // patch GroupMemoryBarrier to GroupMemoryBarrierWithGroupSync
-    DWORD* data = new DWORD[shaderBlob.size / sizeof(DWORD)];
-    if (data == nullptr)
-        return FFX_ERROR_INSUFFICIENT_MEMORY;
-    memcpy(data, shaderBlob.data, shaderBlob.size);
-    for (uint32_t i = 0; i < shaderBlob.size / sizeof(DWORD); ++i)
+// Patched bytecode and binding layout of a permutation, shared by all pipelines created from it
+typedef struct PipelineCacheEntry_DX11 {
+
+    PipelineCacheEntry_DX11*    next;
+
+    FfxEffect                   effect;
+    FfxPass                     pass;
+    uint32_t                    permutationOptions;
+    const uint8_t*              blobData;           // blob used in place, pinned until the entry is destroyed
+    uint8_t                     blobChecksum[16];   // DXBC checksum of the blob, vendor blobs share the key and compressed blobs move
+    bool                        loaded;             // read from a serialized cache and not yet matched by a blob
+
+    uint32_t                    refCount;           // pipelines currently created from this entry
+    ID3D11Device*               device;             // device of the shared shader, not referenced
+    ID3D11ComputeShader*        shader;             // only kept while the entry is referenced
+
+    FfxResourceBinding*         bindings;           // srv textures, uav textures, srv buffers, uav buffers, then constant buffers
+    uint32_t                    srvTextureCount;
+    uint32_t                    uavTextureCount;
+    uint32_t                    srvBufferCount;
+    uint32_t                    uavBufferCount;
+    uint32_t                    constCount;
+
+    const void*                 bytecode;           // the blob itself when it was patched offline, else patchedBytecode
+    uint8_t*                    patchedBytecode;
+    uint32_t                    bytecodeSize;
+
+} PipelineCacheEntry_DX11;
+
+static PipelineCacheEntry_DX11* s_PipelineCache = nullptr;
+static uint64_t                 s_PipelineCacheHitCount = 0;
+static uint64_t                 s_PipelineCacheMissCount = 0;
+static uint64_t                 s_PipelineCacheShaderReuseCount = 0;
+static uint64_t                 s_PipelineCacheLoadedHitCount = 0;
+static std::mutex               s_PipelineCacheMutex;
+#if HAVE_NVIDIA
+static std::mutex               s_NvShaderExtnSlotMutex;
+#endif
+
+static void destroyPipelineCacheEntryDX11(PipelineCacheEntry_DX11* entry)
+{
+    ffxReleasePermutationBlob(entry->blobData);
+    delete[] entry->bindings;
+    delete[] entry->patchedBytecode;
+    delete entry;
+}
+
+// entries loaded from a serialized cache only know their blob by its DXBC checksum and adopt it on first use,
+// adoptedBlob tells the caller the entry now holds its pin on the blob
+static bool matchPipelineCacheEntryDX11(PipelineCacheEntry_DX11* entry, FfxEffect effect, FfxPass pass, uint32_t permutationOptions, const FfxShaderBlob& shaderBlob, bool& adoptedBlob)
+{
+    adoptedBlob = false;
+    if (entry->effect != effect || entry->pass != pass || entry->permutationOptions != permutationOptions)
+        return false;
+
+    if (entry->bytecodeSize != shaderBlob.size || memcmp(entry->blobChecksum, shaderBlob.data + 4, sizeof(entry->blobChecksum)) != 0)
+        return false;
+
+    if (!entry->bytecode)
+    {
+        entry->blobData = shaderBlob.data;
+        entry->bytecode = shaderBlob.data;
+        adoptedBlob = true;
+    }
+    if (entry->loaded)
     {
-        if (data[i] == MAKEFOURCC('S','H','E','X'))
+        entry->loaded = false;
+        s_PipelineCacheLoadedHitCount++;
+    }
+    return true;
+}
+
+// find or build the cache entry of a permutation and take a reference on it, the pin on the blob is either kept by the entry or released.
+// Returns nullptr when the bytecode cannot be patched
+static PipelineCacheEntry_DX11* acquirePipelineCacheEntryDX11(FfxEffect effect, FfxPass pass, uint32_t permutationOptions, const FfxShaderBlob& shaderBlob)
+{
+    bool adoptedBlob = false;
+    {
+        std::lock_guard<std::mutex> cacheLock{ s_PipelineCacheMutex };
+
+        for (PipelineCacheEntry_DX11* entry = s_PipelineCache; entry; entry = entry->next)
         {
-            DWORD* shex = &data[i];
-            DWORD count = data[i + 1];
-            bool hash = false;
-            for (uint32_t i = 0; i < count / sizeof(DWORD); ++i)
-            {
-                if (shex[i] == 0x010010BE)
-                {
-                    shex[i] = 0x010018BE;
-                    hash = true;
-                }
-            }
-            if (hash)
+            if (matchPipelineCacheEntryDX11(entry, effect, pass, permutationOptions, shaderBlob, adoptedBlob))
             {
-                CalculateDXBCChecksum(data, shaderBlob.size, &data[1]);
+                if (!adoptedBlob)
+                    ffxReleasePermutationBlob(shaderBlob.data);
+                entry->refCount++;
+                s_PipelineCacheHitCount++;
+                return entry;
             }
+        }
+    }
+
+    // patching and reflection happen outside the lock, a racing thread may build the same entry
+    PipelineCacheEntry_DX11* newEntry = new PipelineCacheEntry_DX11();
+    newEntry->effect = effect;
+    newEntry->pass = pass;
+    newEntry->permutationOptions = permutationOptions;
+    newEntry->bytecodeSize = shaderBlob.size;
+    FFX_ASSERT(shaderBlob.size >= 4 + sizeof(newEntry->blobChecksum));
+    memcpy(newEntry->blobChecksum, shaderBlob.data + 4, sizeof(newEntry->blobChecksum));
+
+    // blobs run through ffx_dxbc_patch at build time are used in place
+    if ((GetDXBCPatchFlags(shaderBlob.data, shaderBlob.size) & DXBC_PATCH_ALL) == DXBC_PATCH_ALL)
+    {
+        newEntry->blobData = shaderBlob.data;
+        newEntry->bytecode = shaderBlob.data;
+    }
+    else
+    {
+        // patch GroupMemoryBarrier to GroupMemoryBarrierWithGroupSync
+        newEntry->patchedBytecode = new uint8_t[shaderBlob.size];
+        memcpy(newEntry->patchedBytecode, shaderBlob.data, shaderBlob.size);
+        if (PatchDXBCGroupMemoryBarrier(newEntry->patchedBytecode, shaderBlob.size) < 0)
+        {
+            wchar_t message[128];
+            swprintf(message, 128, L"Permutation 0x%x of pass %u of effect %u is not valid DXBC", permutationOptions, uint32_t(pass), uint32_t(effect));
+            FFX_PRINT_MESSAGE(FFX_MESSAGE_TYPE_ERROR, message);
+            destroyPipelineCacheEntryDX11(newEntry);
+            ffxReleasePermutationBlob(shaderBlob.data);
+            return nullptr;
+        }
+        newEntry->bytecode = newEntry->patchedBytecode;
+    }
+
+    // only the bindings in use are kept, the full pipeline state is too large to cache
+    FfxPipelineState* layout = new FfxPipelineState();
+    reflectPipelineLayoutDX11(shaderBlob, layout);
+    newEntry->srvTextureCount = layout->srvTextureCount;
+    newEntry->uavTextureCount = layout->uavTextureCount;
+    newEntry->srvBufferCount = layout->srvBufferCount;
+    newEntry->uavBufferCount = layout->uavBufferCount;
+    newEntry->constCount = layout->constCount;
+    newEntry->bindings = new FfxResourceBinding[layout->srvTextureCount + layout->uavTextureCount + layout->srvBufferCount + layout->uavBufferCount + layout->constCount];
+    FfxResourceBinding* binding = newEntry->bindings;
+    binding = std::copy_n(layout->srvTextureBindings, layout->srvTextureCount, binding);
+    binding = std::copy_n(layout->uavTextureBindings, layout->uavTextureCount, binding);
+    binding = std::copy_n(layout->srvBufferBindings, layout->srvBufferCount, binding);
+    binding = std::copy_n(layout->uavBufferBindings, layout->uavBufferCount, binding);
+    std::copy_n(layout->constantBufferBindings, layout->constCount, binding);
+    delete layout;
+
+    std::lock_guard<std::mutex> cacheLock{ s_PipelineCacheMutex };
+
+    s_PipelineCacheMissCount++;
+
+    for (PipelineCacheEntry_DX11* entry = s_PipelineCache; entry; entry = entry->next)
+    {
+        if (matchPipelineCacheEntryDX11(entry, effect, pass, permutationOptions, shaderBlob, adoptedBlob))
+        {
+            newEntry->blobData = nullptr;
+            destroyPipelineCacheEntryDX11(newEntry);
+            if (!adoptedBlob)
+                ffxReleasePermutationBlob(shaderBlob.data);
+            entry->refCount++;
+            return entry;
+        }
+    }
+
+    if (!newEntry->blobData)
+        ffxReleasePermutationBlob(shaderBlob.data);
+    newEntry->refCount = 1;
+    newEntry->next = s_PipelineCache;
+    s_PipelineCache = newEntry;
+    return newEntry;
+}
+
+// drop a pipeline's reference, the entry keeps its bytecode for later recreations until trimmed
+static void releasePipelineCacheEntryDX11(PipelineCacheEntry_DX11* entry)
+{
+    ID3D11ComputeShader* shader = nullptr;
+    {
+        std::lock_guard<std::mutex> cacheLock{ s_PipelineCacheMutex };
+
+        FFX_ASSERT(entry->refCount > 0);
+        if (--entry->refCount == 0)
+        {
+            shader = entry->shader;
+            entry->shader = nullptr;
+            entry->device = nullptr;
+        }
+    }
+
+    if (shader)
+        shader->Release();
+}
+
+FFX_API void ffxGetPipelineCacheStatsDX11(FfxPipelineCacheStatsDX11* stats)
+{
+    FFX_ASSERT(stats != nullptr);
+
+    std::lock_guard<std::mutex> cacheLock{ s_PipelineCacheMutex };
+
+    memset(stats, 0, sizeof(FfxPipelineCacheStatsDX11));
+    stats->hitCount = s_PipelineCacheHitCount;
+    stats->missCount = s_PipelineCacheMissCount;
+    stats->shaderReuseCount = s_PipelineCacheShaderReuseCount;
+    stats->loadedHitCount = s_PipelineCacheLoadedHitCount;
+    for (PipelineCacheEntry_DX11* entry = s_PipelineCache; entry; entry = entry->next)
+    {
+        stats->entryCount++;
+        stats->activeEntryCount += entry->refCount ? 1 : 0;
+        stats->bytecodeSize += entry->patchedBytecode ? entry->bytecodeSize : 0;
+    }
+}
+
+FFX_API void ffxTrimPipelineCacheDX11()
+{
+    std::lock_guard<std::mutex> cacheLock{ s_PipelineCacheMutex };
+
+    PipelineCacheEntry_DX11** link = &s_PipelineCache;
+    while (*link)
+    {
+        PipelineCacheEntry_DX11* entry = *link;
+        if (entry->refCount == 0)
+        {
+            *link = entry->next;
+            destroyPipelineCacheEntryDX11(entry);
+        }
+        else
+        {
+            link = &entry->next;
+        }
+    }
+}
+
+// serialized pipeline cache, the header is followed by one record per entry with its bindings and runtime patched bytecode
+#define FFX_DX11_PIPELINE_CACHE_MAGIC       MAKEFOURCC('F', 'X', 'P', 'C')
+#define FFX_DX11_PIPELINE_CACHE_VERSION     2
+
+typedef struct PipelineCacheHeader_DX11 {
+
+    uint32_t                    magic;
+    uint32_t                    version;
+    uint32_t                    sdkVersion;
+    uint32_t                    bindingSize;        // FfxResourceBinding is larger in builds with resource names
+    uint32_t                    entryCount;
+    uint32_t                    reserved;
+    uint64_t                    payloadSize;
+    uint64_t                    payloadHash;
+
+} PipelineCacheHeader_DX11;
+
+typedef struct PipelineCacheRecord_DX11 {
+
+    uint32_t                    effect;
+    uint32_t                    pass;
+    uint32_t                    permutationOptions;
+    uint32_t                    bytecodeSize;
+    uint32_t                    patchedBytecodeSize; // 0 when the blob was patched offline and is used in place
+    uint32_t                    srvTextureCount;
+    uint32_t                    uavTextureCount;
+    uint32_t                    srvBufferCount;
+    uint32_t                    uavBufferCount;
+    uint32_t                    constCount;
+    uint8_t                     blobChecksum[16];
+
+} PipelineCacheRecord_DX11;
+
+// FNV-1a over 8 byte words with a fold of the high bits, the payload is mostly bytecode and hashing it a byte at a
+// time took most of the load
+static uint64_t hashPipelineCacheDX11(const uint8_t* data, size_t size)
+{
+    uint64_t hash = 14695981039346656037ull;
+    size_t offset = 0;
+    for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, data + offset, sizeof(word));
+        hash = (hash ^ word) * 1099511628211ull;
+        hash ^= hash >> 32;
+    }
+    for (; offset < size; ++offset)
+        hash = (hash ^ data[offset]) * 1099511628211ull;
+    return hash;
+}
+
+static uint32_t getPipelineCacheBindingCountDX11(const PipelineCacheEntry_DX11* entry)
+{
+    return entry->srvTextureCount + entry->uavTextureCount + entry->srvBufferCount + entry->uavBufferCount + entry->constCount;
+}
+
+static size_t getPipelineCacheRecordSizeDX11(const PipelineCacheEntry_DX11* entry)
+{
+    const size_t patchedSize = entry->patchedBytecode ? FFX_ALIGN_UP(size_t(entry->bytecodeSize), size_t(4)) : 0;
+    return sizeof(PipelineCacheRecord_DX11) + getPipelineCacheBindingCountDX11(entry) * sizeof(FfxResourceBinding) + patchedSize;
+}
+
+FFX_API FfxErrorCode ffxSavePipelineCacheDX11(void* data, size_t* size)
+{
+    FFX_RETURN_ON_ERROR(size, FFX_ERROR_INVALID_POINTER);
+
+    std::lock_guard<std::mutex> cacheLock{ s_PipelineCacheMutex };
+
+    PipelineCacheHeader_DX11 header = {};
+    header.magic = FFX_DX11_PIPELINE_CACHE_MAGIC;
+    header.version = FFX_DX11_PIPELINE_CACHE_VERSION;
+    header.sdkVersion = FFX_SDK_MAKE_VERSION(FFX_SDK_VERSION_MAJOR, FFX_SDK_VERSION_MINOR, FFX_SDK_VERSION_PATCH);
+    header.bindingSize = sizeof(FfxResourceBinding);
+    for (PipelineCacheEntry_DX11* entry = s_PipelineCache; entry; entry = entry->next)
+    {
+        header.entryCount++;
+        header.payloadSize += getPipelineCacheRecordSizeDX11(entry);
+    }
+
+    const size_t requiredSize = sizeof(PipelineCacheHeader_DX11) + size_t(header.payloadSize);
+    if (!data)
+    {
+        *size = requiredSize;
+        return FFX_OK;
+    }
+    if (*size < requiredSize)
+    {
+        *size = requiredSize;
+        return FFX_ERROR_INSUFFICIENT_MEMORY;
+    }
+    FFX_RETURN_ON_ERROR(header.payloadSize <= UINT32_MAX, FFX_ERROR_INVALID_SIZE);
+
+    uint8_t* payload = static_cast<uint8_t*>(data) + sizeof(PipelineCacheHeader_DX11);
+    uint8_t* write = payload;
+    for (PipelineCacheEntry_DX11* entry = s_PipelineCache; entry; entry = entry->next)
+    {
+        PipelineCacheRecord_DX11 record = {};
+        record.effect = entry->effect;
+        record.pass = entry->pass;
+        record.permutationOptions = entry->permutationOptions;
+        record.bytecodeSize = entry->bytecodeSize;
+        record.patchedBytecodeSize = entry->patchedBytecode ? entry->bytecodeSize : 0;
+        record.srvTextureCount = entry->srvTextureCount;
+        record.uavTextureCount = entry->uavTextureCount;
+        record.srvBufferCount = entry->srvBufferCount;
+        record.uavBufferCount = entry->uavBufferCount;
+        record.constCount = entry->constCount;
+        memcpy(record.blobChecksum, entry->blobChecksum, sizeof(record.blobChecksum));
+
+        memcpy(write, &record, sizeof(record));
+        write += sizeof(record);
+        const size_t bindingsSize = getPipelineCacheBindingCountDX11(entry) * sizeof(FfxResourceBinding);
+        memcpy(write, entry->bindings, bindingsSize);
+        write += bindingsSize;
+        if (entry->patchedBytecode)
+        {
+            const size_t alignedSize = FFX_ALIGN_UP(size_t(entry->bytecodeSize), size_t(4));
+            memcpy(write, entry->patchedBytecode, entry->bytecodeSize);
+            memset(write + entry->bytecodeSize, 0, alignedSize - entry->bytecodeSize);
+            write += alignedSize;
+        }
+    }
+    FFX_ASSERT(write == payload + header.payloadSize);
+
+    header.payloadHash = hashPipelineCacheDX11(payload, size_t(header.payloadSize));
+    memcpy(data, &header, sizeof(header));
+    *size = requiredSize;
+    return FFX_OK;
+}
+
+FFX_API FfxErrorCode ffxLoadPipelineCacheDX11(const void* data, size_t size)
+{
+    FFX_RETURN_ON_ERROR(data, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(size >= sizeof(PipelineCacheHeader_DX11), FFX_ERROR_INVALID_SIZE);
+
+    PipelineCacheHeader_DX11 header;
+    memcpy(&header, data, sizeof(header));
+    FFX_RETURN_ON_ERROR(header.magic == FFX_DX11_PIPELINE_CACHE_MAGIC, FFX_ERROR_MALFORMED_DATA);
+    FFX_RETURN_ON_ERROR(header.version == FFX_DX11_PIPELINE_CACHE_VERSION, FFX_ERROR_INVALID_VERSION);
+    FFX_RETURN_ON_ERROR(header.sdkVersion == FFX_SDK_MAKE_VERSION(FFX_SDK_VERSION_MAJOR, FFX_SDK_VERSION_MINOR, FFX_SDK_VERSION_PATCH), FFX_ERROR_INVALID_VERSION);
+    FFX_RETURN_ON_ERROR(header.bindingSize == sizeof(FfxResourceBinding), FFX_ERROR_INVALID_VERSION);
+    FFX_RETURN_ON_ERROR(header.payloadSize <= UINT32_MAX && header.payloadSize == size - sizeof(PipelineCacheHeader_DX11), FFX_ERROR_INVALID_SIZE);
+
+    const uint8_t* payload = static_cast<const uint8_t*>(data) + sizeof(PipelineCacheHeader_DX11);
+    FFX_RETURN_ON_ERROR(hashPipelineCacheDX11(payload, size_t(header.payloadSize)) == header.payloadHash, FFX_ERROR_MALFORMED_DATA);
+
+    // parse every record before touching the cache so a malformed file adds nothing
+    PipelineCacheEntry_DX11* loadedEntries = nullptr;
+    FfxErrorCode errorCode = FFX_OK;
+    const uint8_t* read = payload;
+    const uint8_t* end = payload + header.payloadSize;
+    for (uint32_t entryIndex = 0; entryIndex < header.entryCount && errorCode == FFX_OK; ++entryIndex)
+    {
+        PipelineCacheRecord_DX11 record;
+        if (size_t(end - read) < sizeof(record))
+        {
+            errorCode = FFX_ERROR_MALFORMED_DATA;
             break;
         }
+        memcpy(&record, read, sizeof(record));
+        read += sizeof(record);
+
+        const uint64_t bindingCount = uint64_t(record.srvTextureCount) + record.uavTextureCount + record.srvBufferCount + record.uavBufferCount + record.constCount;
+        const uint64_t bindingsSize = bindingCount * sizeof(FfxResourceBinding);
+        const uint64_t patchedSize = FFX_ALIGN_UP(uint64_t(record.patchedBytecodeSize), uint64_t(4));
+        if (record.srvTextureCount > FFX_MAX_NUM_SRVS || record.uavTextureCount > FFX_MAX_NUM_UAVS ||
+            record.srvBufferCount > FFX_MAX_NUM_SRVS || record.uavBufferCount > FFX_MAX_NUM_UAVS ||
+            record.constCount > FFX_MAX_NUM_CONST_BUFFERS ||
+            (record.patchedBytecodeSize != 0 && record.patchedBytecodeSize != record.bytecodeSize) ||
+            uint64_t(end - read) < bindingsSize + patchedSize)
+        {
+            errorCode = FFX_ERROR_MALFORMED_DATA;
+            break;
+        }
+
+        PipelineCacheEntry_DX11* entry = new PipelineCacheEntry_DX11();
+        entry->effect = FfxEffect(record.effect);
+        entry->pass = FfxPass(record.pass);
+        entry->permutationOptions = record.permutationOptions;
+        memcpy(entry->blobChecksum, record.blobChecksum, sizeof(entry->blobChecksum));
+        entry->loaded = true;
+        entry->srvTextureCount = record.srvTextureCount;
+        entry->uavTextureCount = record.uavTextureCount;
+        entry->srvBufferCount = record.srvBufferCount;
+        entry->uavBufferCount = record.uavBufferCount;
+        entry->constCount = record.constCount;
+        entry->bindings = new FfxResourceBinding[size_t(bindingCount)];
+        memcpy(entry->bindings, read, size_t(bindingsSize));
+        read += bindingsSize;
+        entry->bytecodeSize = record.bytecodeSize;
+        if (record.patchedBytecodeSize)
+        {
+            entry->patchedBytecode = new uint8_t[record.patchedBytecodeSize];
+            memcpy(entry->patchedBytecode, read, record.patchedBytecodeSize);
+            entry->bytecode = entry->patchedBytecode;
+            read += patchedSize;
+        }
+
+        entry->next = loadedEntries;
+        loadedEntries = entry;
+    }
+    if (errorCode == FFX_OK && read != end)
+        errorCode = FFX_ERROR_MALFORMED_DATA;
+
+    std::lock_guard<std::mutex> cacheLock{ s_PipelineCacheMutex };
+
+    while (loadedEntries)
+    {
+        PipelineCacheEntry_DX11* entry = loadedEntries;
+        loadedEntries = entry->next;
+
+        // permutations already in the cache keep their entry
+        bool cached = errorCode != FFX_OK;
+        for (PipelineCacheEntry_DX11* cachedEntry = s_PipelineCache; cachedEntry && !cached; cachedEntry = cachedEntry->next)
+        {
+            cached = cachedEntry->effect == entry->effect && cachedEntry->pass == entry->pass &&
+                     cachedEntry->permutationOptions == entry->permutationOptions && cachedEntry->bytecodeSize == entry->bytecodeSize &&
+                     memcmp(cachedEntry->blobChecksum, entry->blobChecksum, sizeof(entry->blobChecksum)) == 0;
+        }
+
+        if (cached)
+        {
+            destroyPipelineCacheEntryDX11(entry);
+        }
+        else
+        {
+            entry->next = s_PipelineCache;
+            s_PipelineCache = entry;
+        }
+    }
+
+    return errorCode;
+}
+
+FFX_API FfxErrorCode ffxSavePipelineCacheFileDX11(const wchar_t* path)
+{
+    FFX_RETURN_ON_ERROR(path, FFX_ERROR_INVALID_POINTER);
+
+    size_t size = 0;
+    FFX_VALIDATE(ffxSavePipelineCacheDX11(nullptr, &size));
+
+    // the cache may grow between the size query and the copy
+    std::vector<uint8_t> data(size);
+    FfxErrorCode errorCode = FFX_OK;
+    while ((errorCode = ffxSavePipelineCacheDX11(data.data(), &size)) != FFX_OK && size > data.size())
+        data.resize(size);
+    FFX_VALIDATE(errorCode);
+
+    FILE* file = nullptr;
+    FFX_RETURN_ON_ERROR(_wfopen_s(&file, path, L"wb") == 0 && file, FFX_ERROR_INVALID_PATH);
+    const bool written = fwrite(data.data(), 1, size, file) == size;
+    const bool closed = fclose(file) == 0;
+    return written && closed ? FFX_OK : FFX_ERROR_INVALID_PATH;
+}
+
+FFX_API FfxErrorCode ffxLoadPipelineCacheFileDX11(const wchar_t* path)
+{
+    FFX_RETURN_ON_ERROR(path, FFX_ERROR_INVALID_POINTER);
+
+    FILE* file = nullptr;
+    FFX_RETURN_ON_ERROR(_wfopen_s(&file, path, L"rb") == 0 && file, FFX_ERROR_INVALID_PATH);
+
+    std::vector<uint8_t> data;
+    uint8_t chunk[16384];
+    size_t count = 0;
+    while ((count = fread(chunk, 1, sizeof(chunk), file)) != 0)
+        data.insert(data.end(), chunk, chunk + count);
+    const bool failed = ferror(file) != 0;
+    fclose(file);
+    FFX_RETURN_ON_ERROR(!failed, FFX_ERROR_INVALID_PATH);
+
+    return ffxLoadPipelineCacheDX11(data.data(), data.size());
+}
+
+FfxErrorCode CreatePipelineDX11(
+    FfxInterface* backendInterface,
+    FfxEffect effect,
+    FfxPass pass,
+    uint32_t permutationOptions,
+    const FfxPipelineDescription* pipelineDescription,
+    FfxUInt32                     effectContextId,
+    FfxPipelineState* outPipeline)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != pipelineDescription);
+
+    BackendContext_DX11* backendContext = (BackendContext_DX11*)backendInterface->scratchBuffer;
+    ID3D11Device* dx11Device = backendContext->device;
+
+    FfxShaderBlob shaderBlob = { };
+    FFX_VALIDATE(ffxGetPermutationBlobByIndex(effect, pass, FFX_BIND_COMPUTE_SHADER_STAGE, permutationOptions, &shaderBlob));
+    FFX_ASSERT(shaderBlob.data && shaderBlob.size);
+
+    // the patched bytecode and the bindings are shared with every other pipeline of this permutation
+    PipelineCacheEntry_DX11* cacheEntry = acquirePipelineCacheEntryDX11(effect, pass, permutationOptions, shaderBlob);
+    FFX_RETURN_ON_ERROR(cacheEntry, FFX_ERROR_MALFORMED_DATA);
+
+    // Only set the command signature if this is setup as an indirect workload
+    outPipeline->cmdSignature = nullptr;
+
+    outPipeline->srvTextureCount = cacheEntry->srvTextureCount;
+    outPipeline->uavTextureCount = cacheEntry->uavTextureCount;
+    outPipeline->srvBufferCount = cacheEntry->srvBufferCount;
+    outPipeline->uavBufferCount = cacheEntry->uavBufferCount;
+    outPipeline->constCount = cacheEntry->constCount;
+    const FfxResourceBinding* binding = cacheEntry->bindings;
+    std::copy_n(binding, outPipeline->srvTextureCount, outPipeline->srvTextureBindings);
+    binding += outPipeline->srvTextureCount;
+    std::copy_n(binding, outPipeline->uavTextureCount, outPipeline->uavTextureBindings);
+    binding += outPipeline->uavTextureCount;
+    std::copy_n(binding, outPipeline->srvBufferCount, outPipeline->srvBufferBindings);
+    binding += outPipeline->srvBufferCount;
+    std::copy_n(binding, outPipeline->uavBufferCount, outPipeline->uavBufferBindings);
+    binding += outPipeline->uavBufferCount;
+    std::copy_n(binding, outPipeline->constCount, outPipeline->constantBufferBindings);
+
+    // DX11 has no static resources
+    outPipeline->staticTextureSrvCount = 0;
+    outPipeline->staticBufferSrvCount = 0;
+    outPipeline->staticTextureUavCount = 0;
+    outPipeline->staticBufferUavCount = 0;
+
+    // DX11 has no root signatures, the pipeline keeps its cache entry there instead
+    outPipeline->rootSignature = cacheEntry;
+
+    // reuse the shader object of a live pipeline on the same device
+    {
+        std::lock_guard<std::mutex> cacheLock{ s_PipelineCacheMutex };
+        if (cacheEntry->shader && cacheEntry->device == dx11Device)
+        {
+            cacheEntry->shader->AddRef();
+            outPipeline->pipeline = cacheEntry->shader;
+            s_PipelineCacheShaderReuseCount++;
+            return FFX_OK;
+        }
     }
 
     // create the PSO
 #if HAVE_NVIDIA
+    // the extension slot is device state, keep concurrent pipeline creation from interleaving set/create/unset
+    std::unique_lock<std::mutex> extnSlotLock{ s_NvShaderExtnSlotMutex, std::defer_lock };
     if (backendContext->NvAPI_D3D11_SetNvShaderExtnSlot)
-        backendContext->NvAPI_D3D11_SetNvShaderExtnSlot(backendContext->device, 15);
-#endif
-    if (FAILED(dx11Device->CreateComputeShader(data, shaderBlob.size, nullptr, (ID3D11ComputeShader**)&outPipeline->pipeline)))
     {
-#if HAVE_NVIDIA
-        if (backendContext->NvAPI_D3D11_SetNvShaderExtnSlot)
-            backendContext->NvAPI_D3D11_SetNvShaderExtnSlot(backendContext->device, ~0);
-#endif
-        delete[] data;
-        return FFX_ERROR_BACKEND_API_ERROR;
+        extnSlotLock.lock();
+        backendContext->NvAPI_D3D11_SetNvShaderExtnSlot(backendContext->device, 15);
     }
+#endif
+    ID3D11ComputeShader* dx11Shader = nullptr;
+    HRESULT result = dx11Device->CreateComputeShader(cacheEntry->bytecode, cacheEntry->bytecodeSize, nullptr, &dx11Shader);
 #if HAVE_NVIDIA
     if (backendContext->NvAPI_D3D11_SetNvShaderExtnSlot)
         backendContext->NvAPI_D3D11_SetNvShaderExtnSlot(backendContext->device, ~0);
 #endif
-    delete[] data;
+    if (FAILED(result))
+    {
+        releasePipelineCacheEntryDX11(cacheEntry);
+        outPipeline->rootSignature = nullptr;
+        return FFX_ERROR_BACKEND_API_ERROR;
+    }
+    outPipeline->pipeline = dx11Shader;
 
     // Set the pipeline name
-    SetNameDX11(reinterpret_cast<ID3D11ComputeShader*>(outPipeline->pipeline), pipelineDescription->name);
+    SetNameDX11(dx11Shader, pipelineDescription->name);
+
+    {
+        std::lock_guard<std::mutex> cacheLock{ s_PipelineCacheMutex };
+        if (cacheEntry->shader == nullptr)
+        {
+            dx11Shader->AddRef();
+            cacheEntry->shader = dx11Shader;
+            cacheEntry->device = dx11Device;
+        }
+    }
 
     return FFX_OK;
 }
@@ -1865,9 +3006,127 @@ FfxErrorCode DestroyPipelineDX11(
     }
     pipeline->pipeline = nullptr;
 
+    PipelineCacheEntry_DX11* cacheEntry = reinterpret_cast<PipelineCacheEntry_DX11*>(pipeline->rootSignature);
+    if (cacheEntry) {
+        releasePipelineCacheEntryDX11(cacheEntry);
+    }
+    pipeline->rootSignature = nullptr;
+
     return FFX_OK;
 }
 
+// reserve space for a record at the end of the job stream
+static GpuJob_DX11* allocateGpuJobDX11(BackendContext_DX11* backendContext, const FfxGpuJobDescription* job, uint32_t size)
+{
+    size = FFX_ALIGN_UP(size, FFX_DX11_GPU_JOB_ALIGNMENT);
+
+    FFX_ASSERT(backendContext->gpuJobCount < FFX_MAX_GPU_JOBS);
+    FFX_ASSERT(backendContext->gpuJobSize + size <= backendContext->gpuJobCapacity);
+
+    GpuJob_DX11* record = (GpuJob_DX11*)(backendContext->pGpuJobs + backendContext->gpuJobSize);
+    record->jobType = job->jobType;
+    record->size = size;
+#ifdef FFX_DEBUG
+    memcpy(record->jobLabel, job->jobLabel, sizeof(record->jobLabel));
+#endif
+
+    backendContext->gpuJobCount++;
+    backendContext->gpuJobSize += size;
+
+    return record;
+}
+
+static void scheduleGpuJobComputeDX11(BackendContext_DX11* backendContext, const FfxGpuJobDescription* job)
+{
+    const FfxComputeJobDescription& computeJob = job->computeJobDescriptor;
+    const FfxPipelineState& pipeline = computeJob.pipeline;
+
+    // only bindings the execute path would set are recorded, resolved to the slots they bind to,
+    // and written in place behind the record that is allocated once their count is known
+    FFX_ASSERT(backendContext->gpuJobSize + FFX_DX11_MAX_GPU_JOB_SIZE <= backendContext->gpuJobCapacity);
+    GpuJobBinding_DX11* bindings = (GpuJobBinding_DX11*)(backendContext->pGpuJobs + backendContext->gpuJobSize + sizeof(ComputeJob_DX11));
+    uint32_t bindingCount = 0;
+
+    // texture UAVs
+    for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < pipeline.uavTextureCount; ++currentPipelineUavIndex) {
+
+        const FfxResourceBinding& binding = pipeline.uavTextureBindings[currentPipelineUavIndex];
+
+        GpuJobBinding_DX11& record = bindings[bindingCount++];
+        record.slot = binding.slotIndex + binding.arrayIndex;
+        record.resource = computeJob.uavTextures[currentPipelineUavIndex].resource;
+        record.offset = computeJob.uavTextures[currentPipelineUavIndex].mip;
+        record.size = 0;
+        record.stride = 0;
+    }
+    const uint32_t uavTextureCount = bindingCount;
+
+    // buffer UAVs, skipping null and empty resources
+    for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < pipeline.uavBufferCount; ++currentPipelineUavIndex) {
+
+        const FfxBufferUAV& buffer = computeJob.uavBuffers[currentPipelineUavIndex];
+        if (buffer.resource.internalIndex == 0 || buffer.size == 0)
+            continue;
+
+        const FfxResourceBinding& binding = pipeline.uavBufferBindings[currentPipelineUavIndex];
+
+        GpuJobBinding_DX11& record = bindings[bindingCount++];
+        record.slot = binding.slotIndex + binding.arrayIndex;
+        record.resource = buffer.resource;
+        record.offset = buffer.offset;
+        record.size = buffer.size;
+        record.stride = buffer.stride;
+    }
+    const uint32_t uavBufferCount = bindingCount - uavTextureCount;
+
+    // texture SRVs, up to the first null resource
+    for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < pipeline.srvTextureCount; ++currentPipelineSrvIndex) {
+
+        if (computeJob.srvTextures[currentPipelineSrvIndex].resource.internalIndex == 0)
+            break;
+
+        const FfxResourceBinding& binding = pipeline.srvTextureBindings[currentPipelineSrvIndex];
+
+        GpuJobBinding_DX11& record = bindings[bindingCount++];
+        record.slot = binding.slotIndex + binding.arrayIndex;
+        record.resource = computeJob.srvTextures[currentPipelineSrvIndex].resource;
+        record.offset = 0;
+        record.size = 0;
+        record.stride = 0;
+    }
+    const uint32_t srvTextureCount = bindingCount - uavTextureCount - uavBufferCount;
+
+    // buffer SRVs, skipping null and empty resources
+    for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < pipeline.srvBufferCount; ++currentPipelineSrvIndex) {
+
+        const FfxBufferSRV& buffer = computeJob.srvBuffers[currentPipelineSrvIndex];
+        if (buffer.resource.internalIndex == 0 || buffer.size == 0)
+            continue;
+
+        const FfxResourceBinding& binding = pipeline.srvBufferBindings[currentPipelineSrvIndex];
+
+        GpuJobBinding_DX11& record = bindings[bindingCount++];
+        record.slot = binding.slotIndex + binding.arrayIndex;
+        record.resource = buffer.resource;
+        record.offset = buffer.offset;
+        record.size = buffer.size;
+        record.stride = buffer.stride;
+    }
+    const uint32_t srvBufferCount = bindingCount - uavTextureCount - uavBufferCount - srvTextureCount;
+
+    ComputeJob_DX11* record = (ComputeJob_DX11*)allocateGpuJobDX11(backendContext, job, sizeof(ComputeJob_DX11) + bindingCount * sizeof(GpuJobBinding_DX11));
+    record->pipeline = reinterpret_cast<ID3D11ComputeShader*>(pipeline.pipeline);
+    record->dimensions[0] = computeJob.dimensions[0];
+    record->dimensions[1] = computeJob.dimensions[1];
+    record->dimensions[2] = computeJob.dimensions[2];
+    record->uavTextureCount = uint16_t(uavTextureCount);
+    record->uavBufferCount = uint16_t(uavBufferCount);
+    record->srvTextureCount = uint16_t(srvTextureCount);
+    record->srvBufferCount = uint16_t(srvBufferCount);
+    record->constCount = pipeline.constCount;
+    memcpy(record->cbs, computeJob.cbs, pipeline.constCount * sizeof(FfxConstantBuffer));
+}
+
 FfxErrorCode ScheduleGpuJobDX11(
     FfxInterface* backendInterface,
     const FfxGpuJobDescription* job
@@ -1878,121 +3137,134 @@ FfxErrorCode ScheduleGpuJobDX11(
 
     BackendContext_DX11* backendContext = (BackendContext_DX11*)backendInterface->scratchBuffer;
 
-    FFX_ASSERT(backendContext->gpuJobCount < FFX_MAX_GPU_JOBS);
+    switch (job->jobType) {
 
-    backendContext->pGpuJobs[backendContext->gpuJobCount] = *job;
-    backendContext->gpuJobCount++;
+        case FFX_GPU_JOB_CLEAR_FLOAT:
+            ((ClearFloatJob_DX11*)allocateGpuJobDX11(backendContext, job, sizeof(ClearFloatJob_DX11)))->clearJobDescriptor = job->clearJobDescriptor;
+            break;
+
+        case FFX_GPU_JOB_COPY:
+            ((CopyJob_DX11*)allocateGpuJobDX11(backendContext, job, sizeof(CopyJob_DX11)))->copyJobDescriptor = job->copyJobDescriptor;
+            break;
+
+        case FFX_GPU_JOB_COMPUTE:
+            scheduleGpuJobComputeDX11(backendContext, job);
+            break;
+
+        case FFX_GPU_JOB_DISCARD:
+            ((DiscardJob_DX11*)allocateGpuJobDX11(backendContext, job, sizeof(DiscardJob_DX11)))->discardJobDescriptor = job->discardJobDescriptor;
+            break;
+
+        // DX11 tracks hazards itself, barriers are not recorded
+        case FFX_GPU_JOB_BARRIER:
+        default:
+            break;
+    }
 
     return FFX_OK;
 }
 
-static FfxErrorCode executeGpuJobCompute(BackendContext_DX11* backendContext, FfxGpuJobDescription* job, ID3D11Device* dx11Device, ID3D11DeviceContext* dx11DeviceContext)
+static void resetComputeStateDX11(ComputeState_DX11* state)
+{
+    memset(state, 0, sizeof(ComputeState_DX11));
+    state->uavBegin = UINT32_MAX;
+    state->srvBegin = UINT32_MAX;
+}
+
+// leave the views unbound as the application found them, the shader and constant buffers stay set
+static void unbindComputeStateDX11(ComputeState_DX11* state, ID3D11DeviceContext* dx11DeviceContext)
+{
+    static ID3D11UnorderedAccessView* const emptyUAVs[D3D11_1_UAV_SLOT_COUNT] = {};
+    if (state->uavBegin < state->uavEnd) {
+        dx11DeviceContext->CSSetUnorderedAccessViews(state->uavBegin, state->uavEnd - state->uavBegin, emptyUAVs, nullptr);
+    }
+
+    static ID3D11ShaderResourceView* const emptySRVs[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT] = {};
+    if (state->srvBegin < state->srvEnd) {
+        dx11DeviceContext->CSSetShaderResources(state->srvBegin, state->srvEnd - state->srvBegin, emptySRVs);
+    }
+
+    resetComputeStateDX11(state);
+}
+
+static FfxErrorCode executeGpuJobCompute(BackendContext_DX11* backendContext, const ComputeJob_DX11* job, ID3D11Device* dx11Device, ID3D11DeviceContext* dx11DeviceContext)
 {
     ID3D11UnorderedAccessView** uavs = backendContext->uavs;
     ID3D11ShaderResourceView** srvs = backendContext->srvs;
+    ID3D11Resource** uavResources = backendContext->uavResources;
+    ID3D11Resource** srvResources = backendContext->srvResources;
     memset(uavs, 0, sizeof(backendContext->uavs));
     memset(srvs, 0, sizeof(backendContext->srvs));
+    memset(uavResources, 0, sizeof(backendContext->uavResources));
+    memset(srvResources, 0, sizeof(backendContext->srvResources));
+
+    const GpuJobBinding_DX11* uavTextures = (const GpuJobBinding_DX11*)(job + 1);
+    const GpuJobBinding_DX11* uavBuffers = uavTextures + job->uavTextureCount;
+    const GpuJobBinding_DX11* srvTextures = uavBuffers + job->uavBufferCount;
+    const GpuJobBinding_DX11* srvBuffers = srvTextures + job->srvTextureCount;
 
     // bind texture & buffer UAVs (note the binding order here MUST match the root signature mapping order from CreatePipeline!)
     uint32_t minimumUav = UINT32_MAX;
     uint32_t maximumUav = 0;
     {
-        // Set a baseline minimal value
-        uint32_t maximumUavIndex = job->computeJobDescriptor.pipeline.uavTextureCount + job->computeJobDescriptor.pipeline.uavBufferCount;
-
-        for (uint32_t uavTextureBinding = 0; uavTextureBinding < job->computeJobDescriptor.pipeline.uavTextureCount; uavTextureBinding++)
-        {
-            uint32_t slotIndex = job->computeJobDescriptor.pipeline.uavTextureBindings[uavTextureBinding].slotIndex +
-                                 job->computeJobDescriptor.pipeline.uavTextureBindings[uavTextureBinding].arrayIndex;
-
-            if (slotIndex > maximumUavIndex)
-                maximumUavIndex = slotIndex;
-        }
-
-        for (uint32_t uavBufferBinding = 0; uavBufferBinding < job->computeJobDescriptor.pipeline.uavBufferCount; uavBufferBinding++)
-        {
-            uint32_t slotIndex = job->computeJobDescriptor.pipeline.uavBufferBindings[uavBufferBinding].slotIndex +
-                                 job->computeJobDescriptor.pipeline.uavTextureBindings[uavBufferBinding].arrayIndex;
-
-            if (slotIndex > maximumUavIndex)
-                maximumUavIndex = slotIndex;
-        }
-
-        if (maximumUavIndex)
-        {
-            // Set Texture UAVs
-            for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job->computeJobDescriptor.pipeline.uavTextureCount; ++currentPipelineUavIndex) {
-
-                const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.uavTextureBindings[currentPipelineUavIndex];
+        // Set Texture UAVs
+        for (uint32_t currentUavIndex = 0; currentUavIndex < job->uavTextureCount; ++currentUavIndex) {
 
-                // source: UAV of resource to bind
-                const uint32_t resourceIndex = job->computeJobDescriptor.uavTextures[currentPipelineUavIndex].resource.internalIndex;
-                const uint32_t uavIndex = job->computeJobDescriptor.uavTextures[currentPipelineUavIndex].mip;
-                ID3D11UnorderedAccessView* uavPtr = backendContext->pResources[resourceIndex].uavPtr[uavIndex];
+            const GpuJobBinding_DX11& binding = uavTextures[currentUavIndex];
 
-                // where to bind it
-                const uint32_t currentUavResourceIndex = binding.slotIndex + binding.arrayIndex;
+            // source: UAV of resource to bind
+            ID3D11UnorderedAccessView* uavPtr = backendContext->pResources[binding.resource.internalIndex].uavPtr[binding.offset];
 
-                uavs[currentUavResourceIndex] = uavPtr;
+            // where to bind it
+            const uint32_t currentUavResourceIndex = binding.slot;
 
-                minimumUav = minimumUav < currentUavResourceIndex ? minimumUav : currentUavResourceIndex;
-                maximumUav = maximumUav > currentUavResourceIndex ? maximumUav : currentUavResourceIndex;
-            }
-
-            // Set Buffer UAVs
-            for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job->computeJobDescriptor.pipeline.uavBufferCount; ++currentPipelineUavIndex) {
+            uavs[currentUavResourceIndex] = uavPtr;
+            uavResources[currentUavResourceIndex] = getDX11ResourcePtr(backendContext, binding.resource.internalIndex);
 
-                // continue if this is a null resource.
-                if (job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].resource.internalIndex == 0)
-                    continue;
-
-                const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.uavBufferBindings[currentPipelineUavIndex];
+            minimumUav = minimumUav < currentUavResourceIndex ? minimumUav : currentUavResourceIndex;
+            maximumUav = maximumUav > currentUavResourceIndex ? maximumUav : currentUavResourceIndex;
+        }
 
-                // where to bind it
-                const uint32_t currentUavResourceIndex = binding.slotIndex + binding.arrayIndex;
+        // Set Buffer UAVs
+        for (uint32_t currentUavIndex = 0; currentUavIndex < job->uavBufferCount; ++currentUavIndex) {
 
-                if (job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].size > 0)
-                {
-                    bool     isStructured = job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].stride > 0;
-                    uint32_t stride       = isStructured ? job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].stride : sizeof(uint32_t);
+            const GpuJobBinding_DX11& binding = uavBuffers[currentUavIndex];
 
-                    // source: UAV of buffer to bind
-                    const uint32_t resourceIndex = job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].resource.internalIndex;
-                    const uint32_t uavIndex = job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].offset / stride;
-                    ID3D11UnorderedAccessView* uavPtr = backendContext->pResources[resourceIndex].uavPtr[uavIndex];
+            // where to bind it
+            const uint32_t currentUavResourceIndex = binding.slot;
 
-                    if (uavPtr == nullptr)
-                    {
-                        // if size is non-zero create a dynamic descriptor directly on the GPU heap
-                        ID3D11Resource* buffer = getDX11ResourcePtr(backendContext, job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].resource.internalIndex);
-                        FFX_ASSERT(buffer != NULL);
+            bool     isStructured = binding.stride > 0;
+            uint32_t stride       = isStructured ? binding.stride : sizeof(uint32_t);
 
-                        D3D11_UNORDERED_ACCESS_VIEW_DESC dx11UavDescription = {};
+            // source: UAV of buffer to bind
+            const uint32_t resourceIndex = binding.resource.internalIndex;
+            const uint32_t uavIndex = binding.offset / stride;
+            ID3D11UnorderedAccessView* uavPtr = backendContext->pResources[resourceIndex].uavPtr[uavIndex];
 
-                        bool     isStructured = job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].stride > 0;
-                        uint32_t stride       = isStructured ? job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].stride : sizeof(uint32_t);
+            if (uavPtr == nullptr)
+            {
+                // if size is non-zero create a dynamic descriptor directly on the GPU heap
+                ID3D11Resource* buffer = getDX11ResourcePtr(backendContext, resourceIndex);
+                FFX_ASSERT(buffer != NULL);
 
-                        dx11UavDescription.Format                      = isStructured ? DXGI_FORMAT_UNKNOWN : DXGI_FORMAT_R32_TYPELESS;
-                        dx11UavDescription.ViewDimension               = D3D11_UAV_DIMENSION_BUFFER;
-                        dx11UavDescription.Buffer.FirstElement         = job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].offset / stride;
-                        dx11UavDescription.Buffer.NumElements          = job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].size / stride;
-                        dx11UavDescription.Buffer.Flags                = isStructured ? 0 : D3D11_BUFFER_UAV_FLAG_RAW;
+                D3D11_UNORDERED_ACCESS_VIEW_DESC dx11UavDescription = {};
 
-                        TIF(dx11Device->CreateUnorderedAccessView(buffer, &dx11UavDescription, &uavPtr));
+                dx11UavDescription.Format                      = isStructured ? DXGI_FORMAT_UNKNOWN : DXGI_FORMAT_R32_TYPELESS;
+                dx11UavDescription.ViewDimension               = D3D11_UAV_DIMENSION_BUFFER;
+                dx11UavDescription.Buffer.FirstElement         = binding.offset / stride;
+                dx11UavDescription.Buffer.NumElements          = binding.size / stride;
+                dx11UavDescription.Buffer.Flags                = isStructured ? 0 : D3D11_BUFFER_UAV_FLAG_RAW;
 
-                        backendContext->pResources[resourceIndex].uavPtr[uavIndex] = uavPtr;
-                    }
+                TIF(dx11Device->CreateUnorderedAccessView(buffer, &dx11UavDescription, &uavPtr));
 
-                    uavs[currentUavResourceIndex] = uavPtr;
+                backendContext->pResources[resourceIndex].uavPtr[uavIndex] = uavPtr;
+            }
 
-                    minimumUav = minimumUav < currentUavResourceIndex ? minimumUav : currentUavResourceIndex;
-                    maximumUav = maximumUav > currentUavResourceIndex ? maximumUav : currentUavResourceIndex;
-                }
-                else
-                {
+            uavs[currentUavResourceIndex] = uavPtr;
+            uavResources[currentUavResourceIndex] = getDX11ResourcePtr(backendContext, resourceIndex);
 
-                }
-            }
+            minimumUav = minimumUav < currentUavResourceIndex ? minimumUav : currentUavResourceIndex;
+            maximumUav = maximumUav > currentUavResourceIndex ? maximumUav : currentUavResourceIndex;
         }
     }
 
@@ -2000,116 +3272,87 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX11* backendContext, Ff
     uint32_t minimumSrv = UINT32_MAX;
     uint32_t maximumSrv = 0;
     {
-        // Set a baseline minimal value
-        uint32_t maximumSrvIndex = job->computeJobDescriptor.pipeline.srvTextureCount + job->computeJobDescriptor.pipeline.srvBufferCount;
-
-        for (uint32_t srvTextureBinding = 0; srvTextureBinding < job->computeJobDescriptor.pipeline.srvTextureCount; srvTextureBinding++)
+        // Set Texture SRVs
+        for (uint32_t currentSrvIndex = 0; currentSrvIndex < job->srvTextureCount; ++currentSrvIndex)
         {
-            uint32_t slotIndex = job->computeJobDescriptor.pipeline.srvTextureBindings[srvTextureBinding].slotIndex +
-                                 job->computeJobDescriptor.pipeline.srvTextureBindings[srvTextureBinding].arrayIndex;
+            const GpuJobBinding_DX11& binding = srvTextures[currentSrvIndex];
 
-            if (slotIndex > maximumSrvIndex)
-                maximumSrvIndex = slotIndex;
-        }
+            // source: SRV of resource to bind
+            ID3D11ShaderResourceView* srvPtr = backendContext->pResources[binding.resource.internalIndex].srvPtr[0];
 
-        for (uint32_t srvBufferBinding = 0; srvBufferBinding < job->computeJobDescriptor.pipeline.srvBufferCount; srvBufferBinding++)
-        {
-            uint32_t slotIndex = job->computeJobDescriptor.pipeline.srvBufferBindings[srvBufferBinding].slotIndex +
-                                 job->computeJobDescriptor.pipeline.srvTextureBindings[srvBufferBinding].arrayIndex;
+            // Where to bind it
+            uint32_t currentSrvResourceIndex = binding.slot;
+
+            srvs[currentSrvResourceIndex] = srvPtr;
+            srvResources[currentSrvResourceIndex] = getDX11ResourcePtr(backendContext, binding.resource.internalIndex);
 
-            if (slotIndex > maximumSrvIndex)
-                maximumSrvIndex = slotIndex;
+            minimumSrv = minimumSrv < currentSrvResourceIndex ? minimumSrv : currentSrvResourceIndex;
+            maximumSrv = maximumSrv > currentSrvResourceIndex ? maximumSrv : currentSrvResourceIndex;
         }
 
-        if (maximumSrvIndex)
+        // Set Buffer SRVs
+        for (uint32_t currentSrvIndex = 0; currentSrvIndex < job->srvBufferCount; ++currentSrvIndex)
         {
-            for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job->computeJobDescriptor.pipeline.srvTextureCount; ++currentPipelineSrvIndex)
-            {
-                if (job->computeJobDescriptor.srvTextures[currentPipelineSrvIndex].resource.internalIndex == 0)
-                    break;
-
-                const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.srvTextureBindings[currentPipelineSrvIndex];
+            const GpuJobBinding_DX11& binding = srvBuffers[currentSrvIndex];
 
-                // source: SRV of resource to bind
-                const uint32_t resourceIndex = job->computeJobDescriptor.srvTextures[currentPipelineSrvIndex].resource.internalIndex;
-                ID3D11ShaderResourceView* srvPtr = backendContext->pResources[resourceIndex].srvPtr[0];
+            // where to bind it
+            const uint32_t currentSrvResourceIndex = binding.slot;
 
-                // Where to bind it
-                uint32_t currentSrvResourceIndex = binding.slotIndex + binding.arrayIndex;
+            bool     isStructured = binding.stride > 0;
+            uint32_t stride       = isStructured ? binding.stride : sizeof(uint32_t);
 
-                srvs[currentSrvResourceIndex] = srvPtr;
+            // source: SRV of buffer to bind
+            const uint32_t resourceIndex = binding.resource.internalIndex;
+            const uint32_t srvIndex = binding.offset / stride;
+            ID3D11ShaderResourceView* srvPtr = backendContext->pResources[resourceIndex].srvPtr[srvIndex];
 
-                minimumSrv = minimumSrv < currentSrvResourceIndex ? minimumSrv : currentSrvResourceIndex;
-                maximumSrv = maximumSrv > currentSrvResourceIndex ? maximumSrv : currentSrvResourceIndex;
-            }
-
-            // Set Buffer SRVs
-            for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job->computeJobDescriptor.pipeline.srvBufferCount; ++currentPipelineSrvIndex)
+            if (srvPtr == nullptr)
             {
-                // continue if this is a null resource.
-                if (job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].resource.internalIndex == 0)
-                    continue;
-
-                const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.srvBufferBindings[currentPipelineSrvIndex];
-
-                // where to bind it
-                const uint32_t currentSrvResourceIndex = binding.slotIndex + binding.arrayIndex;
+                // if size is non-zero create a dynamic descriptor directly on the GPU heap
+                ID3D11Resource* buffer = getDX11ResourcePtr(backendContext, resourceIndex);
+                FFX_ASSERT(buffer != NULL);
 
-                if (job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].size > 0)
-                {
-                    bool     isStructured = job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].stride > 0;
-                    uint32_t stride       = isStructured ? job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].stride : sizeof(uint32_t);
-
-                    // source: SRV of buffer to bind
-                    const uint32_t resourceIndex = job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].resource.internalIndex;
-                    const uint32_t srvIndex = job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].offset / stride;
-                    ID3D11ShaderResourceView* srvPtr = backendContext->pResources[resourceIndex].srvPtr[srvIndex];
-
-                    if (srvPtr == nullptr)
-                    {
-                        // if size is non-zero create a dynamic descriptor directly on the GPU heap
-                        ID3D11Resource* buffer = getDX11ResourcePtr(backendContext, job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].resource.internalIndex);
-                        FFX_ASSERT(buffer != NULL);
+                D3D11_SHADER_RESOURCE_VIEW_DESC dx11SrvDescription = {};
 
-                        D3D11_SHADER_RESOURCE_VIEW_DESC dx11SrvDescription = {};
+                dx11SrvDescription.Format                     = isStructured ? DXGI_FORMAT_UNKNOWN : DXGI_FORMAT_R32_TYPELESS;
+                dx11SrvDescription.ViewDimension              = D3D11_SRV_DIMENSION_BUFFEREX;
+                dx11SrvDescription.BufferEx.FirstElement      = binding.offset / stride;
+                dx11SrvDescription.BufferEx.NumElements       = binding.size / stride;
+                dx11SrvDescription.BufferEx.Flags             = isStructured ? 0 : D3D11_BUFFEREX_SRV_FLAG_RAW;
 
-                        bool     isStructured = job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].stride > 0;
-                        uint32_t stride       = isStructured ? job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].stride : sizeof(uint32_t);
-
-                        dx11SrvDescription.Format                     = isStructured ? DXGI_FORMAT_UNKNOWN : DXGI_FORMAT_R32_TYPELESS;
-                        dx11SrvDescription.ViewDimension              = D3D11_SRV_DIMENSION_BUFFEREX;
-                        dx11SrvDescription.BufferEx.FirstElement      = job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].offset / stride;
-                        dx11SrvDescription.BufferEx.NumElements       = job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].size / stride;
-                        dx11SrvDescription.BufferEx.Flags             = isStructured ? 0 : D3D11_BUFFEREX_SRV_FLAG_RAW;
-
-                        TIF(dx11Device->CreateShaderResourceView(buffer, &dx11SrvDescription, &srvPtr));
-
-                        backendContext->pResources[resourceIndex].srvPtr[srvIndex] = srvPtr;
-                    }
+                TIF(dx11Device->CreateShaderResourceView(buffer, &dx11SrvDescription, &srvPtr));
 
-                    srvs[currentSrvResourceIndex] = srvPtr;
+                backendContext->pResources[resourceIndex].srvPtr[srvIndex] = srvPtr;
+            }
 
-                    minimumSrv = minimumSrv < currentSrvResourceIndex ? minimumSrv : currentSrvResourceIndex;
-                    maximumSrv = maximumSrv > currentSrvResourceIndex ? maximumSrv : currentSrvResourceIndex;
-                }
-                else
-                {
+            srvs[currentSrvResourceIndex] = srvPtr;
+            srvResources[currentSrvResourceIndex] = getDX11ResourcePtr(backendContext, resourceIndex);
 
-                }
-            }
+            minimumSrv = minimumSrv < currentSrvResourceIndex ? minimumSrv : currentSrvResourceIndex;
+            maximumSrv = maximumSrv > currentSrvResourceIndex ? maximumSrv : currentSrvResourceIndex;
         }
     }
 
+    ComputeState_DX11& state = backendContext->computeState;
+
     // bind pipeline
-    ID3D11ComputeShader* dx11ComputeShader = reinterpret_cast<ID3D11ComputeShader*>(job->computeJobDescriptor.pipeline.pipeline);
-    dx11DeviceContext->CSSetShader(dx11ComputeShader, nullptr, 0);
+    if (!state.shaderKnown || state.shader != job->pipeline) {
+        dx11DeviceContext->CSSetShader(job->pipeline, nullptr, 0);
+        state.shader = job->pipeline;
+        state.shaderKnown = true;
+    }
 
     // copy data to constant buffer and bind
     {
-        std::lock_guard<std::mutex> cbLock{ backendContext->constantBufferMutex };
-        for (uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < job->computeJobDescriptor.pipeline.constCount; ++currentRootConstantIndex) {
+        std::unique_lock<std::mutex> cbLock{ backendContext->constantBufferMutex, std::defer_lock };
+        if (backendContext->deviceContext1 == NULL) {
+            cbLock.lock();
+            backendContext->constantBufferLockCount++;
+        }
+
+        for (uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < job->constCount; ++currentRootConstantIndex) {
 
-            uint32_t size = FFX_ALIGN_UP(job->computeJobDescriptor.cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t), 256);
+            uint32_t size = FFX_ALIGN_UP(job->cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t), 256);
 
             // Direct3D 11.0
             if (backendContext->deviceContext1 == NULL) {
@@ -2121,6 +3364,7 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX11* backendContext, Ff
                         backendContext->constantBufferResource[currentRootConstantIndex] = NULL;
                     }
                     backendContext->constantBufferSize[currentRootConstantIndex] = size;
+                    backendContext->constantBufferContentSize[currentRootConstantIndex] = 0;
 
                     D3D11_BUFFER_DESC constDesc = {};
                     constDesc.ByteWidth = size;
@@ -2133,67 +3377,158 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX11* backendContext, Ff
 
                 if (backendContext->constantBufferResource[currentRootConstantIndex] != NULL) {
 
-                    D3D11_MAPPED_SUBRESOURCE mappedSubresource = {};
-                    TIF(backendContext->deviceContext->Map(backendContext->constantBufferResource[currentRootConstantIndex], 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedSubresource));
+                    // the buffer of this slot may already hold these constants from the previous job
+                    const uint32_t dataSize = job->cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t);
+                    uint8_t* contents = backendContext->constantBufferContents[currentRootConstantIndex];
+                    uint32_t& contentSize = backendContext->constantBufferContentSize[currentRootConstantIndex];
+                    if (contentSize && contentSize == dataSize && memcmp(contents, job->cbs[currentRootConstantIndex].data, dataSize) == 0) {
 
-                    if (mappedSubresource.pData) {
-                        memcpy(mappedSubresource.pData, job->computeJobDescriptor.cbs[currentRootConstantIndex].data, job->computeJobDescriptor.cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t));
-                        backendContext->deviceContext->Unmap(backendContext->constantBufferResource[currentRootConstantIndex], 0);
+                        backendContext->constantBufferReusedCount++;
+                        backendContext->constantBufferReusedBytes += dataSize;
+                    }
+                    else {
+
+                        contentSize = 0;
+                        D3D11_MAPPED_SUBRESOURCE mappedSubresource = {};
+                        TIF(backendContext->deviceContext->Map(backendContext->constantBufferResource[currentRootConstantIndex], 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedSubresource));
+                        backendContext->constantBufferMapCount++;
+
+                        if (mappedSubresource.pData) {
+                            memcpy(mappedSubresource.pData, job->cbs[currentRootConstantIndex].data, dataSize);
+                            backendContext->constantBufferCopiedBytes += dataSize;
+
+                            // remember small contents to compare the next job against
+                            contentSize = dataSize <= FFX_DX11_CONSTANT_BUFFER_REUSE_MAX_SIZE ? dataSize : 0;
+                            if (contentSize)
+                                memcpy(contents, job->cbs[currentRootConstantIndex].data, dataSize);
+                            backendContext->deviceContext->Unmap(backendContext->constantBufferResource[currentRootConstantIndex], 0);
+                        }
                     }
 
-                    dx11DeviceContext->CSSetConstantBuffers(currentRootConstantIndex, 1, &backendContext->constantBufferResource[currentRootConstantIndex]);
+                    if (!(state.constantBufferKnownMask & (1u << currentRootConstantIndex)) ||
+                        state.constantBuffers[currentRootConstantIndex] != backendContext->constantBufferResource[currentRootConstantIndex]) {
+
+                        dx11DeviceContext->CSSetConstantBuffers(currentRootConstantIndex, 1, &backendContext->constantBufferResource[currentRootConstantIndex]);
+                        state.constantBufferKnownMask |= 1u << currentRootConstantIndex;
+                        state.constantBuffers[currentRootConstantIndex] = backendContext->constantBufferResource[currentRootConstantIndex];
+                    }
                 }
 
                 continue;
             }
 
-            if (backendContext->constantBufferOffset[0] + size >= backendContext->constantBufferSize[0])
-                backendContext->constantBufferOffset[0] = 0;
-
-            void* pBuffer = (void*)((uint8_t*)(backendContext->constantBufferMem[0]) + backendContext->constantBufferOffset[0]);
-            memcpy(pBuffer, job->computeJobDescriptor.cbs[currentRootConstantIndex].data, job->computeJobDescriptor.cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t));
+            // constants staged by this backend already live in the ring, anything else is copied in
+            uintptr_t ringBase = reinterpret_cast<uintptr_t>(backendContext->constantBufferMem[0]);
+            uintptr_t data = reinterpret_cast<uintptr_t>(job->cbs[currentRootConstantIndex].data);
+            uint32_t offset = 0;
+            if (data >= ringBase && data - ringBase + size <= backendContext->constantBufferSize[0]) {
+                offset = uint32_t(data - ringBase);
+            }
+            else {
+                offset = uint32_t(allocateConstantBufferDX11(backendContext, size) % backendContext->constantBufferSize[0]);
+                memcpy((uint8_t*)backendContext->constantBufferMem[0] + offset, job->cbs[currentRootConstantIndex].data, job->cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t));
+                backendContext->constantBufferCopiedBytes += job->cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t);
+            }
 
-            uint32_t first = backendContext->constantBufferOffset[0] / sizeof(FfxFloat32x4);
+            uint32_t first = offset / sizeof(FfxFloat32x4);
             uint32_t num = size / sizeof(FfxFloat32x4);
 
-            backendContext->deviceContext1->CSSetConstantBuffers1(currentRootConstantIndex, 1, &backendContext->constantBufferResource[0], &first, &num);
+            if (!(state.constantBufferKnownMask & (1u << currentRootConstantIndex)) ||
+                state.constantBuffers[currentRootConstantIndex] != backendContext->constantBufferResource[0] ||
+                state.constantBufferFirst[currentRootConstantIndex] != first ||
+                state.constantBufferNum[currentRootConstantIndex] != num) {
 
-            // update the offset
-            backendContext->constantBufferOffset[0] += size;
+                backendContext->deviceContext1->CSSetConstantBuffers1(currentRootConstantIndex, 1, &backendContext->constantBufferResource[0], &first, &num);
+                state.constantBufferKnownMask |= 1u << currentRootConstantIndex;
+                state.constantBuffers[currentRootConstantIndex] = backendContext->constantBufferResource[0];
+                state.constantBufferFirst[currentRootConstantIndex] = first;
+                state.constantBufferNum[currentRootConstantIndex] = num;
+            }
         }
     }
 
-    // bind UAVs
-    uint32_t countUav = maximumUav >= minimumUav ? maximumUav - minimumUav + 1 : 0;
-    if (countUav) {
-        dx11DeviceContext->CSSetUnorderedAccessViews(minimumUav, countUav, uavs + minimumUav, nullptr);
+    const uint32_t countUav = maximumUav >= minimumUav ? maximumUav - minimumUav + 1 : 0;
+    const uint32_t countSrv = maximumSrv >= minimumSrv ? maximumSrv - minimumSrv + 1 : 0;
+    auto boundByJob = [](ID3D11Resource* const* resources, uint32_t minimum, uint32_t count, const ID3D11Resource* resource) {
+        for (uint32_t slot = minimum; slot < minimum + count; ++slot)
+            if (resources[slot] == resource)
+                return true;
+        return false;
+    };
+
+    // unbind SRVs of resources this job writes, the runtime would force the UAVs to NULL otherwise
+    uint32_t changeBegin = UINT32_MAX;
+    uint32_t changeEnd = 0;
+    for (uint32_t slot = state.srvBegin; slot < state.srvEnd; ++slot) {
+
+        if (state.srvResources[slot] && boundByJob(uavResources, minimumUav, countUav, state.srvResources[slot])) {
+
+            state.srvs[slot] = nullptr;
+            state.srvResources[slot] = nullptr;
+            changeBegin = std::min(changeBegin, slot);
+            changeEnd = slot + 1;
+        }
     }
-
-    // bind SRVs
-    uint32_t countSrv = maximumSrv >= minimumSrv ? maximumSrv - minimumSrv + 1 : 0;
-    if (countSrv) {
-        dx11DeviceContext->CSSetShaderResources(minimumSrv, countSrv, srvs + minimumSrv);
+    if (changeBegin < changeEnd) {
+        dx11DeviceContext->CSSetShaderResources(changeBegin, changeEnd - changeBegin, state.srvs + changeBegin);
     }
 
-    // dispatch
-    dx11DeviceContext->Dispatch(job->computeJobDescriptor.dimensions[0], job->computeJobDescriptor.dimensions[1], job->computeJobDescriptor.dimensions[2]);
+    // bind UAVs, and unbind those left by previous jobs on resources this job reads
+    // a job without UAVs leaves minimumUav at UINT32_MAX, only the slots still bound are visited then
+    changeBegin = UINT32_MAX;
+    changeEnd = 0;
+    const uint32_t uavVisitBegin = countUav ? std::min(state.uavBegin, minimumUav) : state.uavBegin;
+    const uint32_t uavVisitEnd = countUav ? std::max(state.uavEnd, minimumUav + countUav) : state.uavEnd;
+    for (uint32_t slot = uavVisitBegin; slot < uavVisitEnd; ++slot) {
+
+        const bool jobSlot = slot >= minimumUav && slot < minimumUav + countUav;
+        ID3D11UnorderedAccessView* uav = jobSlot ? uavs[slot] : state.uavs[slot];
+        ID3D11Resource* resource = jobSlot ? uavResources[slot] : state.uavResources[slot];
+        if (!jobSlot && resource && boundByJob(srvResources, minimumSrv, countSrv, resource)) {
+            uav = nullptr;
+            resource = nullptr;
+        }
 
-    // unbind UAVs
-    static ID3D11UnorderedAccessView* const emptyUAVs[D3D11_1_UAV_SLOT_COUNT] = {};
-    if (countUav) {
-        dx11DeviceContext->CSSetUnorderedAccessViews(minimumUav, countUav, emptyUAVs, nullptr);
+        if (state.uavs[slot] != uav) {
+
+            state.uavs[slot] = uav;
+            changeBegin = std::min(changeBegin, slot);
+            changeEnd = slot + 1;
+        }
+        state.uavResources[slot] = resource;
+    }
+    if (changeBegin < changeEnd) {
+        dx11DeviceContext->CSSetUnorderedAccessViews(changeBegin, changeEnd - changeBegin, state.uavs + changeBegin, nullptr);
+        state.uavBegin = std::min(state.uavBegin, changeBegin);
+        state.uavEnd = std::max(state.uavEnd, changeEnd);
     }
 
-    // unbind SRVs
-    static ID3D11ShaderResourceView* const emptySRVs[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT] = {};
-    if (countSrv) {
-        dx11DeviceContext->CSSetShaderResources(minimumSrv, countSrv, emptySRVs);
+    // bind SRVs
+    changeBegin = UINT32_MAX;
+    changeEnd = 0;
+    for (uint32_t slot = minimumSrv; slot < minimumSrv + countSrv; ++slot) {
+
+        if (state.srvs[slot] != srvs[slot]) {
+
+            state.srvs[slot] = srvs[slot];
+            changeBegin = std::min(changeBegin, slot);
+            changeEnd = slot + 1;
+        }
+        state.srvResources[slot] = srvResources[slot];
     }
+    if (changeBegin < changeEnd) {
+        dx11DeviceContext->CSSetShaderResources(changeBegin, changeEnd - changeBegin, state.srvs + changeBegin);
+        state.srvBegin = std::min(state.srvBegin, changeBegin);
+        state.srvEnd = std::max(state.srvEnd, changeEnd);
+    }
+
+    // dispatch, views stay bound for the next job
+    dx11DeviceContext->Dispatch(job->dimensions[0], job->dimensions[1], job->dimensions[2]);
 
     return FFX_OK;
 }
 
-static FfxErrorCode executeGpuJobCopy(BackendContext_DX11* backendContext, FfxGpuJobDescription* job, ID3D11Device* dx11Device, ID3D11DeviceContext* dx11DeviceContext)
+static FfxErrorCode executeGpuJobCopy(BackendContext_DX11* backendContext, const CopyJob_DX11* job, ID3D11Device* dx11Device, ID3D11DeviceContext* dx11DeviceContext)
 {
     ID3D11Resource* dx11ResourceSrc = getDX11ResourcePtr(backendContext, job->copyJobDescriptor.src.internalIndex);
     ID3D11Resource* dx11ResourceDst = getDX11ResourcePtr(backendContext, job->copyJobDescriptor.dst.internalIndex);
@@ -2203,22 +3538,22 @@ static FfxErrorCode executeGpuJobCopy(BackendContext_DX11* backendContext, FfxGp
     return FFX_OK;
 }
 
-static FfxErrorCode executeGpuJobClearFloat(BackendContext_DX11* backendContext, FfxGpuJobDescription* job, ID3D11Device* dx11Device, ID3D11DeviceContext* dx11DeviceContext)
+static FfxErrorCode executeGpuJobClearFloat(BackendContext_DX11* backendContext, const ClearFloatJob_DX11* job, ID3D11Device* dx11Device, ID3D11DeviceContext* dx11DeviceContext)
 {
     uint32_t idx = job->clearJobDescriptor.target.internalIndex;
     BackendContext_DX11::Resource ffxResource = backendContext->pResources[idx];
 
     uint32_t clearColorAsUint[4];
-    clearColorAsUint[0] = reinterpret_cast<uint32_t&> (job->clearJobDescriptor.color[0]);
-    clearColorAsUint[1] = reinterpret_cast<uint32_t&> (job->clearJobDescriptor.color[1]);
-    clearColorAsUint[2] = reinterpret_cast<uint32_t&> (job->clearJobDescriptor.color[2]);
-    clearColorAsUint[3] = reinterpret_cast<uint32_t&> (job->clearJobDescriptor.color[3]);
+    clearColorAsUint[0] = reinterpret_cast<const uint32_t&> (job->clearJobDescriptor.color[0]);
+    clearColorAsUint[1] = reinterpret_cast<const uint32_t&> (job->clearJobDescriptor.color[1]);
+    clearColorAsUint[2] = reinterpret_cast<const uint32_t&> (job->clearJobDescriptor.color[2]);
+    clearColorAsUint[3] = reinterpret_cast<const uint32_t&> (job->clearJobDescriptor.color[3]);
     dx11DeviceContext->ClearUnorderedAccessViewUint(ffxResource.uavPtr[0], clearColorAsUint);
 
     return FFX_OK;
 }
 
-static FfxErrorCode executeGpuJobDiscard(BackendContext_DX11* backendContext, FfxGpuJobDescription* job, ID3D11Device* dx11Device, ID3D11DeviceContext* dx11DeviceContext)
+static FfxErrorCode executeGpuJobDiscard(BackendContext_DX11* backendContext, const DiscardJob_DX11* job, ID3D11Device* dx11Device, ID3D11DeviceContext* dx11DeviceContext)
 {
     uint32_t                            idx = job->discardJobDescriptor.target.internalIndex;
     BackendContext_DX11::Resource       ffxResource = backendContext->pResources[idx];
@@ -2241,32 +3576,38 @@ FfxErrorCode ExecuteGpuJobsDX11(
 
     FfxErrorCode errorCode = FFX_OK;
 
+    backendContext->executedGpuJobCount = backendContext->gpuJobCount;
+    backendContext->executedGpuJobSize = backendContext->gpuJobSize;
+    backendContext->maxExecutedGpuJobSize = FFX_MAXIMUM(backendContext->maxExecutedGpuJobSize, backendContext->gpuJobSize);
+
+    // nothing is known about the state the application left on the context
+    resetComputeStateDX11(&backendContext->computeState);
+
     // execute all GpuJobs
+    const uint8_t* gpuJobs = backendContext->pGpuJobs;
     for (uint32_t currentGpuJobIndex = 0; currentGpuJobIndex < backendContext->gpuJobCount; ++currentGpuJobIndex) {
 
-        FfxGpuJobDescription* GpuJob = &backendContext->pGpuJobs[currentGpuJobIndex];
+        const GpuJob_DX11* GpuJob = (const GpuJob_DX11*)gpuJobs;
+        gpuJobs += GpuJob->size;
         ID3D11Device* dx11Device = backendContext->device;
         ID3D11DeviceContext* dx11DeviceContext = backendContext->deviceContext;
 
         switch (GpuJob->jobType) {
 
             case FFX_GPU_JOB_CLEAR_FLOAT:
-                errorCode = executeGpuJobClearFloat(backendContext, GpuJob, dx11Device, dx11DeviceContext);
+                errorCode = executeGpuJobClearFloat(backendContext, (const ClearFloatJob_DX11*)GpuJob, dx11Device, dx11DeviceContext);
                 break;
 
             case FFX_GPU_JOB_COPY:
-                errorCode = executeGpuJobCopy(backendContext, GpuJob, dx11Device, dx11DeviceContext);
+                errorCode = executeGpuJobCopy(backendContext, (const CopyJob_DX11*)GpuJob, dx11Device, dx11DeviceContext);
                 break;
 
             case FFX_GPU_JOB_COMPUTE:
-                errorCode = executeGpuJobCompute(backendContext, GpuJob, dx11Device, dx11DeviceContext);
-                break;
-
-            case FFX_GPU_JOB_BARRIER:
+                errorCode = executeGpuJobCompute(backendContext, (const ComputeJob_DX11*)GpuJob, dx11Device, dx11DeviceContext);
                 break;
 
             case FFX_GPU_JOB_DISCARD:
-                errorCode = executeGpuJobDiscard(backendContext, GpuJob, dx11Device, dx11DeviceContext);
+                errorCode = executeGpuJobDiscard(backendContext, (const DiscardJob_DX11*)GpuJob, dx11Device, dx11DeviceContext);
                 break;
 
             default:
@@ -2274,12 +3615,15 @@ FfxErrorCode ExecuteGpuJobsDX11(
         }
     }
 
+    unbindComputeStateDX11(&backendContext->computeState, backendContext->deviceContext);
+
     // check the execute function returned cleanly.
     FFX_RETURN_ON_ERROR(
         errorCode == FFX_OK,
         FFX_ERROR_BACKEND_API_ERROR);
 
     backendContext->gpuJobCount = 0;
+    backendContext->gpuJobSize = 0;
 
     return FFX_OK;
 }
@@ -106,6 +106,187 @@ FFX_API FfxSurfaceFormat ffxGetSurfaceFormatDX11(DXGI_FORMAT format);
 
 FFX_API FfxResourceDescription GetFfxResourceDescriptionDX11(ID3D11Resource* pResource);
 
+/// A structure holding the counters of the process-wide DX11 pipeline cache.
+///
+/// Pipelines created from the same effect, pass and permutation share their
+/// patched bytecode and binding layout, and on the same device their shader object.
+///
+/// @ingroup DX11Backend
+typedef struct FfxPipelineCacheStatsDX11
+{
+    uint64_t    hitCount;           ///< Number of pipelines created from an already patched permutation.
+    uint64_t    missCount;          ///< Number of pipelines which had to patch and reflect their permutation.
+    uint64_t    shaderReuseCount;   ///< Number of pipelines which shared the shader object of a live pipeline.
+    uint64_t    loadedHitCount;     ///< Number of permutations first used from a serialized cache instead of being patched and reflected.
+    uint32_t    entryCount;         ///< Number of cached permutations.
+    uint32_t    activeEntryCount;   ///< Number of cached permutations used by live pipelines.
+    uint64_t    bytecodeSize;       ///< Total size in bytes of the bytecode patched at runtime, blobs patched offline are not copied.
+} FfxPipelineCacheStatsDX11;
+
+/// Query the counters of the DX11 pipeline cache.
+///
+/// @param [out] stats                      A pointer to a <c><i>FfxPipelineCacheStatsDX11</i></c> structure to fill in.
+///
+/// @ingroup DX11Backend
+FFX_API void ffxGetPipelineCacheStatsDX11(FfxPipelineCacheStatsDX11* stats);
+
+/// Free the cached permutations which are not used by any live pipeline.
+///
+/// Unused permutations are kept so that recreating a context does not patch
+/// its shaders again. Call this after destroying contexts to release that memory.
+///
+/// @ingroup DX11Backend
+FFX_API void ffxTrimPipelineCacheDX11();
+
+/// Serialize the DX11 pipeline cache so that a later launch can skip patching and reflecting its permutations.
+///
+/// Each permutation is stored with its binding layout, the checksum of its shader blob
+/// and the bytecode patched at runtime. Blobs patched offline are not copied.
+///
+/// @param [out] data                       A pointer to the memory receiving the cache, or <c><i>NULL</i></c> to query its size.
+/// @param [in,out] size                    The size in bytes of <c><i>data</i></c>, receives the size of the cache.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INSUFFICIENT_MEMORY           <c><i>data</i></c> is smaller than the cache, <c><i>size</i></c> receives the required size.
+///
+/// @ingroup DX11Backend
+FFX_API FfxErrorCode ffxSavePipelineCacheDX11(void* data, size_t* size);
+
+/// Add the permutations of a serialized DX11 pipeline cache to the pipeline cache.
+///
+/// The cache is rejected if it was saved by another SDK version or its checksum does not match.
+/// Loaded permutations are only used by pipelines whose shader blob has the stored checksum,
+/// so a cache saved with other shader blobs is harmless. Call this before creating contexts.
+///
+/// @param [in] data                        A pointer to a cache written by <c><i>ffxSavePipelineCacheDX11</i></c>.
+/// @param [in] size                        The size in bytes of <c><i>data</i></c>.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_VERSION               The cache was saved by another version or build configuration of the SDK.
+/// @retval
+/// FFX_ERROR_MALFORMED_DATA                The cache is corrupt, nothing was loaded.
+///
+/// @ingroup DX11Backend
+FFX_API FfxErrorCode ffxLoadPipelineCacheDX11(const void* data, size_t size);
+
+/// Write the DX11 pipeline cache to a file, see <c><i>ffxSavePipelineCacheDX11</i></c>.
+///
+/// @param [in] path                        The path of the file to write.
+///
+/// @ingroup DX11Backend
+FFX_API FfxErrorCode ffxSavePipelineCacheFileDX11(const wchar_t* path);
+
+/// Load a DX11 pipeline cache from a file, see <c><i>ffxLoadPipelineCacheDX11</i></c>.
+///
+/// @param [in] path                        The path of the file to read.
+///
+/// @ingroup DX11Backend
+FFX_API FfxErrorCode ffxLoadPipelineCacheFileDX11(const wchar_t* path);
+
+/// A structure with the counters of the DX11 view cache.
+///
+/// Views of the resources a DX11 backend created and an effect context registers
+/// each frame, such as those one effect shares with another, are cached by
+/// resource and view description, so they survive being registered in a
+/// different order or in a different slot. A new frame starts when an effect
+/// context registers resources again, so the effect contexts dispatched in one
+/// application frame share it. Views of a resource which is not registered for
+/// two frames are released. Resources of the application are not cached, their
+/// views are released by <c><i>UnregisterResources</i></c>.
+///
+/// @ingroup DX11Backend
+typedef struct FfxViewCacheStatsDX11
+{
+    uint32_t    frameHitCount;      ///< Number of views found in the cache during the last completed frame.
+    uint32_t    frameMissCount;     ///< Number of views created during the last completed frame.
+    uint64_t    hitCount;           ///< Total number of views found in the cache.
+    uint64_t    missCount;          ///< Total number of views created.
+    uint64_t    evictionCount;      ///< Number of views released because they aged out or the cache was full.
+    uint32_t    entryCount;         ///< Number of cached views.
+} FfxViewCacheStatsDX11;
+
+/// Query the counters of the view cache of a DX11 backend interface.
+///
+/// @param [in] backendInterface            A pointer to the backend interface.
+/// @param [out] stats                      A pointer to a <c><i>FfxViewCacheStatsDX11</i></c> structure to fill in.
+///
+/// @ingroup DX11Backend
+FFX_API void ffxGetViewCacheStatsDX11(FfxInterface* backendInterface, FfxViewCacheStatsDX11* stats);
+
+/// Release every cached view of a DX11 backend interface.
+///
+/// Only views of resources created by a DX11 backend are cached, so the backend
+/// holds no reference on a resource of the application once it is unregistered.
+/// Flushing releases the views of shared resources which would otherwise stay
+/// alive until they have not been registered for two frames.
+///
+/// @param [in] backendInterface            A pointer to the backend interface.
+///
+/// @ingroup DX11Backend
+FFX_API void ffxFlushViewCacheDX11(FfxInterface* backendInterface);
+
+/// A structure with the counters of the DX11 constant buffer uploads.
+///
+/// On Direct3D 11.1 constants are staged straight into a persistently mapped
+/// ring and each job binds its offset, so every staged byte is copied once and
+/// executing jobs takes no lock. Direct3D 11.0 copies staged constants again
+/// into a buffer mapped with <c><i>D3D11_MAP_WRITE_DISCARD</i></c> for every job,
+/// under one lock per job.
+///
+/// Constant blocks of up to 256 bytes with the same contents as a recently
+/// staged one are not uploaded again: Direct3D 11.1 binds the earlier region of
+/// the ring while it is still live, Direct3D 11.0 skips the map when the buffer
+/// already holds them. The contents are compared byte for byte before reuse.
+/// Direct3D 11.1 stages without taking a lock, Direct3D 11.0 takes one for each
+/// compute job it executes.
+///
+/// @ingroup DX11Backend
+typedef struct FfxConstantBufferStatsDX11
+{
+    uint64_t    stagedBytes;        ///< Number of bytes handed to the backend by the effects.
+    uint64_t    copiedBytes;        ///< Number of bytes copied by the backend, including the staging copy.
+    uint64_t    allocationCount;    ///< Number of regions allocated in the Direct3D 11.1 ring.
+    uint64_t    mapCount;           ///< Number of constant buffers mapped by the Direct3D 11.0 path.
+    uint64_t    wrapCount;          ///< Number of times the Direct3D 11.1 ring wrapped around.
+    uint64_t    reusedCount;        ///< Number of constant blocks bound without being uploaded again.
+    uint64_t    reusedBytes;        ///< Number of bytes not uploaded again thanks to reuse.
+    uint64_t    lockCount;          ///< Number of constant buffer locks taken while executing jobs on Direct3D 11.0.
+} FfxConstantBufferStatsDX11;
+
+/// Query the counters of the constant buffer uploads of a DX11 backend interface.
+///
+/// @param [in] backendInterface            A pointer to the backend interface.
+/// @param [out] stats                      A pointer to a <c><i>FfxConstantBufferStatsDX11</i></c> structure to fill in.
+///
+/// @ingroup DX11Backend
+FFX_API void ffxGetConstantBufferStatsDX11(FfxInterface* backendInterface, FfxConstantBufferStatsDX11* stats);
+
+/// A structure with the sizes of the GPU jobs recorded by a DX11 backend interface.
+///
+/// Scheduled jobs are not kept as <c><i>FfxGpuJobDescription</i></c> copies but as
+/// variable-length records holding only what the execution reads: the pipeline,
+/// the dispatch dimensions, the constant buffers and the bindings actually used.
+///
+/// @ingroup DX11Backend
+typedef struct FfxGpuJobStatsDX11
+{
+    uint32_t    jobCount;           ///< Number of jobs run by the last execution.
+    uint32_t    recordSize;         ///< Size in bytes of the records run by the last execution.
+    uint32_t    maxRecordSize;      ///< Largest size in bytes of the records run by one execution.
+} FfxGpuJobStatsDX11;
+
+/// Query the sizes of the GPU jobs recorded by a DX11 backend interface.
+///
+/// @param [in] backendInterface            A pointer to the backend interface.
+/// @param [out] stats                      A pointer to a <c><i>FfxGpuJobStatsDX11</i></c> structure to fill in.
+///
+/// @ingroup DX11Backend
+FFX_API void ffxGetGpuJobStatsDX11(FfxInterface* backendInterface, FfxGpuJobStatsDX11* stats);
+
 #if defined(__cplusplus)
 }
 #endif // #if defined(__cplusplus)
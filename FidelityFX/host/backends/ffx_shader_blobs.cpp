@@ -98,9 +98,245 @@
 #include "blob_accessors/ffx_brixelizergi_shaderblobs.h"
 #endif  // #if defined(FFX_BRIXELIZER_GI) || defined(FFX_ALL)
 
+#if defined(FFX_FSR1) || defined(FFX_ALL)
+#include "fsr1/ffx_fsr1_private.h"
+#endif // #if defined(FFX_FSR1) || defined(FFX_ALL)
+
+#if defined(FFX_FSR2) || defined(FFX_ALL)
+#include "fsr2/ffx_fsr2_private.h"
+#endif // #if defined(FFX_FSR2) || defined(FFX_ALL)
+
+#if defined(FFX_FSR3UPSCALER) || defined(FFX_ALL)
+#include "fsr3upscaler/ffx_fsr3upscaler_private.h"
+#endif // #if defined(FFX_FSR3UPSCALER) || defined(FFX_ALL)
+
+#if defined(FFX_FI) || defined(FFX_ALL)
+#include "frameinterpolation/ffx_frameinterpolation_private.h"
+#endif // #if defined(FFX_FI) || defined(FFX_ALL)
+
+#if defined(FFX_OF) || defined(FFX_ALL)
+#include "opticalflow/ffx_opticalflow_private.h"
+#endif // #if defined(FFX_OF) || defined(FFX_ALL)
+
+#if defined(FFX_SPD) || defined(FFX_ALL)
+#include "spd/ffx_spd_private.h"
+#endif // #if defined(FFX_SPD) || defined(FFX_ALL)
+
+#if defined(FFX_CAS) || defined(FFX_ALL)
+#include "cas/ffx_cas_private.h"
+#endif // #if defined(FFX_CAS) || defined(FFX_ALL)
+
+#if defined(FFX_BLUR) || defined(FFX_ALL)
+#include "blur/ffx_blur_private.h"
+#endif // #if defined(FFX_BLUR) || defined(FFX_ALL)
+
+#include <FidelityFX/host/ffx_util.h>
+#include <DXBC/DXBCCompress.h>
+#include <windows.h>
+#include <stdio.h>
+#include <wchar.h>
 #include <string.h> // for memset
+#include <algorithm>
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Blobs built with ffx_dxbc_patch -compress are decompressed on first use into a cache shared by every effect.
+// A blob stays pinned until ffxReleasePermutationBlob, unpinned blobs are evicted least recently used first.
+typedef struct DecompressedBlob {
+
+    const uint8_t*  source;
+    uint8_t*        data;
+    uint32_t        size;
+    uint32_t        pinCount;
+
+} DecompressedBlob;
+
+typedef std::list<DecompressedBlob>::iterator DecompressedBlobIterator;
+
+static std::mutex                                                   s_BlobCacheMutex;
+static std::list<DecompressedBlob>                                  s_BlobCache;            // most recently used first
+static std::unordered_map<const uint8_t*, DecompressedBlobIterator> s_BlobCacheBySource;
+static std::unordered_map<const uint8_t*, DecompressedBlobIterator> s_BlobCacheByData;
+static size_t                                                       s_BlobCacheBudget = FFX_PERMUTATION_BLOB_CACHE_DEFAULT_BUDGET;
+static FfxPermutationBlobCacheStats                                 s_BlobCacheStats = {};
+
+// .ffxpack files hold a header, an index per effect and the blobs, each blob starts on its own page
+// so mapping a pack only faults in the permutations in use
+#define FFX_PERMUTATION_PACK_MAGIC      0x4B505846  // 'FXPK'
+#define FFX_PERMUTATION_PACK_VERSION    2
+#define FFX_PERMUTATION_PACK_ALIGNMENT  4096
+
+typedef struct PermutationPackHeader {
+
+    uint32_t    magic;
+    uint32_t    version;
+    uint32_t    sdkVersion;         // the reflection of pack blobs comes from the compiled in tables
+    uint32_t    effectCount;
+    uint32_t    entryCount;
+    uint32_t    blobCount;
+    uint64_t    size;               // of the whole file
+
+} PermutationPackHeader;
+
+typedef struct PermutationPackEffect {
+
+    uint32_t    effect;
+    uint32_t    firstEntry;
+    uint32_t    entryCount;
+    uint32_t    reserved;
+
+} PermutationPackEffect;
+
+// entries of an effect are sorted by pass, stage then permutation options, entries may share a blob.
+// The bytecode is only served when it still matches its checksum and the compiled in reflection it
+// is paired with is the one it was packed with.
+typedef struct PermutationPackEntry {
+
+    uint32_t    pass;
+    uint32_t    stage;
+    uint32_t    permutationOptions;
+    uint32_t    size;
+    uint64_t    offset;
+    uint64_t    checksum;           // of the bytecode
+    uint64_t    reflectionHash;     // of the compiled in reflection of the module the pack was written from
+
+} PermutationPackEntry;
+
+typedef struct PermutationPack {
+
+    HANDLE                          file;
+    HANDLE                          mapping;
+    const uint8_t*                  data;
+    uint64_t                        size;
+    const PermutationPackEffect*    effects;
+    const PermutationPackEntry*     entries;
+    uint32_t                        effectCount;
+    uint32_t                        pinCount;       // blobs served and not yet released
+    std::unordered_set<uint64_t>    servedBlobs;    // offsets of the blobs whose checksum was verified
+    FfxPermutationPackStats         stats;
+
+} PermutationPack;
+
+static std::mutex       s_PermutationPackMutex;
+static PermutationPack* s_PermutationPack = nullptr;
+
+static void evictDecompressedBlobs()
+{
+    for (auto blob = s_BlobCache.end(); blob != s_BlobCache.begin() && s_BlobCacheStats.cachedBytes > s_BlobCacheBudget;)
+    {
+        --blob;
+        if (blob->pinCount)
+            continue;
+
+        s_BlobCacheStats.cachedBytes -= blob->size;
+        s_BlobCacheStats.cachedCount--;
+        s_BlobCacheStats.evictionCount++;
+        s_BlobCacheBySource.erase(blob->source);
+        s_BlobCacheByData.erase(blob->data);
+        delete[] blob->data;
+        blob = s_BlobCache.erase(blob);
+    }
+}
 
-FfxErrorCode ffxGetPermutationBlobByIndex(
+// swap a compressed blob for its decompressed bytes and pin them
+static FfxErrorCode acquireDecompressedBlob(FfxShaderBlob* blob)
+{
+    const uint32_t size = blob->data ? GetDXBCDecompressedSize(blob->data, blob->size) : 0;
+    if (size == 0)
+        return FFX_OK;
+
+    std::lock_guard<std::mutex> cacheLock{ s_BlobCacheMutex };
+
+    auto found = s_BlobCacheBySource.find(blob->data);
+    if (found != s_BlobCacheBySource.end())
+    {
+        DecompressedBlobIterator cached = found->second;
+        s_BlobCache.splice(s_BlobCache.begin(), s_BlobCache, cached);
+        cached->pinCount++;
+        s_BlobCacheStats.hitCount++;
+        blob->data = cached->data;
+    }
+    else
+    {
+        const auto start = std::chrono::steady_clock::now();
+        uint8_t* data = new uint8_t[size];
+        if (!DecompressDXBC(blob->data, blob->size, data, size))
+        {
+            delete[] data;
+            return FFX_ERROR_MALFORMED_DATA;
+        }
+        s_BlobCacheStats.decompressTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        s_BlobCacheStats.decompressCount++;
+        s_BlobCacheStats.decompressedBytes += size;
+        s_BlobCacheStats.cachedBytes += size;
+        s_BlobCacheStats.cachedCount++;
+
+        s_BlobCache.push_front({ blob->data, data, size, 1 });
+        s_BlobCacheBySource[blob->data] = s_BlobCache.begin();
+        s_BlobCacheByData[data] = s_BlobCache.begin();
+        blob->data = data;
+        evictDecompressedBlobs();
+    }
+
+    // the accessors fill FfxShaderBlob by aggregate initialization, its size is const
+    memcpy((void*)&blob->size, &size, sizeof(size));
+    return FFX_OK;
+}
+
+void ffxReleasePermutationBlob(const uint8_t* data)
+{
+    if (!data)
+        return;
+
+    {
+        std::lock_guard<std::mutex> packLock{ s_PermutationPackMutex };
+
+        PermutationPack* pack = s_PermutationPack;
+        if (pack && data >= pack->data && data < pack->data + pack->size)
+        {
+            FFX_ASSERT(pack->pinCount > 0);
+            pack->pinCount--;
+            return;
+        }
+    }
+
+    std::lock_guard<std::mutex> cacheLock{ s_BlobCacheMutex };
+
+    // blobs compiled in uncompressed are not cached
+    auto found = s_BlobCacheByData.find(data);
+    if (found == s_BlobCacheByData.end())
+        return;
+
+    FFX_ASSERT(found->second->pinCount > 0);
+    if (--found->second->pinCount == 0)
+        evictDecompressedBlobs();
+}
+
+FFX_API void ffxSetPermutationBlobCacheBudget(size_t budget)
+{
+    std::lock_guard<std::mutex> cacheLock{ s_BlobCacheMutex };
+
+    s_BlobCacheBudget = budget;
+    evictDecompressedBlobs();
+}
+
+FFX_API void ffxGetPermutationBlobCacheStats(FfxPermutationBlobCacheStats* stats)
+{
+    FFX_ASSERT(stats != nullptr);
+
+    std::lock_guard<std::mutex> cacheLock{ s_BlobCacheMutex };
+
+    *stats = s_BlobCacheStats;
+    stats->pinnedCount = 0;
+    for (const DecompressedBlob& blob : s_BlobCache)
+        stats->pinnedCount += blob.pinCount ? 1 : 0;
+}
+
+static FfxErrorCode getPermutationBlobByIndex(
     FfxEffect effectId,
     FfxPass passId,
     FfxBindStage stageId,
@@ -222,6 +458,454 @@ FfxErrorCode ffxGetPermutationBlobByIndex(
     return FFX_OK;
 }
 
+// FNV-1a
+static uint64_t hashPermutationPackBytes(uint64_t hash, const void* bytes, size_t count)
+{
+    for (size_t byteIndex = 0; byteIndex < count; ++byteIndex)
+        hash = (hash ^ static_cast<const uint8_t*>(bytes)[byteIndex]) * 1099511628211ull;
+    return hash;
+}
+
+static uint64_t hashPermutationPackBindings(uint64_t hash, uint32_t count, const char** names, const uint32_t* bindings, const uint32_t* counts, const uint32_t* spaces)
+{
+    hash = hashPermutationPackBytes(hash, &count, sizeof(count));
+    for (uint32_t index = 0; index < count; ++index)
+    {
+        if (names && names[index])
+            hash = hashPermutationPackBytes(hash, names[index], strlen(names[index]) + 1);
+        if (bindings)
+            hash = hashPermutationPackBytes(hash, &bindings[index], sizeof(uint32_t));
+        if (counts)
+            hash = hashPermutationPackBytes(hash, &counts[index], sizeof(uint32_t));
+        if (spaces)
+            hash = hashPermutationPackBytes(hash, &spaces[index], sizeof(uint32_t));
+    }
+    return hash;
+}
+
+// the names, slots, counts and spaces of every binding the backends build their layout from
+static uint64_t hashPermutationReflection(const FfxShaderBlob& blob)
+{
+    uint64_t hash = 14695981039346656037ull;
+    hash = hashPermutationPackBindings(hash, blob.cbvCount, blob.boundConstantBufferNames, blob.boundConstantBuffers, blob.boundConstantBufferCounts, blob.boundConstantBufferSpaces);
+    hash = hashPermutationPackBindings(hash, blob.srvTextureCount, blob.boundSRVTextureNames, blob.boundSRVTextures, blob.boundSRVTextureCounts, blob.boundSRVTextureSpaces);
+    hash = hashPermutationPackBindings(hash, blob.uavTextureCount, blob.boundUAVTextureNames, blob.boundUAVTextures, blob.boundUAVTextureCounts, blob.boundUAVTextureSpaces);
+    hash = hashPermutationPackBindings(hash, blob.srvBufferCount, blob.boundSRVBufferNames, blob.boundSRVBuffers, blob.boundSRVBufferCounts, blob.boundSRVBufferSpaces);
+    hash = hashPermutationPackBindings(hash, blob.uavBufferCount, blob.boundUAVBufferNames, blob.boundUAVBuffers, blob.boundUAVBufferCounts, blob.boundUAVBufferSpaces);
+    hash = hashPermutationPackBindings(hash, blob.samplerCount, blob.boundSamplerNames, blob.boundSamplers, blob.boundSamplerCounts, blob.boundSamplerSpaces);
+    hash = hashPermutationPackBindings(hash, blob.rtAccelStructCount, blob.boundRTAccelerationStructureNames, blob.boundRTAccelerationStructures,
+                                       blob.boundRTAccelerationStructureCounts, blob.boundRTAccelerationStructureSpaces);
+    return hash;
+}
+
+static uint64_t hashPermutationBytecode(const uint8_t* data, uint32_t size)
+{
+    return hashPermutationPackBytes(14695981039346656037ull, data, size);
+}
+
+static bool lessPermutationPackEntry(const PermutationPackEntry& entry, const PermutationPackEntry& other)
+{
+    if (entry.pass != other.pass)
+        return entry.pass < other.pass;
+    if (entry.stage != other.stage)
+        return entry.stage < other.stage;
+    return entry.permutationOptions < other.permutationOptions;
+}
+
+// serve the bytecode from the loaded pack and pin it, the reflection stays the one of the compiled in tables.
+// An entry packed against other reflection, or whose bytes were damaged, is left for the compiled in blob.
+static bool acquirePackedBlob(FfxEffect effectId, FfxPass passId, FfxBindStage stageId, uint32_t permutationOptions, FfxShaderBlob* blob)
+{
+    std::lock_guard<std::mutex> packLock{ s_PermutationPackMutex };
+
+    PermutationPack* pack = s_PermutationPack;
+    if (!pack)
+        return false;
+
+    for (uint32_t effectIndex = 0; effectIndex < pack->effectCount; ++effectIndex)
+    {
+        const PermutationPackEffect& effect = pack->effects[effectIndex];
+        if (effect.effect != uint32_t(effectId))
+            continue;
+
+        const PermutationPackEntry key = { passId, uint32_t(stageId), permutationOptions };
+        const PermutationPackEntry* first = pack->entries + effect.firstEntry;
+        const PermutationPackEntry* last = first + effect.entryCount;
+        const PermutationPackEntry* entry = std::lower_bound(first, last, key, lessPermutationPackEntry);
+        if (entry == last || lessPermutationPackEntry(key, *entry))
+            return false;
+
+        if (entry->reflectionHash != hashPermutationReflection(*blob))
+        {
+            wchar_t message[128];
+            swprintf(message, 128, L"Permutation 0x%x of pass %u of effect %u in the pack does not match this build's bindings", permutationOptions, passId, uint32_t(effectId));
+            FFX_PRINT_MESSAGE(FFX_MESSAGE_TYPE_WARNING, message);
+            pack->stats.rejectedCount++;
+            return false;
+        }
+
+        // the checksum is verified the first time a blob is served, which is also when its pages are read
+        if (pack->servedBlobs.find(entry->offset) == pack->servedBlobs.end())
+        {
+            if (entry->checksum != hashPermutationBytecode(pack->data + entry->offset, entry->size))
+            {
+                wchar_t message[128];
+                swprintf(message, 128, L"Permutation 0x%x of pass %u of effect %u in the pack is damaged", permutationOptions, passId, uint32_t(effectId));
+                FFX_PRINT_MESSAGE(FFX_MESSAGE_TYPE_WARNING, message);
+                pack->stats.rejectedCount++;
+                return false;
+            }
+            pack->servedBlobs.insert(entry->offset);
+            pack->stats.servedCount++;
+            pack->stats.servedBytes += FFX_ALIGN_UP(uint64_t(entry->size), uint64_t(FFX_PERMUTATION_PACK_ALIGNMENT));
+        }
+
+        blob->data = pack->data + entry->offset;
+        memcpy((void*)&blob->size, &entry->size, sizeof(entry->size));
+        pack->pinCount++;
+        return true;
+    }
+
+    return false;
+}
+
+FfxErrorCode ffxGetPermutationBlobByIndex(
+    FfxEffect effectId,
+    FfxPass passId,
+    FfxBindStage stageId,
+    uint32_t permutationOptions,
+    FfxShaderBlob* outBlob)
+{
+    FfxErrorCode errorCode = getPermutationBlobByIndex(effectId, passId, stageId, permutationOptions, outBlob);
+    if (errorCode != FFX_OK)
+        return errorCode;
+
+    if (acquirePackedBlob(effectId, passId, stageId, permutationOptions, outBlob))
+        return FFX_OK;
+
+    // the permutation manifest of the build left this blob out
+    if (!outBlob->data)
+    {
+        wchar_t message[128];
+        swprintf(message, 128, L"Permutation 0x%x of pass %u of effect %u is not in ffx_permutation_manifest.h", permutationOptions, passId, uint32_t(effectId));
+        FFX_PRINT_MESSAGE(FFX_MESSAGE_TYPE_ERROR, message);
+        return FFX_ERROR_INVALID_ARGUMENT;
+    }
+
+    return acquireDecompressedBlob(outBlob);
+}
+
+static void unmapPermutationPack(PermutationPack* pack)
+{
+    if (pack->data)
+        UnmapViewOfFile(pack->data);
+    if (pack->mapping)
+        CloseHandle(pack->mapping);
+    if (pack->file != INVALID_HANDLE_VALUE)
+        CloseHandle(pack->file);
+    delete pack;
+}
+
+static FfxErrorCode mapPermutationPack(const wchar_t* path, PermutationPack* pack)
+{
+    pack->file = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    FFX_RETURN_ON_ERROR(pack->file != INVALID_HANDLE_VALUE, FFX_ERROR_INVALID_PATH);
+
+    LARGE_INTEGER fileSize = {};
+    FFX_RETURN_ON_ERROR(GetFileSizeEx(pack->file, &fileSize), FFX_ERROR_INVALID_PATH);
+    FFX_RETURN_ON_ERROR(uint64_t(fileSize.QuadPart) >= sizeof(PermutationPackHeader) && uint64_t(fileSize.QuadPart) <= SIZE_MAX, FFX_ERROR_MALFORMED_DATA);
+    pack->size = uint64_t(fileSize.QuadPart);
+
+    pack->mapping = CreateFileMappingW(pack->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    FFX_RETURN_ON_ERROR(pack->mapping, FFX_ERROR_OUT_OF_MEMORY);
+    pack->data = (const uint8_t*)MapViewOfFile(pack->mapping, FILE_MAP_READ, 0, 0, 0);
+    FFX_RETURN_ON_ERROR(pack->data, FFX_ERROR_OUT_OF_MEMORY);
+
+    return FFX_OK;
+}
+
+// only the header and the index are read, blob pages are left untouched until served
+static FfxErrorCode validatePermutationPack(PermutationPack* pack)
+{
+    PermutationPackHeader header;
+    memcpy(&header, pack->data, sizeof(header));
+    FFX_RETURN_ON_ERROR(header.magic == FFX_PERMUTATION_PACK_MAGIC && header.size == pack->size, FFX_ERROR_MALFORMED_DATA);
+    FFX_RETURN_ON_ERROR(header.version == FFX_PERMUTATION_PACK_VERSION, FFX_ERROR_INVALID_VERSION);
+    FFX_RETURN_ON_ERROR(header.sdkVersion == FFX_SDK_MAKE_VERSION(FFX_SDK_VERSION_MAJOR, FFX_SDK_VERSION_MINOR, FFX_SDK_VERSION_PATCH), FFX_ERROR_INVALID_VERSION);
+
+    const uint64_t indexSize = uint64_t(header.effectCount) * sizeof(PermutationPackEffect) + uint64_t(header.entryCount) * sizeof(PermutationPackEntry);
+    FFX_RETURN_ON_ERROR(indexSize <= pack->size - sizeof(header), FFX_ERROR_MALFORMED_DATA);
+    pack->effects = (const PermutationPackEffect*)(pack->data + sizeof(header));
+    pack->entries = (const PermutationPackEntry*)(pack->effects + header.effectCount);
+    pack->effectCount = header.effectCount;
+    pack->stats.fileBytes = pack->size;
+    pack->stats.indexBytes = sizeof(header) + indexSize;
+
+    for (uint32_t effectIndex = 0; effectIndex < header.effectCount; ++effectIndex)
+    {
+        const PermutationPackEffect& effect = pack->effects[effectIndex];
+        FFX_RETURN_ON_ERROR(effect.firstEntry <= header.entryCount && effect.entryCount <= header.entryCount - effect.firstEntry, FFX_ERROR_MALFORMED_DATA);
+
+        for (uint32_t entryIndex = effect.firstEntry; entryIndex < effect.firstEntry + effect.entryCount; ++entryIndex)
+        {
+            const PermutationPackEntry& entry = pack->entries[entryIndex];
+            FFX_RETURN_ON_ERROR(entry.offset % FFX_PERMUTATION_PACK_ALIGNMENT == 0 && entry.offset >= sizeof(header) + indexSize &&
+                                entry.offset <= pack->size && entry.size <= pack->size - entry.offset && entry.size != 0,
+                                FFX_ERROR_MALFORMED_DATA);
+            FFX_RETURN_ON_ERROR(entryIndex == effect.firstEntry || lessPermutationPackEntry(pack->entries[entryIndex - 1], entry), FFX_ERROR_MALFORMED_DATA);
+        }
+    }
+
+    return FFX_OK;
+}
+
+FFX_API FfxErrorCode ffxLoadPermutationPack(const wchar_t* path)
+{
+    FFX_RETURN_ON_ERROR(path, FFX_ERROR_INVALID_POINTER);
+
+    const auto start = std::chrono::steady_clock::now();
+    PermutationPack* pack = new PermutationPack();
+    pack->file = INVALID_HANDLE_VALUE;
+    FfxErrorCode errorCode = mapPermutationPack(path, pack);
+    if (errorCode == FFX_OK)
+        errorCode = validatePermutationPack(pack);
+    pack->stats.loadTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    if (errorCode == FFX_OK)
+    {
+        std::lock_guard<std::mutex> packLock{ s_PermutationPackMutex };
+
+        // blobs of the current pack may still back live pipelines
+        if (s_PermutationPack && s_PermutationPack->pinCount)
+        {
+            errorCode = FFX_ERROR_ACCESS_DENIED;
+        }
+        else
+        {
+            std::swap(pack, s_PermutationPack);
+        }
+    }
+
+    if (pack)
+        unmapPermutationPack(pack);
+    return errorCode;
+}
+
+FFX_API FfxErrorCode ffxUnloadPermutationPack()
+{
+    std::lock_guard<std::mutex> packLock{ s_PermutationPackMutex };
+
+    if (!s_PermutationPack)
+        return FFX_OK;
+    FFX_RETURN_ON_ERROR(s_PermutationPack->pinCount == 0, FFX_ERROR_ACCESS_DENIED);
+
+    unmapPermutationPack(s_PermutationPack);
+    s_PermutationPack = nullptr;
+    return FFX_OK;
+}
+
+FFX_API void ffxGetPermutationPackStats(FfxPermutationPackStats* stats)
+{
+    if (!stats)
+        return;
+
+    std::lock_guard<std::mutex> packLock{ s_PermutationPackMutex };
+    *stats = s_PermutationPack ? s_PermutationPack->stats : FfxPermutationPackStats{};
+}
+
+// the permutation options each effect's tables are indexed with, every flag is independent
+// and each group selects exactly one of its flags
+typedef struct PermutationSpace {
+
+    FfxEffect   effect;
+    uint32_t    passCount;
+    uint32_t    skippedPasses;      // passes without shaders
+    uint32_t    flags;
+    uint32_t    groups[2];
+
+} PermutationSpace;
+
+static const PermutationSpace s_PermutationSpaces[] = {
+#if defined(FFX_FSR1) || defined(FFX_ALL)
+    { FFX_EFFECT_FSR1, FFX_FSR1_PASS_COUNT, 0,
+      FSR1_SHADER_PERMUTATION_APPLY_RCAS | FSR1_SHADER_PERMUTATION_RCAS_PASSTHROUGH_ALPHA | FSR1_SHADER_PERMUTATION_SRGB_CONVERSIONS |
+      FSR1_SHADER_PERMUTATION_FORCE_WAVE64 | FSR1_SHADER_PERMUTATION_ALLOW_FP16 },
+#endif // #if defined(FFX_FSR1) || defined(FFX_ALL)
+#if defined(FFX_FSR2) || defined(FFX_ALL)
+    { FFX_EFFECT_FSR2, FFX_FSR2_PASS_COUNT, 0,
+      FSR2_SHADER_PERMUTATION_USE_LANCZOS_TYPE | FSR2_SHADER_PERMUTATION_HDR_COLOR_INPUT | FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS |
+      FSR2_SHADER_PERMUTATION_JITTER_MOTION_VECTORS | FSR2_SHADER_PERMUTATION_DEPTH_INVERTED | FSR2_SHADER_PERMUTATION_ENABLE_SHARPENING |
+      FSR2_SHADER_PERMUTATION_FORCE_WAVE64 | FSR2_SHADER_PERMUTATION_ALLOW_FP16 },
+#endif // #if defined(FFX_FSR2) || defined(FFX_ALL)
+#if defined(FFX_FSR3UPSCALER) || defined(FFX_ALL)
+    { FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_COUNT, 1u << FFX_FSR3UPSCALER_PASS_TCR_AUTOGENERATE,
+      FSR3UPSCALER_SHADER_PERMUTATION_USE_LANCZOS_TYPE | FSR3UPSCALER_SHADER_PERMUTATION_HDR_COLOR_INPUT | FSR3UPSCALER_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS |
+      FSR3UPSCALER_SHADER_PERMUTATION_JITTER_MOTION_VECTORS | FSR3UPSCALER_SHADER_PERMUTATION_DEPTH_INVERTED | FSR3UPSCALER_SHADER_PERMUTATION_ENABLE_SHARPENING |
+      FSR3UPSCALER_SHADER_PERMUTATION_FORCE_WAVE64 | FSR3UPSCALER_SHADER_PERMUTATION_ALLOW_FP16 },
+#endif // #if defined(FFX_FSR3UPSCALER) || defined(FFX_ALL)
+#if defined(FFX_FI) || defined(FFX_ALL)
+    { FFX_EFFECT_FRAMEINTERPOLATION, FFX_FRAMEINTERPOLATION_PASS_COUNT, 0,
+      FRAMEINTERPOLATION_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS | FRAMEINTERPOLATION_SHADER_PERMUTATION_JITTER_MOTION_VECTORS |
+      FRAMEINTERPOLATION_SHADER_PERMUTATION_DEPTH_INVERTED | FRAMEINTERPOLATION_SHADER_PERMUTATION_FORCE_WAVE64 | FRAMEINTERPOLATION_SHADER_PERMUTATION_ALLOW_FP16 },
+#endif // #if defined(FFX_FI) || defined(FFX_ALL)
+#if defined(FFX_OF) || defined(FFX_ALL)
+    { FFX_EFFECT_OPTICALFLOW, FFX_OPTICALFLOW_PASS_COUNT, 0,
+      OPTICALFLOW_SHADER_PERMUTATION_FORCE_WAVE64 | OPTICALFLOW_SHADER_PERMUTATION_ALLOW_FP16 },
+#endif // #if defined(FFX_OF) || defined(FFX_ALL)
+#if defined(FFX_SPD) || defined(FFX_ALL)
+    { FFX_EFFECT_SPD, FFX_SPD_PASS_COUNT, 0,
+      SPD_SHADER_PERMUTATION_LINEAR_SAMPLE | SPD_SHADER_PERMUTATION_WAVE_INTEROP_LDS | SPD_SHADER_PERMUTATION_FORCE_WAVE64 | SPD_SHADER_PERMUTATION_ALLOW_FP16,
+      { SPD_SHADER_PERMUTATION_DOWNSAMPLE_FILTER_MEAN | SPD_SHADER_PERMUTATION_DOWNSAMPLE_FILTER_MIN | SPD_SHADER_PERMUTATION_DOWNSAMPLE_FILTER_MAX } },
+#endif // #if defined(FFX_SPD) || defined(FFX_ALL)
+#if defined(FFX_CAS) || defined(FFX_ALL)
+    { FFX_EFFECT_CAS, FFX_CAS_PASS_COUNT, 0,
+      CAS_SHADER_PERMUTATION_SHARPEN_ONLY | CAS_SHADER_PERMUTATION_FORCE_WAVE64 | CAS_SHADER_PERMUTATION_ALLOW_FP16,
+      { CAS_SHADER_PERMUTATION_COLOR_SPACE_LINEAR | CAS_SHADER_PERMUTATION_COLOR_SPACE_GAMMA20 | CAS_SHADER_PERMUTATION_COLOR_SPACE_GAMMA22 |
+        CAS_SHADER_PERMUTATION_COLOR_SPACE_SRGB_OUTPUT | CAS_SHADER_PERMUTATION_COLOR_SPACE_SRGB_INPUT_OUTPUT } },
+#endif // #if defined(FFX_CAS) || defined(FFX_ALL)
+#if defined(FFX_BLUR) || defined(FFX_ALL)
+    { FFX_EFFECT_BLUR, FFX_BLUR_PASS_COUNT, 0,
+      BLUR_SHADER_PERMUTATION_FORCE_WAVE64 | BLUR_SHADER_PERMUTATION_ALLOW_FP16,
+      { BLUR_SHADER_PERMUTATION_3x3_KERNEL | BLUR_SHADER_PERMUTATION_5x5_KERNEL | BLUR_SHADER_PERMUTATION_7x7_KERNEL | BLUR_SHADER_PERMUTATION_9x9_KERNEL |
+        BLUR_SHADER_PERMUTATION_11x11_KERNEL | BLUR_SHADER_PERMUTATION_13x13_KERNEL | BLUR_SHADER_PERMUTATION_15x15_KERNEL | BLUR_SHADER_PERMUTATION_17x17_KERNEL |
+        BLUR_SHADER_PERMUTATION_19x19_KERNEL | BLUR_SHADER_PERMUTATION_21x21_KERNEL,
+        BLUR_SHADER_PERMUTATION_KERNEL_0 | BLUR_SHADER_PERMUTATION_KERNEL_1 | BLUR_SHADER_PERMUTATION_KERNEL_2 } },
+#endif // #if defined(FFX_BLUR) || defined(FFX_ALL)
+    { FfxEffect(0), 0 }
+};
+
+static void enumeratePermutationOptions(const PermutationSpace& space, std::vector<uint32_t>& options)
+{
+    options.clear();
+
+    // every subset of the flags
+    uint32_t subset = 0;
+    do
+    {
+        options.push_back(subset);
+        subset = (subset - space.flags) & space.flags;
+    } while (subset != 0);
+
+    for (uint32_t group : space.groups)
+    {
+        if (!group)
+            continue;
+
+        std::vector<uint32_t> expanded;
+        for (uint32_t option : options)
+            for (uint32_t flag = 1; flag && flag <= group; flag <<= 1)
+                if (group & flag)
+                    expanded.push_back(option | flag);
+        options.swap(expanded);
+    }
+
+    std::sort(options.begin(), options.end());
+}
+
+static FfxErrorCode writePermutationPack(FILE* file, const PermutationPackHeader& header, const std::vector<PermutationPackEffect>& effects,
+                                         const std::vector<PermutationPackEntry>& entries, const std::vector<std::vector<uint8_t>>& blobs)
+{
+    static const uint8_t padding[FFX_PERMUTATION_PACK_ALIGNMENT] = {};
+
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1;
+    written = written && fwrite(effects.data(), sizeof(PermutationPackEffect), effects.size(), file) == effects.size();
+    written = written && fwrite(entries.data(), sizeof(PermutationPackEntry), entries.size(), file) == entries.size();
+
+    uint64_t offset = sizeof(header) + effects.size() * sizeof(PermutationPackEffect) + entries.size() * sizeof(PermutationPackEntry);
+    for (const std::vector<uint8_t>& blob : blobs)
+    {
+        const size_t paddingSize = size_t(FFX_ALIGN_UP(offset, uint64_t(FFX_PERMUTATION_PACK_ALIGNMENT)) - offset);
+        written = written && fwrite(padding, 1, paddingSize, file) == paddingSize;
+        written = written && fwrite(blob.data(), 1, blob.size(), file) == blob.size();
+        offset += paddingSize + blob.size();
+    }
+    FFX_ASSERT(!written || offset == header.size);
+
+    return written ? FFX_OK : FFX_ERROR_INVALID_PATH;
+}
+
+FFX_API FfxErrorCode ffxSavePermutationPack(const wchar_t* path)
+{
+    FFX_RETURN_ON_ERROR(path, FFX_ERROR_INVALID_POINTER);
+
+    std::vector<PermutationPackEffect>          effects;
+    std::vector<PermutationPackEntry>           entries;
+    std::vector<std::vector<uint8_t>>           blobs;
+    std::unordered_map<const uint8_t*, size_t>  blobIndices;
+    std::vector<uint32_t>                       options;
+
+    for (const PermutationSpace& space : s_PermutationSpaces)
+    {
+        if (!space.passCount)
+            continue;
+
+        PermutationPackEffect effect = { uint32_t(space.effect), uint32_t(entries.size()) };
+        enumeratePermutationOptions(space, options);
+        for (uint32_t pass = 0; pass < space.passCount; ++pass)
+        {
+            if (space.skippedPasses & (1u << pass))
+                continue;
+
+            for (uint32_t permutationOptions : options)
+            {
+                FfxShaderBlob blob = {};
+                FFX_VALIDATE(getPermutationBlobByIndex(space.effect, pass, FFX_BIND_COMPUTE_SHADER_STAGE, permutationOptions, &blob));
+                if (!blob.data)
+                    continue;
+
+                // options a table ignores lead to the same blob, it is stored once
+                auto found = blobIndices.find(blob.data);
+                if (found == blobIndices.end())
+                {
+                    // packs are served in place, compressed blobs are stored expanded
+                    std::vector<uint8_t> bytes(blob.data, blob.data + blob.size);
+                    if (const uint32_t expandedSize = GetDXBCDecompressedSize(blob.data, blob.size))
+                    {
+                        bytes.resize(expandedSize);
+                        FFX_RETURN_ON_ERROR(DecompressDXBC(blob.data, blob.size, bytes.data(), expandedSize), FFX_ERROR_MALFORMED_DATA);
+                    }
+                    found = blobIndices.emplace(blob.data, blobs.size()).first;
+                    blobs.push_back(std::move(bytes));
+                }
+
+                const std::vector<uint8_t>& bytes = blobs[found->second];
+                PermutationPackEntry entry = { pass, uint32_t(FFX_BIND_COMPUTE_SHADER_STAGE), permutationOptions, uint32_t(bytes.size()), found->second,
+                                               hashPermutationBytecode(bytes.data(), uint32_t(bytes.size())), hashPermutationReflection(blob) };
+                entries.push_back(entry);
+            }
+        }
+        effect.entryCount = uint32_t(entries.size()) - effect.firstEntry;
+        effects.push_back(effect);
+    }
+
+    // entries hold the blob index until the layout is known
+    std::vector<uint64_t> blobOffsets(blobs.size());
+    uint64_t offset = sizeof(PermutationPackHeader) + effects.size() * sizeof(PermutationPackEffect) + entries.size() * sizeof(PermutationPackEntry);
+    for (size_t blobIndex = 0; blobIndex < blobs.size(); ++blobIndex)
+    {
+        blobOffsets[blobIndex] = FFX_ALIGN_UP(offset, uint64_t(FFX_PERMUTATION_PACK_ALIGNMENT));
+        offset = blobOffsets[blobIndex] + blobs[blobIndex].size();
+    }
+    for (PermutationPackEntry& entry : entries)
+        entry.offset = blobOffsets[size_t(entry.offset)];
+
+    PermutationPackHeader header = {};
+    header.magic = FFX_PERMUTATION_PACK_MAGIC;
+    header.version = FFX_PERMUTATION_PACK_VERSION;
+    header.sdkVersion = FFX_SDK_MAKE_VERSION(FFX_SDK_VERSION_MAJOR, FFX_SDK_VERSION_MINOR, FFX_SDK_VERSION_PATCH);
+    header.effectCount = uint32_t(effects.size());
+    header.entryCount = uint32_t(entries.size());
+    header.blobCount = uint32_t(blobs.size());
+    header.size = offset;
+
+    FILE* file = nullptr;
+    FFX_RETURN_ON_ERROR(_wfopen_s(&file, path, L"wb") == 0 && file, FFX_ERROR_INVALID_PATH);
+    FfxErrorCode errorCode = writePermutationPack(file, header, effects, entries, blobs);
+    if (fclose(file) != 0)
+        errorCode = FFX_ERROR_INVALID_PATH;
+    return errorCode;
+}
+
 FfxErrorCode ffxIsWave64(FfxEffect effectId, uint32_t permutationOptions, bool& isWave64)
 {
     (void)permutationOptions;
@@ -31,13 +31,69 @@ extern "C" {
 
 struct FfxShaderBlob;
 
+// Default size in bytes of the cache of decompressed permutation blobs.
+#define FFX_PERMUTATION_BLOB_CACHE_DEFAULT_BUDGET   (4 * 1024 * 1024)
+
+// Counters of the cache of decompressed permutation blobs.
+typedef struct FfxPermutationBlobCacheStats
+{
+    uint64_t    hitCount;               // requests served from the cache
+    uint64_t    decompressCount;        // requests which had to decompress their blob
+    uint64_t    decompressedBytes;      // bytes produced by those decompressions
+    uint64_t    decompressTime;         // time spent decompressing, in microseconds
+    uint64_t    evictionCount;          // blobs dropped to stay within the budget
+    uint64_t    cachedBytes;            // bytes currently cached
+    uint32_t    cachedCount;            // blobs currently cached
+    uint32_t    pinnedCount;            // cached blobs not yet released by every caller
+} FfxPermutationBlobCacheStats;
+
 // Get a shader blob for the specified effect, pass, and permutation index.
+// Compressed blobs are decompressed into a cache and stay valid until released with ffxReleasePermutationBlob.
 FfxErrorCode ffxGetPermutationBlobByIndex(FfxEffect effectId,
     FfxPass passId,
     FfxBindStage bindStage,
     uint32_t permutationOptions,
     FfxShaderBlob* outBlob);
 
+// Release the data of a blob returned by ffxGetPermutationBlobByIndex, does nothing for blobs compiled in uncompressed.
+void ffxReleasePermutationBlob(const uint8_t* data);
+
+// Set the size in bytes above which unreferenced decompressed blobs are evicted, least recently used first.
+FFX_API void ffxSetPermutationBlobCacheBudget(size_t budget);
+
+// Query the counters of the cache of decompressed permutation blobs.
+FFX_API void ffxGetPermutationBlobCacheStats(FfxPermutationBlobCacheStats* stats);
+
+// Counters of the loaded permutation pack, all zero while none is loaded.
+typedef struct FfxPermutationPackStats
+{
+    uint64_t    loadTime;               // time spent mapping and validating the pack, in microseconds
+    uint64_t    fileBytes;              // size of the mapped file
+    uint64_t    indexBytes;             // header and index, the only part read by the load
+    uint64_t    servedBytes;            // page rounded size of the distinct blobs served, what serving can make resident
+    uint32_t    servedCount;            // distinct blobs served
+    uint32_t    rejectedCount;          // lookups left to the compiled in blob because the entry did not match
+} FfxPermutationPackStats;
+
+// Serve the bytecode of permutations from an .ffxpack file, mapped so only the blobs in use are paged in.
+// Permutations missing from the pack keep their compiled in blob, fails while blobs of a previous pack are in use.
+// Each entry records the checksum of its bytecode and a hash of the reflection it was packed with, an entry
+// which does not match either also keeps the compiled in blob.
+FFX_API FfxErrorCode ffxLoadPermutationPack(const wchar_t* path);
+typedef FfxErrorCode (*FfxLoadPermutationPackFunc)(const wchar_t* path);
+
+// Go back to the compiled in blobs, fails while blobs of the pack are in use.
+FFX_API FfxErrorCode ffxUnloadPermutationPack();
+typedef FfxErrorCode (*FfxUnloadPermutationPackFunc)();
+
+// Query the counters of the loaded permutation pack.
+FFX_API void ffxGetPermutationPackStats(FfxPermutationPackStats* stats);
+typedef void (*FfxGetPermutationPackStatsFunc)(FfxPermutationPackStats* stats);
+
+// Write the blobs of every permutation compiled into this module to an .ffxpack file.
+FFX_API FfxErrorCode ffxSavePermutationPack(const wchar_t* path);
+typedef FfxErrorCode (*FfxSavePermutationPackFunc)(const wchar_t* path);
+
 // Check is Wave64 is requested on this permutation
 FfxErrorCode ffxIsWave64(FfxEffect effectId, uint32_t permutationOptions, bool& isWave64);
 
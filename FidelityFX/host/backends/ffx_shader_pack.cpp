@@ -0,0 +1,97 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// ffx_shader_pack: writes the permutation blobs compiled into FidelityFX modules to .ffxpack files, so a single
+// host library can serve the permutations of another build, such as a vendor specific one, with ffxLoadPermutationPack.
+//
+// usage: ffx_shader_pack <module.dll> <output.ffxpack> [<module.dll> <output.ffxpack>]...
+//
+// The module is loaded and its exported ffxSavePermutationPack enumerates every permutation compiled into it.
+// Compressed blobs are stored expanded since packs are served in place, the pack size is reported for each module.
+// The pack is then loaded back through the same module, which checks it and reports the time the load took and
+// the bytes it read: only the header and the index, the blobs are paged in as their permutations are requested.
+
+#include <windows.h>
+#include <stdio.h>
+
+#include <FidelityFX/host/backends/ffx_shader_blobs.h>
+
+static int WritePack(const wchar_t* modulePath, const wchar_t* packPath)
+{
+    HMODULE module = LoadLibraryW(modulePath);
+    if (!module)
+    {
+        fwprintf(stderr, L"ffx_shader_pack: cannot load %ls (error %lu)\n", modulePath, (unsigned long)GetLastError());
+        return 1;
+    }
+
+    FfxSavePermutationPackFunc savePermutationPack = (FfxSavePermutationPackFunc)GetProcAddress(module, "ffxSavePermutationPack");
+    FfxLoadPermutationPackFunc loadPermutationPack = (FfxLoadPermutationPackFunc)GetProcAddress(module, "ffxLoadPermutationPack");
+    FfxUnloadPermutationPackFunc unloadPermutationPack = (FfxUnloadPermutationPackFunc)GetProcAddress(module, "ffxUnloadPermutationPack");
+    FfxGetPermutationPackStatsFunc getPermutationPackStats = (FfxGetPermutationPackStatsFunc)GetProcAddress(module, "ffxGetPermutationPackStats");
+    if (!savePermutationPack || !loadPermutationPack || !unloadPermutationPack || !getPermutationPackStats)
+    {
+        fwprintf(stderr, L"ffx_shader_pack: %ls does not export the permutation pack functions\n", modulePath);
+        FreeLibrary(module);
+        return 1;
+    }
+
+    FfxErrorCode errorCode = savePermutationPack(packPath);
+    if (errorCode != FFX_OK)
+    {
+        fwprintf(stderr, L"ffx_shader_pack: %ls: cannot write %ls (error 0x%08x)\n", modulePath, packPath, (unsigned)errorCode);
+        FreeLibrary(module);
+        return 1;
+    }
+
+    FfxPermutationPackStats stats = {};
+    errorCode = loadPermutationPack(packPath);
+    if (errorCode == FFX_OK)
+    {
+        getPermutationPackStats(&stats);
+        unloadPermutationPack();
+    }
+    FreeLibrary(module);
+    if (errorCode != FFX_OK)
+    {
+        fwprintf(stderr, L"ffx_shader_pack: %ls: cannot load back %ls (error 0x%08x)\n", modulePath, packPath, (unsigned)errorCode);
+        return 1;
+    }
+
+    wprintf(L"ffx_shader_pack: %ls -> %ls, %llu bytes, loads in %llu us reading %llu bytes\n", modulePath, packPath,
+            (unsigned long long)stats.fileBytes, (unsigned long long)stats.loadTime, (unsigned long long)stats.indexBytes);
+    return 0;
+}
+
+int wmain(int argc, wchar_t** argv)
+{
+    if (argc < 3 || (argc - 1) % 2)
+    {
+        fwprintf(stderr, L"usage: ffx_shader_pack <module.dll> <output.ffxpack> [<module.dll> <output.ffxpack>]...\n");
+        return 2;
+    }
+
+    int result = 0;
+    for (int arg = 1; arg + 1 < argc; arg += 2)
+        result |= WritePack(argv[arg], argv[arg + 1]);
+    return result;
+}
@@ -36,8 +36,11 @@
 // lists to map shader resource bindpoint name to resource identifier
 typedef struct ResourceBinding
 {
-    uint32_t index;
-    wchar_t  name[64];
+    uint32_t        index;
+    uint32_t        nameHash;
+    const wchar_t*  name;
+
+    constexpr ResourceBinding(uint32_t index, const wchar_t* name) : index(index), nameHash(ffxHashBindingName(name)), name(name) {}
 } ResourceBinding;
 
 static const ResourceBinding srvTextureBindingTable[] = {
@@ -105,7 +108,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(srvTextureBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
+            if (srvTextureBindingTable[mapIndex].nameHash == inoutPipeline->srvTextureBindings[srvIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(srvTextureBindingTable))
@@ -119,7 +122,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(uavTextureBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
+            if (uavTextureBindingTable[mapIndex].nameHash == inoutPipeline->uavTextureBindings[uavIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(uavTextureBindingTable))
@@ -133,7 +136,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(cbResourceBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(cbResourceBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
+            if (cbResourceBindingTable[mapIndex].nameHash == inoutPipeline->constantBufferBindings[cbIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(cbResourceBindingTable))
@@ -475,7 +478,9 @@ static void scheduleDispatch(FfxBlurContext_Private* context,
                              uint32_t                dispatchZ)
 {
     FfxGpuJobDescription dispatchJob = {FFX_GPU_JOB_COMPUTE};
+#ifdef FFX_DEBUG
     wcscpy_s(dispatchJob.jobLabel, pipeline->name);
+#endif
 
     for (uint32_t currentShaderResourceViewIndex = 0; currentShaderResourceViewIndex < pipeline->srvTextureCount; ++currentShaderResourceViewIndex)
     {
@@ -39,8 +39,11 @@
 // lists to map shader resource bindpoint name to resource identifier
 typedef struct ResourceBinding
 {
-    uint32_t index;
-    wchar_t  name[64];
+    uint32_t        index;
+    uint32_t        nameHash;
+    const wchar_t*  name;
+
+    constexpr ResourceBinding(uint32_t index, const wchar_t* name) : index(index), nameHash(ffxHashBindingName(name)), name(name) {}
 } ResourceBinding;
 
 static const ResourceBinding s_SrvResourceBindingTable[] = {
@@ -62,7 +65,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(s_SrvResourceBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(s_SrvResourceBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
+            if (s_SrvResourceBindingTable[mapIndex].nameHash == inoutPipeline->srvTextureBindings[srvIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(s_SrvResourceBindingTable))
@@ -76,7 +79,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(s_UavResourceBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(s_UavResourceBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
+            if (s_UavResourceBindingTable[mapIndex].nameHash == inoutPipeline->uavTextureBindings[uavIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(s_UavResourceBindingTable))
@@ -90,7 +93,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(s_CbResourceBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(s_CbResourceBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
+            if (s_CbResourceBindingTable[mapIndex].nameHash == inoutPipeline->constantBufferBindings[cbIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(s_CbResourceBindingTable))
@@ -188,7 +191,9 @@ static void scheduleDispatch(
     FfxCasContext_Private* context, const FfxCasDispatchDescription*, const FfxPipelineState* pipeline, uint32_t dispatchX, uint32_t dispatchY)
 {
     FfxGpuJobDescription dispatchJob = {FFX_GPU_JOB_COMPUTE};
+#ifdef FFX_DEBUG
     wcscpy_s(dispatchJob.jobLabel, pipeline->name);
+#endif
 
     for (uint32_t currentShaderResourceViewIndex = 0; currentShaderResourceViewIndex < pipeline->srvTextureCount; ++currentShaderResourceViewIndex)
     {
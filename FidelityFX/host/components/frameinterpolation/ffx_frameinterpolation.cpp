@@ -42,8 +42,11 @@
 // lists to map shader resource bindpoint name to resource identifier
 typedef struct ResourceBinding
 {
-    uint32_t    index;
-    wchar_t     name[64];
+    uint32_t        index;
+    uint32_t        nameHash;
+    const wchar_t*  name;
+
+    constexpr ResourceBinding(uint32_t index, const wchar_t* name) : index(index), nameHash(ffxHashBindingName(name)), name(name) {}
 }ResourceBinding;
 
 static const ResourceBinding srvResourceBindingTable[] =
@@ -156,7 +159,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(srvResourceBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(srvResourceBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
+            if (srvResourceBindingTable[mapIndex].nameHash == inoutPipeline->srvTextureBindings[srvIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(srvResourceBindingTable))
@@ -171,7 +174,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(uavResourceBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(uavResourceBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
+            if (uavResourceBindingTable[mapIndex].nameHash == inoutPipeline->uavTextureBindings[uavIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(uavResourceBindingTable))
@@ -185,7 +188,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(cbResourceBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(cbResourceBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
+            if (cbResourceBindingTable[mapIndex].nameHash == inoutPipeline->constantBufferBindings[cbIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(cbResourceBindingTable))
@@ -199,7 +202,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(uavResourceBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(uavResourceBindingTable[mapIndex].name, inoutPipeline->uavBufferBindings[uavBufferIndex].name))
+            if (uavResourceBindingTable[mapIndex].nameHash == inoutPipeline->uavBufferBindings[uavBufferIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(uavResourceBindingTable))
@@ -213,7 +216,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(srvResourceBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(srvResourceBindingTable[mapIndex].name, inoutPipeline->srvBufferBindings[srvBufferIndex].name))
+            if (srvResourceBindingTable[mapIndex].nameHash == inoutPipeline->srvBufferBindings[srvBufferIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(srvResourceBindingTable))
@@ -286,22 +289,31 @@ static FfxErrorCode createPipelineStates(FfxFrameInterpolationContext_Private* c
     uint32_t contextFlags = context->contextDescription.flags;
 
     // Set up pipeline descriptor (basically RootSignature and binding)
+    FfxCreatePipelineTask pipelineTasks[10] = {};
+    uint32_t pipelineTaskCount = 0;
+
     auto CreateComputePipeline = [&](FfxPass pass, const wchar_t* name, FfxPipelineState* pipeline) -> FfxErrorCode {
+        FFX_ASSERT(pipelineTaskCount < sizeof(pipelineTasks) / sizeof(pipelineTasks[0]));
         ffxSafeReleasePipeline(&context->contextDescription.backendInterface, pipeline, context->effectContextId);
         wcscpy_s(pipelineDescription.name, name);
-        FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(
-            &context->contextDescription.backendInterface,
-            FFX_EFFECT_FRAMEINTERPOLATION,
-            pass,
+        pipelineTasks[pipelineTaskCount++] = { pass,
             getPipelinePermutationFlags(contextFlags, pass, supportedFP16, canForceWave64, useLut),
-            &pipelineDescription,
-            context->effectContextId,
-            pipeline));
-        patchResourceBindings(pipeline);
+            pipelineDescription,
+            pipeline };
 
         return FFX_OK;
     };
 
+    // the debug view is only created by the first dispatch that draws it
+    auto DeferComputePipeline = [&](FfxPass pass, const wchar_t* name, FfxPipelineState* pipeline, FfxDeferredPipeline* deferredPipeline) {
+        ffxSafeReleasePipeline(&context->contextDescription.backendInterface, pipeline, context->effectContextId);
+        wcscpy_s(pipelineDescription.name, name);
+        ffxDeferPipeline(deferredPipeline, pass,
+            getPipelinePermutationFlags(contextFlags, pass, supportedFP16, canForceWave64, useLut),
+            &pipelineDescription,
+            pipeline);
+    };
+
     auto CreateRasterPipeline = [&](FfxPass pass, const wchar_t* name, FfxPipelineState* pipeline) -> FfxErrorCode {
         wcscpy_s(pipelineDescription.name, name);
         pipelineDescription.stage            = (FfxBindStage)(FFX_BIND_VERTEX_SHADER_STAGE | FFX_BIND_PIXEL_SHADER_STAGE);
@@ -329,7 +341,15 @@ static FfxErrorCode createPipelineStates(FfxFrameInterpolationContext_Private* c
     CreateComputePipeline(FFX_FRAMEINTERPOLATION_PASS_INPAINTING_PYRAMID,                   L"INPAINTING_PYRAMID", &context->pipelineInpaintingPyramid);
     CreateComputePipeline(FFX_FRAMEINTERPOLATION_PASS_INPAINTING,                           L"INPAINTING", &context->pipelineInpainting);
     CreateComputePipeline(FFX_FRAMEINTERPOLATION_PASS_GAME_VECTOR_FIELD_INPAINTING_PYRAMID, L"GAME_VECTOR_FIELD_INPAINTING_PYRAMID", & context->pipelineGameVectorFieldInpaintingPyramid);
-    CreateComputePipeline(FFX_FRAMEINTERPOLATION_PASS_DEBUG_VIEW,                           L"DEBUG_VIEW", &context->pipelineDebugView);
+    DeferComputePipeline(FFX_FRAMEINTERPOLATION_PASS_DEBUG_VIEW,                            L"DEBUG_VIEW", &context->pipelineDebugView, &context->deferredPipelineDebugView);
+
+    // the pipelines are independent, create them on as many threads as the task scheduler allows
+    ffxCreatePipelines(&context->contextDescription.backendInterface, FFX_EFFECT_FRAMEINTERPOLATION, context->effectContextId, pipelineTasks, pipelineTaskCount);
+    for (uint32_t taskIndex = 0; taskIndex < pipelineTaskCount; ++taskIndex)
+    {
+        if (pipelineTasks[taskIndex].errorCode == FFX_OK)
+            patchResourceBindings(pipelineTasks[taskIndex].pipeline);
+    }
 
     return FFX_OK;
 }
@@ -633,7 +653,9 @@ static void scheduleDispatch(FfxFrameInterpolationContext_Private* context, cons
     }
 
     FfxGpuJobDescription dispatchJob = { FFX_GPU_JOB_COMPUTE };
+#ifdef FFX_DEBUG
     wcscpy_s(dispatchJob.jobLabel, pipeline->name);
+#endif
     dispatchJob.computeJobDescriptor = jobDescriptor;
 
     context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &dispatchJob);
@@ -734,6 +756,19 @@ FfxErrorCode ffxFrameInterpolationContextDestroy(FfxFrameInterpolationContext* c
     return errorCode;
 }
 
+FfxErrorCode ffxFrameInterpolationContextPrewarmPipelines(FfxFrameInterpolationContext* context)
+{
+    FFX_RETURN_ON_ERROR(
+        context,
+        FFX_ERROR_INVALID_POINTER);
+
+    FfxFrameInterpolationContext_Private* contextPrivate = (FfxFrameInterpolationContext_Private*)context;
+
+    FfxDeferredPipeline* deferredPipeline = &contextPrivate->deferredPipelineDebugView;
+    return ffxResolveDeferredPipelines(&contextPrivate->contextDescription.backendInterface, FFX_EFFECT_FRAMEINTERPOLATION, contextPrivate->effectContextId,
+        &deferredPipeline, 1, patchResourceBindings);
+}
+
 FfxErrorCode ffxFrameInterpolationContextEnqueueRefreshPipelineRequest(FfxFrameInterpolationContext* context)
 {
     FFX_RETURN_ON_ERROR(
@@ -928,6 +963,13 @@ FFX_API FfxErrorCode ffxFrameInterpolationDispatch(FfxFrameInterpolationContext*
         contextPrivate->refreshPipelineStates = false;
     }
 
+    if (params->flags & FFX_FRAMEINTERPOLATION_DISPATCH_DRAW_DEBUG_VIEW)
+    {
+        FfxDeferredPipeline* deferredPipeline = &contextPrivate->deferredPipelineDebugView;
+        FFX_VALIDATE(ffxResolveDeferredPipelines(&contextPrivate->contextDescription.backendInterface, FFX_EFFECT_FRAMEINTERPOLATION, contextPrivate->effectContextId,
+            &deferredPipeline, 1, patchResourceBindings));
+    }
+
     const bool bReset = (contextPrivate->dispatchCount == 0) || params->reset;
 
     FFX_ASSERT_MESSAGE(!contextPrivate->asyncSupported || bReset || (params->frameID > contextPrivate->previousFrameID),
@@ -967,9 +1009,8 @@ FFX_API FfxErrorCode ffxFrameInterpolationDispatch(FfxFrameInterpolationContext*
     contextPrivate->constants.interpolationRectSize[1] = params->interpolationRect.height;
 
     // Debug bar
-    static size_t dbgIdx = 0;
-    memcpy(contextPrivate->constants.debugBarColor, &debugBarColorSequence[dbgIdx * 3], 3 * sizeof(float));
-    dbgIdx = (dbgIdx + 1) % debugBarColorSequenceLength;
+    memcpy(contextPrivate->constants.debugBarColor, &debugBarColorSequence[contextPrivate->debugBarColorIndex * 3], 3 * sizeof(float));
+    contextPrivate->debugBarColorIndex = (contextPrivate->debugBarColorIndex + 1) % debugBarColorSequenceLength;
 
     contextPrivate->constants.backBufferTransferFunction = params->backBufferTransferFunction;
     contextPrivate->constants.minMaxLuminance[0]         = params->minMaxLuminance[0];
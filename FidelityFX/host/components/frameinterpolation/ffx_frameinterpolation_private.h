@@ -23,6 +23,7 @@
 #pragma once
 
 #include <FidelityFX/gpu/frameinterpolation/ffx_frameinterpolation_resources.h>
+#include <ffx_object_management.h>
 
 /// An enumeration of all the permutations that can be passed to the FSR3 algorithm.
 ///
@@ -130,6 +131,7 @@ typedef struct FfxFrameInterpolationContext_Private {
     FfxPipelineState                            pipelineInpainting;
     FfxPipelineState                            pipelineGameVectorFieldInpaintingPyramid;
     FfxPipelineState                            pipelineDebugView;
+    FfxDeferredPipeline                         deferredPipelineDebugView;
 
     FfxConstantBuffer                           constantBuffers[FFX_FRAMEINTERPOLATION_CONSTANTBUFFER_COUNT];
 
@@ -143,5 +145,6 @@ typedef struct FfxFrameInterpolationContext_Private {
     bool                                        asyncSupported;
     uint64_t                                    previousFrameID;
     uint64_t                                    dispatchCount;
+    size_t                                      debugBarColorIndex;
 
 } FfxFrameInterpolationContext_Private;
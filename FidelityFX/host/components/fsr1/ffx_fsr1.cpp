@@ -43,8 +43,11 @@
 // lists to map shader resource bindpoint name to resource identifier
 typedef struct ResourceBinding
 {
-    uint32_t    index;
-    wchar_t     name[64];
+    uint32_t        index;
+    uint32_t        nameHash;
+    const wchar_t*  name;
+
+    constexpr ResourceBinding(uint32_t index, const wchar_t* name) : index(index), nameHash(ffxHashBindingName(name)), name(name) {}
 }ResourceBinding;
 
 static const ResourceBinding srvTextureBindingTable[] =
@@ -73,7 +76,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(srvTextureBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
+            if (srvTextureBindingTable[mapIndex].nameHash == inoutPipeline->srvTextureBindings[srvIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(srvTextureBindingTable))
@@ -87,7 +90,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(uavTextureBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
+            if (uavTextureBindingTable[mapIndex].nameHash == inoutPipeline->uavTextureBindings[uavIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(uavTextureBindingTable))
@@ -101,7 +104,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(cbResourceBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(cbResourceBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
+            if (cbResourceBindingTable[mapIndex].nameHash == inoutPipeline->constantBufferBindings[cbIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(cbResourceBindingTable))
@@ -192,7 +195,9 @@ static FfxErrorCode createPipelineStates(FfxFsr1Context_Private* context)
 static void scheduleDispatch(FfxFsr1Context_Private* context, const FfxFsr1DispatchDescription*, const FfxPipelineState* pipeline, uint32_t dispatchX, uint32_t dispatchY)
 {
     FfxGpuJobDescription dispatchJob = {FFX_GPU_JOB_COMPUTE};
+#ifdef FFX_DEBUG
     wcscpy_s(dispatchJob.jobLabel, pipeline->name);
+#endif
 
     for (uint32_t currentShaderResourceViewIndex = 0; currentShaderResourceViewIndex < pipeline->srvTextureCount; ++currentShaderResourceViewIndex) {
 
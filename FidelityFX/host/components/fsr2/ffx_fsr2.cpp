@@ -53,8 +53,11 @@ static const uint32_t FSR2_MAX_QUEUED_FRAMES = 16;
 // lists to map shader resource bindpoint name to resource identifier
 typedef struct ResourceBinding
 {
-    uint32_t    index;
-    wchar_t     name[64];
+    uint32_t        index;
+    uint32_t        nameHash;
+    const wchar_t*  name;
+
+    constexpr ResourceBinding(uint32_t index, const wchar_t* name) : index(index), nameHash(ffxHashBindingName(name)), name(name) {}
 }ResourceBinding;
 
 static const ResourceBinding srvTextureBindingTable[] =
@@ -328,7 +331,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(srvTextureBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
+            if (srvTextureBindingTable[mapIndex].nameHash == inoutPipeline->srvTextureBindings[srvIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(srvTextureBindingTable))
@@ -342,7 +345,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(uavTextureBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
+            if (uavTextureBindingTable[mapIndex].nameHash == inoutPipeline->uavTextureBindings[uavIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(uavTextureBindingTable))
@@ -356,7 +359,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(constantBufferBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(constantBufferBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
+            if (constantBufferBindingTable[mapIndex].nameHash == inoutPipeline->constantBufferBindings[cbIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(constantBufferBindingTable))
@@ -431,45 +434,52 @@ static FfxErrorCode createPipelineStates(FfxFsr2Context_Private* context)
     uint32_t contextFlags = context->contextDescription.flags;
 
     // Set up pipeline descriptor (basically RootSignature and binding)
+    // passes that only run for some dispatches are recorded here and created on first use
+    FfxCreatePipelineTask pipelineTasks[5] = {};
+    uint32_t pipelineTaskCount = 0;
+
     wcscpy_s(pipelineDescription.name, L"FSR2-LUM_PYRAMID");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_COMPUTE_LUMINANCE_PYRAMID,
+    pipelineTasks[pipelineTaskCount++] = { FFX_FSR2_PASS_COMPUTE_LUMINANCE_PYRAMID,
         getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_COMPUTE_LUMINANCE_PYRAMID, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineComputeLuminancePyramid));
+        pipelineDescription, &context->pipelineComputeLuminancePyramid };
     wcscpy_s(pipelineDescription.name, L"FSR2-RCAS");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_RCAS,
+    ffxDeferPipeline(&context->deferredPipelineRCAS, FFX_FSR2_PASS_RCAS,
         getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_RCAS, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineRCAS));
+        &pipelineDescription, &context->pipelineRCAS);
     wcscpy_s(pipelineDescription.name, L"FSR2-GEN_REACTIVE");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_GENERATE_REACTIVE,
+    ffxDeferPipeline(&context->deferredPipelineGenerateReactive, FFX_FSR2_PASS_GENERATE_REACTIVE,
         getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_GENERATE_REACTIVE, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineGenerateReactive));
+        &pipelineDescription, &context->pipelineGenerateReactive);
     wcscpy_s(pipelineDescription.name, L"FSR2-TCR_AUTOGENERATE");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_TCR_AUTOGENERATE,
+    ffxDeferPipeline(&context->deferredPipelineTcrAutogenerate, FFX_FSR2_PASS_TCR_AUTOGENERATE,
         getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_TCR_AUTOGENERATE, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineTcrAutogenerate));
+        &pipelineDescription, &context->pipelineTcrAutogenerate);
 
     pipelineDescription.rootConstantBufferCount = 1;
 
     wcscpy_s(pipelineDescription.name, L"FSR2-DEPTH_CLIP");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_DEPTH_CLIP,
+    pipelineTasks[pipelineTaskCount++] = { FFX_FSR2_PASS_DEPTH_CLIP,
         getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_DEPTH_CLIP, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineDepthClip));
+        pipelineDescription, &context->pipelineDepthClip };
     wcscpy_s(pipelineDescription.name, L"FSR2-RECON_PREV_DEPTH");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH,
+    pipelineTasks[pipelineTaskCount++] = { FFX_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH,
         getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineReconstructPreviousDepth));
+        pipelineDescription, &context->pipelineReconstructPreviousDepth };
     wcscpy_s(pipelineDescription.name, L"FSR2-LOCK");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_LOCK,
+    pipelineTasks[pipelineTaskCount++] = { FFX_FSR2_PASS_LOCK,
         getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_LOCK, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineLock));
+        pipelineDescription, &context->pipelineLock };
     wcscpy_s(pipelineDescription.name, L"FSR2-ACCUMULATE");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_ACCUMULATE,
+    pipelineTasks[pipelineTaskCount++] = { FFX_FSR2_PASS_ACCUMULATE,
         getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_ACCUMULATE, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineAccumulate));
+        pipelineDescription, &context->pipelineAccumulate };
     wcscpy_s(pipelineDescription.name, L"FSR2-ACCUM_SHARP");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_ACCUMULATE_SHARPEN,
+    ffxDeferPipeline(&context->deferredPipelineAccumulateSharpen, FFX_FSR2_PASS_ACCUMULATE_SHARPEN,
         getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_ACCUMULATE_SHARPEN, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineAccumulateSharpen));
+        &pipelineDescription, &context->pipelineAccumulateSharpen);
+
+    // the pipelines are independent, create them on as many threads as the task scheduler allows
+    FFX_VALIDATE(ffxCreatePipelines(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, context->effectContextId, pipelineTasks, pipelineTaskCount));
 
     // for each pipeline: re-route/fix-up IDs based on names
     patchResourceBindings(&context->pipelineDepthClip);
@@ -477,14 +487,15 @@ static FfxErrorCode createPipelineStates(FfxFsr2Context_Private* context)
     patchResourceBindings(&context->pipelineLock);
     patchResourceBindings(&context->pipelineAccumulate);
     patchResourceBindings(&context->pipelineComputeLuminancePyramid);
-    patchResourceBindings(&context->pipelineAccumulateSharpen);
-    patchResourceBindings(&context->pipelineRCAS);
-    patchResourceBindings(&context->pipelineGenerateReactive);
-    patchResourceBindings(&context->pipelineTcrAutogenerate);
 
     return FFX_OK;
 }
 
+static FfxErrorCode resolveDeferredPipeline(FfxFsr2Context_Private* context, FfxDeferredPipeline* deferredPipeline)
+{
+    return ffxResolveDeferredPipelines(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, context->effectContextId, &deferredPipeline, 1, patchResourceBindings);
+}
+
 static FfxErrorCode generateReactiveMaskInternal(FfxFsr2Context_Private* contextPrivate, const FfxFsr2DispatchDescription* params);
 
 static FfxErrorCode fsr2Create(FfxFsr2Context_Private* context, const FfxFsr2ContextDescription* contextDescription)
@@ -975,7 +986,9 @@ static void setupDeviceDepthToViewSpaceDepthParams(FfxFsr2Context_Private* conte
 static void scheduleDispatch(FfxFsr2Context_Private* context, const FfxFsr2DispatchDescription*, const FfxPipelineState* pipeline, uint32_t dispatchX, uint32_t dispatchY)
 {
     FfxGpuJobDescription dispatchJob = {FFX_GPU_JOB_COMPUTE};
+#ifdef FFX_DEBUG
     wcscpy_s(dispatchJob.jobLabel, pipeline->name);
+#endif
 
     for (uint32_t currentShaderResourceViewIndex = 0; currentShaderResourceViewIndex < pipeline->srvTextureCount; ++currentShaderResourceViewIndex) {
 
@@ -1033,6 +1046,15 @@ static FfxErrorCode fsr2Dispatch(FfxFsr2Context_Private* context, const FfxFsr2D
         fsr2DebugCheckDispatch(context, params);
     }
 
+    // create the pipelines of optional passes the first time a dispatch uses them
+    if (params->enableSharpening)
+    {
+        FFX_VALIDATE(resolveDeferredPipeline(context, &context->deferredPipelineAccumulateSharpen));
+        FFX_VALIDATE(resolveDeferredPipeline(context, &context->deferredPipelineRCAS));
+    }
+    if (params->enableAutoReactive)
+        FFX_VALIDATE(resolveDeferredPipeline(context, &context->deferredPipelineTcrAutogenerate));
+
     // take a short cut to the command list
     FfxCommandList commandList = params->commandList;
 
@@ -1415,6 +1437,24 @@ FfxErrorCode ffxFsr2ContextDispatch(FfxFsr2Context* context, const FfxFsr2Dispat
     return errorCode;
 }
 
+FfxErrorCode ffxFsr2ContextPrewarmPipelines(FfxFsr2Context* context)
+{
+    FFX_RETURN_ON_ERROR(
+        context,
+        FFX_ERROR_INVALID_POINTER);
+
+    FfxFsr2Context_Private* contextPrivate = (FfxFsr2Context_Private*)(context);
+
+    FfxDeferredPipeline* deferredPipelines[] = {
+        &contextPrivate->deferredPipelineAccumulateSharpen,
+        &contextPrivate->deferredPipelineRCAS,
+        &contextPrivate->deferredPipelineGenerateReactive,
+        &contextPrivate->deferredPipelineTcrAutogenerate,
+    };
+    return ffxResolveDeferredPipelines(&contextPrivate->contextDescription.backendInterface, FFX_EFFECT_FSR2, contextPrivate->effectContextId,
+        deferredPipelines, FFX_ARRAY_ELEMENTS(deferredPipelines), patchResourceBindings);
+}
+
 float ffxFsr2GetUpscaleRatioFromQualityMode(FfxFsr2QualityMode qualityMode)
 {
     switch (qualityMode) {
@@ -1509,6 +1549,8 @@ FfxErrorCode ffxFsr2ContextGenerateReactiveMask(FfxFsr2Context* context, const F
         contextPrivate->device,
         FFX_ERROR_NULL_DEVICE);
 
+    FFX_VALIDATE(resolveDeferredPipeline(contextPrivate, &contextPrivate->deferredPipelineGenerateReactive));
+
     // take a short cut to the command list
     FfxCommandList commandList = params->commandList;
 
@@ -1563,10 +1605,12 @@ FfxErrorCode ffxFsr2ContextGenerateReactiveMask(FfxFsr2Context* context, const F
     wcscpy_s(jobDescriptor.cbNames[0], pipeline->constantBufferBindings[0].name);
 #endif
     FfxGpuJobDescription dispatchJob = { FFX_GPU_JOB_COMPUTE };
+#ifdef FFX_DEBUG
     wcscpy_s(dispatchJob.jobLabel, pipeline->name);
+#endif
     dispatchJob.computeJobDescriptor = jobDescriptor;
 
-    //contextPrivate->contextDescription.backendInterface.fpScheduleGpuJob(&contextPrivate->contextDescription.backendInterface, &dispatchJob);
+    contextPrivate->contextDescription.backendInterface.fpScheduleGpuJob(&contextPrivate->contextDescription.backendInterface, &dispatchJob);
 
     contextPrivate->contextDescription.backendInterface.fpExecuteGpuJobs(
         &contextPrivate->contextDescription.backendInterface, commandList, contextPrivate->effectContextId);
@@ -1628,7 +1672,9 @@ static FfxErrorCode generateReactiveMaskInternal(FfxFsr2Context_Private* context
     }
 
     FfxGpuJobDescription dispatchJob = { FFX_GPU_JOB_COMPUTE };
+#ifdef FFX_DEBUG
     wcscpy_s(dispatchJob.jobLabel, pipeline->name);
+#endif
     dispatchJob.computeJobDescriptor = jobDescriptor;
 
     contextPrivate->contextDescription.backendInterface.fpScheduleGpuJob(&contextPrivate->contextDescription.backendInterface, &dispatchJob);
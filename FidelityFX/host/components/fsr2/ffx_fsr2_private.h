@@ -22,6 +22,7 @@
 
 #pragma once
 #include <FidelityFX/gpu/fsr2/ffx_fsr2_resources.h>
+#include <ffx_object_management.h>
 
 /// An enumeration of all the permutations that can be passed to the FSR2 algorithm.
 ///
@@ -90,6 +91,10 @@ typedef struct FfxFsr2Context_Private {
     FfxPipelineState            pipelineComputeLuminancePyramid;
     FfxPipelineState            pipelineGenerateReactive;
     FfxPipelineState            pipelineTcrAutogenerate;
+    FfxDeferredPipeline         deferredPipelineAccumulateSharpen;
+    FfxDeferredPipeline         deferredPipelineRCAS;
+    FfxDeferredPipeline         deferredPipelineGenerateReactive;
+    FfxDeferredPipeline         deferredPipelineTcrAutogenerate;
     FfxConstantBuffer           constantBuffers[4];
 
     // 2 arrays of resources, as e.g. FFX_FSR2_RESOURCE_IDENTIFIER_LOCK_STATUS will use different resources when bound as SRV vs when bound as UAV
@@ -39,9 +39,6 @@
 
 #include "ffx_fsr3_private.h"
 
-// To track only one context is present, also used in fi dispatch callback
-static FfxFsr3Context* s_Context = nullptr;
-
 FfxErrorCode ffxFsr3ContextCreate(FfxFsr3Context* context, FfxFsr3ContextDescription* contextDescription)
 {
     FFX_STATIC_ASSERT(sizeof(FfxFsr3Context) >= sizeof(FfxFsr3Context_Private));
@@ -276,14 +273,14 @@ FfxErrorCode ffxFsr3ContextGenerateReactiveMask(FfxFsr3Context* context, const F
     return ffxFsr3UpscalerContextGenerateReactiveMask(&contextPrivate->upscalerContext, &fsr3Params);
 }
 
-FfxErrorCode ffxFsr3DispatchFrameGeneration(const FfxFrameGenerationDispatchDescription* callbackDesc)
+FfxErrorCode ffxFsr3DispatchFrameGeneration(const FfxFrameGenerationDispatchDescription* callbackDesc, void* context)
 {
     FfxErrorCode errorCode = FFX_OK;
 
-    FFX_RETURN_ON_ERROR(s_Context, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(context, FFX_ERROR_INVALID_POINTER);
     FFX_RETURN_ON_ERROR(callbackDesc, FFX_ERROR_INVALID_POINTER);
 
-    FfxFsr3Context_Private* contextPrivate = (FfxFsr3Context_Private*)(s_Context);
+    FfxFsr3Context_Private* contextPrivate = (FfxFsr3Context_Private*)(context);
 
     bool upscalingOnly     = (contextPrivate->description.flags & FFX_FSR3_ENABLE_UPSCALING_ONLY) != 0;
     FFX_ASSERT_MESSAGE(upscalingOnly == false, "Fsr3 context has not been initialized to support Frame Generation");
@@ -509,19 +506,7 @@ FfxErrorCode ffxFsr3ConfigureFrameGeneration(FfxFsr3Context* context, const FfxF
         patchedConfig.drawDebugPacingLines = true;
     }
 
-    // reset shared resource indices
-    if (contextPrivate->frameGenerationEnabled != patchedConfig.frameGenerationEnabled)
-    {
-        contextPrivate->frameGenerationEnabled = patchedConfig.frameGenerationEnabled;
-
-        if (contextPrivate->frameGenerationEnabled) {
-            FFX_ASSERT(nullptr == s_Context);
-            s_Context = context;
-        }
-        else if (s_Context == context) {
-            s_Context = nullptr;
-        }
-    }
+    contextPrivate->frameGenerationEnabled = patchedConfig.frameGenerationEnabled;
 
     return contextPrivate->backendInterfaceFrameInterpolation.fpSwapChainConfigureFrameGeneration(&patchedConfig);
 }
@@ -550,10 +535,6 @@ FfxErrorCode ffxFsr3ContextDestroy(FfxFsr3Context* context)
         FFX_VALIDATE(ffxFsr3UpscalerContextDestroy(&contextPrivate->upscalerContext));
     }
 
-    if (s_Context == context) {
-        s_Context = nullptr;
-    }
-
     return FFX_OK;
 }
 
@@ -44,13 +44,24 @@
 // max queued frames for descriptor management
 static const uint32_t FSR3UPSCALER_MAX_QUEUED_FRAMES = 16;
 
+// passes a dispatch can schedule: prepare inputs, luma pyramid, shading change pyramid, shading change,
+// prepare reactivity, luma instability, accumulate, RCAS and the debug view
+static const uint32_t FSR3UPSCALER_DISPATCH_PASS_COUNT = 9;
+
+// upper bound of the jobs a single dispatch queues: 4 first frame clears, 3 reset clears,
+// 2 per frame clears, 5 discards, the SPD clear and the passes
+static const uint32_t FSR3UPSCALER_MAX_JOBS_PER_DISPATCH = 15 + FSR3UPSCALER_DISPATCH_PASS_COUNT;
+
 #include "ffx_fsr3upscaler_private.h"
 
 // lists to map shader resource bindpoint name to resource identifier
 typedef struct ResourceBinding
 {
-    uint32_t    index;
-    wchar_t     name[64];
+    uint32_t        index;
+    uint32_t        nameHash;
+    const wchar_t*  name;
+
+    constexpr ResourceBinding(uint32_t index, const wchar_t* name) : index(index), nameHash(ffxHashBindingName(name)), name(name) {}
 }ResourceBinding;
 
 static const ResourceBinding srvTextureBindingTable[] =
@@ -321,7 +332,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(srvTextureBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
+            if (srvTextureBindingTable[mapIndex].nameHash == inoutPipeline->srvTextureBindings[srvIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(srvTextureBindingTable))
@@ -335,7 +346,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(uavTextureBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
+            if (uavTextureBindingTable[mapIndex].nameHash == inoutPipeline->uavTextureBindings[uavIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(uavTextureBindingTable))
@@ -349,7 +360,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(constantBufferBindingTable); ++mapIndex)
         {
-            if (0 == wcscmp(constantBufferBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
+            if (constantBufferBindingTable[mapIndex].nameHash == inoutPipeline->constantBufferBindings[cbIndex].nameHash)
                 break;
         }
         if (mapIndex == _countof(constantBufferBindingTable))
@@ -427,60 +438,67 @@ static FfxErrorCode createPipelineStates(FfxFsr3UpscalerContext_Private* context
     uint32_t contextFlags = context->contextDescription.flags;
 
     // Set up pipeline descriptor (basically RootSignature and binding)
+    // passes that only run for some dispatches are recorded here and created on first use
+    FfxCreatePipelineTask pipelineTasks[7] = {};
+    uint32_t pipelineTaskCount = 0;
+
     wcscpy_s(pipelineDescription.name, L"FSR3-LUMA-PYRAMID");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_LUMA_PYRAMID,
+    pipelineTasks[pipelineTaskCount++] = { FFX_FSR3UPSCALER_PASS_LUMA_PYRAMID,
         getPipelinePermutationFlags(contextFlags, FFX_FSR3UPSCALER_PASS_LUMA_PYRAMID, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineLumaPyramid));
+        pipelineDescription, &context->pipelineLumaPyramid };
     wcscpy_s(pipelineDescription.name, L"FSR3-RCAS");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_RCAS,
+    ffxDeferPipeline(&context->deferredPipelineRCAS, FFX_FSR3UPSCALER_PASS_RCAS,
         getPipelinePermutationFlags(contextFlags, FFX_FSR3UPSCALER_PASS_RCAS, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineRCAS));
+        &pipelineDescription, &context->pipelineRCAS);
     wcscpy_s(pipelineDescription.name, L"FSR3-GEN_REACTIVE");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_GENERATE_REACTIVE,
+    ffxDeferPipeline(&context->deferredPipelineGenerateReactive, FFX_FSR3UPSCALER_PASS_GENERATE_REACTIVE,
         getPipelinePermutationFlags(contextFlags, FFX_FSR3UPSCALER_PASS_GENERATE_REACTIVE, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineGenerateReactive));
+        &pipelineDescription, &context->pipelineGenerateReactive);
 
     pipelineDescription.rootConstantBufferCount = 1;
 
     wcscpy_s(pipelineDescription.name, L"FSR3-PREPARE-INPUTS");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_PREPARE_INPUTS,
+    pipelineTasks[pipelineTaskCount++] = { FFX_FSR3UPSCALER_PASS_PREPARE_INPUTS,
         getPipelinePermutationFlags(contextFlags, FFX_FSR3UPSCALER_PASS_PREPARE_INPUTS, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelinePrepareInputs));
+        pipelineDescription, &context->pipelinePrepareInputs };
 
     wcscpy_s(pipelineDescription.name, L"FSR3-PREPARE-REACTIVITY");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_PREPARE_REACTIVITY,
+    pipelineTasks[pipelineTaskCount++] = { FFX_FSR3UPSCALER_PASS_PREPARE_REACTIVITY,
         getPipelinePermutationFlags(contextFlags, FFX_FSR3UPSCALER_PASS_PREPARE_REACTIVITY, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelinePrepareReactivity));
+        pipelineDescription, &context->pipelinePrepareReactivity };
     
     wcscpy_s(pipelineDescription.name, L"FSR3-SHADING-CHANGE");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_SHADING_CHANGE,
+    pipelineTasks[pipelineTaskCount++] = { FFX_FSR3UPSCALER_PASS_SHADING_CHANGE,
         getPipelinePermutationFlags(contextFlags, FFX_FSR3UPSCALER_PASS_SHADING_CHANGE, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineShadingChange));
+        pipelineDescription, &context->pipelineShadingChange };
     
     wcscpy_s(pipelineDescription.name, L"FSR3-ACCUMULATE");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_ACCUMULATE,
+    pipelineTasks[pipelineTaskCount++] = { FFX_FSR3UPSCALER_PASS_ACCUMULATE,
         getPipelinePermutationFlags(contextFlags, FFX_FSR3UPSCALER_PASS_ACCUMULATE, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineAccumulate));
+        pipelineDescription, &context->pipelineAccumulate };
     
     wcscpy_s(pipelineDescription.name, L"FSR3-ACCUM_SHARP");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_ACCUMULATE_SHARPEN,
+    ffxDeferPipeline(&context->deferredPipelineAccumulateSharpen, FFX_FSR3UPSCALER_PASS_ACCUMULATE_SHARPEN,
         getPipelinePermutationFlags(contextFlags, FFX_FSR3UPSCALER_PASS_ACCUMULATE_SHARPEN, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineAccumulateSharpen));
+        &pipelineDescription, &context->pipelineAccumulateSharpen);
 
     wcscpy_s(pipelineDescription.name, L"FSR3-SHADING-CHANGE-PYRAMID");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_SHADING_CHANGE_PYRAMID,
+    pipelineTasks[pipelineTaskCount++] = { FFX_FSR3UPSCALER_PASS_SHADING_CHANGE_PYRAMID,
         getPipelinePermutationFlags(contextFlags, FFX_FSR3UPSCALER_PASS_SHADING_CHANGE_PYRAMID, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineShadingChangePyramid));
+        pipelineDescription, &context->pipelineShadingChangePyramid };
 
     wcscpy_s(pipelineDescription.name, L"FSR3-LUMA-INSTABILITY");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_LUMA_INSTABILITY,
+    pipelineTasks[pipelineTaskCount++] = { FFX_FSR3UPSCALER_PASS_LUMA_INSTABILITY,
         getPipelinePermutationFlags(contextFlags, FFX_FSR3UPSCALER_PASS_LUMA_INSTABILITY, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineLumaInstability));
+        pipelineDescription, &context->pipelineLumaInstability };
 
     wcscpy_s(pipelineDescription.name, L"FSR3-DEBUG-VIEW");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_DEBUG_VIEW,
+    ffxDeferPipeline(&context->deferredPipelineDebugView, FFX_FSR3UPSCALER_PASS_DEBUG_VIEW,
         getPipelinePermutationFlags(contextFlags, FFX_FSR3UPSCALER_PASS_DEBUG_VIEW, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineDebugView));
+        &pipelineDescription, &context->pipelineDebugView);
+
+    // the pipelines are independent, create them on as many threads as the task scheduler allows
+    FFX_VALIDATE(ffxCreatePipelines(&context->contextDescription.backendInterface, FFX_EFFECT_FSR3UPSCALER, context->effectContextId, pipelineTasks, pipelineTaskCount));
 
     // for each pipeline: re-route/fix-up IDs based on names
     FFX_VALIDATE(patchResourceBindings(&context->pipelinePrepareInputs));
@@ -488,17 +506,18 @@ static FfxErrorCode createPipelineStates(FfxFsr3UpscalerContext_Private* context
     FFX_VALIDATE(patchResourceBindings(&context->pipelineShadingChange));
     FFX_VALIDATE(patchResourceBindings(&context->pipelineAccumulate));
     FFX_VALIDATE(patchResourceBindings(&context->pipelineLumaPyramid));
-    FFX_VALIDATE(patchResourceBindings(&context->pipelineAccumulateSharpen));
-    FFX_VALIDATE(patchResourceBindings(&context->pipelineRCAS));
-    FFX_VALIDATE(patchResourceBindings(&context->pipelineGenerateReactive));
     FFX_VALIDATE(patchResourceBindings(&context->pipelineTcrAutogenerate));
     FFX_VALIDATE(patchResourceBindings(&context->pipelineShadingChangePyramid));
     FFX_VALIDATE(patchResourceBindings(&context->pipelineLumaInstability));
-    FFX_VALIDATE(patchResourceBindings(&context->pipelineDebugView));
 
     return FFX_OK;
 }
 
+static FfxErrorCode resolveDeferredPipeline(FfxFsr3UpscalerContext_Private* context, FfxDeferredPipeline* deferredPipeline)
+{
+    return ffxResolveDeferredPipelines(&context->contextDescription.backendInterface, FFX_EFFECT_FSR3UPSCALER, context->effectContextId, &deferredPipeline, 1, patchResourceBindings);
+}
+
 static FfxErrorCode generateReactiveMaskInternal(FfxFsr3UpscalerContext_Private* contextPrivate, const FfxFsr3UpscalerDispatchDescription* params);
 
 static FfxErrorCode fsr3upscalerCreate(FfxFsr3UpscalerContext_Private* context, const FfxFsr3UpscalerContextDescription* contextDescription)
@@ -758,7 +777,12 @@ static void setupDeviceDepthToViewSpaceDepthParams(FfxFsr3UpscalerContext_Privat
 
 static void scheduleDispatch(FfxFsr3UpscalerContext_Private* context, const FfxFsr3UpscalerDispatchDescription*, const FfxPipelineState* pipeline, uint32_t dispatchX, uint32_t dispatchY)
 {
-    FfxComputeJobDescription jobDescriptor = {};
+    // the job is built in place: a compute job description is about 40KB, most of it the pipeline state
+    FfxGpuJobDescription dispatchJob = { FFX_GPU_JOB_COMPUTE };
+#ifdef FFX_DEBUG
+    wcscpy_s(dispatchJob.jobLabel, pipeline->name);
+#endif
+    FfxComputeJobDescription& jobDescriptor = dispatchJob.computeJobDescriptor;
 
     for (uint32_t currentShaderResourceViewIndex = 0; currentShaderResourceViewIndex < pipeline->srvTextureCount; ++currentShaderResourceViewIndex) {
 
@@ -803,10 +827,6 @@ static void scheduleDispatch(FfxFsr3UpscalerContext_Private* context, const FfxF
         jobDescriptor.cbs[currentRootConstantIndex] = context->constantBuffers[pipeline->constantBufferBindings[currentRootConstantIndex].resourceIdentifier];
     }
 
-    FfxGpuJobDescription dispatchJob = { FFX_GPU_JOB_COMPUTE };
-    wcscpy_s(dispatchJob.jobLabel, pipeline->name);
-    dispatchJob.computeJobDescriptor = jobDescriptor;
-
     context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &dispatchJob);
 }
 
@@ -830,17 +850,37 @@ FFX_API FfxErrorCode ffxFsr3UpscalerGetSharedResourceDescriptions(FfxFsr3Upscale
     return FFX_OK;
 }
 
-static FfxErrorCode fsr3upscalerDispatch(FfxFsr3UpscalerContext_Private* context, const FfxFsr3UpscalerDispatchDescription* params)
+// pipelines and thread group counts of the passes recorded for one dispatch, null pipelines are skipped
+typedef struct Fsr3UpscalerDispatchPasses
 {
+    const FfxPipelineState* pipelines[FSR3UPSCALER_DISPATCH_PASS_COUNT];
+    uint32_t                dispatchX[FSR3UPSCALER_DISPATCH_PASS_COUNT];
+    uint32_t                dispatchY[FSR3UPSCALER_DISPATCH_PASS_COUNT];
+} Fsr3UpscalerDispatchPasses;
 
+static FfxErrorCode fsr3upscalerPrepareDispatch(FfxFsr3UpscalerContext_Private* context, const FfxFsr3UpscalerDispatchDescription* params)
+{
     if ((context->contextDescription.flags & FFX_FSR3UPSCALER_ENABLE_DEBUG_CHECKING) == FFX_FSR3UPSCALER_ENABLE_DEBUG_CHECKING)
     {
         fsr3upscalerDebugCheckDispatch(context, params);
     }
 
-    // take a short cut to the command list
-    FfxCommandList commandList = params->commandList;
+    // create the pipelines of optional passes the first time a dispatch uses them
+    if (params->enableSharpening)
+    {
+        FFX_VALIDATE(resolveDeferredPipeline(context, &context->deferredPipelineAccumulateSharpen));
+        FFX_VALIDATE(resolveDeferredPipeline(context, &context->deferredPipelineRCAS));
+    }
+    if (params->flags & FFX_FSR3UPSCALER_DISPATCH_DRAW_DEBUG_VIEW)
+        FFX_VALIDATE(resolveDeferredPipeline(context, &context->deferredPipelineDebugView));
+
+    return FFX_OK;
+}
 
+// registers the inputs, stages the constants and queues the clears of a dispatch, the passes are
+// returned in passes so that a batch can interleave them with those of other views
+static void fsr3upscalerRecordDispatch(FfxFsr3UpscalerContext_Private* context, const FfxFsr3UpscalerDispatchDescription* params, Fsr3UpscalerDispatchPasses* passes)
+{
     if (context->firstExecution)
     {
         FfxGpuJobDescription clearJob = { FFX_GPU_JOB_CLEAR_FLOAT };
@@ -1139,14 +1179,21 @@ static FfxErrorCode fsr3upscalerDispatch(FfxFsr3UpscalerContext_Private* context
         }
     }
 
-    scheduleDispatch(context, params, &context->pipelinePrepareInputs, dispatchSrcX, dispatchSrcY);
-    scheduleDispatch(context, params, &context->pipelineLumaPyramid, dispatchThreadGroupCountXY[0], dispatchThreadGroupCountXY[1]);
-    scheduleDispatch(context, params, &context->pipelineShadingChangePyramid, dispatchThreadGroupCountXY[0], dispatchThreadGroupCountXY[1]);
-    scheduleDispatch(context, params, &context->pipelineShadingChange, dispatchShadingChangePassX, dispatchShadingChangePassY);
-    scheduleDispatch(context, params, &context->pipelinePrepareReactivity, dispatchSrcX, dispatchSrcY);
-    scheduleDispatch(context, params, &context->pipelineLumaInstability, dispatchSrcX, dispatchSrcY);
+    const auto setPass = [passes](uint32_t passIndex, const FfxPipelineState* pipeline, uint32_t dispatchX, uint32_t dispatchY) {
+        passes->pipelines[passIndex] = pipeline;
+        passes->dispatchX[passIndex] = dispatchX;
+        passes->dispatchY[passIndex] = dispatchY;
+    };
+
+    memset(passes, 0, sizeof(Fsr3UpscalerDispatchPasses));
+    setPass(0, &context->pipelinePrepareInputs, dispatchSrcX, dispatchSrcY);
+    setPass(1, &context->pipelineLumaPyramid, dispatchThreadGroupCountXY[0], dispatchThreadGroupCountXY[1]);
+    setPass(2, &context->pipelineShadingChangePyramid, dispatchThreadGroupCountXY[0], dispatchThreadGroupCountXY[1]);
+    setPass(3, &context->pipelineShadingChange, dispatchShadingChangePassX, dispatchShadingChangePassY);
+    setPass(4, &context->pipelinePrepareReactivity, dispatchSrcX, dispatchSrcY);
+    setPass(5, &context->pipelineLumaInstability, dispatchSrcX, dispatchSrcY);
 
-    scheduleDispatch(context, params, params->enableSharpening ? &context->pipelineAccumulateSharpen : &context->pipelineAccumulate, dispatchDstX, dispatchDstY);
+    setPass(6, params->enableSharpening ? &context->pipelineAccumulateSharpen : &context->pipelineAccumulate, dispatchDstX, dispatchDstY);
 
     // RCAS
     if (params->enableSharpening)
@@ -1156,17 +1203,34 @@ static FfxErrorCode fsr3upscalerDispatch(FfxFsr3UpscalerContext_Private* context
         const int32_t threadGroupWorkRegionDimRCAS = 16;
         const int32_t dispatchX = (context->constants.upscaleSize[0] + (threadGroupWorkRegionDimRCAS - 1)) / threadGroupWorkRegionDimRCAS;
         const int32_t dispatchY = (context->constants.upscaleSize[1] + (threadGroupWorkRegionDimRCAS - 1)) / threadGroupWorkRegionDimRCAS;
-        scheduleDispatch(context, params, &context->pipelineRCAS, dispatchX, dispatchY);
+        setPass(7, &context->pipelineRCAS, dispatchX, dispatchY);
     }
     
     if (params->flags & FFX_FSR3UPSCALER_DISPATCH_DRAW_DEBUG_VIEW) {
-        scheduleDispatch(context, params, &context->pipelineDebugView, dispatchDstX, dispatchDstY);
+        setPass(8, &context->pipelineDebugView, dispatchDstX, dispatchDstY);
     }
 
     context->resourceFrameIndex = (context->resourceFrameIndex + 1) % FSR3UPSCALER_MAX_QUEUED_FRAMES;
 
     // Fsr3UpscalerMaxQueuedFrames must be an even number.
     FFX_STATIC_ASSERT((FSR3UPSCALER_MAX_QUEUED_FRAMES & 1) == 0);
+}
+
+static FfxErrorCode fsr3upscalerDispatch(FfxFsr3UpscalerContext_Private* context, const FfxFsr3UpscalerDispatchDescription* params)
+{
+    FFX_VALIDATE(fsr3upscalerPrepareDispatch(context, params));
+
+    // take a short cut to the command list
+    FfxCommandList commandList = params->commandList;
+
+    Fsr3UpscalerDispatchPasses passes;
+    fsr3upscalerRecordDispatch(context, params, &passes);
+
+    for (uint32_t passIndex = 0; passIndex < FSR3UPSCALER_DISPATCH_PASS_COUNT; ++passIndex) {
+
+        if (passes.pipelines[passIndex])
+            scheduleDispatch(context, params, passes.pipelines[passIndex], passes.dispatchX[passIndex], passes.dispatchY[passIndex]);
+    }
 
     context->contextDescription.backendInterface.fpExecuteGpuJobs(&context->contextDescription.backendInterface, commandList, context->effectContextId);
 
@@ -1176,6 +1240,39 @@ static FfxErrorCode fsr3upscalerDispatch(FfxFsr3UpscalerContext_Private* context
     return FFX_OK;
 }
 
+static FfxErrorCode fsr3upscalerDispatchBatch(FfxFsr3UpscalerContext_Private* const* contexts, const FfxFsr3UpscalerDispatchDescription* params, uint32_t viewCount)
+{
+    // resolve everything that can fail before the first job is queued, a failing view must not leave a partial batch behind
+    for (uint32_t viewIndex = 0; viewIndex < viewCount; ++viewIndex)
+        FFX_VALIDATE(fsr3upscalerPrepareDispatch(contexts[viewIndex], &params[viewIndex]));
+
+    Fsr3UpscalerDispatchPasses passes[FFX_FSR3UPSCALER_MAX_BATCH_VIEW_COUNT];
+    for (uint32_t viewIndex = 0; viewIndex < viewCount; ++viewIndex)
+        fsr3upscalerRecordDispatch(contexts[viewIndex], &params[viewIndex], &passes[viewIndex]);
+
+    // interleave the views pass by pass, the contexts share their pipelines through the backend so the
+    // backend state filtering keeps the shader and most of the bindings between consecutive views
+    for (uint32_t passIndex = 0; passIndex < FSR3UPSCALER_DISPATCH_PASS_COUNT; ++passIndex) {
+
+        for (uint32_t viewIndex = 0; viewIndex < viewCount; ++viewIndex) {
+
+            const Fsr3UpscalerDispatchPasses& viewPasses = passes[viewIndex];
+            if (viewPasses.pipelines[passIndex])
+                scheduleDispatch(contexts[viewIndex], &params[viewIndex], viewPasses.pipelines[passIndex], viewPasses.dispatchX[passIndex], viewPasses.dispatchY[passIndex]);
+        }
+    }
+
+    // the job queue belongs to the backend, a single execute submits the jobs of every view
+    FfxInterface* backendInterface = &contexts[0]->contextDescription.backendInterface;
+    backendInterface->fpExecuteGpuJobs(backendInterface, params[0].commandList, contexts[0]->effectContextId);
+
+    // release dynamic resources
+    for (uint32_t viewIndex = 0; viewIndex < viewCount; ++viewIndex)
+        backendInterface->fpUnregisterResources(backendInterface, params[viewIndex].commandList, contexts[viewIndex]->effectContextId);
+
+    return FFX_OK;
+}
+
 FFX_API FfxErrorCode ffxFsr3UpscalerContextCreate(FfxFsr3UpscalerContext* context, const FfxFsr3UpscalerContextDescription* contextDescription)
 {
     // zero context memory
@@ -1238,17 +1335,8 @@ FfxErrorCode ffxFsr3UpscalerContextDestroy(FfxFsr3UpscalerContext* context)
     return errorCode;
 }
 
-FfxErrorCode ffxFsr3UpscalerContextDispatch(FfxFsr3UpscalerContext* context, const FfxFsr3UpscalerDispatchDescription* dispatchParams)
+static FfxErrorCode validateDispatch(const FfxFsr3UpscalerContext_Private* contextPrivate, const FfxFsr3UpscalerDispatchDescription* dispatchParams)
 {
-    FFX_RETURN_ON_ERROR(
-        context,
-        FFX_ERROR_INVALID_POINTER);
-    FFX_RETURN_ON_ERROR(
-        dispatchParams,
-        FFX_ERROR_INVALID_POINTER);
-
-    FfxFsr3UpscalerContext_Private* contextPrivate = (FfxFsr3UpscalerContext_Private*)(context);
-
     // validate that renderSize is within the maximum.
     FFX_RETURN_ON_ERROR(
         dispatchParams->renderSize.width <= contextPrivate->contextDescription.maxRenderSize.width,
@@ -1266,11 +1354,95 @@ FfxErrorCode ffxFsr3UpscalerContextDispatch(FfxFsr3UpscalerContext* context, con
         contextPrivate->device,
         FFX_ERROR_NULL_DEVICE);
 
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFsr3UpscalerContextDispatch(FfxFsr3UpscalerContext* context, const FfxFsr3UpscalerDispatchDescription* dispatchParams)
+{
+    FFX_RETURN_ON_ERROR(
+        context,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        dispatchParams,
+        FFX_ERROR_INVALID_POINTER);
+
+    FfxFsr3UpscalerContext_Private* contextPrivate = (FfxFsr3UpscalerContext_Private*)(context);
+    FFX_VALIDATE(validateDispatch(contextPrivate, dispatchParams));
+
     // dispatch the FSR3 passes.
     const FfxErrorCode errorCode = fsr3upscalerDispatch(contextPrivate, dispatchParams);
     return errorCode;
 }
 
+FfxErrorCode ffxFsr3UpscalerContextDispatchBatch(FfxFsr3UpscalerContext* const* contexts, const FfxFsr3UpscalerDispatchDescription* dispatchParams, uint32_t viewCount)
+{
+    FFX_RETURN_ON_ERROR(
+        contexts,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        dispatchParams,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        viewCount > 0 && viewCount <= FFX_FSR3UPSCALER_MAX_BATCH_VIEW_COUNT,
+        FFX_ERROR_INVALID_ARGUMENT);
+
+    // every view of a full batch has to fit the job queue of the backend
+    FFX_STATIC_ASSERT(FFX_FSR3UPSCALER_MAX_BATCH_VIEW_COUNT * FSR3UPSCALER_MAX_JOBS_PER_DISPATCH <= FFX_MAX_GPU_JOBS);
+
+    FfxFsr3UpscalerContext_Private* contextsPrivate[FFX_FSR3UPSCALER_MAX_BATCH_VIEW_COUNT];
+    for (uint32_t viewIndex = 0; viewIndex < viewCount; ++viewIndex) {
+
+        FFX_RETURN_ON_ERROR(
+            contexts[viewIndex],
+            FFX_ERROR_INVALID_POINTER);
+
+        contextsPrivate[viewIndex] = (FfxFsr3UpscalerContext_Private*)(contexts[viewIndex]);
+        FFX_VALIDATE(validateDispatch(contextsPrivate[viewIndex], &dispatchParams[viewIndex]));
+
+        // the views are recorded into one job queue and share their pipelines, so they must come from
+        // the same backend, command list and context configuration
+        const FfxFsr3UpscalerContextDescription& firstDescription = contextsPrivate[0]->contextDescription;
+        const FfxFsr3UpscalerContextDescription& viewDescription = contextsPrivate[viewIndex]->contextDescription;
+        FFX_RETURN_ON_ERROR(
+            viewDescription.backendInterface.scratchBuffer == firstDescription.backendInterface.scratchBuffer,
+            FFX_ERROR_INVALID_ARGUMENT);
+        FFX_RETURN_ON_ERROR(
+            viewDescription.flags == firstDescription.flags,
+            FFX_ERROR_INVALID_ARGUMENT);
+        FFX_RETURN_ON_ERROR(
+            dispatchParams[viewIndex].commandList == dispatchParams[0].commandList,
+            FFX_ERROR_INVALID_ARGUMENT);
+
+        // a context appearing twice would record its temporal history twice in one frame
+        for (uint32_t otherIndex = 0; otherIndex < viewIndex; ++otherIndex)
+            FFX_RETURN_ON_ERROR(
+                contextsPrivate[otherIndex] != contextsPrivate[viewIndex],
+                FFX_ERROR_INVALID_ARGUMENT);
+    }
+
+    // dispatch the FSR3 passes of every view.
+    const FfxErrorCode errorCode = fsr3upscalerDispatchBatch(contextsPrivate, dispatchParams, viewCount);
+    return errorCode;
+}
+
+FfxErrorCode ffxFsr3UpscalerContextPrewarmPipelines(FfxFsr3UpscalerContext* context)
+{
+    FFX_RETURN_ON_ERROR(
+        context,
+        FFX_ERROR_INVALID_POINTER);
+
+    FfxFsr3UpscalerContext_Private* contextPrivate = (FfxFsr3UpscalerContext_Private*)(context);
+
+    FfxDeferredPipeline* deferredPipelines[] = {
+        &contextPrivate->deferredPipelineAccumulateSharpen,
+        &contextPrivate->deferredPipelineRCAS,
+        &contextPrivate->deferredPipelineGenerateReactive,
+        &contextPrivate->deferredPipelineDebugView,
+    };
+    return ffxResolveDeferredPipelines(&contextPrivate->contextDescription.backendInterface, FFX_EFFECT_FSR3UPSCALER, contextPrivate->effectContextId,
+        deferredPipelines, FFX_ARRAY_ELEMENTS(deferredPipelines), patchResourceBindings);
+}
+
 FFX_API float ffxFsr3UpscalerGetUpscaleRatioFromQualityMode(FfxFsr3UpscalerQualityMode qualityMode)
 {
     switch (qualityMode) {
@@ -1366,6 +1538,8 @@ FfxErrorCode ffxFsr3UpscalerContextGenerateReactiveMask(FfxFsr3UpscalerContext*
         contextPrivate->device,
         FFX_ERROR_NULL_DEVICE);
 
+    FFX_VALIDATE(resolveDeferredPipeline(contextPrivate, &contextPrivate->deferredPipelineGenerateReactive));
+
     // take a short cut to the command list
     FfxCommandList commandList = params->commandList;
 
@@ -22,6 +22,7 @@
 
 #pragma once
 #include <FidelityFX/gpu/fsr3upscaler/ffx_fsr3upscaler_resources.h>
+#include <ffx_object_management.h>
 
 /// An enumeration of all the permutations that can be passed to the FSR3 Upscaler algorithm.
 ///
@@ -104,6 +105,10 @@ typedef struct FfxFsr3UpscalerContext_Private {
     FfxPipelineState                    pipelineShadingChangePyramid;
     FfxPipelineState                    pipelineLumaInstability;
     FfxPipelineState                    pipelineDebugView;
+    FfxDeferredPipeline                 deferredPipelineAccumulateSharpen;
+    FfxDeferredPipeline                 deferredPipelineRCAS;
+    FfxDeferredPipeline                 deferredPipelineGenerateReactive;
+    FfxDeferredPipeline                 deferredPipelineDebugView;
     FfxConstantBuffer                   constantBuffers[FFX_FSR3UPSCALER_CONSTANTBUFFER_COUNT];
 
     // 2 arrays of resources, as e.g. FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_LOCK_STATUS will use different resources when bound as SRV vs when bound as UAV
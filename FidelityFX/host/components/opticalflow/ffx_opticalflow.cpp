@@ -43,8 +43,11 @@
 
 typedef struct Binding
 {
-    uint32_t    index;
-    wchar_t     name[64];
+    uint32_t        index;
+    uint32_t        nameHash;
+    const wchar_t*  name;
+
+    constexpr Binding(uint32_t index, const wchar_t* name) : index(index), nameHash(ffxHashBindingName(name)), name(name) {}
 }Binding;
 
 static const Binding srvBindingNames[] =
@@ -109,7 +112,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(srvBindingNames); ++mapIndex)
         {
-            if (0 == wcscmp(srvBindingNames[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
+            if (srvBindingNames[mapIndex].nameHash == inoutPipeline->srvTextureBindings[srvIndex].nameHash)
                 break;
         }
         FFX_ASSERT(mapIndex < _countof(srvBindingNames));
@@ -124,7 +127,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(uavBindingNames); ++mapIndex)
         {
-            if (0 == wcscmp(uavBindingNames[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
+            if (uavBindingNames[mapIndex].nameHash == inoutPipeline->uavTextureBindings[uavIndex].nameHash)
                 break;
         }
         FFX_ASSERT(mapIndex < _countof(uavBindingNames));
@@ -139,7 +142,7 @@ static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
         int32_t mapIndex = 0;
         for (mapIndex = 0; mapIndex < _countof(cbBindingNames); ++mapIndex)
         {
-            if (0 == wcscmp(cbBindingNames[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
+            if (cbBindingNames[mapIndex].nameHash == inoutPipeline->constantBufferBindings[cbIndex].nameHash)
                 break;
         }
         FFX_ASSERT(mapIndex < _countof(cbBindingNames));
@@ -200,19 +203,18 @@ static FfxErrorCode createPipelineStates(FfxOpticalflowContext_Private* context)
 
     uint32_t contextFlags = context->contextDescription.flags;
 
+    FfxCreatePipelineTask pipelineTasks[7] = {};
+    uint32_t pipelineTaskCount = 0;
+
     auto CreateComputePipeline = [&](FfxPass pass, const wchar_t* name, FfxPipelineState* pipeline) -> FfxErrorCode {
+        FFX_ASSERT(pipelineTaskCount < sizeof(pipelineTasks) / sizeof(pipelineTasks[0]));
         ffxSafeReleasePipeline(&context->contextDescription.backendInterface, pipeline, context->effectContextId);
         wcscpy_s(pipelineDescription.name, name);
-        FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(
-            &context->contextDescription.backendInterface,
-            FFX_EFFECT_OPTICALFLOW,
-            pass,
+        pipelineTasks[pipelineTaskCount++] = { pass,
             getPipelinePermutationFlags(contextFlags, pass, supportedFP16, canForceWave64, useLut),
-            &pipelineDescription,
-            context->effectContextId,
-            pipeline));
+            pipelineDescription,
+            pipeline };
 
-        patchResourceBindings(pipeline);
         return FFX_OK;
     };
 
@@ -225,6 +227,14 @@ static FfxErrorCode createPipelineStates(FfxOpticalflowContext_Private* context)
     CreateComputePipeline(FFX_OPTICALFLOW_PASS_FILTER_OPTICAL_FLOW_V5, L"Opticalflow_Filter", &context->pipelineFilterOpticalFlowV5);
     CreateComputePipeline(FFX_OPTICALFLOW_PASS_SCALE_OPTICAL_FLOW_ADVANCED_V5, L"Opticalflow_Upscale", &context->pipelineScaleOpticalFlowAdvancedV5);
 
+    // the pipelines are independent, create them on as many threads as the task scheduler allows
+    ffxCreatePipelines(&context->contextDescription.backendInterface, FFX_EFFECT_OPTICALFLOW, context->effectContextId, pipelineTasks, pipelineTaskCount);
+    for (uint32_t taskIndex = 0; taskIndex < pipelineTaskCount; ++taskIndex)
+    {
+        if (pipelineTasks[taskIndex].errorCode == FFX_OK)
+            patchResourceBindings(pipelineTasks[taskIndex].pipeline);
+    }
+
     return FFX_OK;
 }
 
@@ -506,7 +516,9 @@ static void scheduleDispatch(FfxOpticalflowContext_Private* context, const FfxPi
     }
 
     FfxGpuJobDescription dispatchJob = { FFX_GPU_JOB_COMPUTE };
+#ifdef FFX_DEBUG
     wcscpy_s(dispatchJob.jobLabel, pipelineName);
+#endif
     dispatchJob.computeJobDescriptor = jobDescriptor;
 
     context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &dispatchJob);
@@ -283,6 +283,21 @@ typedef struct FfxFrameInterpolationDispatchDescription {
 
 FFX_API FfxErrorCode ffxFrameInterpolationDispatch(FfxFrameInterpolationContext* context, const FfxFrameInterpolationDispatchDescription* params);
 
+/// Create the debug view pipeline up front instead of on the first dispatch
+/// that sets <c><i>FFX_FRAMEINTERPOLATION_DISPATCH_DRAW_DEBUG_VIEW</i></c>.
+///
+/// @param [in] context                 A pointer to a <c><i>FfxFrameInterpolationContext</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_CODE_NULL_POINTER         The operation failed because <c><i>context</i></c> was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_BACKEND_API_ERROR         The operation failed because of an error returned from the backend.
+///
+/// @ingroup FRAMEINTERPOLATION
+FFX_API FfxErrorCode ffxFrameInterpolationContextPrewarmPipelines(FfxFrameInterpolationContext* context);
+
 /// Destroy the FidelityFX Super Resolution context.
 ///
 /// @param [out] context                A pointer to a <c><i>FfxFsr3Context</i></c> structure to destroy.
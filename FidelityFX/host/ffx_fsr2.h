@@ -347,6 +347,27 @@ FFX_API FfxErrorCode ffxFsr2ContextDispatch(FfxFsr2Context* pContext, const FfxF
 /// @ingroup ffxFsr2
 FFX_API FfxErrorCode ffxFsr2ContextGenerateReactiveMask(FfxFsr2Context* pContext, const FfxFsr2GenerateReactiveDescription* pParams);
 
+/// Create the pipelines of the optional passes up front.
+///
+/// The pipelines of passes that only some dispatches use (sharpening, the
+/// automatic reactive mask and <c><i>ffxFsr2ContextGenerateReactiveMask</i></c>)
+/// are created by the first dispatch that needs them. Applications which
+/// prefer to pay that cost at load time rather than on the first frame that
+/// enables one of those features can call this function after creating the
+/// context.
+///
+/// @param [in] pContext                 A pointer to a <c><i>FfxFsr2Context</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_CODE_NULL_POINTER         The operation failed because <c><i>context</i></c> was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_BACKEND_API_ERROR         The operation failed because of an error returned from the backend.
+///
+/// @ingroup ffxFsr2
+FFX_API FfxErrorCode ffxFsr2ContextPrewarmPipelines(FfxFsr2Context* pContext);
+
 /// Destroy the FidelityFX Super Resolution context.
 ///
 /// @param [out] pContext                A pointer to a <c><i>FfxFsr2Context</i></c> structure to destroy.
@@ -213,7 +213,23 @@ typedef struct FfxFsr3DispatchFrameGenerationPrepareDescription
     uint64_t                    frameID;
 } FfxFsr3DispatchFrameGenerationPrepareDescription;
 
-FFX_API FfxErrorCode ffxFsr3DispatchFrameGeneration(const FfxFrameGenerationDispatchDescription* desc);
+/// Generate the interpolated frame of a FSR3 context.
+///
+/// The signature matches <c><i>FfxFrameGenerationDispatchFunc</i></c>, so the function can be set as the
+/// <c><i>frameGenerationCallback</i></c> of a <c><i>FfxFrameGenerationConfig</i></c> with the context as its
+/// <c><i>frameGenerationCallbackContext</i></c>. Every context carries its own frame generation state, so several
+/// contexts (one per viewport, for example) can generate frames in the same process.
+///
+/// @param [in] desc                    A pointer to a <c><i>FfxFrameGenerationDispatchDescription</i></c> structure.
+/// @param [in] context                 A pointer to the <c><i>FfxFsr3Context</i></c> the frame belongs to.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The operation failed because either <c><i>desc</i></c> or <c><i>context</i></c> was <c><i>NULL</i></c>.
+///
+/// @ingroup FSR3
+FFX_API FfxErrorCode ffxFsr3DispatchFrameGeneration(const FfxFrameGenerationDispatchDescription* desc, void* context);
 
 /// A structure encapsulating the parameters for automatic generation of a reactive mask
 ///
@@ -279,6 +295,12 @@ typedef struct FfxFsr3Context
 /// disabled by a user. To destroy the FSR3 context you should call
 /// <c><i>ffxFsr3ContextDestroy</i></c>.
 ///
+/// Several FSR3 contexts can be alive at once. Each one owns its upscaler,
+/// optical flow and frame interpolation contexts and their resources, while
+/// pipelines and shader blobs are shared through the backend caches. Contexts
+/// created on the same backend interface need scratch memory for
+/// <c><i>FFX_FSR3_CONTEXT_COUNT</i></c> effect contexts each.
+///
 /// @param [out] context                A pointer to a <c><i>FfxFsr3Context</i></c> structure to populate.
 /// @param [in]  contextDescription     A pointer to a <c><i>FfxFsr3ContextDescription</i></c> structure.
 ///
@@ -57,6 +57,11 @@
 /// @ingroup ffxFsr3Upscaler
 #define FFX_FSR3UPSCALER_CONTEXT_SIZE (FFX_SDK_DEFAULT_CONTEXT_SIZE)
 
+/// The maximum number of views <c><i>ffxFsr3UpscalerContextDispatchBatch</i></c> accepts in one call.
+///
+/// @ingroup ffxFsr3Upscaler
+#define FFX_FSR3UPSCALER_MAX_BATCH_VIEW_COUNT   8
+
 #if defined(__cplusplus)
 extern "C" {
 #endif // #if defined(__cplusplus)
@@ -372,6 +377,38 @@ FFX_API FfxErrorCode ffxFsr3UpscalerContextGetGpuMemoryUsage(FfxFsr3UpscalerCont
 /// @ingroup ffxFsr3Upscaler
 FFX_API FfxErrorCode ffxFsr3UpscalerContextDispatch(FfxFsr3UpscalerContext* pContext, const FfxFsr3UpscalerDispatchDescription* pDispatchDescription);
 
+/// Dispatch FidelityFX Super Resolution 3 for several views in one call.
+///
+/// Each view (for example the eyes of a stereo renderer or the panes of a
+/// split screen) keeps its own temporal history and therefore needs its own
+/// <c><i>FfxFsr3UpscalerContext</i></c>. All contexts of a batch must be
+/// created with the same flags on the same backend interface, and every
+/// dispatch description must target the same command list. The views are
+/// recorded pass by pass, so consecutive dispatches run the same pipeline,
+/// and the queued work is submitted to the backend once for the whole batch.
+/// The result is identical to calling
+/// <c><i>ffxFsr3UpscalerContextDispatch</i></c> for each view in order.
+///
+/// @param [in] pContexts                An array of <c><i>viewCount</i></c> pointers to distinct <c><i>FfxFsr3UpscalerContext</i></c> structures.
+/// @param [in] pDispatchDescriptions    An array of <c><i>viewCount</i></c> <c><i>FfxFsr3UpscalerDispatchDescription</i></c> structures, one per context.
+/// @param [in] viewCount                The number of views, between 1 and <c><i>FFX_FSR3UPSCALER_MAX_BATCH_VIEW_COUNT</i></c>.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_CODE_NULL_POINTER         The operation failed because either <c><i>pContexts</i></c>, one of its entries or <c><i>pDispatchDescriptions</i></c> was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          The operation failed because <c><i>viewCount</i></c> was out of range, a context appeared twice or the views do not share a backend, flags and command list.
+/// @retval
+/// FFX_ERROR_OUT_OF_RANGE              The operation failed because the render or upscale size of a view was larger than the maximum of its context.
+/// @retval
+/// FFX_ERROR_NULL_DEVICE               The operation failed because the device inside a context was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_BACKEND_API_ERROR         The operation failed because of an error returned from the backend.
+///
+/// @ingroup ffxFsr3Upscaler
+FFX_API FfxErrorCode ffxFsr3UpscalerContextDispatchBatch(FfxFsr3UpscalerContext* const* pContexts, const FfxFsr3UpscalerDispatchDescription* pDispatchDescriptions, uint32_t viewCount);
+
 /// A helper function generate a Reactive mask from an opaque only texure and one containing translucent objects.
 ///
 /// @param [in] pContext                 A pointer to a <c><i>FfxFsr3UpscalerContext</i></c> structure.
@@ -383,6 +420,27 @@ FFX_API FfxErrorCode ffxFsr3UpscalerContextDispatch(FfxFsr3UpscalerContext* pCon
 /// @ingroup ffxFsr3Upscaler
 FFX_API FfxErrorCode ffxFsr3UpscalerContextGenerateReactiveMask(FfxFsr3UpscalerContext* pContext, const FfxFsr3UpscalerGenerateReactiveDescription* pParams);
 
+/// Create the pipelines of the optional passes up front.
+///
+/// The pipelines of passes that only some dispatches use (sharpening, the
+/// debug view and <c><i>ffxFsr3UpscalerContextGenerateReactiveMask</i></c>)
+/// are created by the first dispatch that needs them. Applications which
+/// prefer to pay that cost at load time rather than on the first frame that
+/// enables one of those features can call this function after creating the
+/// context.
+///
+/// @param [in] pContext                 A pointer to a <c><i>FfxFsr3UpscalerContext</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_CODE_NULL_POINTER         The operation failed because <c><i>context</i></c> was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_BACKEND_API_ERROR         The operation failed because of an error returned from the backend.
+///
+/// @ingroup ffxFsr3Upscaler
+FFX_API FfxErrorCode ffxFsr3UpscalerContextPrewarmPipelines(FfxFsr3UpscalerContext* pContext);
+
 /// Destroy the FidelityFX Super Resolution context.
 ///
 /// @param [out] pContext                A pointer to a <c><i>FfxFsr3UpscalerContext</i></c> structure to destroy.
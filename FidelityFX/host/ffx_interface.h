@@ -394,12 +394,37 @@ typedef FfxErrorCode (*FfxCreatePipelineFunc)(
     FfxUInt32 effectContextId,
     FfxPipelineState* outPipeline);
 
+/// Get the shader blob of a pass permutation, with its bytecode and reflection.
+///
+/// The bytecode of a compressed or packed blob is pinned in memory until it is
+/// released with <c><i>FfxReleasePermutationBlobFunc</i></c>, every successful
+/// call must be paired with one release.
+///
+/// @param [in] effectId                            The effect the pass belongs to.
+/// @param [in] passId                              The pass to get the blob of.
+/// @param [in] bindStage                           The shader stage to get the blob of.
+/// @param [in] permutationOptions                  The permutation flags of the pass.
+/// @param [out] outBlob                            A pointer to a <c><i>FfxShaderBlob</i></c> structure to fill in.
+///
+/// @retval
+/// FFX_OK                                          The operation completed successfully.
+/// @retval
+/// Anything else                                   The operation failed.
+///
+/// @ingroup FfxInterface
 typedef FfxErrorCode(*FfxGetPermutationBlobByIndexFunc)(FfxEffect effectId,
     FfxPass passId,
     FfxBindStage bindStage,
     uint32_t permutationOptions,
     FfxShaderBlob* outBlob);
 
+/// Release the bytecode of a blob returned by <c><i>FfxGetPermutationBlobByIndexFunc</i></c>.
+///
+/// @param [in] data                                The <c><i>data</i></c> of the returned blob, NULL does nothing.
+///
+/// @ingroup FfxInterface
+typedef void(*FfxReleasePermutationBlobFunc)(const uint8_t* data);
+
 /// Destroy a render pipeline.
 ///
 /// @param [in] backendInterface                    A pointer to the backend interface.
@@ -648,7 +673,7 @@ typedef struct FfxInterface {
     FfxBreadcrumbsWriteFunc            fpBreadcrumbsWrite;            ///< A callback function to write marker into AMD FidelityFX Breadcrumbs Library.
     FfxBreadcrumbsPrintDeviceInfoFunc  fpBreadcrumbsPrintDeviceInfo;  ///< A callback function to print active GPU info for AMD FidelityFX Breadcrumbs Library log.
 
-    FfxGetPermutationBlobByIndexFunc fpGetPermutationBlobByIndex;
+    FfxGetPermutationBlobByIndexFunc fpGetPermutationBlobByIndex;                      ///< A callback function to get a shader blob, released with <c><i>fpReleasePermutationBlob</i></c>.
     FfxSwapChainConfigureFrameGenerationFunc    fpSwapChainConfigureFrameGeneration;    ///< A callback function to configure swap chain present callback.
 
     FfxRegisterConstantBufferAllocatorFunc  fpRegisterConstantBufferAllocator;          ///< A callback function to register a custom <b>Thread Safe</b> constant buffer allocator.
@@ -657,6 +682,9 @@ typedef struct FfxInterface {
     size_t                             scratchBufferSize;             ///< Size of the buffer pointed to by <c><i>scratchBuffer</i></c>.
     FfxDevice                          device;                        ///< A backend specific device
 
+    // added last so the members above keep their offsets
+    FfxReleasePermutationBlobFunc      fpReleasePermutationBlob;      ///< A callback function to release a blob returned by <c><i>fpGetPermutationBlobByIndex</i></c>.
+
 } FfxInterface;
 
 #if defined(__cplusplus)
@@ -0,0 +1,87 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <FidelityFX/host/ffx_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // #ifdef __cplusplus
+
+/// @defgroup Tasks Tasks
+/// Task scheduling used by FidelityFX SDK functions to spread independent work, such as
+/// pipeline creation, across threads
+///
+/// @ingroup ffxHost
+
+/// A typedef for a unit of work handed to a task scheduler.
+///
+/// @param [in] taskData                The data the task was scheduled with.
+///
+/// @ingroup Tasks
+typedef void (*FfxTaskFunc)(void* taskData);
+
+/// A typedef for an application supplied task scheduler.
+///
+/// The scheduler must call task(taskData) exactly once, on any thread. The SDK keeps working
+/// on the calling thread and does not wait for tasks that have not started yet, so a scheduler
+/// that is busy or runs the task late never blocks the caller.
+///
+/// @param [in] task                    The task to run.
+/// @param [in] taskData                The data to pass to the task.
+/// @param [in] userData                The user data given to ffxSetTaskScheduler.
+///
+/// @ingroup Tasks
+typedef void (*FfxScheduleTaskFunc)(FfxTaskFunc task, void* taskData, void* userData);
+
+/// Configures how the SDK spreads independent work across threads.
+///
+/// By default all work runs serially on the calling thread. Backends must be able to create
+/// pipelines from several threads at once when more than one thread is allowed, for DX11 this
+/// means the device must not be created with D3D11_CREATE_DEVICE_SINGLETHREADED.
+///
+/// Without a scheduler the SDK starts its threads on the first batch that needs them and keeps
+/// them waiting for later batches. Calling this function again lets those threads exit and
+/// waits for them. It may be called from any thread, batches already running finish on their
+/// calling threads. It must not be called from a task.
+///
+/// @param [in] scheduler               The scheduler to hand tasks to, or NULL to use threads owned by the SDK.
+/// @param [in] userData                Passed back to the scheduler.
+/// @param [in] maxThreadCount          The number of threads, including the calling thread, that may work on one batch of tasks. 0 uses the number of hardware threads, 1 runs everything on the calling thread.
+///
+/// @ingroup Tasks
+FFX_API void ffxSetTaskScheduler(FfxScheduleTaskFunc scheduler, void* userData, uint32_t maxThreadCount);
+
+/// Runs a batch of tasks and returns once all of them have finished.
+///
+/// @param [in] task                    The function to run for every task.
+/// @param [in] taskData                The data of the first task.
+/// @param [in] taskDataStride          The distance in bytes between the data of two tasks.
+/// @param [in] taskCount               The number of tasks.
+///
+/// @ingroup Tasks
+FFX_API void ffxRunTasks(FfxTaskFunc task, void* taskData, size_t taskDataStride, uint32_t taskCount);
+
+#ifdef __cplusplus
+}
+#endif  // #ifdef __cplusplus
@@ -894,6 +894,7 @@ typedef struct FfxResourceBinding
     uint32_t    slotIndex;                      ///< The slot into which to bind the resource
     uint32_t    arrayIndex;                     ///< The resource offset for mip/array access
     uint32_t    resourceIdentifier;             ///< A unique resource identifier representing an internal resource index
+    uint32_t    nameHash;                       ///< The hash of the shader binding name, used to resolve the resource identifier
     wchar_t     name[FFX_RESOURCE_NAME_SIZE];   ///< A debug name to help track the resource binding
 }FfxResourceBinding;
 
@@ -1208,42 +1209,49 @@ typedef struct FfxShaderBlob {
 
     // constant buffers
     const char** boundConstantBufferNames;
+    const uint32_t* boundConstantBufferNameHashes;      ///< Pointer to an array of ConstantBuffer name hashes (see ffxHashBindingName)
     const uint32_t* boundConstantBuffers;               ///< Pointer to an array of bound ConstantBuffers.
     const uint32_t* boundConstantBufferCounts;          ///< Pointer to an array of bound ConstantBuffer resource counts
     const uint32_t* boundConstantBufferSpaces;          ///< Pointer to an array of bound ConstantBuffer resource spaces
 
     // srv textures
     const char** boundSRVTextureNames;
+    const uint32_t* boundSRVTextureNameHashes;          ///< Pointer to an array of SRV texture name hashes (see ffxHashBindingName)
     const uint32_t* boundSRVTextures;                   ///< Pointer to an array of bound SRV resources.
     const uint32_t* boundSRVTextureCounts;              ///< Pointer to an array of bound SRV resource counts
     const uint32_t* boundSRVTextureSpaces;              ///< Pointer to an array of bound SRV resource spaces
 
     // uav textures
     const char** boundUAVTextureNames;
+    const uint32_t* boundUAVTextureNameHashes;          ///< Pointer to an array of UAV texture name hashes (see ffxHashBindingName)
     const uint32_t* boundUAVTextures;                   ///< Pointer to an array of bound UAV texture resources.
     const uint32_t* boundUAVTextureCounts;              ///< Pointer to an array of bound UAV texture resource counts
     const uint32_t* boundUAVTextureSpaces;              ///< Pointer to an array of bound UAV texture resource spaces
 
     // srv buffers
     const char** boundSRVBufferNames;
+    const uint32_t* boundSRVBufferNameHashes;           ///< Pointer to an array of SRV buffer name hashes (see ffxHashBindingName)
     const uint32_t* boundSRVBuffers;                    ///< Pointer to an array of bound SRV buffer resources.
     const uint32_t* boundSRVBufferCounts;               ///< Pointer to an array of bound SRV buffer resource counts
     const uint32_t* boundSRVBufferSpaces;               ///< Pointer to an array of bound SRV buffer resource spaces
 
     // uav buffers
     const char** boundUAVBufferNames;
+    const uint32_t* boundUAVBufferNameHashes;           ///< Pointer to an array of UAV buffer name hashes (see ffxHashBindingName)
     const uint32_t* boundUAVBuffers;                    ///< Pointer to an array of bound UAV buffer resources.
     const uint32_t* boundUAVBufferCounts;               ///< Pointer to an array of bound UAV buffer resource counts
     const uint32_t* boundUAVBufferSpaces;               ///< Pointer to an array of bound UAV buffer resource spaces
 
     // samplers
     const char** boundSamplerNames;
+    const uint32_t* boundSamplerNameHashes;             ///< Pointer to an array of sampler name hashes (see ffxHashBindingName)
     const uint32_t* boundSamplers;                      ///< Pointer to an array of bound sampler resources.
     const uint32_t* boundSamplerCounts;                 ///< Pointer to an array of bound sampler resource counts
     const uint32_t* boundSamplerSpaces;                 ///< Pointer to an array of bound sampler resource spaces
 
     // rt acceleration structures
     const char** boundRTAccelerationStructureNames;
+    const uint32_t* boundRTAccelerationStructureNameHashes; ///< Pointer to an array of RT acceleration structure name hashes (see ffxHashBindingName)
     const uint32_t* boundRTAccelerationStructures;      ///< Pointer to an array of bound UAV buffer resources.
     const uint32_t* boundRTAccelerationStructureCounts; ///< Pointer to an array of bound UAV buffer resource counts
     const uint32_t* boundRTAccelerationStructureSpaces; ///< Pointer to an array of bound UAV buffer resource spaces
@@ -188,3 +188,23 @@ inline uint8_t ffxCountBitsSet(uint32_t val) noexcept
     return static_cast<uint8_t>(((c >> 16) + c) & 0x0000FFFF);
 #endif
 }
+
+/// Computes the 32-bit FNV-1a hash of a shader binding name.
+///
+/// The blob accessors store these hashes next to the binding names so that
+/// effects can resolve their bindings with integer compares. Binding names
+/// are ASCII, so narrow and wide strings hash to the same value.
+///
+/// @param [in] name Null terminated binding name.
+///
+/// @return The hash of the name.
+///
+/// @ingroup Utils
+template<typename CharType>
+constexpr uint32_t ffxHashBindingName(const CharType* name) noexcept
+{
+    uint32_t hash = 2166136261u;
+    while (*name)
+        hash = (hash ^ uint32_t(*name++)) * 16777619u;
+    return hash;
+}
@@ -0,0 +1,44 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Minimal Direct3D common shim for the recording mock device.
+
+#pragma once
+
+#include <windows.h>
+
+typedef enum D3D_FEATURE_LEVEL
+{
+    D3D_FEATURE_LEVEL_10_0  = 0xa000,
+    D3D_FEATURE_LEVEL_10_1  = 0xa100,
+    D3D_FEATURE_LEVEL_11_0  = 0xb000,
+    D3D_FEATURE_LEVEL_11_1  = 0xb100,
+    D3D_FEATURE_LEVEL_12_0  = 0xc000,
+    D3D_FEATURE_LEVEL_12_1  = 0xc100,
+    D3D_FEATURE_LEVEL_12_2  = 0xc200,
+} D3D_FEATURE_LEVEL;
+
+typedef enum D3D_SHADER_MIN_PRECISION_SUPPORT
+{
+    D3D_SHADER_MIN_PRECISION_10_BIT = 0x1,
+    D3D_SHADER_MIN_PRECISION_16_BIT = 0x2,
+} D3D_SHADER_MIN_PRECISION_SUPPORT;
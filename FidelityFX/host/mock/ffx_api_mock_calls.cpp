@@ -0,0 +1,474 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Measures what the ffx-api entry points cost the host per call. The real
+// ffx_api.cpp, ffx_provider.cpp and backends.cpp route the calls to stand-in
+// upscale and frame generation providers that do no work of their own, with
+// the DX11 backend running on the recording mock device, so the numbers are
+// those of provider selection and dispatch alone. Returns non-zero when a
+// check fails.
+//
+// Built for FFX_BACKEND_DX11 with FFXAPI_VALIDATION, see CMakeLists.txt in
+// this directory. Started with --dispatch it only prints the time of an
+// upscale dispatch, which is how it measures itself with validation off.
+
+#include "ffx_mock.h"
+#include "ffx_dx11_mock.h"
+#include <ffx_provider.h>
+#include <ffx_provider_fsr2.h>
+#include <ffx_provider_fsr3upscale.h>
+#include <ffx_provider_framegeneration.h>
+#include <validation.h>
+#include <ffx_api/ffx_upscale.hpp>
+#include <ffx_api/ffx_framegeneration.hpp>
+#include <ffx_api/dx11/ffx_api_dx11.h>
+#include <host/backends/ffx_shader_blobs.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The stand-in providers create no effect contexts, so the backend never asks for a shader.
+FfxErrorCode ffxGetPermutationBlobByIndex(FfxEffect, FfxPass, FfxBindStage, uint32_t, FfxShaderBlob*)
+{
+    return FFX_ERROR_INVALID_ARGUMENT;
+}
+
+void ffxReleasePermutationBlob(const uint8_t*)
+{
+}
+
+void ffxPrintMessage(uint32_t, const wchar_t*)
+{
+}
+
+// What the stand-in providers have been asked, so the calls cannot be optimized away and routing can be checked.
+static uint64_t s_lastProviderId = 0;
+static uint64_t s_callCount = 0;
+static uint64_t s_distortionFieldCount = 0;
+static uint64_t s_warningCount = 0;
+static ffxApiMessage s_dispatchMessage = nullptr;
+
+static void countMessage(uint32_t type, const wchar_t*)
+{
+    if (type == FFX_API_MESSAGE_TYPE_WARNING)
+        s_warningCount++;
+}
+
+// Stand-in providers with the ids and descriptor matching of the real ones. Contexts only hold the provider,
+// configure takes the distortion field from the index the way the real frame generation provider does, and dispatch
+// checks its chain the way the real upscaler does when it has somewhere to send messages.
+#define FFX_API_MOCK_PROVIDER(Provider, effectId, versionId)                                                                            \
+    Provider Provider::Instance;                                                                                                        \
+    bool Provider::CanProvide(uint64_t type) const { return (type & FFX_API_EFFECT_MASK) == effectId; }                                 \
+    uint64_t Provider::GetId() const { return versionId; }                                                                              \
+    const char* Provider::GetVersionName() const { return #Provider; }                                                                  \
+    ffxReturnCode_t Provider::CreateContext(ffxContext* context, ffxCreateContextDescHeader*, const DescIndex&, Allocator& alloc) const \
+    {                                                                                                                                   \
+        InternalContextHeader* header = alloc.construct<InternalContextHeader>();                                                       \
+        header->provider = this;                                                                                                        \
+        *context = header;                                                                                                              \
+        return FFX_API_RETURN_OK;                                                                                                       \
+    }                                                                                                                                   \
+    ffxReturnCode_t Provider::DestroyContext(ffxContext* context, Allocator& alloc) const                                               \
+    {                                                                                                                                   \
+        alloc.dealloc(*context);                                                                                                        \
+        return FFX_API_RETURN_OK;                                                                                                       \
+    }                                                                                                                                   \
+    ffxReturnCode_t Provider::Configure(ffxContext*, const ffxConfigureDescHeader*, const DescIndex& index) const                       \
+    {                                                                                                                                   \
+        if (index.distortionField)                                                                                                      \
+            s_distortionFieldCount++;                                                                                                   \
+        s_lastProviderId = versionId;                                                                                                   \
+        s_callCount++;                                                                                                                  \
+        return FFX_API_RETURN_OK;                                                                                                       \
+    }                                                                                                                                   \
+    ffxReturnCode_t Provider::Query(ffxContext*, ffxQueryDescHeader*, const DescIndex&) const                                           \
+    {                                                                                                                                   \
+        s_lastProviderId = versionId;                                                                                                   \
+        s_callCount++;                                                                                                                  \
+        return FFX_API_RETURN_OK;                                                                                                       \
+    }                                                                                                                                   \
+    ffxReturnCode_t Provider::Dispatch(ffxContext*, const ffxDispatchDescHeader* desc, const DescIndex&) const                          \
+    {                                                                                                                                   \
+        if (s_dispatchMessage)                                                                                                          \
+            Validator{s_dispatchMessage, desc}.NoExtensions();                                                                          \
+        s_lastProviderId = versionId;                                                                                                   \
+        s_callCount++;                                                                                                                  \
+        return FFX_API_RETURN_OK;                                                                                                       \
+    }
+
+static const uint64_t s_fsr3UpscaleVersionId = 0xF5A5CA1E00030104ull;
+static const uint64_t s_fsr2VersionId = 0xF5A5CA1E00020300ull;
+static const uint64_t s_frameGenerationVersionId = 0xF5A5F6E000030104ull;
+
+FFX_API_MOCK_PROVIDER(ffxProvider_FSR3Upscale, FFX_API_EFFECT_ID_UPSCALE, s_fsr3UpscaleVersionId)
+FFX_API_MOCK_PROVIDER(ffxProvider_FSR2, FFX_API_EFFECT_ID_UPSCALE, s_fsr2VersionId)
+FFX_API_MOCK_PROVIDER(ffxProvider_FrameGeneration, FFX_API_EFFECT_ID_FRAMEGENERATION, s_frameGenerationVersionId)
+
+// Runs a call count times, seven times over, and returns the fastest run in nanoseconds per call.
+template<typename Call>
+static double timeCall(uint32_t count, Call call)
+{
+    double best = 1e30;
+    for (uint32_t run = 0; run < 7; ++run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t index = 0; index < count; ++index)
+            call();
+        const auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count() / count);
+    }
+    return best;
+}
+
+// Upscale and frame generation contexts created the way an application creates them, with the DX11 backend
+// descriptor chained, so that provider selection finds the device.
+struct ApiCalls
+{
+    FfxMockDeviceDX11*                     device = nullptr;
+    ffxCreateBackendDX11Desc               backendDesc = {};
+    ffxCreateContextDescUpscale            upscaleDesc = {};
+    ffxCreateContextDescFrameGeneration    frameGenerationDesc = {};
+    ffxDispatchDescUpscale                 upscaleDispatch = {};
+    ffxDispatchDescFrameGeneration         frameGenerationDispatch = {};
+    ffxConfigureDescFrameGeneration        frameGenerationConfig = {};
+    ffxQueryDescUpscaleGetJitterOffset     jitterQuery = {};
+    ffxContext                             upscaleContext = nullptr;
+    ffxContext                             frameGenerationContext = nullptr;
+};
+
+static void createApiCalls(ApiCalls& calls)
+{
+    calls.device = new FfxMockDeviceDX11();
+    calls.backendDesc.header.type = FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX11;
+    calls.backendDesc.device = calls.device;
+    calls.upscaleDesc.header.type = FFX_API_CREATE_CONTEXT_DESC_TYPE_UPSCALE;
+    calls.upscaleDesc.header.pNext = &calls.backendDesc.header;
+    calls.frameGenerationDesc.header.type = FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATION;
+    calls.frameGenerationDesc.header.pNext = &calls.backendDesc.header;
+    calls.upscaleDispatch.header.type = FFX_API_DISPATCH_DESC_TYPE_UPSCALE;
+    calls.frameGenerationDispatch.header.type = FFX_API_DISPATCH_DESC_TYPE_FRAMEGENERATION;
+    calls.frameGenerationConfig.header.type = FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATION;
+    calls.jitterQuery.header.type = FFX_API_QUERY_DESC_TYPE_UPSCALE_GETJITTEROFFSET;
+
+    CHECK(ffxCreateContext(&calls.upscaleContext, &calls.upscaleDesc.header, nullptr) == FFX_API_RETURN_OK);
+    CHECK(ffxCreateContext(&calls.frameGenerationContext, &calls.frameGenerationDesc.header, nullptr) == FFX_API_RETURN_OK);
+}
+
+static void destroyApiCalls(ApiCalls& calls)
+{
+    CHECK(ffxDestroyContext(&calls.upscaleContext, nullptr) == FFX_API_RETURN_OK);
+    CHECK(ffxDestroyContext(&calls.frameGenerationContext, nullptr) == FFX_API_RETURN_OK);
+    calls.device->Release();
+    CHECK(ffxMockLiveObjectCountDX11() == 0);
+}
+
+// Every call has to reach the provider its descriptor names: the first upscaler in the list unless a version
+// override picks another, and none at all for an effect without one.
+static void runRouting()
+{
+    ApiCalls calls;
+    createApiCalls(calls);
+
+    CHECK(ffxDispatch(&calls.upscaleContext, &calls.upscaleDispatch.header) == FFX_API_RETURN_OK);
+    CHECK(s_lastProviderId == s_fsr3UpscaleVersionId);
+    CHECK(ffxDispatch(&calls.frameGenerationContext, &calls.frameGenerationDispatch.header) == FFX_API_RETURN_OK);
+    CHECK(s_lastProviderId == s_frameGenerationVersionId);
+    CHECK(ffxQuery(nullptr, &calls.jitterQuery.header) == FFX_API_RETURN_OK);
+    CHECK(s_lastProviderId == s_fsr3UpscaleVersionId);
+
+    ffxOverrideVersion overrideVersion = {};
+    overrideVersion.header.type = FFX_API_DESC_TYPE_OVERRIDE_VERSION;
+    overrideVersion.versionId = s_fsr2VersionId;
+    calls.jitterQuery.header.pNext = &overrideVersion.header;
+    CHECK(ffxQuery(nullptr, &calls.jitterQuery.header) == FFX_API_RETURN_OK);
+    CHECK(s_lastProviderId == s_fsr2VersionId);
+    calls.jitterQuery.header.pNext = nullptr;
+    CHECK(ffxQuery(nullptr, &calls.jitterQuery.header) == FFX_API_RETURN_OK);
+    CHECK(s_lastProviderId == s_fsr3UpscaleVersionId);
+
+    ffxContext overridden = nullptr;
+    overrideVersion.header.pNext = &calls.backendDesc.header;
+    calls.upscaleDesc.header.pNext = &overrideVersion.header;
+    CHECK(ffxCreateContext(&overridden, &calls.upscaleDesc.header, nullptr) == FFX_API_RETURN_OK);
+    CHECK(ffxDispatch(&overridden, &calls.upscaleDispatch.header) == FFX_API_RETURN_OK);
+    CHECK(s_lastProviderId == s_fsr2VersionId);
+    CHECK(ffxDestroyContext(&overridden, nullptr) == FFX_API_RETURN_OK);
+    calls.upscaleDesc.header.pNext = &calls.backendDesc.header;
+
+    ffxConfigureDescFrameGenerationRegisterDistortionFieldResource distortionField = {};
+    distortionField.header.type = FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATION_REGISTERDISTORTIONRESOURCE;
+    calls.frameGenerationConfig.header.pNext = &distortionField.header;
+    s_distortionFieldCount = 0;
+    CHECK(ffxConfigure(&calls.frameGenerationContext, &calls.frameGenerationConfig.header) == FFX_API_RETURN_OK);
+    CHECK(s_distortionFieldCount == 0);
+    distortionField.distortionField.resource = calls.device;
+    CHECK(ffxConfigure(&calls.frameGenerationContext, &calls.frameGenerationConfig.header) == FFX_API_RETURN_OK);
+    CHECK(s_distortionFieldCount == 1);
+    calls.frameGenerationConfig.header.pNext = nullptr;
+
+    ffxContext missing = nullptr;
+    ffxApiHeader unknownDesc = {};
+    unknownDesc.type = 0x7f000000u;
+    CHECK(ffxCreateContext(&missing, reinterpret_cast<ffxCreateContextDescHeader*>(&unknownDesc), nullptr) == FFX_API_RETURN_NO_PROVIDER);
+    CHECK(missing == nullptr);
+    CHECK(ffxQuery(nullptr, &unknownDesc) == FFX_API_RETURN_NO_PROVIDER);
+
+    destroyApiCalls(calls);
+}
+
+// Looks providers up from several threads at once, each with its own device and more descriptor types, overrides
+// and devices between them than the lookup table holds. Every lookup has to return the provider the key names,
+// whether it was served from the table, added to it or resolved after the table filled up.
+static void runConcurrentLookups()
+{
+    const uint32_t threadCount = 4;
+    std::atomic<uint32_t> wrongCount{0};
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < threadCount; ++thread)
+    {
+        threads.emplace_back([thread, &wrongCount] {
+            void* device = reinterpret_cast<void*>(uintptr_t(thread + 1) * 64);
+            for (uint32_t index = 0; index < 20000; ++index)
+            {
+                const bool frameGeneration = (index & 1) != 0;
+                const bool overridden = !frameGeneration && (index & 2) != 0;
+                const ffxStructType_t descType = (frameGeneration ? FFX_API_EFFECT_ID_FRAMEGENERATION : FFX_API_EFFECT_ID_UPSCALE) + index % 24;
+                const ffxProvider* provider = GetffxProvider(descType, overridden ? s_fsr2VersionId : 0, (index & 4) ? device : nullptr);
+                const ffxProvider* expected = frameGeneration ? static_cast<const ffxProvider*>(&ffxProvider_FrameGeneration::Instance)
+                                            : overridden      ? static_cast<const ffxProvider*>(&ffxProvider_FSR2::Instance)
+                                                              : static_cast<const ffxProvider*>(&ffxProvider_FSR3Upscale::Instance);
+                if (provider != expected)
+                    wrongCount++;
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    CHECK(wrongCount == 0);
+}
+
+// Times the calls an application makes every frame, and context creation, which also selects a provider.
+// Dispatch and configure go straight to the context's provider; a query without a context and context creation
+// look one up from the descriptor chain.
+static void runCallOverhead()
+{
+    ApiCalls calls;
+    createApiCalls(calls);
+
+    const uint32_t callCount = 1000000;
+    const uint64_t firstCall = s_callCount;
+    printf("ffx-api call overhead, ns per call\n");
+    printf("  ffxDispatch upscale                  %6.1f\n", timeCall(callCount, [&] {
+        ffxDispatch(&calls.upscaleContext, &calls.upscaleDispatch.header);
+    }));
+    printf("  ffxDispatch frame generation         %6.1f\n", timeCall(callCount, [&] {
+        ffxDispatch(&calls.frameGenerationContext, &calls.frameGenerationDispatch.header);
+    }));
+    printf("  ffxConfigure frame generation        %6.1f\n", timeCall(callCount, [&] {
+        ffxConfigure(&calls.frameGenerationContext, &calls.frameGenerationConfig.header);
+    }));
+    printf("  ffxQuery upscale jitter, no context  %6.1f\n", timeCall(callCount, [&] {
+        ffxQuery(nullptr, &calls.jitterQuery.header);
+    }));
+    CHECK(s_callCount - firstCall == 4ull * 7 * callCount);
+
+    printf("  ffxCreateContext + ffxDestroyContext\n");
+    printf("    upscale                            %6.1f\n", timeCall(callCount / 10, [&] {
+        ffxContext context = nullptr;
+        ffxCreateContext(&context, &calls.upscaleDesc.header, nullptr);
+        ffxDestroyContext(&context, nullptr);
+    }));
+    printf("    frame generation                   %6.1f\n", timeCall(callCount / 10, [&] {
+        ffxContext context = nullptr;
+        ffxCreateContext(&context, &calls.frameGenerationDesc.header, nullptr);
+        ffxDestroyContext(&context, nullptr);
+    }));
+
+    destroyApiCalls(calls);
+}
+
+// Times the calls with 0, 4 and 8 unrelated extension structures chained ahead of the ones that matter, as an
+// application passing several effect options would. Every call indexes the chain once on the way in: the version
+// override, the device and the distortion field are found at the end of it, so the cost of the walk shows up in
+// full, and dispatch pays for the walk alone.
+static void runExtensionChains()
+{
+    ApiCalls calls;
+    createApiCalls(calls);
+
+    ffxOverrideVersion overrideVersion = {};
+    overrideVersion.header.type = FFX_API_DESC_TYPE_OVERRIDE_VERSION;
+    overrideVersion.versionId = s_fsr2VersionId;
+
+    const uint32_t callCount = 1000000;
+    ffxConfigureDescFrameGenerationRegisterDistortionFieldResource distortionField = {};
+    distortionField.header.type = FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATION_REGISTERDISTORTIONRESOURCE;
+    distortionField.distortionField.resource = calls.device;
+
+    printf("ffx-api calls with extension structures, ns per call\n");
+    printf("  extensions                           %6s %6s %6s\n", "0", "4", "8");
+    double queryTimes[3], overriddenQueryTimes[3], upscaleTimes[3], frameGenerationTimes[3];
+    double dispatchTimes[3], configureTimes[3];
+    for (uint32_t chain = 0; chain < 3; ++chain)
+    {
+        const uint32_t extensionCount = chain * 4;
+        ffxApiHeader extensions[8] = {};
+        for (uint32_t index = 0; index < extensionCount; ++index)
+        {
+            extensions[index].type = 0x00090000u + index;
+            extensions[index].pNext = index + 1 < extensionCount ? &extensions[index + 1] : nullptr;
+        }
+        ffxApiHeader* first = extensionCount ? &extensions[0] : nullptr;
+        ffxApiHeader* last = extensionCount ? &extensions[extensionCount - 1] : nullptr;
+
+        calls.upscaleDispatch.header.pNext = first;
+        dispatchTimes[chain] = timeCall(callCount, [&] { ffxDispatch(&calls.upscaleContext, &calls.upscaleDispatch.header); });
+        CHECK(s_lastProviderId == s_fsr3UpscaleVersionId);
+        calls.upscaleDispatch.header.pNext = nullptr;
+
+        if (last)
+            last->pNext = &distortionField.header;
+        calls.frameGenerationConfig.header.pNext = extensionCount ? first : &distortionField.header;
+        s_distortionFieldCount = 0;
+        configureTimes[chain] = timeCall(callCount, [&] { ffxConfigure(&calls.frameGenerationContext, &calls.frameGenerationConfig.header); });
+        CHECK(s_distortionFieldCount == 7ull * callCount);
+        calls.frameGenerationConfig.header.pNext = nullptr;
+        if (last)
+            last->pNext = nullptr;
+
+        calls.jitterQuery.header.pNext = first;
+        queryTimes[chain] = timeCall(callCount, [&] { ffxQuery(nullptr, &calls.jitterQuery.header); });
+        CHECK(s_lastProviderId == s_fsr3UpscaleVersionId);
+
+        if (last)
+            last->pNext = &overrideVersion.header;
+        else
+            calls.jitterQuery.header.pNext = &overrideVersion.header;
+        overriddenQueryTimes[chain] = timeCall(callCount, [&] { ffxQuery(nullptr, &calls.jitterQuery.header); });
+        CHECK(s_lastProviderId == s_fsr2VersionId);
+
+        if (last)
+            last->pNext = &calls.backendDesc.header;
+        calls.upscaleDesc.header.pNext = extensionCount ? first : &calls.backendDesc.header;
+        calls.frameGenerationDesc.header.pNext = calls.upscaleDesc.header.pNext;
+        upscaleTimes[chain] = timeCall(callCount / 10, [&] {
+            ffxContext context = nullptr;
+            ffxCreateContext(&context, &calls.upscaleDesc.header, nullptr);
+            ffxDestroyContext(&context, nullptr);
+        });
+        frameGenerationTimes[chain] = timeCall(callCount / 10, [&] {
+            ffxContext context = nullptr;
+            ffxCreateContext(&context, &calls.frameGenerationDesc.header, nullptr);
+            ffxDestroyContext(&context, nullptr);
+        });
+
+        ffxContext context = nullptr;
+        CHECK(ffxCreateContext(&context, &calls.upscaleDesc.header, nullptr) == FFX_API_RETURN_OK);
+        CHECK(ffxDispatch(&context, &calls.upscaleDispatch.header) == FFX_API_RETURN_OK);
+        CHECK(s_lastProviderId == s_fsr3UpscaleVersionId);
+        CHECK(ffxDestroyContext(&context, nullptr) == FFX_API_RETURN_OK);
+    }
+    printf("  ffxDispatch upscale                  %6.1f %6.1f %6.1f\n", dispatchTimes[0], dispatchTimes[1], dispatchTimes[2]);
+    printf("  ffxConfigure frame generation,\n");
+    printf("    distortion field last              %6.1f %6.1f %6.1f\n", configureTimes[0], configureTimes[1], configureTimes[2]);
+    printf("  ffxQuery upscale jitter, no context  %6.1f %6.1f %6.1f\n", queryTimes[0], queryTimes[1], queryTimes[2]);
+    printf("    with a version override            %6.1f %6.1f %6.1f\n", overriddenQueryTimes[0], overriddenQueryTimes[1], overriddenQueryTimes[2]);
+    printf("  ffxCreateContext + ffxDestroyContext\n");
+    printf("    upscale                            %6.1f %6.1f %6.1f\n", upscaleTimes[0], upscaleTimes[1], upscaleTimes[2]);
+    printf("    frame generation                   %6.1f %6.1f %6.1f\n", frameGenerationTimes[0], frameGenerationTimes[1], frameGenerationTimes[2]);
+
+    calls.jitterQuery.header.pNext = nullptr;
+    calls.upscaleDesc.header.pNext = &calls.backendDesc.header;
+    calls.frameGenerationDesc.header.pNext = &calls.backendDesc.header;
+    destroyApiCalls(calls);
+}
+
+// Times an upscale dispatch whose provider has somewhere to send messages, so that it checks the chain.
+static double timeUpscaleDispatch()
+{
+    ApiCalls calls;
+    createApiCalls(calls);
+    s_dispatchMessage = countMessage;
+    const double time = timeCall(1000000, [&] { ffxDispatch(&calls.upscaleContext, &calls.upscaleDispatch.header); });
+    s_dispatchMessage = nullptr;
+    destroyApiCalls(calls);
+    return time;
+}
+
+// Times an upscale dispatch with the descriptor chain checks on, and off in a copy of this process started with
+// FFX_API_VALIDATION=0, since the switch is read once per process. An extension the upscaler does not take has
+// to be reported while the checks are on, and only then.
+static void runValidation(const char* path)
+{
+    ApiCalls calls;
+    createApiCalls(calls);
+    ffxApiHeader unexpected = {};
+    unexpected.type = FFX_API_DESC_TYPE_OVERRIDE_VERSION;
+    calls.upscaleDispatch.header.pNext = &unexpected;
+    s_warningCount = 0;
+    s_dispatchMessage = countMessage;
+    CHECK(ffxDispatch(&calls.upscaleContext, &calls.upscaleDispatch.header) == FFX_API_RETURN_OK);
+    CHECK(s_warningCount == (Validator::Enabled() ? 1u : 0u));
+    s_dispatchMessage = nullptr;
+    calls.upscaleDispatch.header.pNext = nullptr;
+    destroyApiCalls(calls);
+
+    const double validated = timeUpscaleDispatch();
+    double unvalidated = 0.0;
+    const std::string command = std::string("FFX_API_VALIDATION=0 \"") + path + "\" --dispatch";
+    FILE* child = popen(command.c_str(), "r");
+    CHECK(child != nullptr);
+    if (child)
+    {
+        CHECK(fscanf(child, "%lf", &unvalidated) == 1);
+        CHECK(pclose(child) == 0);
+    }
+
+    printf("ffx-api validation, ns per upscale dispatch\n");
+    printf("  checks %-29s %6.1f\n", Validator::Enabled() ? "on" : "off (FFX_API_VALIDATION=0)", validated);
+    printf("  checks off (FFX_API_VALIDATION=0)    %6.1f\n", unvalidated);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1 && strcmp(argv[1], "--dispatch") == 0)
+    {
+        CHECK(!Validator::Enabled() || getenv("FFX_API_VALIDATION") == nullptr);
+        printf("%f\n", timeUpscaleDispatch());
+        return ffxMockExitCode();
+    }
+
+    runRouting();
+    runConcurrentLookups();
+    runCallOverhead();
+    runExtensionChains();
+    runValidation(argv[0]);
+
+    return ffxMockExitCode();
+}
@@ -0,0 +1,794 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Runs the effects with CPU kernels through their components on the CPU backend
+// and checks what the kernels write against serial references. The pass
+// reflection the backend reads is served from the tables below, since the
+// permutation headers are only generated on Windows. Returns non-zero when a
+// check fails.
+//
+// Built with -fshort-wchar, see CMakeLists.txt in this directory.
+
+#include "ffx_mock.h"
+#include <host/backends/cpu/ffx_cpu.h>
+#include <host/backends/ffx_shader_blobs.h>
+#include <host/ffx_blur.h>
+#include <host/ffx_cas.h>
+#include <host/ffx_fsr1.h>
+#include <host/ffx_fsr2.h>
+#include <host/components/fsr2/ffx_fsr2_private.h>
+#include <host/ffx_fsr3upscaler.h>
+#include <host/ffx_spd.h>
+#include <host/ffx_message.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+void ffxSetPrintMessageCallback(ffxMessageCallback, uint32_t)
+{
+}
+
+void ffxPrintMessage(uint32_t, const wchar_t*)
+{
+}
+
+// Bindings of one resource kind in a pass, in the order the HLSL compiler reflects them.
+struct Bindings
+{
+    std::vector<const char*> names;
+    std::vector<uint32_t>    slots;
+    std::vector<uint32_t>    counts;
+    std::vector<uint32_t>    spaces;
+
+    Bindings(std::initializer_list<std::pair<const char*, uint32_t>> bindings, uint32_t arrayCount = 1)
+    {
+        for (const auto& binding : bindings) {
+            names.push_back(binding.first);
+            slots.push_back(binding.second);
+            counts.push_back(1);
+            spaces.push_back(0);
+        }
+        if (!counts.empty())
+            counts.back() = arrayCount;
+    }
+};
+
+struct PassReflection
+{
+    FfxEffect effect;
+    FfxPass   pass;
+    Bindings  cbs;
+    Bindings  srvTextures;
+    Bindings  uavTextures;
+    Bindings  srvBuffers;
+    Bindings  uavBuffers;
+};
+
+static Bindings fsr2AccumulateSrvs()
+{
+    return { { "r_input_exposure", 0 }, { "r_dilated_reactive_masks", 1 }, { "r_dilated_motion_vectors", 2 }, { "r_internal_upscaled_color", 3 },
+             { "r_lock_status", 4 }, { "r_prepared_input_color", 5 }, { "r_lanczos_lut", 6 }, { "r_upsample_maximum_bias_lut", 7 },
+             { "r_imgMips", 8 }, { "r_auto_exposure", 9 }, { "r_luma_history", 10 } };
+}
+
+static Bindings fsr3UpscalerAccumulateSrvs()
+{
+    return { { "r_input_exposure", 0 }, { "r_dilated_reactive_masks", 1 }, { "r_dilated_motion_vectors", 2 }, { "r_internal_upscaled_color", 3 },
+             { "r_farthest_depth_mip1", 5 }, { "r_luma_instability", 7 }, { "r_input_color_jittered", 8 } };
+}
+
+// Slots match the bind slots the kernels in FidelityFX/host/backends/cpu define.
+static std::vector<PassReflection>& passReflections()
+{
+    static std::vector<PassReflection> reflections = {
+        { FFX_EFFECT_SPD, FFX_SPD_PASS_DOWNSAMPLE, { { "cbSPD", 0 } }, {},
+          Bindings({ { "rw_input_downsample_src_mid_mip", 1 }, { "rw_input_downsample_src_mips", 2 } }, SPD_MAX_MIP_LEVELS + 1), {},
+          { { "rw_internal_global_atomic", 0 } } },
+        { FFX_EFFECT_CAS, FFX_CAS_PASS_SHARPEN, { { "cbCAS", 0 } }, { { "r_input_color", 0 } }, { { "rw_output_color", 0 } }, {}, {} },
+        { FFX_EFFECT_FSR1, FFX_FSR1_PASS_EASU, { { "cbFSR1", 0 } }, { { "r_input_color", 0 } }, { { "rw_upscaled_output", 1 } }, {}, {} },
+        { FFX_EFFECT_FSR1, FFX_FSR1_PASS_EASU_RCAS, { { "cbFSR1", 0 } }, { { "r_input_color", 0 } }, { { "rw_internal_upscaled_color", 0 } }, {}, {} },
+        { FFX_EFFECT_FSR1, FFX_FSR1_PASS_RCAS, { { "cbFSR1", 0 } }, { { "r_internal_upscaled_color", 0 } }, { { "rw_upscaled_output", 0 } }, {}, {} },
+        { FFX_EFFECT_BLUR, FFX_BLUR_PASS_BLUR, { { "cbBLUR", 0 } }, { { "r_input_src", 0 } }, { { "rw_output", 0 } }, {}, {} },
+        { FFX_EFFECT_FSR2, FFX_FSR2_PASS_DEPTH_CLIP, { { "cbFSR2", 0 } },
+          { { "r_reconstructed_previous_nearest_depth", 0 }, { "r_dilated_motion_vectors", 1 }, { "r_dilatedDepth", 2 }, { "r_reactive_mask", 3 },
+            { "r_transparency_and_composition_mask", 4 }, { "r_previous_dilated_motion_vectors", 5 }, { "r_input_motion_vectors", 6 },
+            { "r_input_color_jittered", 7 }, { "r_input_depth", 8 }, { "r_input_exposure", 9 } },
+          { { "rw_dilated_reactive_masks", 0 }, { "rw_prepared_input_color", 1 } }, {}, {} },
+        { FFX_EFFECT_FSR2, FFX_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH, { { "cbFSR2", 0 } },
+          { { "r_input_motion_vectors", 0 }, { "r_input_depth", 1 }, { "r_input_color_jittered", 2 }, { "r_input_exposure", 3 } },
+          { { "rw_reconstructed_previous_nearest_depth", 0 }, { "rw_dilated_motion_vectors", 1 }, { "rw_dilatedDepth", 2 }, { "rw_lock_input_luma", 3 } }, {}, {} },
+        { FFX_EFFECT_FSR2, FFX_FSR2_PASS_LOCK, { { "cbFSR2", 0 } }, { { "r_lock_input_luma", 0 } },
+          { { "rw_new_locks", 0 }, { "rw_reconstructed_previous_nearest_depth", 1 } }, {}, {} },
+        { FFX_EFFECT_FSR2, FFX_FSR2_PASS_ACCUMULATE, { { "cbFSR2", 0 } }, fsr2AccumulateSrvs(),
+          { { "rw_internal_upscaled_color", 0 }, { "rw_lock_status", 1 }, { "rw_upscaled_output", 2 }, { "rw_new_locks", 3 }, { "rw_luma_history", 4 } }, {}, {} },
+        { FFX_EFFECT_FSR2, FFX_FSR2_PASS_ACCUMULATE_SHARPEN, { { "cbFSR2", 0 } }, fsr2AccumulateSrvs(),
+          { { "rw_internal_upscaled_color", 0 }, { "rw_lock_status", 1 }, { "rw_new_locks", 3 }, { "rw_luma_history", 4 } }, {}, {} },
+        { FFX_EFFECT_FSR2, FFX_FSR2_PASS_RCAS, { { "cbFSR2", 0 }, { "cbRCAS", 1 } }, { { "r_input_exposure", 0 }, { "r_rcas_input", 1 } },
+          { { "rw_upscaled_output", 0 } }, {}, {} },
+        { FFX_EFFECT_FSR2, FFX_FSR2_PASS_GENERATE_REACTIVE, { { "cbGenerateReactive", 1 } },
+          { { "r_input_opaque_only", 0 }, { "r_input_color_jittered", 1 } }, { { "rw_output_autoreactive", 0 } }, {}, {} },
+        { FFX_EFFECT_FSR2, FFX_FSR2_PASS_TCR_AUTOGENERATE, { { "cbFSR2", 0 }, { "cbGenerateReactive", 1 } },
+          { { "r_input_opaque_only", 0 }, { "r_input_color_jittered", 1 }, { "r_input_motion_vectors", 2 }, { "r_reactive_mask", 4 },
+            { "r_transparency_and_composition_mask", 5 }, { "r_input_prev_color_pre_alpha", 46 }, { "r_input_prev_color_post_alpha", 47 } },
+          { { "rw_output_autoreactive", 0 }, { "rw_output_autocomposition", 1 }, { "rw_output_prev_color_pre_alpha", 2 }, { "rw_output_prev_color_post_alpha", 3 } },
+          {}, {} },
+        { FFX_EFFECT_FSR2, FFX_FSR2_PASS_COMPUTE_LUMINANCE_PYRAMID, { { "cbFSR2", 0 }, { "cbSPD", 1 } }, { { "r_input_color_jittered", 0 } },
+          { { "rw_spd_global_atomic", 0 }, { "rw_img_mip_shading_change", 1 }, { "rw_img_mip_5", 2 }, { "rw_auto_exposure", 3 } }, {}, {} },
+        { FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_PREPARE_INPUTS, { { "cbFSR3Upscaler", 0 } },
+          { { "r_input_motion_vectors", 0 }, { "r_input_depth", 1 }, { "r_input_color_jittered", 2 } },
+          { { "rw_dilated_motion_vectors", 0 }, { "rw_dilated_depth", 1 }, { "rw_reconstructed_previous_nearest_depth", 2 }, { "rw_farthest_depth", 3 },
+            { "rw_current_luma", 4 } }, {}, {} },
+        { FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_LUMA_PYRAMID, { { "cbFSR3Upscaler", 0 }, { "cbSPD", 1 } },
+          { { "r_current_luma", 0 }, { "r_farthest_depth", 1 } },
+          { { "rw_spd_global_atomic", 0 }, { "rw_frame_info", 1 }, { "rw_spd_mip0", 2 }, { "rw_spd_mip1", 3 }, { "rw_spd_mip2", 4 }, { "rw_spd_mip3", 5 },
+            { "rw_spd_mip4", 6 }, { "rw_spd_mip5", 7 }, { "rw_farthest_depth_mip1", 8 } }, {}, {} },
+        { FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_SHADING_CHANGE_PYRAMID, { { "cbFSR3Upscaler", 0 }, { "cbSPD", 1 } },
+          { { "r_current_luma", 0 }, { "r_previous_luma", 1 }, { "r_dilated_motion_vectors", 2 }, { "r_input_exposure", 3 } },
+          { { "rw_spd_global_atomic", 0 }, { "rw_spd_mip0", 1 }, { "rw_spd_mip1", 2 }, { "rw_spd_mip2", 3 }, { "rw_spd_mip3", 4 }, { "rw_spd_mip4", 5 },
+            { "rw_spd_mip5", 6 } }, {}, {} },
+        { FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_SHADING_CHANGE, { { "cbFSR3Upscaler", 0 } }, { { "r_spd_mips", 0 } },
+          { { "rw_shading_change", 0 } }, {}, {} },
+        { FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_PREPARE_REACTIVITY, { { "cbFSR3Upscaler", 0 } },
+          { { "r_reconstructed_previous_nearest_depth", 0 }, { "r_dilated_motion_vectors", 1 }, { "r_dilated_depth", 2 }, { "r_reactive_mask", 3 },
+            { "r_transparency_and_composition_mask", 4 }, { "r_accumulation", 5 }, { "r_shading_change", 6 }, { "r_current_luma", 7 },
+            { "r_input_exposure", 8 } },
+          { { "rw_dilated_reactive_masks", 0 }, { "rw_new_locks", 1 }, { "rw_accumulation", 2 } }, {}, {} },
+        { FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_LUMA_INSTABILITY, { { "cbFSR3Upscaler", 0 } },
+          { { "r_input_exposure", 0 }, { "r_dilated_reactive_masks", 1 }, { "r_dilated_motion_vectors", 2 }, { "r_luma_history", 4 },
+            { "r_farthest_depth_mip1", 5 }, { "r_current_luma", 6 } },
+          { { "rw_luma_history", 0 }, { "rw_luma_instability", 1 } }, {}, {} },
+        { FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_ACCUMULATE, { { "cbFSR3Upscaler", 0 } }, fsr3UpscalerAccumulateSrvs(),
+          { { "rw_internal_upscaled_color", 0 }, { "rw_upscaled_output", 1 }, { "rw_new_locks", 2 } }, {}, {} },
+        { FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_ACCUMULATE_SHARPEN, { { "cbFSR3Upscaler", 0 } }, fsr3UpscalerAccumulateSrvs(),
+          { { "rw_internal_upscaled_color", 0 }, { "rw_new_locks", 2 } }, {}, {} },
+        { FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_RCAS, { { "cbRCAS", 1 } }, { { "r_input_exposure", 0 }, { "r_rcas_input", 1 } },
+          { { "rw_upscaled_output", 0 } }, {}, {} },
+        { FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_DEBUG_VIEW, { { "cbFSR3Upscaler", 0 } },
+          { { "r_dilated_reactive_masks", 0 }, { "r_dilated_motion_vectors", 1 }, { "r_dilated_depth", 2 }, { "r_internal_upscaled_color", 3 } },
+          { { "rw_upscaled_output", 0 } }, {}, {} },
+        { FFX_EFFECT_FSR3UPSCALER, FFX_FSR3UPSCALER_PASS_GENERATE_REACTIVE, { { "cbGenerateReactive", 1 } },
+          { { "r_input_opaque_only", 0 }, { "r_input_color_jittered", 1 } }, { { "rw_output_autoreactive", 0 } }, {}, {} },
+    };
+    return reflections;
+}
+
+// Blobs handed out and not released yet, the backend must release every blob it gets.
+static std::atomic<int32_t> s_pinnedBlobCount{ 0 };
+static const uint8_t        s_emptyBytecode[4] = {};
+
+FfxErrorCode ffxGetPermutationBlobByIndex(FfxEffect effect, FfxPass pass, FfxBindStage, uint32_t, FfxShaderBlob* outBlob)
+{
+    for (PassReflection& reflection : passReflections()) {
+        if (reflection.effect != effect || reflection.pass != pass)
+            continue;
+
+        FfxShaderBlob shaderBlob = { s_emptyBytecode, uint32_t(sizeof(s_emptyBytecode)),
+            uint32_t(reflection.cbs.slots.size()), uint32_t(reflection.srvTextures.slots.size()), uint32_t(reflection.uavTextures.slots.size()),
+            uint32_t(reflection.srvBuffers.slots.size()), uint32_t(reflection.uavBuffers.slots.size()), 0, 0,
+            reflection.cbs.names.data(), nullptr, reflection.cbs.slots.data(), reflection.cbs.counts.data(), reflection.cbs.spaces.data(),
+            reflection.srvTextures.names.data(), nullptr, reflection.srvTextures.slots.data(), reflection.srvTextures.counts.data(), reflection.srvTextures.spaces.data(),
+            reflection.uavTextures.names.data(), nullptr, reflection.uavTextures.slots.data(), reflection.uavTextures.counts.data(), reflection.uavTextures.spaces.data(),
+            reflection.srvBuffers.names.data(), nullptr, reflection.srvBuffers.slots.data(), reflection.srvBuffers.counts.data(), reflection.srvBuffers.spaces.data(),
+            reflection.uavBuffers.names.data(), nullptr, reflection.uavBuffers.slots.data(), reflection.uavBuffers.counts.data(), reflection.uavBuffers.spaces.data() };
+        memcpy(static_cast<void*>(outBlob), &shaderBlob, sizeof(shaderBlob));
+        s_pinnedBlobCount++;
+        return FFX_OK;
+    }
+
+    return FFX_ERROR_INVALID_ARGUMENT;
+}
+
+void ffxReleasePermutationBlob(const uint8_t* data)
+{
+    if (data)
+        s_pinnedBlobCount--;
+}
+
+// A 32 bit per channel texture in the CPU backend layout, mips packed one after the other.
+struct Texture
+{
+    FfxResourceDescription description = {};
+    std::vector<uint8_t>   memory;
+    uint32_t               channelCount;
+
+    Texture(uint32_t width, uint32_t height, uint32_t mipCount = 1, FfxSurfaceFormat format = FFX_SURFACE_FORMAT_R32G32B32A32_FLOAT)
+    {
+        channelCount = format == FFX_SURFACE_FORMAT_R32G32B32A32_FLOAT ? 4 : (format == FFX_SURFACE_FORMAT_R32G32_FLOAT ? 2 : 1);
+
+        description.type     = FFX_RESOURCE_TYPE_TEXTURE2D;
+        description.format   = format;
+        description.width    = width;
+        description.height   = height;
+        description.depth    = 1;
+        description.mipCount = mipCount;
+        description.usage    = FFX_RESOURCE_USAGE_UAV;
+        memory.resize(ffxGetResourceMemorySizeCPU(description));
+    }
+
+    float* texel(uint32_t x, uint32_t y, uint32_t mip = 0)
+    {
+        size_t offset = 0;
+        for (uint32_t level = 0; level < mip; ++level)
+            offset += size_t(description.width >> level) * (description.height >> level);
+        return reinterpret_cast<float*>(memory.data()) + (offset + size_t(y) * (description.width >> mip) + x) * channelCount;
+    }
+
+    void fill(float r, float g, float b)
+    {
+        for (uint32_t y = 0; y < description.height; ++y)
+            for (uint32_t x = 0; x < description.width; ++x) {
+                float* value = texel(x, y);
+                value[0] = r, value[1] = g, value[2] = b, value[3] = 1.0f;
+            }
+    }
+
+    FfxResource resource(const wchar_t* name, FfxResourceStates state = FFX_RESOURCE_STATE_COMPUTE_READ)
+    {
+        return ffxGetResourceCPU(memory.data(), description, name, state);
+    }
+};
+
+// The largest difference of the RGB channels of a texture from a flat colour.
+static float flatError(Texture& texture, float r, float g, float b)
+{
+    float error = 0.0f;
+    for (uint32_t y = 0; y < texture.description.height; ++y)
+        for (uint32_t x = 0; x < texture.description.width; ++x) {
+            const float* value = texture.texel(x, y);
+            error = fmaxf(error, fmaxf(fabsf(value[0] - r), fmaxf(fabsf(value[1] - g), fabsf(value[2] - b))));
+        }
+    return error;
+}
+
+static double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+struct CpuBackend
+{
+    FfxCpuDeviceDescription deviceDescription = {};
+    FfxInterface            backendInterface  = {};
+    std::vector<uint8_t>    scratch;
+    FfxDevice               device = nullptr;
+
+    CpuBackend()
+    {
+        device = ffxGetDeviceCPU(&deviceDescription);
+        scratch.resize(ffxGetScratchMemorySizeCPU(1));
+        CHECK(ffxGetInterfaceCPU(&backendInterface, device, scratch.data(), scratch.size(), 1) == FFX_OK);
+    }
+};
+
+// 256x256 is 16 workgroups of SPD, the last one to finish reduces mip 6 to mips 7 and 8.
+static void runSpd()
+{
+    const uint32_t size = 256, mipCount = 9;
+    Texture        texture(size, size, mipCount);
+    srand(1);
+    for (uint32_t y = 0; y < size; ++y)
+        for (uint32_t x = 0; x < size; ++x)
+            for (uint32_t channel = 0; channel < 4; ++channel)
+                texture.texel(x, y)[channel] = float(rand() % 1024) / 1024.0f;
+
+    CpuBackend               backend;
+    FfxSpdContextDescription contextDescription = {};
+    contextDescription.flags            = FFX_SPD_SAMPLER_LOAD | FFX_SPD_WAVE_INTEROP_LDS | FFX_SPD_MATH_NONPACKED;
+    contextDescription.downsampleFilter = FFX_SPD_DOWNSAMPLE_FILTER_MEAN;
+    contextDescription.backendInterface = backend.backendInterface;
+
+    FfxSpdContext context;
+    CHECK(ffxSpdContextCreate(&context, &contextDescription) == FFX_OK);
+
+    FfxSpdDispatchDescription dispatchDescription = {};
+    dispatchDescription.commandList = ffxGetCommandListCPU(backend.device);
+    dispatchDescription.resource    = texture.resource(L"SPD_Source", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+
+    const auto start = std::chrono::steady_clock::now();
+    CHECK(ffxSpdContextDispatch(&context, &dispatchDescription) == FFX_OK);
+    const double milliseconds = millisecondsSince(start);
+    CHECK(ffxSpdContextDestroy(&context) == FFX_OK);
+
+    // serial 2x2 mean of the previous mip
+    float maxError = 0.0f;
+    for (uint32_t mip = 1; mip < mipCount; ++mip) {
+        std::vector<float> expected(size_t(size >> mip) * (size >> mip) * 4);
+        for (uint32_t y = 0; y < (size >> mip); ++y)
+            for (uint32_t x = 0; x < (size >> mip); ++x)
+                for (uint32_t channel = 0; channel < 4; ++channel) {
+                    const float mean = (texture.texel(2 * x, 2 * y, mip - 1)[channel] + texture.texel(2 * x + 1, 2 * y, mip - 1)[channel] +
+                                        texture.texel(2 * x, 2 * y + 1, mip - 1)[channel] + texture.texel(2 * x + 1, 2 * y + 1, mip - 1)[channel]) * 0.25f;
+                    maxError = fmaxf(maxError, fabsf(texture.texel(x, y, mip)[channel] - mean));
+                }
+    }
+
+    printf("SPD %ux%u mean, %u mips: %.2f ms, max error %g\n", size, size, mipCount - 1, milliseconds, maxError);
+    CHECK(maxError < 1e-5f);
+}
+
+// CAS and RCAS use approximate reciprocals, so a flat image comes out within a few thousandths of the input.
+static void runCas()
+{
+    const uint32_t size = 64;
+    Texture        input(size, size), output(size, size);
+    input.fill(0.25f, 0.5f, 0.75f);
+
+    CpuBackend               backend;
+    FfxCasContextDescription contextDescription = {};
+    contextDescription.flags                = FFX_CAS_SHARPEN_ONLY;
+    contextDescription.colorSpaceConversion = FFX_CAS_COLOR_SPACE_LINEAR;
+    contextDescription.maxRenderSize        = { size, size };
+    contextDescription.displaySize          = { size, size };
+    contextDescription.backendInterface     = backend.backendInterface;
+
+    FfxCasContext context;
+    CHECK(ffxCasContextCreate(&context, &contextDescription) == FFX_OK);
+
+    FfxCasDispatchDescription dispatchDescription = {};
+    dispatchDescription.commandList = ffxGetCommandListCPU(backend.device);
+    dispatchDescription.color       = input.resource(L"CAS_Input");
+    dispatchDescription.output      = output.resource(L"CAS_Output", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    dispatchDescription.renderSize  = { size, size };
+    dispatchDescription.sharpness   = 1.0f;
+
+    const auto start = std::chrono::steady_clock::now();
+    CHECK(ffxCasContextDispatch(&context, &dispatchDescription) == FFX_OK);
+    const double milliseconds = millisecondsSince(start);
+    CHECK(ffxCasContextDestroy(&context) == FFX_OK);
+
+    const float error = flatError(output, 0.25f, 0.5f, 0.75f);
+    printf("CAS %ux%u sharpen: %.2f ms, flat error %g\n", size, size, milliseconds, error);
+    CHECK(error < 5e-3f);
+}
+
+static void runFsr1(bool enableSharpening)
+{
+    const uint32_t renderSize = 32, displaySize = 64;
+    Texture        input(renderSize, renderSize), output(displaySize, displaySize);
+    input.fill(0.25f, 0.5f, 0.75f);
+
+    CpuBackend                backend;
+    FfxFsr1ContextDescription contextDescription = {};
+    contextDescription.flags            = enableSharpening ? FFX_FSR1_ENABLE_RCAS : 0;
+    contextDescription.outputFormat     = FFX_SURFACE_FORMAT_R32G32B32A32_FLOAT;
+    contextDescription.maxRenderSize    = { renderSize, renderSize };
+    contextDescription.displaySize      = { displaySize, displaySize };
+    contextDescription.backendInterface = backend.backendInterface;
+
+    FfxFsr1Context context;
+    CHECK(ffxFsr1ContextCreate(&context, &contextDescription) == FFX_OK);
+
+    FfxFsr1DispatchDescription dispatchDescription = {};
+    dispatchDescription.commandList      = ffxGetCommandListCPU(backend.device);
+    dispatchDescription.color            = input.resource(L"FSR1_Input");
+    dispatchDescription.output           = output.resource(L"FSR1_Output", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    dispatchDescription.renderSize       = { renderSize, renderSize };
+    dispatchDescription.enableSharpening = enableSharpening;
+    dispatchDescription.sharpness        = 0.8f;
+
+    const auto start = std::chrono::steady_clock::now();
+    CHECK(ffxFsr1ContextDispatch(&context, &dispatchDescription) == FFX_OK);
+    const double milliseconds = millisecondsSince(start);
+    CHECK(ffxFsr1ContextDestroy(&context) == FFX_OK);
+
+    const float error = flatError(output, 0.25f, 0.5f, 0.75f);
+    printf("FSR1 %u to %u%s: %.2f ms, flat error %g\n", renderSize, displaySize, enableSharpening ? " with RCAS" : "", milliseconds, error);
+    CHECK(error < (enableSharpening ? 5e-3f : 1e-5f));
+}
+
+// The 5x5 kernel weights sum to one, so a flat image stays flat and an impulse spreads without losing energy,
+// up to the precision of the halves the group shared cache packs the channels into.
+static void runBlur()
+{
+    const uint32_t size = 32;
+    Texture        input(size, size), output(size, size);
+
+    CpuBackend                backend;
+    FfxBlurContextDescription contextDescription = {};
+    contextDescription.kernelPermutations = FFX_BLUR_KERNEL_PERMUTATION_0;
+    contextDescription.kernelSizes        = FFX_BLUR_KERNEL_SIZE_5x5;
+    contextDescription.floatPrecision     = FFX_BLUR_FLOAT_PRECISION_32BIT;
+    contextDescription.backendInterface   = backend.backendInterface;
+
+    FfxBlurContext context;
+    CHECK(ffxBlurContextCreate(&context, &contextDescription) == FFX_OK);
+
+    FfxBlurDispatchDescription dispatchDescription = {};
+    dispatchDescription.commandList        = ffxGetCommandListCPU(backend.device);
+    dispatchDescription.kernelPermutation  = FFX_BLUR_KERNEL_PERMUTATION_0;
+    dispatchDescription.kernelSize         = FFX_BLUR_KERNEL_SIZE_5x5;
+    dispatchDescription.inputAndOutputSize = { size, size };
+    dispatchDescription.input              = input.resource(L"BLUR_Input");
+    dispatchDescription.output             = output.resource(L"BLUR_Output", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+
+    input.fill(0.25f, 0.5f, 0.75f);
+    const auto start = std::chrono::steady_clock::now();
+    CHECK(ffxBlurContextDispatch(&context, &dispatchDescription) == FFX_OK);
+    const double milliseconds = millisecondsSince(start);
+    const float  flat         = flatError(output, 0.25f, 0.5f, 0.75f);
+
+    input.fill(0.0f, 0.0f, 0.0f);
+    input.texel(size / 2, size / 2)[0] = 1.0f;
+    CHECK(ffxBlurContextDispatch(&context, &dispatchDescription) == FFX_OK);
+    CHECK(ffxBlurContextDestroy(&context) == FFX_OK);
+
+    float energy = 0.0f, asymmetry = 0.0f;
+    for (uint32_t y = 0; y < size; ++y)
+        for (uint32_t x = 0; x < size; ++x) {
+            energy += output.texel(x, y)[0];
+            if (x > 0 && y > 0)
+                asymmetry = fmaxf(asymmetry, fabsf(output.texel(x, y)[0] - output.texel(size - x, size - y)[0]));
+        }
+
+    printf("Blur %ux%u 5x5: %.2f ms, flat error %g, impulse energy %g\n", size, size, milliseconds, flat, energy);
+    CHECK(flat < 1e-5f);
+    CHECK(fabsf(energy - 1.0f) < 1e-3f);
+    CHECK(asymmetry < 1e-6f);
+    CHECK(output.texel(size / 2, size / 2)[0] > output.texel(size / 2 + 1, size / 2)[0]);
+}
+
+// A flat frame with a flat depth and no motion, upscaled by FSR2 over a full jitter sequence, has to come out
+// as flat as it went in. The internal history is half float, which bounds the error, and RCAS loosens it as
+// for FSR1. With sharpening the exposure is computed by the luminance pyramid, and the reactive and the
+// transparency and composition masks are generated from an opaque-only input that differs from the colour;
+// the reactive mask the context generates is checked against a serial reference.
+static void runFsr2(bool enableSharpening)
+{
+    const uint32_t renderSize = 32, displaySize = 64;
+    Texture        color(renderSize, renderSize), opaqueOnly(renderSize, renderSize), output(displaySize, displaySize);
+    Texture        depth(renderSize, renderSize, 1, FFX_SURFACE_FORMAT_R32_FLOAT), motionVectors(renderSize, renderSize, 1, FFX_SURFACE_FORMAT_R32G32_FLOAT);
+    Texture        reactive(renderSize, renderSize, 1, FFX_SURFACE_FORMAT_R32_FLOAT);
+    color.fill(0.25f, 0.5f, 0.75f);
+    opaqueOnly.fill(0.125f, 0.5f, 0.5f);
+    for (uint32_t y = 0; y < renderSize; ++y)
+        for (uint32_t x = 0; x < renderSize; ++x)
+            depth.texel(x, y)[0] = 0.5f;
+
+    CpuBackend                backend;
+    FfxFsr2ContextDescription contextDescription = {};
+    contextDescription.flags            = enableSharpening ? FFX_FSR2_ENABLE_AUTO_EXPOSURE : 0;
+    contextDescription.maxRenderSize    = { renderSize, renderSize };
+    contextDescription.displaySize      = { displaySize, displaySize };
+    contextDescription.backendInterface = backend.backendInterface;
+
+    FfxFsr2Context context;
+    CHECK(ffxFsr2ContextCreate(&context, &contextDescription) == FFX_OK);
+
+    float reactiveError = 0.0f;
+    if (enableSharpening) {
+        FfxFsr2GenerateReactiveDescription reactiveDescription = {};
+        reactiveDescription.commandList     = ffxGetCommandListCPU(backend.device);
+        reactiveDescription.colorOpaqueOnly = opaqueOnly.resource(L"FSR2_OpaqueOnly");
+        reactiveDescription.colorPreUpscale = color.resource(L"FSR2_Color");
+        reactiveDescription.outReactive     = reactive.resource(L"FSR2_Reactive", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+        reactiveDescription.renderSize      = { renderSize, renderSize };
+        reactiveDescription.scale           = 0.5f;
+        CHECK(ffxFsr2ContextGenerateReactiveMask(&context, &reactiveDescription) == FFX_OK);
+
+        // length of the colour difference, scaled
+        const float expected = sqrtf(0.125f * 0.125f + 0.25f * 0.25f) * 0.5f;
+        for (uint32_t y = 0; y < renderSize; ++y)
+            for (uint32_t x = 0; x < renderSize; ++x)
+                reactiveError = fmaxf(reactiveError, fabsf(reactive.texel(x, y)[0] - expected));
+    }
+
+    FfxFsr2DispatchDescription dispatchDescription = {};
+    dispatchDescription.commandList             = ffxGetCommandListCPU(backend.device);
+    dispatchDescription.color                   = color.resource(L"FSR2_Color");
+    dispatchDescription.depth                   = depth.resource(L"FSR2_Depth");
+    dispatchDescription.motionVectors           = motionVectors.resource(L"FSR2_MotionVectors");
+    dispatchDescription.output                  = output.resource(L"FSR2_Output", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    dispatchDescription.motionVectorScale       = { 1.0f, 1.0f };
+    dispatchDescription.renderSize              = { renderSize, renderSize };
+    dispatchDescription.enableSharpening        = enableSharpening;
+    dispatchDescription.sharpness               = 0.8f;
+    dispatchDescription.frameTimeDelta          = 16.6f;
+    dispatchDescription.preExposure             = 1.0f;
+    dispatchDescription.cameraNear              = 0.1f;
+    dispatchDescription.cameraFar               = 100.0f;
+    dispatchDescription.cameraFovAngleVertical  = 1.0f;
+    dispatchDescription.viewSpaceToMetersFactor = 1.0f;
+    if (enableSharpening) {
+        dispatchDescription.enableAutoReactive = true;
+        dispatchDescription.colorOpaqueOnly    = opaqueOnly.resource(L"FSR2_OpaqueOnly");
+        dispatchDescription.autoTcThreshold    = 0.05f;
+        dispatchDescription.autoTcScale        = 1.0f;
+        dispatchDescription.autoReactiveScale  = 5.0f;
+        dispatchDescription.autoReactiveMax    = 0.9f;
+    }
+
+    const int32_t phaseCount = ffxFsr2GetJitterPhaseCount(int32_t(renderSize), int32_t(displaySize));
+    const auto    start      = std::chrono::steady_clock::now();
+    for (int32_t frame = 0; frame < phaseCount; ++frame) {
+        CHECK(ffxFsr2GetJitterOffset(&dispatchDescription.jitterOffset.x, &dispatchDescription.jitterOffset.y, frame, phaseCount) == FFX_OK);
+        dispatchDescription.reset = frame == 0;
+        CHECK(ffxFsr2ContextDispatch(&context, &dispatchDescription) == FFX_OK);
+    }
+    const double milliseconds = millisecondsSince(start) / phaseCount;
+    CHECK(ffxFsr2ContextDestroy(&context) == FFX_OK);
+
+    const float error = flatError(output, 0.25f, 0.5f, 0.75f);
+    printf("FSR2 %u to %u%s: %.2f ms per frame over %d frames, flat error %g", renderSize, displaySize,
+           enableSharpening ? " with RCAS and generated masks" : "", milliseconds, phaseCount, error);
+    if (enableSharpening)
+        printf(", reactive mask error %g", reactiveError);
+    printf("\n");
+    CHECK(error < (enableSharpening ? 5e-3f : 2e-3f));
+    CHECK(reactiveError < 1e-5f);
+}
+
+// The same flat frame through the FSR3 upscaler, whose dilated depth, dilated motion vectors and reconstructed
+// previous depth are shared resources the application allocates. The plain run then draws the debug view,
+// which has to replace the flat output.
+static void runFsr3Upscaler(bool enableSharpening)
+{
+    const uint32_t renderSize = 32, displaySize = 64;
+    Texture        color(renderSize, renderSize), opaqueOnly(renderSize, renderSize), output(displaySize, displaySize);
+    Texture        depth(renderSize, renderSize, 1, FFX_SURFACE_FORMAT_R32_FLOAT), motionVectors(renderSize, renderSize, 1, FFX_SURFACE_FORMAT_R32G32_FLOAT);
+    Texture        reactive(renderSize, renderSize, 1, FFX_SURFACE_FORMAT_R32_FLOAT);
+    color.fill(0.25f, 0.5f, 0.75f);
+    opaqueOnly.fill(0.125f, 0.5f, 0.5f);
+    for (uint32_t y = 0; y < renderSize; ++y)
+        for (uint32_t x = 0; x < renderSize; ++x)
+            depth.texel(x, y)[0] = 0.5f;
+
+    CpuBackend                        backend;
+    FfxFsr3UpscalerContextDescription contextDescription = {};
+    contextDescription.flags            = enableSharpening ? FFX_FSR3UPSCALER_ENABLE_AUTO_EXPOSURE : 0;
+    contextDescription.maxRenderSize    = { renderSize, renderSize };
+    contextDescription.maxUpscaleSize   = { displaySize, displaySize };
+    contextDescription.backendInterface = backend.backendInterface;
+
+    FfxFsr3UpscalerContext context;
+    CHECK(ffxFsr3UpscalerContextCreate(&context, &contextDescription) == FFX_OK);
+
+    FfxFsr3UpscalerSharedResourceDescriptions sharedResources = {};
+    CHECK(ffxFsr3UpscalerGetSharedResourceDescriptions(&context, &sharedResources) == FFX_OK);
+    Texture dilatedDepth(sharedResources.dilatedDepth.resourceDescription.width, sharedResources.dilatedDepth.resourceDescription.height, 1,
+                         FFX_SURFACE_FORMAT_R32_FLOAT);
+    Texture dilatedMotionVectors(sharedResources.dilatedMotionVectors.resourceDescription.width,
+                                 sharedResources.dilatedMotionVectors.resourceDescription.height, 1, FFX_SURFACE_FORMAT_R32G32_FLOAT);
+    Texture reconstructedPrevNearestDepth(sharedResources.reconstructedPrevNearestDepth.resourceDescription.width,
+                                          sharedResources.reconstructedPrevNearestDepth.resourceDescription.height, 1, FFX_SURFACE_FORMAT_R32_UINT);
+
+    float reactiveError = 0.0f;
+    if (enableSharpening) {
+        FfxFsr3UpscalerGenerateReactiveDescription reactiveDescription = {};
+        reactiveDescription.commandList     = ffxGetCommandListCPU(backend.device);
+        reactiveDescription.colorOpaqueOnly = opaqueOnly.resource(L"FSR3UPSCALER_OpaqueOnly");
+        reactiveDescription.colorPreUpscale = color.resource(L"FSR3UPSCALER_Color");
+        reactiveDescription.outReactive     = reactive.resource(L"FSR3UPSCALER_Reactive", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+        reactiveDescription.renderSize      = { renderSize, renderSize };
+        reactiveDescription.scale           = 0.5f;
+        CHECK(ffxFsr3UpscalerContextGenerateReactiveMask(&context, &reactiveDescription) == FFX_OK);
+
+        const float expected = sqrtf(0.125f * 0.125f + 0.25f * 0.25f) * 0.5f;
+        for (uint32_t y = 0; y < renderSize; ++y)
+            for (uint32_t x = 0; x < renderSize; ++x)
+                reactiveError = fmaxf(reactiveError, fabsf(reactive.texel(x, y)[0] - expected));
+    }
+
+    FfxFsr3UpscalerDispatchDescription dispatchDescription = {};
+    dispatchDescription.commandList                   = ffxGetCommandListCPU(backend.device);
+    dispatchDescription.color                         = color.resource(L"FSR3UPSCALER_Color");
+    dispatchDescription.depth                         = depth.resource(L"FSR3UPSCALER_Depth");
+    dispatchDescription.motionVectors                 = motionVectors.resource(L"FSR3UPSCALER_MotionVectors");
+    dispatchDescription.dilatedDepth                  = dilatedDepth.resource(L"FSR3UPSCALER_DilatedDepth", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    dispatchDescription.dilatedMotionVectors          = dilatedMotionVectors.resource(L"FSR3UPSCALER_DilatedVelocity", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    dispatchDescription.reconstructedPrevNearestDepth = reconstructedPrevNearestDepth.resource(L"FSR3UPSCALER_ReconstructedPrevNearestDepth", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    dispatchDescription.output                        = output.resource(L"FSR3UPSCALER_Output", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    dispatchDescription.motionVectorScale             = { 1.0f, 1.0f };
+    dispatchDescription.renderSize                    = { renderSize, renderSize };
+    dispatchDescription.upscaleSize                   = { displaySize, displaySize };
+    dispatchDescription.enableSharpening              = enableSharpening;
+    dispatchDescription.sharpness                     = 0.8f;
+    dispatchDescription.frameTimeDelta                = 16.6f;
+    dispatchDescription.preExposure                   = 1.0f;
+    dispatchDescription.cameraNear                    = 0.1f;
+    dispatchDescription.cameraFar                     = 100.0f;
+    dispatchDescription.cameraFovAngleVertical        = 1.0f;
+    dispatchDescription.viewSpaceToMetersFactor       = 1.0f;
+    if (enableSharpening)
+        dispatchDescription.reactive = reactive.resource(L"FSR3UPSCALER_Reactive");
+
+    const int32_t phaseCount = ffxFsr3UpscalerGetJitterPhaseCount(int32_t(renderSize), int32_t(displaySize));
+    const auto    start      = std::chrono::steady_clock::now();
+    for (int32_t frame = 0; frame < phaseCount; ++frame) {
+        CHECK(ffxFsr3UpscalerGetJitterOffset(&dispatchDescription.jitterOffset.x, &dispatchDescription.jitterOffset.y, frame, phaseCount) == FFX_OK);
+        dispatchDescription.reset = frame == 0;
+        CHECK(ffxFsr3UpscalerContextDispatch(&context, &dispatchDescription) == FFX_OK);
+    }
+    const double milliseconds = millisecondsSince(start) / phaseCount;
+
+    const float error = flatError(output, 0.25f, 0.5f, 0.75f);
+    if (!enableSharpening) {
+        dispatchDescription.flags = FFX_FSR3UPSCALER_DISPATCH_DRAW_DEBUG_VIEW;
+        CHECK(ffxFsr3UpscalerContextDispatch(&context, &dispatchDescription) == FFX_OK);
+        CHECK(flatError(output, 0.25f, 0.5f, 0.75f) > 0.1f);
+    }
+    CHECK(ffxFsr3UpscalerContextDestroy(&context) == FFX_OK);
+
+    printf("FSR3 upscaler %u to %u%s: %.2f ms per frame over %d frames, flat error %g", renderSize, displaySize,
+           enableSharpening ? " with RCAS and a generated reactive mask" : "", milliseconds, phaseCount, error);
+    if (enableSharpening)
+        printf(", reactive mask error %g", reactiveError);
+    printf("\n");
+    CHECK(error < (enableSharpening ? 5e-3f : 2e-3f));
+    CHECK(reactiveError < 1e-5f);
+}
+
+// Mirrors Fsr2SpdConstants, which is private to ffx_fsr2.cpp.
+struct LuminancePyramidConstants
+{
+    uint32_t mips;
+    uint32_t numWorkGroups;
+    uint32_t workGroupOffset[2];
+    uint32_t renderSize[2];
+};
+
+// Runs the FSR2 luminance pyramid straight through the backend interface, the passes the FSR2
+// context creates next to it have no CPU kernels. The pass is SPD on log luma with a group shared
+// cache, so the shading change mip, mip 5 and the 1x1 average are checked against serial block
+// means of the log luma, and the exposure against the FSR2 ISO 100 formula. The second frame
+// starts from the first one's average and has to blend towards the new one by 1 - exp(-deltaTime).
+static void runFsr2LuminancePyramid()
+{
+    const uint32_t size = 256, mipCount = 8, shadingChangeMip = FFX_FSR2_SHADING_CHANGE_MIP_LEVEL;
+    Texture        input(size, size), luminance(size / 2, size / 2, mipCount, FFX_SURFACE_FORMAT_R32_FLOAT);
+    Texture        autoExposure(1, 1, 1, FFX_SURFACE_FORMAT_R32G32_FLOAT), atomicCounter(1, 1, 1, FFX_SURFACE_FORMAT_R32_UINT);
+    srand(2);
+    for (uint32_t y = 0; y < size; ++y)
+        for (uint32_t x = 0; x < size; ++x)
+            for (uint32_t channel = 0; channel < 4; ++channel)
+                input.texel(x, y)[channel] = float(rand() % 1024) / 256.0f;
+
+    CpuBackend backend;
+    FfxInterface* backendInterface = &backend.backendInterface;
+    uint32_t      effectContextId  = 0;
+    CHECK(backendInterface->fpCreateBackendContext(backendInterface, FFX_EFFECT_FSR2, nullptr, &effectContextId) == FFX_OK);
+
+    FfxPipelineDescription pipelineDescription = {};
+    pipelineDescription.stage = FFX_BIND_COMPUTE_SHADER_STAGE;
+    FfxPipelineState pipeline = {};
+    CHECK(backendInterface->fpCreatePipeline(backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_COMPUTE_LUMINANCE_PYRAMID,
+                                             FSR2_SHADER_PERMUTATION_LOW_RES_MOTION_VECTORS, &pipelineDescription, effectContextId, &pipeline) == FFX_OK);
+
+    Fsr2Constants constants = {};
+    constants.renderSize[0] = constants.renderSize[1] = constants.maxRenderSize[0] = constants.maxRenderSize[1] = int32_t(size);
+    constants.inputColorResourceDimensions[0] = constants.inputColorResourceDimensions[1] = int32_t(size);
+    constants.lumaMipLevelToUse = int32_t(shadingChangeMip);
+    constants.lumaMipDimensions[0] = constants.lumaMipDimensions[1] = int32_t(size >> (shadingChangeMip + 1));
+    constants.preExposure = 2.0f;
+    constants.deltaTime   = 0.25f;
+
+    // 64x64 pixels per workgroup
+    LuminancePyramidConstants spdConstants = { mipCount, (size / 64) * (size / 64), { 0, 0 }, { size, size } };
+
+    // cleared the way the FSR2 context clears it on a reset
+    autoExposure.texel(0, 0)[0] = -1.0f;
+    autoExposure.texel(0, 0)[1] = 1e8f;
+
+    auto dispatch = [&]() {
+        FfxResourceInternal inputResource, luminanceResource, autoExposureResource, atomicCounterResource;
+        FfxResource         resource = input.resource(L"FSR2_InputColor");
+        backendInterface->fpRegisterResource(backendInterface, &resource, effectContextId, &inputResource);
+        resource = luminance.resource(L"FSR2_SceneLuminance", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+        backendInterface->fpRegisterResource(backendInterface, &resource, effectContextId, &luminanceResource);
+        resource = autoExposure.resource(L"FSR2_AutoExposure", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+        backendInterface->fpRegisterResource(backendInterface, &resource, effectContextId, &autoExposureResource);
+        resource = atomicCounter.resource(L"FSR2_SpdAtomicCount", FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+        backendInterface->fpRegisterResource(backendInterface, &resource, effectContextId, &atomicCounterResource);
+
+        FfxGpuJobDescription job = { FFX_GPU_JOB_COMPUTE };
+        job.computeJobDescriptor.pipeline = pipeline;
+        job.computeJobDescriptor.dimensions[0] = size / 64;
+        job.computeJobDescriptor.dimensions[1] = size / 64;
+        job.computeJobDescriptor.dimensions[2] = 1;
+        job.computeJobDescriptor.srvTextures[0].resource = inputResource;
+
+        // by slot, in whatever order the pipeline reflects the bindings
+        const FfxTextureUAV uavs[] = { { 0, atomicCounterResource }, { shadingChangeMip, luminanceResource }, { 5, luminanceResource }, { 0, autoExposureResource } };
+        for (uint32_t index = 0; index < pipeline.uavTextureCount; ++index)
+            job.computeJobDescriptor.uavTextures[index] = uavs[pipeline.uavTextureBindings[index].slotIndex];
+
+        backendInterface->fpStageConstantBufferDataFunc(backendInterface, &constants, sizeof(constants), &job.computeJobDescriptor.cbs[0]);
+        backendInterface->fpStageConstantBufferDataFunc(backendInterface, &spdConstants, sizeof(spdConstants), &job.computeJobDescriptor.cbs[1]);
+        if (pipeline.constantBufferBindings[0].slotIndex != 0)
+            std::swap(job.computeJobDescriptor.cbs[0], job.computeJobDescriptor.cbs[1]);
+
+        CHECK(backendInterface->fpScheduleGpuJob(backendInterface, &job) == FFX_OK);
+        CHECK(backendInterface->fpExecuteGpuJobs(backendInterface, ffxGetCommandListCPU(backend.device), effectContextId) == FFX_OK);
+        CHECK(backendInterface->fpUnregisterResources(backendInterface, ffxGetCommandListCPU(backend.device), effectContextId) == FFX_OK);
+    };
+
+    // serial block means of the log luma at the resolution of each checked mip
+    auto logLumaMean = [&](uint32_t x0, uint32_t y0, uint32_t blockSize) {
+        double sum = 0.0;
+        for (uint32_t y = y0; y < y0 + blockSize; ++y)
+            for (uint32_t x = x0; x < x0 + blockSize; ++x) {
+                const float* rgb  = input.texel(x, y);
+                const float  luma = (rgb[0] * 0.2126f + rgb[1] * 0.7152f + rgb[2] * 0.0722f) / constants.preExposure;
+                sum += log(fmax(1e-3, double(luma)));
+            }
+        return sum / (double(blockSize) * blockSize);
+    };
+    auto mipError = [&](uint32_t mip) {
+        const uint32_t blockSize = 2u << mip;
+        float          error     = 0.0f;
+        for (uint32_t y = 0; y < size / blockSize; ++y)
+            for (uint32_t x = 0; x < size / blockSize; ++x)
+                error = fmaxf(error, fabsf(luminance.texel(x, y, mip)[0] - float(logLumaMean(x * blockSize, y * blockSize, blockSize))));
+        return error;
+    };
+    // ComputeAutoExposureFromLavg with S = 100, K = 12.5 and q = 0.65
+    auto exposure = [](double averageLogLuma) { return 1.0 / (78.0 / (0.65 * 100.0) * exp(averageLogLuma) * 100.0 / 12.5); };
+
+    const auto start = std::chrono::steady_clock::now();
+    dispatch();
+    const double milliseconds = millisecondsSince(start);
+
+    const double average       = logLumaMean(0, 0, size);
+    const float  mipsError     = fmaxf(mipError(shadingChangeMip), mipError(5));
+    const float  averageError  = fabsf(autoExposure.texel(0, 0)[1] - float(average));
+    const float  exposureError = fabsf(autoExposure.texel(0, 0)[0] / float(exposure(average)) - 1.0f);
+
+    // a darker frame, smoothed from the first frame's average
+    for (uint32_t y = 0; y < size; ++y)
+        for (uint32_t x = 0; x < size; ++x)
+            for (uint32_t channel = 0; channel < 3; ++channel)
+                input.texel(x, y)[channel] *= 0.125f;
+    dispatch();
+
+    const double smoothed      = average + (logLumaMean(0, 0, size) - average) * (1.0 - exp(-double(constants.deltaTime)));
+    const float  smoothedError = fabsf(autoExposure.texel(0, 0)[1] - float(smoothed));
+
+    CHECK(backendInterface->fpDestroyPipeline(backendInterface, &pipeline, effectContextId) == FFX_OK);
+    CHECK(backendInterface->fpDestroyBackendContext(backendInterface, effectContextId) == FFX_OK);
+
+    printf("FSR2 luminance pyramid %ux%u: %.2f ms, mip error %g, average error %g, exposure error %g, smoothed average error %g\n", size, size,
+           milliseconds, mipsError, averageError, exposureError, smoothedError);
+    CHECK(mipsError < 1e-4f);
+    CHECK(averageError < 1e-4f);
+    CHECK(exposureError < 1e-4f);
+    CHECK(smoothedError < 1e-4f);
+    CHECK(atomicCounter.texel(0, 0)[0] == 0.0f);
+}
+
+int main()
+{
+    runSpd();
+    runCas();
+    runFsr1(false);
+    runFsr1(true);
+    runBlur();
+    runFsr2LuminancePyramid();
+    runFsr2(false);
+    runFsr2(true);
+    runFsr3Upscaler(false);
+    runFsr3Upscaler(true);
+
+    CHECK(s_pinnedBlobCount == 0);
+    return ffxMockExitCode();
+}
@@ -0,0 +1,637 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/// @defgroup DX11Mock DX11 Mock Device
+/// A header-only recording implementation of the Direct3D 11 device and
+/// immediate context used by the DX11 backend.
+///
+/// Together with the <c><i>windows.h</i></c>, <c><i>d3d11.h</i></c>,
+/// <c><i>d3d11_1.h</i></c> and <c><i>dxgi.h</i></c> shims in this directory,
+/// the backend builds and runs on platforms without the Windows SDK. Every
+/// device and context call is counted and timed, the bound compute state is
+/// tracked so that hazards the runtime would silently resolve are reported,
+/// and live objects are counted so that leaks show up when the device is
+/// released. No GPU work is performed.
+///
+/// Put this directory first on the include path, ahead of any Windows SDK, and
+/// define <c><i>_WIN32</i></c>. <c><i>CMakeLists.txt</i></c> in this directory
+/// builds <c><i>ffx_dx11_mock_jobs.cpp</i></c> with <c><i>ffx_dx11.cpp</i></c>,
+/// <c><i>ffx_task.cpp</i></c>, <c><i>ffx_object_management.cpp</i></c> and the
+/// DXBC patching sources into an executable which checks a chain of jobs and
+/// reports the costs of the backend.
+///
+/// @ingroup DX11Backend
+
+#pragma once
+
+#include <d3d11_1.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// The device and context calls recorded by the mock.
+///
+/// @ingroup DX11Mock
+typedef enum FfxMockCallDX11
+{
+    FFX_MOCK_CALL_CREATE_BUFFER,
+    FFX_MOCK_CALL_CREATE_TEXTURE1D,
+    FFX_MOCK_CALL_CREATE_TEXTURE2D,
+    FFX_MOCK_CALL_CREATE_TEXTURE3D,
+    FFX_MOCK_CALL_CREATE_SHADER_RESOURCE_VIEW,
+    FFX_MOCK_CALL_CREATE_UNORDERED_ACCESS_VIEW,
+    FFX_MOCK_CALL_CREATE_COMPUTE_SHADER,
+    FFX_MOCK_CALL_MAP,
+    FFX_MOCK_CALL_UNMAP,
+    FFX_MOCK_CALL_CS_SET_SHADER,
+    FFX_MOCK_CALL_CS_SET_SHADER_RESOURCES,
+    FFX_MOCK_CALL_CS_SET_UNORDERED_ACCESS_VIEWS,
+    FFX_MOCK_CALL_CS_SET_CONSTANT_BUFFERS,
+    FFX_MOCK_CALL_CS_SET_CONSTANT_BUFFERS1,
+    FFX_MOCK_CALL_DISPATCH,
+    FFX_MOCK_CALL_COPY_RESOURCE,
+    FFX_MOCK_CALL_CLEAR_UNORDERED_ACCESS_VIEW_UINT,
+    FFX_MOCK_CALL_DISCARD_RESOURCE,
+
+    FFX_MOCK_CALL_COUNT
+} FfxMockCallDX11;
+
+/// Get the name of the Direct3D 11 method behind a recorded call.
+///
+/// @ingroup DX11Mock
+inline const char* ffxMockCallNameDX11(FfxMockCallDX11 call)
+{
+    static const char* const names[FFX_MOCK_CALL_COUNT] = {
+        "CreateBuffer",
+        "CreateTexture1D",
+        "CreateTexture2D",
+        "CreateTexture3D",
+        "CreateShaderResourceView",
+        "CreateUnorderedAccessView",
+        "CreateComputeShader",
+        "Map",
+        "Unmap",
+        "CSSetShader",
+        "CSSetShaderResources",
+        "CSSetUnorderedAccessViews",
+        "CSSetConstantBuffers",
+        "CSSetConstantBuffers1",
+        "Dispatch",
+        "CopyResource",
+        "ClearUnorderedAccessViewUint",
+        "DiscardResource",
+    };
+    return call < FFX_MOCK_CALL_COUNT ? names[call] : "";
+}
+
+/// A single recorded call.
+///
+/// @ingroup DX11Mock
+typedef struct FfxMockCallRecordDX11
+{
+    FfxMockCallDX11     call;           ///< The method which was called.
+    uint64_t            timestamp;      ///< Time the call was made, in nanoseconds since the log was last reset.
+} FfxMockCallRecordDX11;
+
+/// The calls made on a mock device and its immediate context.
+///
+/// The gaps between the timestamps of consecutive records are the host time
+/// the caller spent between two calls. Device calls may come from several
+/// threads at once, as on a free-threaded device, so updates take a lock.
+///
+/// @ingroup DX11Mock
+struct FfxMockCallLogDX11
+{
+    std::mutex                          mutex;                              ///< Guards the counts, times and records.
+    uint32_t                            counts[FFX_MOCK_CALL_COUNT] = {};   ///< Number of calls per method.
+    uint64_t                            times[FFX_MOCK_CALL_COUNT] = {};    ///< Time spent inside the mock per method, in nanoseconds.
+    uint32_t                            hazardCount = 0;                    ///< Number of views the runtime would have unbound because their resource was also bound for the other access.
+    std::vector<FfxMockCallRecordDX11>  records;                            ///< Every call in order, when <c><i>recordCalls</i></c> is set.
+    bool                                recordCalls = false;                ///< Keep a record of every call, not just the counts.
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    /// Clear all counts and records and restart the clock.
+    void reset()
+    {
+        memset(counts, 0, sizeof(counts));
+        memset(times, 0, sizeof(times));
+        hazardCount = 0;
+        records.clear();
+        start = std::chrono::steady_clock::now();
+    }
+
+    /// Total number of calls recorded since the last reset.
+    uint32_t totalCount() const
+    {
+        uint32_t total = 0;
+        for (uint32_t count : counts)
+            total += count;
+        return total;
+    }
+
+    /// Print the non-zero counts and times.
+    void print(FILE* file) const
+    {
+        for (uint32_t call = 0; call < FFX_MOCK_CALL_COUNT; ++call) {
+            if (counts[call])
+                fprintf(file, "%-32s %8u calls %10.3f us\n", ffxMockCallNameDX11(FfxMockCallDX11(call)), counts[call], times[call] / 1000.0);
+        }
+        if (hazardCount)
+            fprintf(file, "%-32s %8u\n", "hazards", hazardCount);
+    }
+};
+
+// times one mock call and records it in the log
+class FfxMockCallScopeDX11
+{
+public:
+    FfxMockCallScopeDX11(FfxMockCallLogDX11& log, FfxMockCallDX11 call)
+        : m_log(log), m_call(call), m_begin(std::chrono::steady_clock::now())
+    {
+        std::lock_guard<std::mutex> lock{ m_log.mutex };
+        m_log.counts[m_call]++;
+        if (m_log.recordCalls)
+            m_log.records.push_back({ m_call, uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(m_begin - m_log.start).count()) });
+    }
+
+    ~FfxMockCallScopeDX11()
+    {
+        std::lock_guard<std::mutex> lock{ m_log.mutex };
+        m_log.times[m_call] += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_begin).count();
+    }
+
+private:
+    FfxMockCallLogDX11&                     m_log;
+    FfxMockCallDX11                         m_call;
+    std::chrono::steady_clock::time_point   m_begin;
+};
+
+/// Number of mock objects alive in the process, including devices and contexts.
+///
+/// @ingroup DX11Mock
+inline std::atomic<int32_t>& ffxMockLiveObjectCountDX11()
+{
+    static std::atomic<int32_t> count{ 0 };
+    return count;
+}
+
+// reference counting and interface queries shared by every mock object
+template<typename Interface>
+class FfxMockObjectDX11 : public Interface
+{
+public:
+    FfxMockObjectDX11() { ffxMockLiveObjectCountDX11()++; }
+    virtual ~FfxMockObjectDX11() { ffxMockLiveObjectCountDX11()--; }
+
+    HRESULT QueryInterface(REFIID riid, void** ppvObject) override
+    {
+        if (riid == __uuidof(IUnknown) || riid == __uuidof(Interface)) {
+            this->AddRef();
+            *ppvObject = static_cast<Interface*>(this);
+            return S_OK;
+        }
+        *ppvObject = nullptr;
+        return E_NOINTERFACE;
+    }
+
+    UINT AddRef() override
+    {
+        return ++m_refCount;
+    }
+
+    UINT Release() override
+    {
+        const UINT refCount = --m_refCount;
+        if (refCount == 0)
+            delete this;
+        return refCount;
+    }
+
+    using Interface::QueryInterface;
+
+private:
+    std::atomic<UINT>   m_refCount{ 1 };
+};
+
+// device children keep their private data, debug names included. Only the immediate context knows its device;
+// it does not hold a reference on it, since the device owns the context.
+template<typename Interface>
+class FfxMockDeviceChildDX11 : public FfxMockObjectDX11<Interface>
+{
+public:
+    void GetDevice(ID3D11Device** ppDevice) override
+    {
+        if (m_device)
+            m_device->AddRef();
+        *ppDevice = m_device;
+    }
+
+    HRESULT GetPrivateData(REFGUID guid, UINT* pDataSize, void* pData) override
+    {
+        for (const PrivateData& entry : m_privateData) {
+            if (entry.guid != guid)
+                continue;
+            if (pData && *pDataSize < entry.data.size())
+                return E_INVALIDARG;
+            if (pData)
+                memcpy(pData, entry.data.data(), entry.data.size());
+            *pDataSize = static_cast<UINT>(entry.data.size());
+            return S_OK;
+        }
+        *pDataSize = 0;
+        return E_FAIL;
+    }
+
+    HRESULT SetPrivateData(REFGUID guid, UINT dataSize, const void* pData) override
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(pData);
+        for (PrivateData& entry : m_privateData) {
+            if (entry.guid == guid) {
+                entry.data.assign(bytes, bytes + dataSize);
+                return S_OK;
+            }
+        }
+        m_privateData.push_back({ guid, std::vector<uint8_t>(bytes, bytes + dataSize) });
+        return S_OK;
+    }
+
+protected:
+    struct PrivateData
+    {
+        GUID                    guid;
+        std::vector<uint8_t>    data;
+    };
+
+    ID3D11Device*               m_device = nullptr;
+    std::vector<PrivateData>    m_privateData;
+};
+
+/// A mock buffer with system memory backing for <c><i>Map</i></c>.
+///
+/// @ingroup DX11Mock
+class FfxMockBufferDX11 : public FfxMockDeviceChildDX11<ID3D11Buffer>
+{
+public:
+    explicit FfxMockBufferDX11(const D3D11_BUFFER_DESC& desc) : m_desc(desc), m_data(desc.ByteWidth) {}
+
+    void GetType(D3D11_RESOURCE_DIMENSION* pResourceDimension) override { *pResourceDimension = D3D11_RESOURCE_DIMENSION_BUFFER; }
+    void GetDesc(D3D11_BUFFER_DESC* pDesc) override { *pDesc = m_desc; }
+
+    uint8_t* data() { return m_data.data(); }
+
+private:
+    D3D11_BUFFER_DESC       m_desc;
+    std::vector<uint8_t>    m_data;
+};
+
+// textures only keep their description
+template<typename Interface, typename Desc, D3D11_RESOURCE_DIMENSION Dimension>
+class FfxMockTextureDX11 : public FfxMockDeviceChildDX11<Interface>
+{
+public:
+    explicit FfxMockTextureDX11(const Desc& desc) : m_desc(desc) {}
+
+    void GetType(D3D11_RESOURCE_DIMENSION* pResourceDimension) override { *pResourceDimension = Dimension; }
+    void GetDesc(Desc* pDesc) override { *pDesc = m_desc; }
+
+private:
+    Desc    m_desc;
+};
+
+typedef FfxMockTextureDX11<ID3D11Texture1D, D3D11_TEXTURE1D_DESC, D3D11_RESOURCE_DIMENSION_TEXTURE1D> FfxMockTexture1DDX11;
+typedef FfxMockTextureDX11<ID3D11Texture2D, D3D11_TEXTURE2D_DESC, D3D11_RESOURCE_DIMENSION_TEXTURE2D> FfxMockTexture2DDX11;
+typedef FfxMockTextureDX11<ID3D11Texture3D, D3D11_TEXTURE3D_DESC, D3D11_RESOURCE_DIMENSION_TEXTURE3D> FfxMockTexture3DDX11;
+
+// views hold a reference on their resource, as the runtime does
+template<typename Interface, typename Desc>
+class FfxMockViewDX11 : public FfxMockDeviceChildDX11<Interface>
+{
+public:
+    FfxMockViewDX11(ID3D11Resource* resource, const Desc* desc) : m_resource(resource), m_desc(desc ? *desc : Desc{})
+    {
+        m_resource->AddRef();
+    }
+
+    ~FfxMockViewDX11() override { m_resource->Release(); }
+
+    void GetResource(ID3D11Resource** ppResource) override
+    {
+        m_resource->AddRef();
+        *ppResource = m_resource;
+    }
+
+    void GetDesc(Desc* pDesc) override { *pDesc = m_desc; }
+
+    ID3D11Resource* resource() const { return m_resource; }
+
+private:
+    ID3D11Resource* m_resource;
+    Desc            m_desc;
+};
+
+typedef FfxMockViewDX11<ID3D11ShaderResourceView, D3D11_SHADER_RESOURCE_VIEW_DESC>   FfxMockShaderResourceViewDX11;
+typedef FfxMockViewDX11<ID3D11UnorderedAccessView, D3D11_UNORDERED_ACCESS_VIEW_DESC> FfxMockUnorderedAccessViewDX11;
+
+/// A mock compute shader keeping a copy of its bytecode.
+///
+/// @ingroup DX11Mock
+class FfxMockComputeShaderDX11 : public FfxMockDeviceChildDX11<ID3D11ComputeShader>
+{
+public:
+    FfxMockComputeShaderDX11(const void* bytecode, SIZE_T size)
+        : m_bytecode(static_cast<const uint8_t*>(bytecode), static_cast<const uint8_t*>(bytecode) + size) {}
+
+    const std::vector<uint8_t>& bytecode() const { return m_bytecode; }
+
+private:
+    std::vector<uint8_t>    m_bytecode;
+};
+
+/// A mock immediate context which records its calls and tracks the bound compute state.
+///
+/// The context answers queries for <c><i>ID3D11DeviceContext1</i></c> unless
+/// <c><i>supportContext1</i></c> is cleared, which emulates a Direct3D 11.0
+/// runtime.
+///
+/// @ingroup DX11Mock
+class FfxMockDeviceContextDX11 : public FfxMockDeviceChildDX11<ID3D11DeviceContext1>
+{
+public:
+    FfxMockDeviceContextDX11(FfxMockCallLogDX11& log, ID3D11Device* device) : m_log(log) { m_device = device; }
+
+    HRESULT QueryInterface(REFIID riid, void** ppvObject) override
+    {
+        if (riid == __uuidof(ID3D11DeviceContext) || (supportContext1 && riid == __uuidof(ID3D11DeviceContext1)) || riid == __uuidof(IUnknown)) {
+            AddRef();
+            *ppvObject = static_cast<ID3D11DeviceContext1*>(this);
+            return S_OK;
+        }
+        *ppvObject = nullptr;
+        return E_NOINTERFACE;
+    }
+
+    using ID3D11DeviceContext1::QueryInterface;
+
+    void CSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* ppShaderResourceViews) override
+    {
+        FfxMockCallScopeDX11 scope(m_log, FFX_MOCK_CALL_CS_SET_SHADER_RESOURCES);
+        for (UINT i = 0; i < numViews; ++i) {
+            ID3D11ShaderResourceView* view = ppShaderResourceViews[i];
+
+            // an SRV of a resource bound for unordered access is bound as null
+            for (ID3D11UnorderedAccessView* uav : uavs) {
+                if (view && uav && resourceOf(uav) == resourceOf(view)) {
+                    view = nullptr;
+                    m_log.hazardCount++;
+                    break;
+                }
+            }
+            srvs[startSlot + i] = view;
+        }
+    }
+
+    void CSSetUnorderedAccessViews(UINT startSlot, UINT numUAVs, ID3D11UnorderedAccessView* const* ppUnorderedAccessViews, const UINT*) override
+    {
+        FfxMockCallScopeDX11 scope(m_log, FFX_MOCK_CALL_CS_SET_UNORDERED_ACCESS_VIEWS);
+        for (UINT i = 0; i < numUAVs; ++i) {
+            ID3D11UnorderedAccessView* view = ppUnorderedAccessViews[i];
+
+            // binding a UAV unbinds every SRV of the same resource
+            for (ID3D11ShaderResourceView*& srv : srvs) {
+                if (view && srv && resourceOf(srv) == resourceOf(view)) {
+                    srv = nullptr;
+                    m_log.hazardCount++;
+                }
+            }
+            uavs[startSlot + i] = view;
+        }
+    }
+
+    void CSSetShader(ID3D11ComputeShader* pComputeShader, ID3D11ClassInstance* const*, UINT) override
+    {
+        FfxMockCallScopeDX11 scope(m_log, FFX_MOCK_CALL_CS_SET_SHADER);
+        shader = pComputeShader;
+    }
+
+    void CSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* ppConstantBuffers) override
+    {
+        FfxMockCallScopeDX11 scope(m_log, FFX_MOCK_CALL_CS_SET_CONSTANT_BUFFERS);
+        for (UINT i = 0; i < numBuffers; ++i) {
+            constantBuffers[startSlot + i] = ppConstantBuffers[i];
+            constantBufferOffsets[startSlot + i] = 0;
+        }
+    }
+
+    void CSSetConstantBuffers1(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* ppConstantBuffers, const UINT* pFirstConstant, const UINT*) override
+    {
+        FfxMockCallScopeDX11 scope(m_log, FFX_MOCK_CALL_CS_SET_CONSTANT_BUFFERS1);
+        for (UINT i = 0; i < numBuffers; ++i) {
+            constantBuffers[startSlot + i] = ppConstantBuffers[i];
+            constantBufferOffsets[startSlot + i] = pFirstConstant ? pFirstConstant[i] * 16 : 0;
+        }
+    }
+
+    void Dispatch(UINT, UINT, UINT) override
+    {
+        FfxMockCallScopeDX11 scope(m_log, FFX_MOCK_CALL_DISPATCH);
+        if (onDispatch)
+            onDispatch(*this);
+    }
+
+    HRESULT Map(ID3D11Resource* pResource, UINT, D3D11_MAP, UINT, D3D11_MAPPED_SUBRESOURCE* pMappedResource) override
+    {
+        FfxMockCallScopeDX11 scope(m_log, FFX_MOCK_CALL_MAP);
+        D3D11_RESOURCE_DIMENSION dimension;
+        pResource->GetType(&dimension);
+        if (dimension != D3D11_RESOURCE_DIMENSION_BUFFER)
+            return E_INVALIDARG;
+
+        pMappedResource->pData = static_cast<FfxMockBufferDX11*>(static_cast<ID3D11Buffer*>(pResource))->data();
+        pMappedResource->RowPitch = 0;
+        pMappedResource->DepthPitch = 0;
+        return S_OK;
+    }
+
+    void Unmap(ID3D11Resource*, UINT) override
+    {
+        FfxMockCallScopeDX11 scope(m_log, FFX_MOCK_CALL_UNMAP);
+    }
+
+    void CopyResource(ID3D11Resource*, ID3D11Resource*) override
+    {
+        FfxMockCallScopeDX11 scope(m_log, FFX_MOCK_CALL_COPY_RESOURCE);
+    }
+
+    void ClearUnorderedAccessViewUint(ID3D11UnorderedAccessView*, const UINT[4]) override
+    {
+        FfxMockCallScopeDX11 scope(m_log, FFX_MOCK_CALL_CLEAR_UNORDERED_ACCESS_VIEW_UINT);
+    }
+
+    void DiscardResource(ID3D11Resource*) override
+    {
+        FfxMockCallScopeDX11 scope(m_log, FFX_MOCK_CALL_DISCARD_RESOURCE);
+    }
+
+    /// Check that no views are left bound.
+    bool viewsUnbound() const
+    {
+        for (ID3D11ShaderResourceView* srv : srvs) {
+            if (srv)
+                return false;
+        }
+        for (ID3D11UnorderedAccessView* uav : uavs) {
+            if (uav)
+                return false;
+        }
+        return true;
+    }
+
+    /// The contents of the constant buffer bound to a slot, at its bound offset.
+    const uint8_t* constantBufferData(UINT slot) const
+    {
+        if (!constantBuffers[slot])
+            return nullptr;
+        return static_cast<FfxMockBufferDX11*>(constantBuffers[slot])->data() + constantBufferOffsets[slot];
+    }
+
+    bool                        supportContext1 = true;
+    std::function<void(const FfxMockDeviceContextDX11&)> onDispatch;  ///< Called on every <c><i>Dispatch</i></c> with the state it would run with.
+    ID3D11ComputeShader*        shader = nullptr;
+    ID3D11ShaderResourceView*   srvs[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT] = {};
+    ID3D11UnorderedAccessView*  uavs[D3D11_1_UAV_SLOT_COUNT] = {};
+    ID3D11Buffer*               constantBuffers[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT] = {};
+    UINT                        constantBufferOffsets[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT] = {};  // in bytes
+
+private:
+    static ID3D11Resource* resourceOf(ID3D11View* view)
+    {
+        ID3D11Resource* resource = nullptr;
+        view->GetResource(&resource);
+        resource->Release();
+        return resource;
+    }
+
+    FfxMockCallLogDX11&         m_log;
+};
+
+/// A mock device which records its calls in <c><i>log</i></c>.
+///
+/// The device owns its immediate context and reports
+/// <c><i>featureLevel</i></c>, 11.1 by default.
+///
+/// @ingroup DX11Mock
+class FfxMockDeviceDX11 : public FfxMockObjectDX11<ID3D11Device>
+{
+public:
+    FfxMockDeviceDX11() : m_context(new FfxMockDeviceContextDX11(log, this)) {}
+    ~FfxMockDeviceDX11() override { m_context->Release(); }
+
+    HRESULT CreateBuffer(const D3D11_BUFFER_DESC* pDesc, const D3D11_SUBRESOURCE_DATA* pInitialData, ID3D11Buffer** ppBuffer) override
+    {
+        FfxMockCallScopeDX11 scope(log, FFX_MOCK_CALL_CREATE_BUFFER);
+        FfxMockBufferDX11* buffer = new FfxMockBufferDX11(*pDesc);
+        if (pInitialData && pInitialData->pSysMem)
+            memcpy(buffer->data(), pInitialData->pSysMem, pDesc->ByteWidth);
+        *ppBuffer = buffer;
+        return S_OK;
+    }
+
+    HRESULT CreateTexture1D(const D3D11_TEXTURE1D_DESC* pDesc, const D3D11_SUBRESOURCE_DATA*, ID3D11Texture1D** ppTexture1D) override
+    {
+        FfxMockCallScopeDX11 scope(log, FFX_MOCK_CALL_CREATE_TEXTURE1D);
+        *ppTexture1D = new FfxMockTexture1DDX11(*pDesc);
+        return S_OK;
+    }
+
+    HRESULT CreateTexture2D(const D3D11_TEXTURE2D_DESC* pDesc, const D3D11_SUBRESOURCE_DATA*, ID3D11Texture2D** ppTexture2D) override
+    {
+        FfxMockCallScopeDX11 scope(log, FFX_MOCK_CALL_CREATE_TEXTURE2D);
+        *ppTexture2D = new FfxMockTexture2DDX11(*pDesc);
+        return S_OK;
+    }
+
+    HRESULT CreateTexture3D(const D3D11_TEXTURE3D_DESC* pDesc, const D3D11_SUBRESOURCE_DATA*, ID3D11Texture3D** ppTexture3D) override
+    {
+        FfxMockCallScopeDX11 scope(log, FFX_MOCK_CALL_CREATE_TEXTURE3D);
+        *ppTexture3D = new FfxMockTexture3DDX11(*pDesc);
+        return S_OK;
+    }
+
+    HRESULT CreateShaderResourceView(ID3D11Resource* pResource, const D3D11_SHADER_RESOURCE_VIEW_DESC* pDesc, ID3D11ShaderResourceView** ppSRView) override
+    {
+        FfxMockCallScopeDX11 scope(log, FFX_MOCK_CALL_CREATE_SHADER_RESOURCE_VIEW);
+        *ppSRView = new FfxMockShaderResourceViewDX11(pResource, pDesc);
+        return S_OK;
+    }
+
+    HRESULT CreateUnorderedAccessView(ID3D11Resource* pResource, const D3D11_UNORDERED_ACCESS_VIEW_DESC* pDesc, ID3D11UnorderedAccessView** ppUAView) override
+    {
+        FfxMockCallScopeDX11 scope(log, FFX_MOCK_CALL_CREATE_UNORDERED_ACCESS_VIEW);
+        *ppUAView = new FfxMockUnorderedAccessViewDX11(pResource, pDesc);
+        return S_OK;
+    }
+
+    HRESULT CreateComputeShader(const void* pShaderBytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage*, ID3D11ComputeShader** ppComputeShader) override
+    {
+        FfxMockCallScopeDX11 scope(log, FFX_MOCK_CALL_CREATE_COMPUTE_SHADER);
+        if (createComputeShaderTime.count())
+            std::this_thread::sleep_for(createComputeShaderTime);
+        *ppComputeShader = new FfxMockComputeShaderDX11(pShaderBytecode, bytecodeLength);
+        return S_OK;
+    }
+
+    HRESULT CheckFeatureSupport(D3D11_FEATURE feature, void* pFeatureSupportData, UINT featureSupportDataSize) override
+    {
+        if (feature == D3D11_FEATURE_SHADER_MIN_PRECISION_SUPPORT && featureSupportDataSize == sizeof(D3D11_FEATURE_DATA_SHADER_MIN_PRECISION_SUPPORT)) {
+            D3D11_FEATURE_DATA_SHADER_MIN_PRECISION_SUPPORT* data = static_cast<D3D11_FEATURE_DATA_SHADER_MIN_PRECISION_SUPPORT*>(pFeatureSupportData);
+            data->PixelShaderMinPrecision = D3D_SHADER_MIN_PRECISION_16_BIT;
+            data->AllOtherShaderStagesMinPrecision = D3D_SHADER_MIN_PRECISION_16_BIT;
+            return S_OK;
+        }
+        return E_INVALIDARG;
+    }
+
+    D3D_FEATURE_LEVEL GetFeatureLevel() override { return featureLevel; }
+
+    void GetImmediateContext(ID3D11DeviceContext** ppImmediateContext) override
+    {
+        m_context->AddRef();
+        *ppImmediateContext = m_context;
+    }
+
+    /// The immediate context, without adding a reference.
+    FfxMockDeviceContextDX11* context() const { return m_context; }
+
+    FfxMockCallLogDX11          log;
+    D3D_FEATURE_LEVEL           featureLevel = D3D_FEATURE_LEVEL_11_1;
+
+    /// Time each <c><i>CreateComputeShader</i></c> call sleeps for, standing in
+    /// for the driver compiling the bytecode. Sleeping calls on several threads overlap.
+    std::chrono::microseconds   createComputeShaderTime{ 0 };
+
+private:
+    FfxMockDeviceContextDX11*   m_context;
+};
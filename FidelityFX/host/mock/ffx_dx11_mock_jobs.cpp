@@ -0,0 +1,1119 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Runs a chain of GPU jobs through the DX11 backend on the recording mock
+// device and checks the calls it makes. Pipelines are built by hand around
+// mock shaders, except those of the pipeline cache run which come from
+// synthetic permutation blobs. Returns non-zero when a check fails.
+
+#include "ffx_mock.h"
+#include "ffx_dx11_mock.h"
+#include <host/ffx_interface.h>
+#include <host/ffx_fsr3upscaler.h>
+#include <host/backends/dx11/ffx_dx11.h>
+#include <host/backends/ffx_shader_blobs.h>
+#include <host/ffx_task.h>
+#include <ffx_object_management.h>
+#include <DXBC/DXBCPatch.h>
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+// the size of the program of a synthetic blob, FSR3 upscaler shaders are a few thousand instructions long
+static const uint32_t s_syntheticInstructionCount = 4096;
+
+// Builds a DXBC container holding a SHEX chunk of s_syntheticInstructionCount single token instructions,
+// every 64th of them a GroupMemoryBarrier for the backend to patch, and signs it.
+static std::vector<uint32_t> createSyntheticBlob(FfxPass pass, uint32_t permutationOptions)
+{
+    const uint32_t headerSize = 9;                                      // fourcc, checksum, version, size, chunk count, chunk offset
+    const uint32_t programSize = 2 + s_syntheticInstructionCount;       // version and length tokens, instructions
+    std::vector<uint32_t> blob(headerSize + 2 + programSize);
+    blob[0] = MAKEFOURCC('D', 'X', 'B', 'C');
+    blob[5] = 1;
+    blob[6] = uint32_t(blob.size() * sizeof(uint32_t));
+    blob[7] = 1;
+    blob[8] = headerSize * sizeof(uint32_t);
+    blob[9] = MAKEFOURCC('S', 'H', 'E', 'X');
+    blob[10] = programSize * sizeof(uint32_t);
+    blob[11] = 0x00050050;
+    blob[12] = programSize;
+    for (uint32_t i = 0; i < s_syntheticInstructionCount; ++i)
+        blob[13 + i] = (i % 64 == 63) ? 0x010010BE : 0x0100003A;      // sync_g_t or nop
+    blob[13] = 0x01000000 | (pass << 8) | (permutationOptions & 0xff); // keep every permutation distinct
+    blob.back() = 0x0100003E;                                           // ret
+    CalculateDXBCChecksum((unsigned char*)blob.data(), blob[6], &blob[1]);
+    return blob;
+}
+
+// Blobs handed out and not released yet, the backend must release every blob it gets.
+static std::atomic<int32_t> s_pinnedBlobCount{ 0 };
+
+// Permutations with this option get a program longer than its chunk, which the backend must refuse to patch.
+static const uint32_t s_malformedPermutation = 0x80000000u;
+
+static std::atomic<uint32_t> s_errorMessageCount{ 0 };
+
+void ffxPrintMessage(uint32_t type, const wchar_t*)
+{
+    if (type == FFX_MESSAGE_TYPE_ERROR)
+        s_errorMessageCount++;
+}
+
+// The pipeline cache run creates FSR3 upscaler pipelines from synthetic blobs, the other effects have none.
+FfxErrorCode ffxGetPermutationBlobByIndex(FfxEffect effect, FfxPass pass, FfxBindStage, uint32_t permutationOptions, FfxShaderBlob* outBlob)
+{
+    static const char*    srvNames[] = { "r_input_color", "r_history" };
+    static const uint32_t srvSlots[] = { 0, 1 }, srvCounts[] = { 1, 2 }, srvSpaces[] = { 0, 0 };
+    static const char*    uavNames[] = { "rw_output" };
+    static const uint32_t uavSlots[] = { 0 }, uavCounts[] = { 1 }, uavSpaces[] = { 0 };
+    static const char*    cbNames[] = { "cbFSR3Upscaler" };
+    static const uint32_t cbSlots[] = { 0 }, cbCounts[] = { 1 }, cbSpaces[] = { 0 };
+    static std::map<uint64_t, std::vector<uint32_t>> blobs;
+    static std::mutex blobsMutex;
+
+    if (effect != FFX_EFFECT_FSR3UPSCALER)
+        return FFX_ERROR_INVALID_ARGUMENT;
+
+    std::lock_guard<std::mutex> lock{ blobsMutex };
+    std::vector<uint32_t>& blob = blobs[(uint64_t(pass) << 32) | permutationOptions];
+    if (blob.empty()) {
+        blob = createSyntheticBlob(pass, permutationOptions);
+        if (permutationOptions & s_malformedPermutation)
+            blob[12] += 1;
+    }
+
+    FfxShaderBlob shaderBlob = { (const uint8_t*)blob.data(), uint32_t(blob.size() * sizeof(uint32_t)), 1, 2, 1, 0, 0, 0, 0,
+        cbNames, nullptr, cbSlots, cbCounts, cbSpaces,
+        srvNames, nullptr, srvSlots, srvCounts, srvSpaces,
+        uavNames, nullptr, uavSlots, uavCounts, uavSpaces };
+    memcpy(static_cast<void*>(outBlob), &shaderBlob, sizeof(shaderBlob));
+    s_pinnedBlobCount++;
+    return FFX_OK;
+}
+
+void ffxReleasePermutationBlob(const uint8_t* data)
+{
+    if (data)
+        s_pinnedBlobCount--;
+}
+
+static FfxResourceInternal createTexture(FfxInterface* backendInterface, uint32_t effectContextId, const wchar_t* name)
+{
+    FfxCreateResourceDescription description = {};
+    description.heapType = FFX_HEAP_TYPE_DEFAULT;
+    description.resourceDescription.type = FFX_RESOURCE_TYPE_TEXTURE2D;
+    description.resourceDescription.format = FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT;
+    description.resourceDescription.width = 64;
+    description.resourceDescription.height = 64;
+    description.resourceDescription.depth = 1;
+    description.resourceDescription.mipCount = 1;
+    description.resourceDescription.usage = FFX_RESOURCE_USAGE_UAV;
+    description.initialState = FFX_RESOURCE_STATE_UNORDERED_ACCESS;
+    description.name = name;
+
+    FfxResourceInternal resource = {};
+    CHECK(backendInterface->fpCreateResource(backendInterface, &description, effectContextId, &resource) == FFX_OK);
+    return resource;
+}
+
+static FfxPipelineState createPipeline(ID3D11Device* device, uint32_t srvCount, uint32_t uavCount)
+{
+    static const uint8_t bytecode[4] = {};
+    ID3D11ComputeShader* shader = nullptr;
+    device->CreateComputeShader(bytecode, sizeof(bytecode), nullptr, &shader);
+
+    FfxPipelineState pipeline = {};
+    pipeline.pipeline = shader;
+    pipeline.srvTextureCount = srvCount;
+    pipeline.uavTextureCount = uavCount;
+    pipeline.constCount = 1;
+    for (uint32_t i = 0; i < srvCount; ++i)
+        pipeline.srvTextureBindings[i].slotIndex = i;
+    for (uint32_t i = 0; i < uavCount; ++i)
+        pipeline.uavTextureBindings[i].slotIndex = i;
+    return pipeline;
+}
+
+static void scheduleCompute(FfxInterface* backendInterface, const FfxPipelineState& pipeline, std::vector<FfxResourceInternal> srvs, std::vector<FfxResourceInternal> uavs, const FfxConstantBuffer& constants)
+{
+    FfxGpuJobDescription job = { FFX_GPU_JOB_COMPUTE };
+    job.computeJobDescriptor.pipeline = pipeline;
+    job.computeJobDescriptor.dimensions[0] = 8;
+    job.computeJobDescriptor.dimensions[1] = 8;
+    job.computeJobDescriptor.dimensions[2] = 1;
+    for (size_t i = 0; i < srvs.size(); ++i)
+        job.computeJobDescriptor.srvTextures[i].resource = srvs[i];
+    for (size_t i = 0; i < uavs.size(); ++i)
+        job.computeJobDescriptor.uavTextures[i].resource = uavs[i];
+    job.computeJobDescriptor.cbs[0] = constants;
+    backendInterface->fpScheduleGpuJob(backendInterface, &job);
+}
+
+// Stages a few distinct constant blocks from several threads at once on Direct3D 11.1, where the reuse table is read
+// and written without a lock. Fewer blocks are staged than the ring holds, so every region handed out must still hold
+// the contents it was staged with once all threads are done.
+static void stageConstantsConcurrently(FfxInterface* backendInterface)
+{
+    const uint32_t threadCount = 4;
+    const uint32_t stageCount = 32;
+    const uint32_t blockCount = 4;
+
+    uint32_t blocks[blockCount][16] = {};
+    for (uint32_t block = 0; block < blockCount; ++block)
+        for (uint32_t word = 0; word < 16; ++word)
+            blocks[block][word] = 0x1000u * (block + 1) + word;
+
+    FfxConstantBufferStatsDX11 before = {};
+    ffxGetConstantBufferStatsDX11(backendInterface, &before);
+
+    std::vector<FfxConstantBuffer> staged(threadCount * stageCount);
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < threadCount; ++thread) {
+        threads.emplace_back([&, thread] {
+            for (uint32_t stage = 0; stage < stageCount; ++stage) {
+                const uint32_t* block = blocks[(thread + stage) % blockCount];
+                FfxConstantBuffer& constantBuffer = staged[thread * stageCount + stage];
+                backendInterface->fpStageConstantBufferDataFunc(backendInterface, (void*)block, sizeof(blocks[0]), &constantBuffer);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (uint32_t thread = 0; thread < threadCount; ++thread)
+        for (uint32_t stage = 0; stage < stageCount; ++stage) {
+            const FfxConstantBuffer& constantBuffer = staged[thread * stageCount + stage];
+            CHECK(constantBuffer.num32BitEntries == 16);
+            CHECK(memcmp(constantBuffer.data, blocks[(thread + stage) % blockCount], sizeof(blocks[0])) == 0);
+        }
+
+    FfxConstantBufferStatsDX11 after = {};
+    ffxGetConstantBufferStatsDX11(backendInterface, &after);
+    CHECK(after.lockCount == before.lockCount);
+    CHECK(after.reusedCount > before.reusedCount);
+    CHECK(after.reusedCount - before.reusedCount + after.allocationCount - before.allocationCount == threadCount * stageCount);
+}
+
+static void run(bool supportContext1)
+{
+    FfxMockDeviceDX11* device = new FfxMockDeviceDX11();
+    device->context()->supportContext1 = supportContext1;
+
+    {
+        std::vector<uint8_t> scratchBuffer(ffxGetScratchMemorySizeDX11(1));
+        FfxInterface backendInterface = {};
+        CHECK(ffxGetInterfaceDX11(&backendInterface, ffxGetDeviceDX11(device), scratchBuffer.data(), scratchBuffer.size(), 1) == FFX_OK);
+
+        FfxUInt32 effectContextId = 0;
+        CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_SPD, nullptr, &effectContextId) == FFX_OK);
+
+        FfxResourceInternal input = createTexture(&backendInterface, effectContextId, L"input");
+        FfxResourceInternal ping = createTexture(&backendInterface, effectContextId, L"ping");
+        FfxResourceInternal pong = createTexture(&backendInterface, effectContextId, L"pong");
+        FfxResourceInternal output = createTexture(&backendInterface, effectContextId, L"output");
+
+        FfxPipelineState filter = createPipeline(device, 1, 1);
+        FfxPipelineState reduce = createPipeline(device, 2, 0);
+
+        uint32_t constants[2][4] = { { 1, 2, 3, 4 }, { 5, 6, 7, 8 } };
+
+        // every dispatch must see the constants its job was scheduled with
+        const uint32_t* expectedConstants[3] = { constants[0], constants[1], constants[0] };
+        uint32_t dispatchIndex = 0;
+        device->context()->onDispatch = [&](const FfxMockDeviceContextDX11& context) {
+            const uint8_t* data = context.constantBufferData(0);
+            CHECK(data && memcmp(data, expectedConstants[dispatchIndex++ % 3], sizeof(constants[0])) == 0);
+        };
+
+        const uint32_t frameCount = 4;
+        uint32_t firstFrameCallCount = 0;
+        FfxConstantBufferStatsDX11 previousConstantStats = {};
+        for (uint32_t frame = 0; frame < frameCount; ++frame) {
+            device->log.reset();
+
+            FfxGpuJobDescription clearJob = { FFX_GPU_JOB_CLEAR_FLOAT };
+            clearJob.clearJobDescriptor.target = pong;
+            backendInterface.fpScheduleGpuJob(&backendInterface, &clearJob);
+
+            // constants are staged for every job, as the effects do, even when they have not changed
+            FfxConstantBuffer stagedConstants[3] = {};
+            for (uint32_t job = 0; job < 3; ++job)
+                backendInterface.fpStageConstantBufferDataFunc(&backendInterface, (void*)expectedConstants[job], sizeof(constants[0]), &stagedConstants[job]);
+
+            scheduleCompute(&backendInterface, filter, { input }, { ping }, stagedConstants[0]);
+            scheduleCompute(&backendInterface, filter, { ping }, { pong }, stagedConstants[1]);
+
+            // a job without UAVs after jobs with UAVs
+            scheduleCompute(&backendInterface, reduce, { ping, pong }, {}, stagedConstants[2]);
+
+            FfxGpuJobDescription copyJob = { FFX_GPU_JOB_COPY };
+            copyJob.copyJobDescriptor.src = pong;
+            copyJob.copyJobDescriptor.dst = output;
+            backendInterface.fpScheduleGpuJob(&backendInterface, &copyJob);
+
+            FfxGpuJobDescription discardJob = { FFX_GPU_JOB_DISCARD };
+            discardJob.discardJobDescriptor.target = ping;
+            backendInterface.fpScheduleGpuJob(&backendInterface, &discardJob);
+
+            CHECK(backendInterface.fpExecuteGpuJobs(&backendInterface, nullptr, effectContextId) == FFX_OK);
+
+            // identical blocks are only uploaded once, compared byte for byte
+            FfxConstantBufferStatsDX11 constantStats = {};
+            ffxGetConstantBufferStatsDX11(&backendInterface, &constantStats);
+            if (supportContext1) {
+                CHECK(constantStats.allocationCount == 2);
+                CHECK(constantStats.reusedCount == 1 + 3 * frame);
+            }
+            else {
+                CHECK(constantStats.mapCount == (frame ? 2 + 2 * frame + 1 : 3));
+            }
+
+            // 11.1 stages without locks and copies only new blocks, 11.0 takes one lock per compute job
+            const uint64_t frameCopiedBytes = constantStats.copiedBytes - previousConstantStats.copiedBytes;
+            const uint64_t frameLockCount = constantStats.lockCount - previousConstantStats.lockCount;
+            CHECK(frameLockCount == (supportContext1 ? 0u : 3u));
+            if (supportContext1)
+                CHECK(frameCopiedBytes == (frame ? 0 : 2 * sizeof(constants[0])));
+            previousConstantStats = constantStats;
+
+            const FfxMockCallLogDX11& log = device->log;
+            CHECK(log.counts[FFX_MOCK_CALL_DISPATCH] == 3);
+            CHECK(dispatchIndex == 3 * (frame + 1));
+            CHECK(log.counts[FFX_MOCK_CALL_COPY_RESOURCE] == 1);
+            CHECK(log.counts[FFX_MOCK_CALL_CLEAR_UNORDERED_ACCESS_VIEW_UINT] == 1);
+            CHECK(log.counts[FFX_MOCK_CALL_DISCARD_RESOURCE] == (supportContext1 ? 1u : 0u));
+            CHECK(log.hazardCount == 0);
+            CHECK(device->context()->viewsUnbound());
+
+            // views are created once and reused on later frames
+            if (frame == 0)
+                firstFrameCallCount = log.totalCount();
+            else
+                CHECK(log.totalCount() <= firstFrameCallCount);
+
+            if (frame == frameCount - 1) {
+                printf("D3D11 %s, calls per frame:\n", supportContext1 ? "11.1" : "11.0");
+                log.print(stdout);
+                printf("constant buffers: %llu bytes staged, %llu copied, %llu reused, %llu maps\n",
+                    (unsigned long long)constantStats.stagedBytes, (unsigned long long)constantStats.copiedBytes,
+                    (unsigned long long)constantStats.reusedBytes, (unsigned long long)constantStats.mapCount);
+                printf("constant buffers per frame: %llu bytes copied, %llu locks\n",
+                    (unsigned long long)frameCopiedBytes, (unsigned long long)frameLockCount);
+            }
+        }
+
+        if (supportContext1)
+            stageConstantsConcurrently(&backendInterface);
+
+        device->context()->onDispatch = nullptr;
+        static_cast<ID3D11ComputeShader*>(filter.pipeline)->Release();
+        static_cast<ID3D11ComputeShader*>(reduce.pipeline)->Release();
+
+        CHECK(backendInterface.fpDestroyResource(&backendInterface, input, effectContextId) == FFX_OK);
+        CHECK(backendInterface.fpDestroyResource(&backendInterface, ping, effectContextId) == FFX_OK);
+        CHECK(backendInterface.fpDestroyResource(&backendInterface, pong, effectContextId) == FFX_OK);
+        CHECK(backendInterface.fpDestroyResource(&backendInterface, output, effectContextId) == FFX_OK);
+        CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, effectContextId) == FFX_OK);
+    }
+
+    device->Release();
+    CHECK(ffxMockLiveObjectCountDX11() == 0);
+}
+
+// The dispatches of an FSR3 upscaler frame with the textures each one reads and writes, in binding order, as declared
+// by the pass shaders. Textures a pass both reads and writes are ping-ponged, the "previous" ones are last frame's.
+struct Fsr3PassBindings
+{
+    const char*                 name;
+    std::vector<const char*>    srvs;
+    std::vector<const char*>    uavs;
+};
+
+static const Fsr3PassBindings s_fsr3FramePasses[] = {
+    { "prepare inputs",         { "input motion vectors", "input depth", "input color" },
+                                { "dilated motion vectors", "dilated depth", "reconstructed previous nearest depth", "farthest depth", "current luma" } },
+    { "luma pyramid",           { "current luma", "farthest depth" },
+                                { "spd atomic", "frame info", "spd mip 0", "spd mip 1", "spd mip 2", "spd mip 3", "spd mip 4", "spd mip 5", "farthest depth mip 1" } },
+    { "shading change pyramid", { "current luma", "previous luma", "dilated motion vectors", "input exposure" },
+                                { "spd atomic", "spd mip 0", "spd mip 1", "spd mip 2", "spd mip 3", "spd mip 4", "spd mip 5" } },
+    { "shading change",         { "spd mip 0" },
+                                { "shading change" } },
+    { "prepare reactivity",     { "reconstructed previous nearest depth", "dilated motion vectors", "dilated depth", "input reactive mask",
+                                  "input transparency and composition mask", "previous accumulation", "shading change", "current luma", "input exposure" },
+                                { "dilated reactive masks", "new locks", "accumulation" } },
+    { "luma instability",       { "input exposure", "dilated reactive masks", "dilated motion vectors", "frame info", "previous luma history",
+                                  "farthest depth mip 1", "current luma" },
+                                { "luma history", "luma instability" } },
+    { "accumulate",             { "input exposure", "dilated reactive masks", "dilated motion vectors", "input motion vectors", "previous internal upscaled",
+                                  "lanczos lut", "farthest depth mip 1", "current luma", "luma instability", "input color" },
+                                { "internal upscaled", "upscaled output", "new locks" } },
+    { "rcas",                   { "input exposure", "internal upscaled" },
+                                { "upscaled output" } },
+};
+
+// Executes FSR3 upscaler frames on the recording mock and checks the calls made for them: every bind the previous
+// dispatch already made is skipped, and views are only unbound when a texture written by one dispatch is read by
+// the next, so the runtime never has to resolve a hazard.
+static void runFsr3FrameCalls()
+{
+    FfxMockDeviceDX11* device = new FfxMockDeviceDX11();
+
+    {
+        std::vector<uint8_t> scratchBuffer(ffxGetScratchMemorySizeDX11(1));
+        FfxInterface backendInterface = {};
+        CHECK(ffxGetInterfaceDX11(&backendInterface, ffxGetDeviceDX11(device), scratchBuffer.data(), scratchBuffer.size(), 1) == FFX_OK);
+
+        FfxUInt32 effectContextId = 0;
+        CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_FSR3UPSCALER, nullptr, &effectContextId) == FFX_OK);
+
+        std::map<std::string, FfxResourceInternal> textures;
+        std::vector<FfxPipelineState> pipelines;
+        for (const Fsr3PassBindings& pass : s_fsr3FramePasses) {
+            for (const char* name : pass.srvs)
+                if (!textures.count(name))
+                    textures[name] = createTexture(&backendInterface, effectContextId, L"texture");
+            for (const char* name : pass.uavs)
+                if (!textures.count(name))
+                    textures[name] = createTexture(&backendInterface, effectContextId, L"texture");
+            pipelines.push_back(createPipeline(device, uint32_t(pass.srvs.size()), uint32_t(pass.uavs.size())));
+        }
+
+        uint32_t constants[64] = {};
+        const uint32_t frameCount = 4;
+        const uint32_t passCount = uint32_t(std::size(s_fsr3FramePasses));
+        uint32_t firstFrameCallCount = 0;
+        for (uint32_t frame = 0; frame < frameCount; ++frame) {
+            device->log.reset();
+
+            for (uint32_t passIndex = 0; passIndex < passCount; ++passIndex) {
+                const Fsr3PassBindings& pass = s_fsr3FramePasses[passIndex];
+                std::vector<FfxResourceInternal> srvs, uavs;
+                for (const char* name : pass.srvs)
+                    srvs.push_back(textures[name]);
+                for (const char* name : pass.uavs)
+                    uavs.push_back(textures[name]);
+
+                // the passes share the upscaler constants, sharpening has its own
+                FfxConstantBuffer stagedConstants = {};
+                constants[0] = frame;
+                constants[1] = passIndex == passCount - 1;
+                backendInterface.fpStageConstantBufferDataFunc(&backendInterface, constants, sizeof(constants), &stagedConstants);
+                scheduleCompute(&backendInterface, pipelines[passIndex], srvs, uavs, stagedConstants);
+            }
+            CHECK(backendInterface.fpExecuteGpuJobs(&backendInterface, nullptr, effectContextId) == FFX_OK);
+
+            const FfxMockCallLogDX11& log = device->log;
+            CHECK(log.counts[FFX_MOCK_CALL_DISPATCH] == passCount);
+            CHECK(log.counts[FFX_MOCK_CALL_CS_SET_SHADER] == passCount);
+            CHECK(log.hazardCount == 0);
+
+            // one bind of each kind per dispatch and one unbind at the end, where unbinding after every
+            // dispatch took 7 calls per dispatch
+            CHECK(log.counts[FFX_MOCK_CALL_CS_SET_SHADER_RESOURCES] <= passCount + 1);
+            CHECK(log.counts[FFX_MOCK_CALL_CS_SET_UNORDERED_ACCESS_VIEWS] <= passCount + 1);
+            CHECK(log.counts[FFX_MOCK_CALL_CS_SET_CONSTANT_BUFFERS1] == 2);
+            CHECK(log.totalCount() < 5 * passCount);
+            CHECK(device->context()->viewsUnbound());
+
+            // every frame after the first binds the same way
+            if (frame == 0)
+                firstFrameCallCount = log.totalCount();
+            else
+                CHECK(log.totalCount() == firstFrameCallCount);
+
+            if (frame == frameCount - 1) {
+                printf("FSR3 upscaler frame, %u dispatches, %u calls:\n", passCount, log.totalCount());
+                log.print(stdout);
+            }
+        }
+
+        for (FfxPipelineState& pipeline : pipelines)
+            static_cast<ID3D11ComputeShader*>(pipeline.pipeline)->Release();
+        for (auto& texture : textures)
+            CHECK(backendInterface.fpDestroyResource(&backendInterface, texture.second, effectContextId) == FFX_OK);
+        CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, effectContextId) == FFX_OK);
+    }
+
+    device->Release();
+    CHECK(ffxMockLiveObjectCountDX11() == 0);
+}
+
+static ID3D11Texture2D* createAppTexture(ID3D11Device* device)
+{
+    D3D11_TEXTURE2D_DESC description = {};
+    description.Width = 64;
+    description.Height = 64;
+    description.MipLevels = 1;
+    description.ArraySize = 1;
+    description.Format = DXGI_FORMAT_R16G16B16A16_FLOAT;
+    description.SampleDesc.Count = 1;
+    description.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_UNORDERED_ACCESS;
+
+    ID3D11Texture2D* texture = nullptr;
+    device->CreateTexture2D(&description, nullptr, &texture);
+    return texture;
+}
+
+static void registerResources(FfxInterface* backendInterface, uint32_t effectContextId, std::vector<FfxResource> resources)
+{
+    for (const FfxResource& resource : resources) {
+        FfxResourceInternal internalResource = {};
+        CHECK(backendInterface->fpRegisterResource(backendInterface, &resource, effectContextId, &internalResource) == FFX_OK);
+    }
+}
+
+static FfxResource appResource(ID3D11Texture2D* texture)
+{
+    return ffxGetResourceDX11(texture, GetFfxResourceDescriptionDX11(texture), L"input");
+}
+
+static UINT refCount(IUnknown* object)
+{
+    object->AddRef();
+    return object->Release();
+}
+
+// Registers application textures and textures one effect context created for others, the way the effects do
+// every frame, and checks the views created for them. The views of the shared textures are cached: none are
+// created once they are known, whatever the order and slot they are registered in, and those of a texture no
+// longer registered are released two frames later. The application textures are not held past
+// UnregisterResources, so the application can release them, or resize a swap chain, right after a dispatch.
+static void runViewCache()
+{
+    FfxMockDeviceDX11* device = new FfxMockDeviceDX11();
+
+    {
+        std::vector<uint8_t> scratchBuffer(ffxGetScratchMemorySizeDX11(3));
+        FfxInterface backendInterface = {};
+        CHECK(ffxGetInterfaceDX11(&backendInterface, ffxGetDeviceDX11(device), scratchBuffer.data(), scratchBuffer.size(), 3) == FFX_OK);
+
+        FfxUInt32 sharedContextId = 0;
+        FfxUInt32 upscaleContextId = 0;
+        FfxUInt32 sharpenContextId = 0;
+        CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_SHAREDAPIBACKEND, nullptr, &sharedContextId) == FFX_OK);
+        CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_FSR3UPSCALER, nullptr, &upscaleContextId) == FFX_OK);
+        CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_CAS, nullptr, &sharpenContextId) == FFX_OK);
+
+        const FfxResource dilated = backendInterface.fpGetResource(&backendInterface, createTexture(&backendInterface, sharedContextId, L"dilated"));
+        const FfxResource history = backendInterface.fpGetResource(&backendInterface, createTexture(&backendInterface, sharedContextId, L"history"));
+
+        ID3D11Texture2D* color = createAppTexture(device);
+        ID3D11Texture2D* depth = createAppTexture(device);
+        ID3D11Texture2D* motion = createAppTexture(device);
+        ID3D11Texture2D* mask = createAppTexture(device);
+
+        // two effect contexts per frame, the inputs of the first one change order every frame
+        const uint32_t frameCount = 6;
+        for (uint32_t frame = 0; frame < frameCount; ++frame) {
+            device->log.reset();
+
+            if (frame & 1)
+                registerResources(&backendInterface, upscaleContextId, { appResource(motion), history, appResource(color), dilated, appResource(depth) });
+            else
+                registerResources(&backendInterface, upscaleContextId, { appResource(color), appResource(depth), dilated, appResource(motion), history });
+            CHECK(backendInterface.fpUnregisterResources(&backendInterface, nullptr, upscaleContextId) == FFX_OK);
+
+            registerResources(&backendInterface, sharpenContextId, { appResource(color), dilated });
+            CHECK(backendInterface.fpUnregisterResources(&backendInterface, nullptr, sharpenContextId) == FFX_OK);
+
+            // a view and a UAV for each of the four application textures, and for each shared one the first time
+            const uint32_t viewCount = device->log.counts[FFX_MOCK_CALL_CREATE_SHADER_RESOURCE_VIEW] + device->log.counts[FFX_MOCK_CALL_CREATE_UNORDERED_ACCESS_VIEW];
+            CHECK(viewCount == (frame ? 8u : 12u));
+            CHECK(refCount(color) == 1 && refCount(depth) == 1 && refCount(motion) == 1);
+        }
+
+        // the frame only advanced once per application frame, not once per effect context
+        FfxViewCacheStatsDX11 stats = {};
+        ffxGetViewCacheStatsDX11(&backendInterface, &stats);
+        CHECK(stats.frameMissCount == 0);
+        CHECK(stats.frameHitCount == 6);
+        CHECK(stats.entryCount == 4);
+
+        // stop sharing the history: after two frames without it, its views are released
+        for (uint32_t frame = 0; frame < 3; ++frame) {
+            registerResources(&backendInterface, upscaleContextId, { appResource(color), appResource(depth), dilated, appResource(mask) });
+            CHECK(backendInterface.fpUnregisterResources(&backendInterface, nullptr, upscaleContextId) == FFX_OK);
+            registerResources(&backendInterface, sharpenContextId, { appResource(color), dilated });
+            CHECK(backendInterface.fpUnregisterResources(&backendInterface, nullptr, sharpenContextId) == FFX_OK);
+        }
+        registerResources(&backendInterface, upscaleContextId, { appResource(color), appResource(depth), dilated, appResource(mask) });
+        CHECK(backendInterface.fpUnregisterResources(&backendInterface, nullptr, upscaleContextId) == FFX_OK);
+
+        ffxGetViewCacheStatsDX11(&backendInterface, &stats);
+        CHECK(stats.evictionCount == 2);
+        CHECK(stats.entryCount == 2);
+
+        // nothing but the application holds a texture it registered, even one registered in the last dispatch
+        const int32_t liveObjectCount = ffxMockLiveObjectCountDX11();
+        CHECK(motion->Release() == 0);
+        CHECK(mask->Release() == 0);
+        CHECK(ffxMockLiveObjectCountDX11() == liveObjectCount - 2);
+
+        printf("view cache: %llu hits, %llu misses, %llu evictions\n",
+            (unsigned long long)stats.hitCount, (unsigned long long)stats.missCount, (unsigned long long)stats.evictionCount);
+
+        CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, sharpenContextId) == FFX_OK);
+        CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, upscaleContextId) == FFX_OK);
+        CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, sharedContextId) == FFX_OK);
+        color->Release();
+        depth->Release();
+    }
+
+    device->Release();
+    CHECK(ffxMockLiveObjectCountDX11() == 0);
+}
+
+// Schedules and executes a frame shaped like an upscaler's, a clear and ten dispatches reading up to eight
+// textures, and compares the bytes recorded and the time spent scheduling with copying every job description.
+static void runJobRecords()
+{
+    FfxMockDeviceDX11* device = new FfxMockDeviceDX11();
+
+    {
+        std::vector<uint8_t> scratchBuffer(ffxGetScratchMemorySizeDX11(1));
+        FfxInterface backendInterface = {};
+        CHECK(ffxGetInterfaceDX11(&backendInterface, ffxGetDeviceDX11(device), scratchBuffer.data(), scratchBuffer.size(), 1) == FFX_OK);
+
+        FfxUInt32 effectContextId = 0;
+        CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_FSR3UPSCALER, nullptr, &effectContextId) == FFX_OK);
+
+        const uint32_t textureCount = 12;
+        std::vector<FfxResourceInternal> textures;
+        for (uint32_t i = 0; i < textureCount; ++i)
+            textures.push_back(createTexture(&backendInterface, effectContextId, L"texture"));
+
+        const uint32_t passCount = 10;
+        std::vector<FfxPipelineState> pipelines;
+        for (uint32_t pass = 0; pass < passCount; ++pass)
+            pipelines.push_back(createPipeline(device, 2 + pass % 7, 1 + pass % 3));
+
+        // the descriptions are built once, only their constants are staged again every frame
+        std::vector<FfxGpuJobDescription> jobs(1 + passCount);
+        jobs[0].jobType = FFX_GPU_JOB_CLEAR_FLOAT;
+        jobs[0].clearJobDescriptor.target = textures[0];
+        for (uint32_t pass = 0; pass < passCount; ++pass) {
+            FfxComputeJobDescription& compute = jobs[1 + pass].computeJobDescriptor;
+            jobs[1 + pass].jobType = FFX_GPU_JOB_COMPUTE;
+            compute.pipeline = pipelines[pass];
+            compute.dimensions[0] = 8;
+            compute.dimensions[1] = 8;
+            compute.dimensions[2] = 1;
+            for (uint32_t i = 0; i < compute.pipeline.srvTextureCount; ++i)
+                compute.srvTextures[i].resource = textures[(pass + i) % textureCount];
+            for (uint32_t i = 0; i < compute.pipeline.uavTextureCount; ++i)
+                compute.uavTextures[i].resource = textures[(pass + 8 + i) % textureCount];
+        }
+
+        uint32_t constants[16] = {};
+        auto stageConstants = [&]() {
+            for (uint32_t pass = 0; pass < passCount; ++pass)
+                backendInterface.fpStageConstantBufferDataFunc(&backendInterface, constants, sizeof(constants), &jobs[1 + pass].computeJobDescriptor.cbs[0]);
+        };
+
+        stageConstants();
+        for (const FfxGpuJobDescription& job : jobs)
+            CHECK(backendInterface.fpScheduleGpuJob(&backendInterface, &job) == FFX_OK);
+        CHECK(backendInterface.fpExecuteGpuJobs(&backendInterface, nullptr, effectContextId) == FFX_OK);
+
+        FfxGpuJobStatsDX11 stats = {};
+        ffxGetGpuJobStatsDX11(&backendInterface, &stats);
+        const size_t descriptionSize = jobs.size() * sizeof(FfxGpuJobDescription);
+        CHECK(stats.jobCount == jobs.size());
+        CHECK(stats.recordSize > 0 && stats.recordSize * 32 < descriptionSize);
+        CHECK(stats.maxRecordSize == stats.recordSize);
+
+        // the time spent in the mock is left out of the execution time
+        const uint32_t frameCount = 2000;
+        std::chrono::duration<double, std::micro> scheduleTime(0), executeTime(0);
+        device->log.reset();
+        for (uint32_t frame = 0; frame < frameCount; ++frame) {
+            stageConstants();
+            auto start = std::chrono::steady_clock::now();
+            for (const FfxGpuJobDescription& job : jobs)
+                backendInterface.fpScheduleGpuJob(&backendInterface, &job);
+            auto scheduled = std::chrono::steady_clock::now();
+            backendInterface.fpExecuteGpuJobs(&backendInterface, nullptr, effectContextId);
+            scheduleTime += scheduled - start;
+            executeTime += std::chrono::steady_clock::now() - scheduled;
+        }
+        uint64_t mockTime = 0;
+        for (uint64_t time : device->log.times)
+            mockTime += time;
+
+        // what scheduling cost when every description was copied into a FFX_MAX_GPU_JOBS array
+        std::vector<FfxGpuJobDescription> copiedJobs(FFX_MAX_GPU_JOBS);
+        std::chrono::duration<double, std::micro> copyTime(0);
+        for (uint32_t frame = 0; frame < frameCount; ++frame) {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < jobs.size(); ++i)
+                memcpy(&copiedJobs[i], &jobs[i], sizeof(FfxGpuJobDescription));
+            copyTime += std::chrono::steady_clock::now() - start;
+            // keep the copies from being optimized away
+            jobs[1].computeJobDescriptor.dimensions[2] = copiedJobs[frame % jobs.size()].computeJobDescriptor.dimensions[2];
+        }
+
+        printf("GPU jobs: %u per frame, %u bytes of records instead of %zu bytes of descriptions\n",
+            stats.jobCount, stats.recordSize, descriptionSize);
+        printf("GPU jobs: %.2f us to schedule against %.2f us to copy the descriptions, %.2f us to execute\n",
+            scheduleTime.count() / frameCount, copyTime.count() / frameCount, (executeTime.count() - mockTime / 1000.0) / frameCount);
+
+        for (FfxPipelineState& pipeline : pipelines)
+            static_cast<ID3D11ComputeShader*>(pipeline.pipeline)->Release();
+        for (FfxResourceInternal texture : textures)
+            CHECK(backendInterface.fpDestroyResource(&backendInterface, texture, effectContextId) == FFX_OK);
+        CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, effectContextId) == FFX_OK);
+    }
+
+    device->Release();
+    CHECK(ffxMockLiveObjectCountDX11() == 0);
+}
+
+static void createPipelines(FfxInterface* backendInterface, FfxUInt32 effectContextId, std::vector<FfxPipelineState>& pipelines)
+{
+    FfxPipelineDescription description = {};
+    for (uint32_t pass = 0; pass < FFX_FSR3UPSCALER_PASS_COUNT; ++pass)
+        CHECK(backendInterface->fpCreatePipeline(backendInterface, FFX_EFFECT_FSR3UPSCALER, FfxPass(pass), 0, &description, effectContextId, &pipelines[pass]) == FFX_OK);
+}
+
+static void destroyPipelines(FfxInterface* backendInterface, FfxUInt32 effectContextId, std::vector<FfxPipelineState>& pipelines)
+{
+    for (FfxPipelineState& pipeline : pipelines)
+        CHECK(backendInterface->fpDestroyPipeline(backendInterface, &pipeline, effectContextId) == FFX_OK);
+}
+
+// Creates the pipelines of one FSR3 upscaler context and then of a second one. The first context patches,
+// signs and reflects every permutation; the second must find them all in the cache and share the shaders.
+static void runPipelineCache()
+{
+    FfxMockDeviceDX11* device = new FfxMockDeviceDX11();
+
+    {
+        std::vector<uint8_t> scratchBuffer(ffxGetScratchMemorySizeDX11(2));
+        FfxInterface backendInterface = {};
+        CHECK(ffxGetInterfaceDX11(&backendInterface, ffxGetDeviceDX11(device), scratchBuffer.data(), scratchBuffer.size(), 2) == FFX_OK);
+
+        FfxUInt32 firstContextId = 0, secondContextId = 0;
+        CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_FSR3UPSCALER, nullptr, &firstContextId) == FFX_OK);
+        CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_FSR3UPSCALER, nullptr, &secondContextId) == FFX_OK);
+
+        // the blobs are built before timing so that only the backend is measured, every blob the interface hands
+        // out stays pinned until it is released through the interface
+        for (uint32_t pass = 0; pass < FFX_FSR3UPSCALER_PASS_COUNT; ++pass) {
+            FfxShaderBlob blob = {};
+            CHECK(backendInterface.fpGetPermutationBlobByIndex(FFX_EFFECT_FSR3UPSCALER, FfxPass(pass), FFX_BIND_COMPUTE_SHADER_STAGE, 0, &blob) == FFX_OK);
+            CHECK(s_pinnedBlobCount == 1);
+            backendInterface.fpReleasePermutationBlob(blob.data);
+            CHECK(s_pinnedBlobCount == 0);
+        }
+
+        // pipeline states are large, they are allocated and touched outside the timed region as well
+        std::vector<FfxPipelineState> firstPipelines(FFX_FSR3UPSCALER_PASS_COUNT), secondPipelines(FFX_FSR3UPSCALER_PASS_COUNT);
+        device->log.reset();
+        auto start = std::chrono::steady_clock::now();
+        createPipelines(&backendInterface, firstContextId, firstPipelines);
+        std::chrono::duration<double, std::micro> firstTime = std::chrono::steady_clock::now() - start;
+        CHECK(device->log.counts[FFX_MOCK_CALL_CREATE_COMPUTE_SHADER] == FFX_FSR3UPSCALER_PASS_COUNT);
+
+        FfxPipelineCacheStatsDX11 stats = {};
+        ffxGetPipelineCacheStatsDX11(&stats);
+        CHECK(stats.missCount == FFX_FSR3UPSCALER_PASS_COUNT && stats.hitCount == 0);
+        CHECK(stats.entryCount == FFX_FSR3UPSCALER_PASS_COUNT && stats.activeEntryCount == FFX_FSR3UPSCALER_PASS_COUNT);
+
+        // the device only ever sees patched bytecode
+        for (const FfxPipelineState& pipeline : firstPipelines) {
+            const std::vector<uint8_t>& bytecode = static_cast<FfxMockComputeShaderDX11*>(pipeline.pipeline)->bytecode();
+            bool unpatched = false;
+            for (size_t offset = 0; offset + 4 <= bytecode.size(); offset += 4)
+                unpatched |= *(const uint32_t*)(bytecode.data() + offset) == 0x010010BE;
+            CHECK(!unpatched);
+        }
+
+        device->log.reset();
+        start = std::chrono::steady_clock::now();
+        createPipelines(&backendInterface, secondContextId, secondPipelines);
+        std::chrono::duration<double, std::micro> secondTime = std::chrono::steady_clock::now() - start;
+        CHECK(device->log.counts[FFX_MOCK_CALL_CREATE_COMPUTE_SHADER] == 0);
+
+        ffxGetPipelineCacheStatsDX11(&stats);
+        CHECK(stats.missCount == FFX_FSR3UPSCALER_PASS_COUNT && stats.hitCount == FFX_FSR3UPSCALER_PASS_COUNT);
+        CHECK(stats.shaderReuseCount == FFX_FSR3UPSCALER_PASS_COUNT);
+        CHECK(stats.entryCount == FFX_FSR3UPSCALER_PASS_COUNT);
+        for (uint32_t pass = 0; pass < FFX_FSR3UPSCALER_PASS_COUNT; ++pass) {
+            CHECK(secondPipelines[pass].pipeline == firstPipelines[pass].pipeline);
+            CHECK(secondPipelines[pass].srvTextureCount == 3 && secondPipelines[pass].srvTextureBindings[2].arrayIndex == 1);
+            CHECK(secondPipelines[pass].constantBufferBindings[0].nameHash == ffxHashBindingName("cbFSR3Upscaler"));
+        }
+
+        printf("pipeline cache: %u pipelines of %u bytes, first context %.1f us, second context %.1f us, %llu hits, %llu misses\n",
+            FFX_FSR3UPSCALER_PASS_COUNT, uint32_t((2 + 9 + 2 + s_syntheticInstructionCount) * sizeof(uint32_t)), firstTime.count(), secondTime.count(),
+            (unsigned long long)stats.hitCount, (unsigned long long)stats.missCount);
+
+        // shaders go with the last pipeline using them, the patched bytecode stays until trimmed
+        destroyPipelines(&backendInterface, firstContextId, firstPipelines);
+        destroyPipelines(&backendInterface, secondContextId, secondPipelines);
+        ffxGetPipelineCacheStatsDX11(&stats);
+        CHECK(stats.activeEntryCount == 0 && stats.entryCount == FFX_FSR3UPSCALER_PASS_COUNT);
+        ffxTrimPipelineCacheDX11();
+        ffxGetPipelineCacheStatsDX11(&stats);
+        CHECK(stats.entryCount == 0 && stats.bytecodeSize == 0);
+        CHECK(s_pinnedBlobCount == 0);
+
+        // bytecode that cannot be patched fails pipeline creation with an error and never reaches the device
+        FfxPipelineDescription description = {};
+        FfxPipelineState malformedPipeline = {};
+        const uint32_t errorMessageCount = s_errorMessageCount;
+        device->log.reset();
+        CHECK(backendInterface.fpCreatePipeline(&backendInterface, FFX_EFFECT_FSR3UPSCALER, FfxPass(0), s_malformedPermutation, &description, firstContextId, &malformedPipeline) == FfxErrorCode(FFX_ERROR_MALFORMED_DATA));
+        CHECK(s_errorMessageCount == errorMessageCount + 1);
+        CHECK(device->log.counts[FFX_MOCK_CALL_CREATE_COMPUTE_SHADER] == 0);
+        CHECK(s_pinnedBlobCount == 0);
+        ffxGetPipelineCacheStatsDX11(&stats);
+        CHECK(stats.entryCount == 0);
+
+        CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, secondContextId) == FFX_OK);
+        CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, firstContextId) == FFX_OK);
+    }
+
+    device->Release();
+    CHECK(ffxMockLiveObjectCountDX11() == 0);
+}
+
+// Creates the pipelines of an FSR3 upscaler context from an empty pipeline cache, saves the cache, and creates them
+// again in what stands for a later launch: the in-memory cache trimmed, then the saved one loaded. The warm context
+// must neither patch nor reflect a permutation and end up with the same pipelines. A corrupt cache is rejected.
+static void runPersistentPipelineCache()
+{
+    FfxMockDeviceDX11* device = new FfxMockDeviceDX11();
+
+    {
+        std::vector<uint8_t> scratchBuffer(ffxGetScratchMemorySizeDX11(1));
+        FfxInterface backendInterface = {};
+        CHECK(ffxGetInterfaceDX11(&backendInterface, ffxGetDeviceDX11(device), scratchBuffer.data(), scratchBuffer.size(), 1) == FFX_OK);
+
+        FfxUInt32 effectContextId = 0;
+        CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_FSR3UPSCALER, nullptr, &effectContextId) == FFX_OK);
+
+        std::vector<FfxPipelineState> coldPipelines(FFX_FSR3UPSCALER_PASS_COUNT), warmPipelines(FFX_FSR3UPSCALER_PASS_COUNT);
+        for (uint32_t pass = 0; pass < FFX_FSR3UPSCALER_PASS_COUNT; ++pass) {
+            FfxShaderBlob blob = {};
+            backendInterface.fpGetPermutationBlobByIndex(FFX_EFFECT_FSR3UPSCALER, FfxPass(pass), FFX_BIND_COMPUTE_SHADER_STAGE, 0, &blob);
+            backendInterface.fpReleasePermutationBlob(blob.data);
+        }
+
+        FfxPipelineCacheStatsDX11 startStats = {}, stats = {};
+        ffxGetPipelineCacheStatsDX11(&startStats);
+        CHECK(startStats.entryCount == 0);
+        auto start = std::chrono::steady_clock::now();
+        createPipelines(&backendInterface, effectContextId, coldPipelines);
+        std::chrono::duration<double, std::micro> coldTime = std::chrono::steady_clock::now() - start;
+        ffxGetPipelineCacheStatsDX11(&stats);
+        CHECK(stats.missCount - startStats.missCount == FFX_FSR3UPSCALER_PASS_COUNT);
+
+        size_t cacheSize = 0;
+        CHECK(ffxSavePipelineCacheDX11(nullptr, &cacheSize) == FFX_OK && cacheSize > 0);
+        std::vector<uint8_t> cache(cacheSize);
+        size_t smallSize = cacheSize - 1;
+        CHECK(ffxSavePipelineCacheDX11(cache.data(), &smallSize) == FfxErrorCode(FFX_ERROR_INSUFFICIENT_MEMORY) && smallSize == cacheSize);
+        CHECK(ffxSavePipelineCacheDX11(cache.data(), &cacheSize) == FFX_OK && cacheSize == cache.size());
+
+        // the shader objects of the cold context are kept to compare the warm ones against
+        std::vector<std::vector<uint8_t>> coldBytecode;
+        for (const FfxPipelineState& pipeline : coldPipelines)
+            coldBytecode.push_back(static_cast<FfxMockComputeShaderDX11*>(pipeline.pipeline)->bytecode());
+        destroyPipelines(&backendInterface, effectContextId, coldPipelines);
+        ffxTrimPipelineCacheDX11();
+
+        // a flipped byte anywhere in the payload rejects the whole cache
+        std::vector<uint8_t> corruptCache = cache;
+        corruptCache[corruptCache.size() / 2] ^= 0x40;
+        CHECK(ffxLoadPipelineCacheDX11(corruptCache.data(), corruptCache.size()) == FfxErrorCode(FFX_ERROR_MALFORMED_DATA));
+        CHECK(ffxLoadPipelineCacheDX11(cache.data(), cache.size() / 2) != FFX_OK);
+        ffxGetPipelineCacheStatsDX11(&stats);
+        CHECK(stats.entryCount == 0);
+
+        // the load is part of what a warm launch pays
+        ffxGetPipelineCacheStatsDX11(&startStats);
+        device->log.reset();
+        start = std::chrono::steady_clock::now();
+        CHECK(ffxLoadPipelineCacheDX11(cache.data(), cache.size()) == FFX_OK);
+        std::chrono::duration<double, std::micro> loadTime = std::chrono::steady_clock::now() - start;
+        createPipelines(&backendInterface, effectContextId, warmPipelines);
+        std::chrono::duration<double, std::micro> warmTime = std::chrono::steady_clock::now() - start;
+
+        ffxGetPipelineCacheStatsDX11(&stats);
+        CHECK(stats.missCount == startStats.missCount);
+        CHECK(stats.loadedHitCount - startStats.loadedHitCount == FFX_FSR3UPSCALER_PASS_COUNT);
+        CHECK(stats.entryCount == FFX_FSR3UPSCALER_PASS_COUNT);
+        CHECK(device->log.counts[FFX_MOCK_CALL_CREATE_COMPUTE_SHADER] == FFX_FSR3UPSCALER_PASS_COUNT);
+        for (uint32_t pass = 0; pass < FFX_FSR3UPSCALER_PASS_COUNT; ++pass) {
+            CHECK(static_cast<FfxMockComputeShaderDX11*>(warmPipelines[pass].pipeline)->bytecode() == coldBytecode[pass]);
+            CHECK(warmPipelines[pass].srvTextureCount == 3 && warmPipelines[pass].srvTextureBindings[2].arrayIndex == 1);
+            CHECK(warmPipelines[pass].uavTextureCount == 1 && warmPipelines[pass].constCount == 1);
+            CHECK(warmPipelines[pass].constantBufferBindings[0].nameHash == ffxHashBindingName("cbFSR3Upscaler"));
+        }
+
+        printf("persistent pipeline cache: %zu bytes for %u pipelines, cold context %.1f us, warm context %.1f us including %.1f us to load\n",
+            cache.size(), FFX_FSR3UPSCALER_PASS_COUNT, coldTime.count(), warmTime.count(), loadTime.count());
+
+        destroyPipelines(&backendInterface, effectContextId, warmPipelines);
+        ffxTrimPipelineCacheDX11();
+
+        CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, effectContextId) == FFX_OK);
+    }
+
+    device->Release();
+    CHECK(ffxMockLiveObjectCountDX11() == 0);
+}
+
+// Runs many small batches on the threads owned by the SDK, from one and then from two threads at once, and checks
+// every task ran exactly once on no more threads than the largest batch was allowed to use.
+struct PoolTaskData
+{
+    std::atomic<uint32_t>*  runCount;
+    std::mutex*             mutex;
+    std::set<std::thread::id>* threadIds;
+};
+
+static void runPoolTask(void* taskData)
+{
+    PoolTaskData* data = static_cast<PoolTaskData*>(taskData);
+    (*data->runCount)++;
+    std::lock_guard<std::mutex> lock{ *data->mutex };
+    data->threadIds->insert(std::this_thread::get_id());
+}
+
+static void runTaskPool()
+{
+    const uint32_t batchCount = 200;
+    const uint32_t taskCount = 8;
+
+    std::mutex mutex;
+    std::set<std::thread::id> threadIds;
+    auto runBatches = [&](std::atomic<uint32_t>* runCounts) {
+        for (uint32_t batch = 0; batch < batchCount; ++batch) {
+            std::vector<PoolTaskData> tasks(taskCount, PoolTaskData{ &runCounts[batch], &mutex, &threadIds });
+            ffxRunTasks(runPoolTask, tasks.data(), sizeof(PoolTaskData), taskCount);
+            CHECK(runCounts[batch] == taskCount);
+        }
+    };
+
+    std::vector<std::atomic<uint32_t>> runCounts(batchCount * 3);
+    for (std::atomic<uint32_t>& runCount : runCounts)
+        runCount = 0;
+
+    ffxSetTaskScheduler(nullptr, nullptr, 4);
+    auto start = std::chrono::steady_clock::now();
+    runBatches(runCounts.data());
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    // the calling thread and at most three workers
+    CHECK(threadIds.size() >= 1 && threadIds.size() <= 4);
+
+    threadIds.clear();
+    std::thread other(runBatches, runCounts.data() + batchCount);
+    runBatches(runCounts.data() + 2 * batchCount);
+    other.join();
+    // both calling threads share the same three workers
+    CHECK(threadIds.size() >= 2 && threadIds.size() <= 5);
+
+    ffxSetTaskScheduler(nullptr, nullptr, 1);
+    printf("task pool: %.1f us per batch of %u tasks on 4 threads\n", elapsed.count() / batchCount, taskCount);
+}
+
+// Creates the FSR3 upscaler pipelines as one ffxCreatePipelines batch with 1, 2, 4 and 8 threads, from an empty
+// pipeline cache every time. Shader creation sleeps for a while on the mock device to stand in for the driver
+// compiling the bytecode, the part of pipeline creation which overlaps even on a single core.
+static void runParallelPipelines()
+{
+    FfxMockDeviceDX11* device = new FfxMockDeviceDX11();
+    device->createComputeShaderTime = std::chrono::microseconds(1000);
+
+    {
+        std::vector<uint8_t> scratchBuffer(ffxGetScratchMemorySizeDX11(1));
+        FfxInterface backendInterface = {};
+        CHECK(ffxGetInterfaceDX11(&backendInterface, ffxGetDeviceDX11(device), scratchBuffer.data(), scratchBuffer.size(), 1) == FFX_OK);
+
+        FfxUInt32 effectContextId = 0;
+        CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_FSR3UPSCALER, nullptr, &effectContextId) == FFX_OK);
+
+        std::vector<FfxPipelineState> pipelines(FFX_FSR3UPSCALER_PASS_COUNT);
+        std::vector<FfxCreatePipelineTask> tasks(FFX_FSR3UPSCALER_PASS_COUNT);
+
+        printf("parallel pipeline creation:");
+        double serialTime = 0.0;
+        for (uint32_t threadCount : { 1u, 2u, 4u, 8u }) {
+            for (uint32_t pass = 0; pass < FFX_FSR3UPSCALER_PASS_COUNT; ++pass)
+                tasks[pass] = { FfxPass(pass), 0, {}, &pipelines[pass], FfxErrorCode(FFX_ERROR_INVALID_ARGUMENT) };
+
+            ffxSetTaskScheduler(nullptr, nullptr, threadCount);
+            device->log.reset();
+            auto start = std::chrono::steady_clock::now();
+            CHECK(ffxCreatePipelines(&backendInterface, FFX_EFFECT_FSR3UPSCALER, effectContextId, tasks.data(), uint32_t(tasks.size())) == FFX_OK);
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+            FfxPipelineCacheStatsDX11 stats = {};
+            ffxGetPipelineCacheStatsDX11(&stats);
+            CHECK(stats.entryCount == FFX_FSR3UPSCALER_PASS_COUNT && stats.activeEntryCount == FFX_FSR3UPSCALER_PASS_COUNT);
+            CHECK(device->log.counts[FFX_MOCK_CALL_CREATE_COMPUTE_SHADER] == FFX_FSR3UPSCALER_PASS_COUNT);
+            for (const FfxCreatePipelineTask& task : tasks)
+                CHECK(task.errorCode == FFX_OK && task.pipeline->pipeline != nullptr);
+
+            if (threadCount == 1)
+                serialTime = elapsed.count();
+            printf(" %u threads %.2f ms (%.1fx)", threadCount, elapsed.count(), serialTime / elapsed.count());
+
+            destroyPipelines(&backendInterface, effectContextId, pipelines);
+            ffxTrimPipelineCacheDX11();
+        }
+        printf("\n");
+        ffxSetTaskScheduler(nullptr, nullptr, 1);
+
+        CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, effectContextId) == FFX_OK);
+    }
+
+    device->Release();
+    CHECK(ffxMockLiveObjectCountDX11() == 0);
+}
+
+// Creates the pipelines of an FSR3 upscaler context the way the component does, the passes only some dispatches
+// use (sharpening, reactive mask generation and the debug view) deferred, and compares the cost of context
+// creation with creating all of them up front. Then resolves them on first use and by prewarming.
+static void runDeferredPipelines()
+{
+    const FfxPass eagerPasses[] = {
+        FFX_FSR3UPSCALER_PASS_PREPARE_INPUTS, FFX_FSR3UPSCALER_PASS_LUMA_PYRAMID, FFX_FSR3UPSCALER_PASS_SHADING_CHANGE_PYRAMID,
+        FFX_FSR3UPSCALER_PASS_SHADING_CHANGE, FFX_FSR3UPSCALER_PASS_PREPARE_REACTIVITY, FFX_FSR3UPSCALER_PASS_LUMA_INSTABILITY,
+        FFX_FSR3UPSCALER_PASS_ACCUMULATE };
+    const FfxPass deferredPasses[] = {
+        FFX_FSR3UPSCALER_PASS_ACCUMULATE_SHARPEN, FFX_FSR3UPSCALER_PASS_RCAS, FFX_FSR3UPSCALER_PASS_GENERATE_REACTIVE,
+        FFX_FSR3UPSCALER_PASS_DEBUG_VIEW };
+    const uint32_t eagerCount = uint32_t(std::size(eagerPasses));
+    const uint32_t deferredCount = uint32_t(std::size(deferredPasses));
+
+    FfxMockDeviceDX11* device = new FfxMockDeviceDX11();
+
+    {
+        std::vector<uint8_t> scratchBuffer(ffxGetScratchMemorySizeDX11(1));
+        FfxInterface backendInterface = {};
+        CHECK(ffxGetInterfaceDX11(&backendInterface, ffxGetDeviceDX11(device), scratchBuffer.data(), scratchBuffer.size(), 1) == FFX_OK);
+
+        FfxUInt32 effectContextId = 0;
+        CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_FSR3UPSCALER, nullptr, &effectContextId) == FFX_OK);
+
+        std::vector<FfxPipelineState> pipelines(eagerCount + deferredCount);
+        std::vector<FfxCreatePipelineTask> tasks(eagerCount + deferredCount);
+        for (uint32_t passIndex = 0; passIndex < eagerCount + deferredCount; ++passIndex) {
+            FfxPass pass = passIndex < eagerCount ? eagerPasses[passIndex] : deferredPasses[passIndex - eagerCount];
+            tasks[passIndex] = { pass, 0, {}, &pipelines[passIndex], FFX_OK };
+        }
+
+        // every pipeline up front
+        FfxPipelineCacheStatsDX11 cacheStats = {};
+        device->log.reset();
+        auto start = std::chrono::steady_clock::now();
+        CHECK(ffxCreatePipelines(&backendInterface, FFX_EFFECT_FSR3UPSCALER, effectContextId, tasks.data(), eagerCount + deferredCount) == FFX_OK);
+        std::chrono::duration<double, std::micro> eagerTime = std::chrono::steady_clock::now() - start;
+        ffxGetPipelineCacheStatsDX11(&cacheStats);
+        const uint64_t eagerBytecodeSize = cacheStats.bytecodeSize;
+        CHECK(device->log.counts[FFX_MOCK_CALL_CREATE_COMPUTE_SHADER] == eagerCount + deferredCount);
+
+        for (FfxPipelineState& pipeline : pipelines)
+            ffxSafeReleasePipeline(&backendInterface, &pipeline, effectContextId);
+        ffxTrimPipelineCacheDX11();
+
+        // the rarely used passes deferred
+        FfxPipelineCreationStats creationStats = {}, startStats = {};
+        ffxGetPipelineCreationStats(&startStats);
+        std::vector<FfxDeferredPipeline> deferredPipelines(deferredCount);
+        std::vector<FfxDeferredPipeline*> deferredPointers;
+        device->log.reset();
+        start = std::chrono::steady_clock::now();
+        CHECK(ffxCreatePipelines(&backendInterface, FFX_EFFECT_FSR3UPSCALER, effectContextId, tasks.data(), eagerCount) == FFX_OK);
+        for (uint32_t passIndex = 0; passIndex < deferredCount; ++passIndex) {
+            const FfxCreatePipelineTask& task = tasks[eagerCount + passIndex];
+            ffxDeferPipeline(&deferredPipelines[passIndex], task.pass, task.permutationOptions, &task.description, task.pipeline);
+            deferredPointers.push_back(&deferredPipelines[passIndex]);
+        }
+        std::chrono::duration<double, std::micro> deferredTime = std::chrono::steady_clock::now() - start;
+        ffxGetPipelineCacheStatsDX11(&cacheStats);
+        ffxGetPipelineCreationStats(&creationStats);
+        const uint64_t deferredBytecodeSize = cacheStats.bytecodeSize;
+        CHECK(device->log.counts[FFX_MOCK_CALL_CREATE_COMPUTE_SHADER] == eagerCount);
+        CHECK(creationStats.createdPipelineCount - startStats.createdPipelineCount == eagerCount);
+        CHECK(creationStats.deferredPipelineCount - startStats.deferredPipelineCount == deferredCount);
+        CHECK(deferredBytecodeSize * (eagerCount + deferredCount) == eagerBytecodeSize * eagerCount);
+        for (uint32_t passIndex = 0; passIndex < deferredCount; ++passIndex)
+            CHECK(pipelines[eagerCount + passIndex].pipeline == nullptr);
+
+        // the first sharpened dispatch creates its pipeline, later ones find it created
+        start = std::chrono::steady_clock::now();
+        CHECK(ffxResolveDeferredPipelines(&backendInterface, FFX_EFFECT_FSR3UPSCALER, effectContextId, &deferredPointers[0], 1, nullptr) == FFX_OK);
+        std::chrono::duration<double, std::micro> firstUseTime = std::chrono::steady_clock::now() - start;
+        CHECK(ffxResolveDeferredPipelines(&backendInterface, FFX_EFFECT_FSR3UPSCALER, effectContextId, &deferredPointers[0], 1, nullptr) == FFX_OK);
+        CHECK(pipelines[eagerCount].pipeline != nullptr);
+        CHECK(device->log.counts[FFX_MOCK_CALL_CREATE_COMPUTE_SHADER] == eagerCount + 1);
+
+        // prewarming creates the rest
+        CHECK(ffxResolveDeferredPipelines(&backendInterface, FFX_EFFECT_FSR3UPSCALER, effectContextId, deferredPointers.data(), deferredCount, nullptr) == FFX_OK);
+        ffxGetPipelineCreationStats(&creationStats);
+        CHECK(creationStats.lazyCreatedPipelineCount - startStats.lazyCreatedPipelineCount == deferredCount);
+        CHECK(device->log.counts[FFX_MOCK_CALL_CREATE_COMPUTE_SHADER] == eagerCount + deferredCount);
+        for (const FfxDeferredPipeline& deferredPipeline : deferredPipelines)
+            CHECK(!deferredPipeline.pending && deferredPipeline.task.pipeline->pipeline != nullptr);
+
+        printf("deferred pipelines: context creation %u pipelines in %.1f us and %llu bytes of bytecode instead of %u in %.1f us and %llu bytes, "
+               "first use %.1f us\n",
+            eagerCount, deferredTime.count(), (unsigned long long)deferredBytecodeSize,
+            eagerCount + deferredCount, eagerTime.count(), (unsigned long long)eagerBytecodeSize, firstUseTime.count());
+
+        for (FfxPipelineState& pipeline : pipelines)
+            ffxSafeReleasePipeline(&backendInterface, &pipeline, effectContextId);
+        ffxTrimPipelineCacheDX11();
+
+        CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, effectContextId) == FFX_OK);
+    }
+
+    device->Release();
+    CHECK(ffxMockLiveObjectCountDX11() == 0);
+}
+
+int main()
+{
+    run(true);
+    run(false);
+    runFsr3FrameCalls();
+    runViewCache();
+    runJobRecords();
+    runPipelineCache();
+    runPersistentPipelineCache();
+    runTaskPool();
+    runParallelPipelines();
+    runDeferredPipelines();
+
+    return ffxMockExitCode();
+}
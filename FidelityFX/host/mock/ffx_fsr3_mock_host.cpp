@@ -0,0 +1,450 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Runs FSR3 contexts on a host-side stand-in backend and reports what they cost
+// the host. The backend records effect contexts, resources, pipelines and jobs,
+// stages constants and performs no other work, so the numbers are those of the
+// components alone. Returns non-zero when a check fails.
+//
+// Built with -fshort-wchar, see CMakeLists.txt in this directory.
+
+#include "ffx_mock.h"
+#include <host/ffx_fsr3.h>
+#include <host/ffx_fsr3upscaler.h>
+#include <host/ffx_message.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <new>
+#include <vector>
+
+// Heap memory taken through operator new, so that host allocations made by the components show up.
+static size_t s_heapBytes = 0;
+
+void* operator new(size_t size)
+{
+    size_t* block = static_cast<size_t*>(malloc(sizeof(size_t) + size));
+    if (!block)
+        throw std::bad_alloc();
+    block[0] = size;
+    s_heapBytes += size;
+    return block + 1;
+}
+
+void operator delete(void* pointer) noexcept
+{
+    if (!pointer)
+        return;
+    size_t* block = static_cast<size_t*>(pointer) - 1;
+    s_heapBytes -= block[0];
+    free(block);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+static uint32_t s_messageCount = 0;
+
+void ffxSetPrintMessageCallback(ffxMessageCallback, uint32_t)
+{
+}
+
+void ffxPrintMessage(uint32_t, const wchar_t*)
+{
+    s_messageCount++;
+}
+
+// What the components have asked of the backend. Resource indices are handed out in order and only those still live
+// are counted when destroyed, since the components release every slot whether it was created or not. Queued compute
+// jobs are replayed on execute the way a backend binds them, counting the shader changes.
+static const uint32_t s_standInResourceCapacity = 1024;
+static const uint32_t s_standInConstantRingSize = 64 * 1024;
+
+struct StandInBackend
+{
+    bool        liveResources[s_standInResourceCapacity] = {};
+    FfxPipeline queuedShaders[FFX_MAX_GPU_JOBS] = {};
+    uint8_t     constantRing[s_standInConstantRingSize];
+    uint32_t    constantRingPosition = 0;
+    uint32_t    queuedJobCount = 0;
+    uint64_t    dispatchCount = 0;
+    uint64_t    shaderBindCount = 0;
+    uint32_t effectContextCount = 0;
+    uint32_t nextEffectContextId = 0;
+    uint32_t resourceCount = 0;
+    uint32_t nextResourceIndex = 1;
+    uint64_t resourceTexels = 0;
+    uint32_t pipelineCount = 0;
+    uint64_t jobCount = 0;
+    uint64_t executeCount = 0;
+};
+
+static StandInBackend* standIn(FfxInterface* backendInterface)
+{
+    return static_cast<StandInBackend*>(backendInterface->scratchBuffer);
+}
+
+static void getStandInInterface(FfxInterface* backendInterface, StandInBackend* backend)
+{
+    memset(backendInterface, 0, sizeof(*backendInterface));
+    backendInterface->device            = backend;
+    backendInterface->scratchBuffer     = backend;
+    backendInterface->scratchBufferSize = sizeof(*backend);
+
+    backendInterface->fpGetSDKVersion = [](FfxInterface*) -> FfxVersionNumber {
+        return FFX_SDK_MAKE_VERSION(FFX_SDK_VERSION_MAJOR, FFX_SDK_VERSION_MINOR, FFX_SDK_VERSION_PATCH);
+    };
+    backendInterface->fpGetEffectGpuMemoryUsage = [](FfxInterface*, FfxUInt32, FfxEffectMemoryUsage* usage) -> FfxErrorCode {
+        memset(usage, 0, sizeof(*usage));
+        return FFX_OK;
+    };
+    backendInterface->fpCreateBackendContext = [](FfxInterface* backendInterface, FfxEffect, FfxEffectBindlessConfig*, FfxUInt32* effectContextId) -> FfxErrorCode {
+        standIn(backendInterface)->effectContextCount++;
+        *effectContextId = standIn(backendInterface)->nextEffectContextId++;
+        return FFX_OK;
+    };
+    backendInterface->fpGetDeviceCapabilities = [](FfxInterface*, FfxDeviceCapabilities* capabilities) -> FfxErrorCode {
+        memset(capabilities, 0, sizeof(*capabilities));
+        capabilities->maximumSupportedShaderModel = FFX_SHADER_MODEL_5_1;
+        return FFX_OK;
+    };
+    backendInterface->fpDestroyBackendContext = [](FfxInterface* backendInterface, FfxUInt32) -> FfxErrorCode {
+        standIn(backendInterface)->effectContextCount--;
+        return FFX_OK;
+    };
+    backendInterface->fpCreateResource = [](FfxInterface* backendInterface, const FfxCreateResourceDescription* description, FfxUInt32, FfxResourceInternal* resource) -> FfxErrorCode {
+        const FfxResourceDescription& desc = description->resourceDescription;
+        StandInBackend* backend = standIn(backendInterface);
+        if (backend->nextResourceIndex == s_standInResourceCapacity)
+            return FFX_ERROR_OUT_OF_MEMORY;
+        backend->resourceCount++;
+        backend->resourceTexels += uint64_t(desc.width) * std::max(1u, desc.height) * std::max(1u, desc.depth);
+        backend->liveResources[backend->nextResourceIndex] = true;
+        resource->internalIndex = backend->nextResourceIndex++;
+        return FFX_OK;
+    };
+    backendInterface->fpRegisterResource = [](FfxInterface*, const FfxResource*, FfxUInt32, FfxResourceInternal* resource) -> FfxErrorCode {
+        resource->internalIndex = 0;
+        return FFX_OK;
+    };
+    backendInterface->fpGetResource = [](FfxInterface*, FfxResourceInternal internal) -> FfxResource {
+        FfxResource resource = {};
+        resource.resource         = reinterpret_cast<void*>(uintptr_t(internal.internalIndex));
+        resource.description.type = FFX_RESOURCE_TYPE_TEXTURE2D;
+        return resource;
+    };
+    backendInterface->fpUnregisterResources = [](FfxInterface*, FfxCommandList, FfxUInt32) -> FfxErrorCode {
+        return FFX_OK;
+    };
+    backendInterface->fpRegisterStaticResource = [](FfxInterface*, const FfxStaticResourceDescription*, FfxUInt32) -> FfxErrorCode {
+        return FFX_OK;
+    };
+    backendInterface->fpGetResourceDescription = [](FfxInterface*, FfxResourceInternal) -> FfxResourceDescription {
+        FfxResourceDescription description = {};
+        return description;
+    };
+    backendInterface->fpDestroyResource = [](FfxInterface* backendInterface, FfxResourceInternal resource, FfxUInt32) -> FfxErrorCode {
+        StandInBackend* backend = standIn(backendInterface);
+        if (resource.internalIndex > 0 && resource.internalIndex < int32_t(s_standInResourceCapacity) && backend->liveResources[resource.internalIndex]) {
+            backend->liveResources[resource.internalIndex] = false;
+            backend->resourceCount--;
+        }
+        return FFX_OK;
+    };
+    backendInterface->fpMapResource = [](FfxInterface*, FfxResourceInternal, void**) -> FfxErrorCode {
+        return FFX_ERROR_BACKEND_API_ERROR;
+    };
+    backendInterface->fpUnmapResource = [](FfxInterface*, FfxResourceInternal) -> FfxErrorCode {
+        return FFX_OK;
+    };
+    backendInterface->fpStageConstantBufferDataFunc = [](FfxInterface* backendInterface, void* data, FfxUInt32 size, FfxConstantBuffer* constantBuffer) -> FfxErrorCode {
+        StandInBackend* backend = standIn(backendInterface);
+        if (backend->constantRingPosition + size > s_standInConstantRingSize)
+            backend->constantRingPosition = 0;
+        memcpy(backend->constantRing + backend->constantRingPosition, data, size);
+        constantBuffer->data            = reinterpret_cast<uint32_t*>(backend->constantRing + backend->constantRingPosition);
+        constantBuffer->num32BitEntries = size / sizeof(uint32_t);
+        backend->constantRingPosition  += (size + 255) & ~255u;
+        return FFX_OK;
+    };
+    // pipelines come out of a process-wide cache in the real backends, so every context gets the same shader per pass
+    backendInterface->fpCreatePipeline = [](FfxInterface* backendInterface, FfxEffect effect, FfxPass pass, uint32_t, const FfxPipelineDescription*, FfxUInt32, FfxPipelineState* pipeline) -> FfxErrorCode {
+        standIn(backendInterface)->pipelineCount++;
+        memset(pipeline, 0, sizeof(*pipeline));
+        pipeline->pipeline = reinterpret_cast<FfxPipeline>(uintptr_t(effect) << 16 | (uintptr_t(pass) + 1));
+        return FFX_OK;
+    };
+    backendInterface->fpDestroyPipeline = [](FfxInterface* backendInterface, FfxPipelineState* pipeline, FfxUInt32) -> FfxErrorCode {
+        if (pipeline && pipeline->pipeline)
+            standIn(backendInterface)->pipelineCount--;
+        if (pipeline)
+            memset(pipeline, 0, sizeof(*pipeline));
+        return FFX_OK;
+    };
+    backendInterface->fpScheduleGpuJob = [](FfxInterface* backendInterface, const FfxGpuJobDescription* job) -> FfxErrorCode {
+        StandInBackend* backend = standIn(backendInterface);
+        backend->jobCount++;
+        if (job->jobType != FFX_GPU_JOB_COMPUTE)
+            return FFX_OK;
+        if (backend->queuedJobCount == FFX_MAX_GPU_JOBS)
+            return FFX_ERROR_OUT_OF_MEMORY;
+        backend->queuedShaders[backend->queuedJobCount++] = job->computeJobDescriptor.pipeline.pipeline;
+        return FFX_OK;
+    };
+    backendInterface->fpExecuteGpuJobs = [](FfxInterface* backendInterface, FfxCommandList, FfxUInt32) -> FfxErrorCode {
+        StandInBackend* backend = standIn(backendInterface);
+        backend->executeCount++;
+        FfxPipeline boundShader = nullptr;
+        for (uint32_t index = 0; index < backend->queuedJobCount; ++index) {
+            backend->dispatchCount++;
+            if (backend->queuedShaders[index] != boundShader) {
+                boundShader = backend->queuedShaders[index];
+                backend->shaderBindCount++;
+            }
+        }
+        backend->queuedJobCount = 0;
+        return FFX_OK;
+    };
+    backendInterface->fpGetPermutationBlobByIndex = [](FfxEffect, FfxPass, FfxBindStage, uint32_t, FfxShaderBlob* blob) -> FfxErrorCode {
+        const FfxShaderBlob empty = {};
+        memcpy(static_cast<void*>(blob), &empty, sizeof(empty));
+        return FFX_OK;
+    };
+    backendInterface->fpReleasePermutationBlob = [](const uint8_t*) {
+    };
+    backendInterface->fpSwapChainConfigureFrameGeneration = [](FfxFrameGenerationConfig const*) -> FfxErrorCode {
+        return FFX_OK;
+    };
+    backendInterface->fpRegisterConstantBufferAllocator = [](FfxInterface*, FfxConstantBufferAllocator) {
+    };
+}
+
+static void getContextDescription(FfxFsr3ContextDescription* description, const FfxInterface& backendInterface)
+{
+    memset(description, 0, sizeof(*description));
+    description->flags                              = FFX_FSR3_ENABLE_ASYNC_WORKLOAD_SUPPORT;
+    description->maxRenderSize                      = { 1280, 720 };
+    description->maxUpscaleSize                     = { 2560, 1440 };
+    description->displaySize                        = { 2560, 1440 };
+    description->backendInterfaceSharedResources    = backendInterface;
+    description->backendInterfaceUpscaling          = backendInterface;
+    description->backendInterfaceFrameInterpolation = backendInterface;
+    description->backBufferFormat                   = FFX_SURFACE_FORMAT_R8G8B8A8_UNORM;
+}
+
+// Creates 1 to 8 FSR3 contexts side by side on one backend, enables frame generation on all of them at once and
+// generates a frame through each context's own callback. Every extra context has to add the same host memory,
+// backend objects and jobs as the first one, and destroying them has to hand everything back.
+static void runConcurrentContexts()
+{
+    printf("concurrent contexts: %zu bytes of host memory per FfxFsr3Context\n", sizeof(FfxFsr3Context));
+
+    for (uint32_t contextCount : { 1u, 2u, 4u, 8u }) {
+        StandInBackend backend;
+        FfxInterface   backendInterface = {};
+        getStandInInterface(&backendInterface, &backend);
+
+        std::vector<FfxFsr3Context> contexts(contextCount);
+        StandInBackend first = {};
+        size_t firstHeapBytes = 0;
+        double createTime = 0.0;
+        for (uint32_t index = 0; index < contextCount; ++index) {
+            FfxFsr3ContextDescription description;
+            getContextDescription(&description, backendInterface);
+
+            const StandInBackend before    = backend;
+            const size_t         heapBytes = s_heapBytes;
+            auto start = std::chrono::steady_clock::now();
+            CHECK(ffxFsr3ContextCreate(&contexts[index], &description) == FFX_OK);
+            createTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            StandInBackend added = {};
+            added.effectContextCount = backend.effectContextCount - before.effectContextCount;
+            added.resourceCount      = backend.resourceCount - before.resourceCount;
+            added.resourceTexels     = backend.resourceTexels - before.resourceTexels;
+            added.pipelineCount      = backend.pipelineCount - before.pipelineCount;
+            if (index == 0) {
+                first          = added;
+                firstHeapBytes = s_heapBytes - heapBytes;
+                CHECK(first.effectContextCount <= FFX_FSR3_CONTEXT_COUNT);
+            }
+            CHECK(added.effectContextCount == first.effectContextCount && added.resourceCount == first.resourceCount);
+            CHECK(added.resourceTexels == first.resourceTexels && added.pipelineCount == first.pipelineCount);
+            CHECK(s_heapBytes - heapBytes == firstHeapBytes);
+        }
+
+        // frame generation is on in every context at once, each dispatched through its own callback context
+        uint32_t firstJobCount = 0;
+        double   dispatchTime  = 0.0;
+        for (uint32_t index = 0; index < contextCount; ++index) {
+            FfxFrameGenerationConfig config = {};
+            config.frameGenerationEnabled        = true;
+            config.frameGenerationCallback       = ffxFsr3DispatchFrameGeneration;
+            config.frameGenerationCallbackContext = &contexts[index];
+            CHECK(ffxFsr3ConfigureFrameGeneration(&contexts[index], &config) == FFX_OK);
+
+            FfxFrameGenerationDispatchDescription frame = {};
+            frame.commandList                     = &frame;
+            frame.presentColor.resource           = &frame;
+            frame.presentColor.description.type   = FFX_RESOURCE_TYPE_TEXTURE2D;
+            frame.presentColor.description.width  = 2560;
+            frame.presentColor.description.height = 1440;
+            frame.outputs[0]                      = frame.presentColor;
+            frame.frameID = 1;
+
+            const uint64_t jobCount = backend.jobCount;
+            auto start = std::chrono::steady_clock::now();
+            CHECK(config.frameGenerationCallback(&frame, config.frameGenerationCallbackContext) == FFX_OK);
+            dispatchTime += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            if (index == 0)
+                firstJobCount = uint32_t(backend.jobCount - jobCount);
+            CHECK(firstJobCount > 0 && backend.jobCount - jobCount == firstJobCount);
+        }
+        CHECK(ffxFsr3DispatchFrameGeneration(nullptr, &contexts[0]) == FfxErrorCode(FFX_ERROR_INVALID_POINTER));
+
+        double destroyTime = 0.0;
+        for (uint32_t index = 0; index < contextCount; ++index) {
+            auto start = std::chrono::steady_clock::now();
+            CHECK(ffxFsr3ContextDestroy(&contexts[index]) == FFX_OK);
+            destroyTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+        CHECK(backend.effectContextCount == 0 && backend.resourceCount == 0 && backend.pipelineCount == 0);
+
+        printf("  %u contexts: create %.2f ms, generate a frame %.1f us, destroy %.2f ms per context; per context %u effect contexts, "
+               "%u resources (%.1f M texels), %u pipelines, %zu heap bytes, %u jobs per frame\n",
+               contextCount, createTime / contextCount, dispatchTime / contextCount, destroyTime / contextCount,
+               first.effectContextCount, first.resourceCount, double(first.resourceTexels) / 1e6, first.pipelineCount,
+               firstHeapBytes, firstJobCount);
+    }
+}
+
+// Upscales 2 to 8 views, each with its own upscaler context on one backend, first with one
+// ffxFsr3UpscalerContextDispatch per view and then with one ffxFsr3UpscalerContextDispatchBatch per frame, and
+// compares the host time per view. The batch has to queue the same dispatches, execute once per frame and bind each
+// pass's shader once for all views. Misuse has to be rejected with nothing queued.
+static void runBatchedViews()
+{
+    const uint32_t frameCount = 500;
+
+    printf("batched views (median of %u frames, 1280x720 to 2560x1440 with sharpening):\n", frameCount);
+
+    for (uint32_t viewCount : { 2u, 4u, 8u }) {
+        StandInBackend* backend = new StandInBackend();
+        FfxInterface    backendInterface = {};
+        getStandInInterface(&backendInterface, backend);
+
+        std::vector<FfxFsr3UpscalerContext>             contexts(viewCount);
+        std::vector<FfxFsr3UpscalerContext*>            views(viewCount);
+        std::vector<FfxFsr3UpscalerDispatchDescription> descriptions(viewCount);
+        for (uint32_t view = 0; view < viewCount; ++view) {
+            FfxFsr3UpscalerContextDescription contextDescription = {};
+            contextDescription.flags            = FFX_FSR3UPSCALER_ENABLE_AUTO_EXPOSURE;
+            contextDescription.maxRenderSize    = { 1280, 720 };
+            contextDescription.maxUpscaleSize   = { 2560, 1440 };
+            contextDescription.backendInterface = backendInterface;
+            CHECK(ffxFsr3UpscalerContextCreate(&contexts[view], &contextDescription) == FFX_OK);
+            CHECK(ffxFsr3UpscalerContextPrewarmPipelines(&contexts[view]) == FFX_OK);
+            views[view] = &contexts[view];
+
+            FfxFsr3UpscalerDispatchDescription& description = descriptions[view];
+            memset(&description, 0, sizeof(description));
+            description.commandList            = backend;
+            description.renderSize             = { 1280, 720 };
+            description.upscaleSize            = { 2560, 1440 };
+            description.motionVectorScale      = { 1280.0f, 720.0f };
+            description.enableSharpening       = true;
+            description.sharpness              = 0.5f;
+            description.frameTimeDelta         = 16.6f;
+            description.preExposure            = 1.0f;
+            description.cameraNear             = 0.1f;
+            description.cameraFar              = 1000.0f;
+            description.cameraFovAngleVertical = 1.0f;
+        }
+
+        // the two ways alternate frame by frame so that both see the same machine, and the median frame is reported
+        std::vector<double> frameTimes[2];
+        uint64_t dispatchCounts[2]   = {};
+        uint64_t executeCounts[2]    = {};
+        uint64_t shaderBindCounts[2] = {};
+        for (uint32_t frame = 0; frame < 2 * frameCount; ++frame) {
+            const uint32_t batched = frame & 1;
+            for (FfxFsr3UpscalerDispatchDescription& description : descriptions)
+                description.jitterOffset = { float(frame & 7) * 0.1f - 0.4f, float(frame & 3) * 0.2f - 0.3f };
+
+            const uint64_t dispatchCount   = backend->dispatchCount;
+            const uint64_t executeCount    = backend->executeCount;
+            const uint64_t shaderBindCount = backend->shaderBindCount;
+            auto start = std::chrono::steady_clock::now();
+            if (batched) {
+                CHECK(ffxFsr3UpscalerContextDispatchBatch(views.data(), descriptions.data(), viewCount) == FFX_OK);
+            } else {
+                for (uint32_t view = 0; view < viewCount; ++view)
+                    CHECK(ffxFsr3UpscalerContextDispatch(views[view], &descriptions[view]) == FFX_OK);
+            }
+            frameTimes[batched].push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+            dispatchCounts[batched]   = backend->dispatchCount - dispatchCount;
+            executeCounts[batched]    = backend->executeCount - executeCount;
+            shaderBindCounts[batched] = backend->shaderBindCount - shaderBindCount;
+        }
+
+        double viewTime[2] = {};
+        for (uint32_t batched = 0; batched < 2; ++batched) {
+            std::vector<double>& times = frameTimes[batched];
+            std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+            viewTime[batched] = times[times.size() / 2] / viewCount;
+        }
+
+        CHECK(dispatchCounts[1] == dispatchCounts[0] && dispatchCounts[1] > 0);
+        CHECK(executeCounts[0] == viewCount && executeCounts[1] == 1);
+        CHECK(shaderBindCounts[0] == dispatchCounts[0]);
+        CHECK(shaderBindCounts[1] * viewCount == dispatchCounts[1]);
+
+        printf("  %u views: %.1f us per view single, %.1f us batched (%.0f%%); per frame %llu dispatches, %llu -> %llu executes, "
+               "%llu -> %llu shader binds\n",
+               viewCount, viewTime[0], viewTime[1], 100.0 * (viewTime[0] - viewTime[1]) / viewTime[0], (unsigned long long)dispatchCounts[1],
+               (unsigned long long)executeCounts[0], (unsigned long long)executeCounts[1], (unsigned long long)shaderBindCounts[0],
+               (unsigned long long)shaderBindCounts[1]);
+
+        // a context may appear once per batch, and an empty batch is an error
+        FfxFsr3UpscalerContext* duplicates[2] = { views[0], views[0] };
+        const uint64_t          jobCount      = backend->jobCount;
+        CHECK(ffxFsr3UpscalerContextDispatchBatch(duplicates, descriptions.data(), 2) == FfxErrorCode(FFX_ERROR_INVALID_ARGUMENT));
+        CHECK(ffxFsr3UpscalerContextDispatchBatch(views.data(), descriptions.data(), 0) == FfxErrorCode(FFX_ERROR_INVALID_ARGUMENT));
+        CHECK(backend->jobCount == jobCount && backend->queuedJobCount == 0);
+
+        for (FfxFsr3UpscalerContext* view : views)
+            CHECK(ffxFsr3UpscalerContextDestroy(view) == FFX_OK);
+        CHECK(backend->effectContextCount == 0 && backend->resourceCount == 0 && backend->pipelineCount == 0);
+        delete backend;
+    }
+}
+
+int main()
+{
+    runConcurrentContexts();
+    runBatchedViews();
+
+    return ffxMockExitCode();
+}
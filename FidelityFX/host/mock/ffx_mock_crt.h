@@ -0,0 +1,68 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Minimal MSVC CRT shim for building the FidelityFX host code on platforms
+// without it. Every target in this directory force-includes it (-include).
+// Targets built with -fshort-wchar, which keeps wchar_t at the 2 bytes the
+// component context sizes are budgeted for, also link ffx_mock_wchar.cpp: it
+// replaces the C library's wide character functions, which assume 4 bytes.
+
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+#include <wchar.h>
+
+#if !defined(_MSC_VER)
+#define __declspec(x)
+#endif // #if !defined(_MSC_VER)
+
+#define _countof(a) (sizeof(a) / sizeof((a)[0]))
+
+template<size_t N>
+inline int wcscpy_s(wchar_t (&dst)[N], const wchar_t* src)
+{
+    size_t i = 0;
+    for (; i + 1 < N && src[i]; ++i)
+        dst[i] = src[i];
+    dst[i] = 0;
+    return 0;
+}
+
+template<size_t N>
+inline int wcscat_s(wchar_t (&dst)[N], const wchar_t* src)
+{
+    size_t i = 0;
+    while (i < N && dst[i])
+        ++i;
+    for (; i + 1 < N && *src; ++i, ++src)
+        dst[i] = *src;
+    if (i < N)
+        dst[i] = 0;
+    return 0;
+}
+
+template<size_t N, typename... Args>
+inline int swprintf_s(wchar_t (&dst)[N], const wchar_t* format, Args... args)
+{
+    return swprintf(dst, N, format, args...);
+}
@@ -0,0 +1,191 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// The C library's wide character functions, rebuilt for a 2 byte wchar_t so
+// that the components can be linked with -fshort-wchar. Defining them in the
+// executable takes precedence over the C library. Formatting follows MSVC,
+// where %s in a wide format reads a wide string.
+
+#include "ffx_mock_crt.h"
+#include <stdarg.h>
+#include <stdint.h>
+
+static_assert(sizeof(wchar_t) == 2, "build with -fshort-wchar");
+
+extern "C" {
+
+size_t wcslen(const wchar_t* s) noexcept
+{
+    size_t length = 0;
+    while (s[length])
+        ++length;
+    return length;
+}
+
+wchar_t* wcsncpy(wchar_t* dst, const wchar_t* src, size_t count) noexcept
+{
+    size_t i = 0;
+    for (; i < count && src[i]; ++i)
+        dst[i] = src[i];
+    for (; i < count; ++i)
+        dst[i] = 0;
+    return dst;
+}
+
+wchar_t* wmemcpy(wchar_t* dst, const wchar_t* src, size_t count) noexcept
+{
+    return static_cast<wchar_t*>(memcpy(dst, src, count * sizeof(wchar_t)));
+}
+
+wchar_t* wmemmove(wchar_t* dst, const wchar_t* src, size_t count) noexcept
+{
+    return static_cast<wchar_t*>(memmove(dst, src, count * sizeof(wchar_t)));
+}
+
+wchar_t* wmemset(wchar_t* dst, wchar_t value, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+        dst[i] = value;
+    return dst;
+}
+
+int wmemcmp(const wchar_t* a, const wchar_t* b, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+        if (a[i] != b[i])
+            return a[i] < b[i] ? -1 : 1;
+    return 0;
+}
+
+// Handles %s, %ls, %S, %hs, %c, %d, %i, %u and %x with the l, ll and z size prefixes, and %%.
+int vswprintf(wchar_t* dst, size_t count, const wchar_t* format, va_list args) noexcept
+{
+    if (!dst || !count)
+        return -1;
+
+    size_t written = 0;
+    auto   put     = [&](wchar_t c) {
+        if (written + 1 < count)
+            dst[written] = c;
+        ++written;
+    };
+
+    for (const wchar_t* f = format; *f; ++f)
+    {
+        if (*f != L'%')
+        {
+            put(*f);
+            continue;
+        }
+        ++f;
+
+        uint32_t longCount = 0;
+        bool     narrow    = false;
+        bool     sizeType  = false;
+        for (;; ++f)
+        {
+            if (*f == L'l')
+                ++longCount;
+            else if (*f == L'h')
+                narrow = true;
+            else if (*f == L'z')
+                sizeType = true;
+            else
+                break;
+        }
+
+        switch (*f)
+        {
+        case L'S':
+            narrow = true;
+            // fall through
+        case L's':
+            if (narrow && !longCount)
+            {
+                for (const char* s = va_arg(args, const char*); s && *s; ++s)
+                    put(wchar_t(uint8_t(*s)));
+            }
+            else
+            {
+                for (const wchar_t* s = va_arg(args, const wchar_t*); s && *s; ++s)
+                    put(*s);
+            }
+            break;
+        case L'c':
+            put(wchar_t(va_arg(args, int)));
+            break;
+        case L'd':
+        case L'i':
+        case L'u':
+        case L'x':
+        {
+            const bool isSigned = *f == L'd' || *f == L'i';
+            uint64_t   digits   = 0;
+            bool       negative = false;
+            if (sizeType)
+                digits = va_arg(args, size_t);
+            else if (isSigned)
+            {
+                const int64_t value = longCount > 1 ? va_arg(args, long long) : longCount ? va_arg(args, long) : va_arg(args, int);
+                negative = value < 0;
+                digits   = negative ? 0 - uint64_t(value) : uint64_t(value);
+            }
+            else
+                digits = longCount > 1 ? va_arg(args, unsigned long long) : longCount ? va_arg(args, unsigned long) : va_arg(args, unsigned int);
+
+            const uint32_t base = *f == L'x' ? 16 : 10;
+            char           text[24];
+            int            length = 0;
+            do
+            {
+                text[length++] = "0123456789abcdef"[digits % base];
+                digits /= base;
+            } while (digits);
+            if (negative)
+                put(L'-');
+            while (length)
+                put(wchar_t(text[--length]));
+            break;
+        }
+        case L'%':
+            put(L'%');
+            break;
+        default:
+            dst[0] = 0;
+            return -1;
+        }
+    }
+
+    dst[written < count ? written : count - 1] = 0;
+    return written < count ? int(written) : -1;
+}
+
+int swprintf(wchar_t* dst, size_t count, const wchar_t* format, ...) noexcept
+{
+    va_list args;
+    va_start(args, format);
+    const int result = vswprintf(dst, count, format, args);
+    va_end(args);
+    return result;
+}
+
+} // extern "C"
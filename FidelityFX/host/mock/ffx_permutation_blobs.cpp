@@ -0,0 +1,378 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Checks the build steps that shape the embedded permutation blobs: the DXBC codec the blob accessors
+// decompress with, chunk stripping, and ffx_dxbc_patch run with -strip -dedup -compress over fxc headers
+// in a scratch directory, as ffx_dxbc_patch.targets runs it. The manifest run builds a permutation table
+// the way the generated permutation headers do and checks which slots it keeps. Returns non-zero when a
+// check fails.
+
+// options the manifest run prunes, set before the manifest is included as a project would
+#define FFX_PERMUTATION_MANIFEST_FP16               FFX_PERMUTATION_OFF
+#define FFX_PERMUTATION_MANIFEST_HDR_COLOR_INPUT    FFX_PERMUTATION_ON
+#define FFX_PERMUTATION_MANIFEST_DEPTH_INVERTED     FFX_PERMUTATION_ON
+
+#include "ffx_mock.h"
+#include <host/backends/blob_accessors/ffx_permutation_manifest.h>
+#include <DXBC/DXBCCompress.h>
+#include <DXBC/DXBCPatch.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct Chunk
+{
+    uint32_t             fourCC;
+    std::vector<uint8_t> payload;
+};
+
+static uint32_t fourCC(const char* name)
+{
+    uint32_t value;
+    memcpy(&value, name, sizeof(value));
+    return value;
+}
+
+static uint32_t read32(const std::vector<uint8_t>& data, size_t offset)
+{
+    uint32_t value;
+    memcpy(&value, data.data() + offset, sizeof(value));
+    return value;
+}
+
+static void write32(std::vector<uint8_t>& data, size_t offset, uint32_t value)
+{
+    memcpy(data.data() + offset, &value, sizeof(value));
+}
+
+// A signed DXBC container with the chunks in order, each payload padded to a DWORD.
+static std::vector<uint8_t> createContainer(const std::vector<Chunk>& chunks)
+{
+    const size_t          tableEnd = 0x20 + chunks.size() * 4;
+    std::vector<uint8_t>  container(tableEnd);
+    memcpy(container.data(), "DXBC", 4);
+    write32(container, 0x14, 1);
+    write32(container, 0x1C, uint32_t(chunks.size()));
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        const size_t offset = container.size();
+        write32(container, 0x20 + i * 4, uint32_t(offset));
+        container.resize(offset + 8 + ((chunks[i].payload.size() + 3) & ~size_t(3)));
+        write32(container, offset, chunks[i].fourCC);
+        write32(container, offset + 4, uint32_t(chunks[i].payload.size()));
+        memcpy(container.data() + offset + 8, chunks[i].payload.data(), chunks[i].payload.size());
+    }
+    write32(container, 0x18, uint32_t(container.size()));
+
+    uint32_t hash[4];
+    CalculateDXBCChecksum(container.data(), uint32_t(container.size()), hash);
+    memcpy(container.data() + 4, hash, sizeof(hash));
+    return container;
+}
+
+// A cs_5_0 program of single token instructions ending in ret, with a sync_g every 16th.
+static Chunk createProgram(uint32_t instructionCount, uint32_t seed)
+{
+    std::vector<uint32_t> tokens = { 0x00050050, 2 + instructionCount };
+    for (uint32_t i = 0; i + 1 < instructionCount; ++i)
+        tokens.push_back(i % 16 == 15 ? 0x010010BE : (0x01000000 | ((seed + i) % 0x30)));
+    tokens.push_back(0x0100003E);
+
+    Chunk chunk = { fourCC("SHEX"), std::vector<uint8_t>(tokens.size() * 4) };
+    memcpy(chunk.payload.data(), tokens.data(), chunk.payload.size());
+    return chunk;
+}
+
+static Chunk createData(const char* name, size_t size, uint32_t seed)
+{
+    Chunk chunk = { fourCC(name), std::vector<uint8_t>(size) };
+    for (size_t i = 0; i < size; ++i)
+        chunk.payload[i] = uint8_t((seed * 31 + i * 7) ^ (i >> 3));
+    return chunk;
+}
+
+static bool validChecksum(const std::vector<uint8_t>& container)
+{
+    uint32_t hash[4];
+    CalculateDXBCChecksum(const_cast<uint8_t*>(container.data()), uint32_t(container.size()), hash);
+    return memcmp(container.data() + 4, hash, sizeof(hash)) == 0;
+}
+
+// Compresses and decompresses a container, a long run, tiny inputs and noise, and feeds the decoder a wrong
+// size and streams cut in half.
+static void runCompression()
+{
+    std::vector<std::vector<uint8_t>> inputs;
+    inputs.push_back(createContainer({ createData("RDEF", 301, 1), createProgram(2048, 5), createData("STAT", 148, 2) }));
+    inputs.push_back(std::vector<uint8_t>(100000, 0x5A));
+    inputs.push_back({ 'D', 'X', 'B' });
+    inputs.push_back({});
+    std::vector<uint8_t> noise(70000);
+    srand(7);
+    for (uint8_t& value : noise)
+        value = uint8_t(rand());
+    inputs.push_back(noise);
+    // a match further back than the 16 bit offset reaches
+    std::vector<uint8_t> far = noise;
+    far.insert(far.end(), noise.begin(), noise.begin() + 4096);
+    inputs.push_back(far);
+
+    uint64_t rawBytes = 0, packedBytes = 0;
+    for (const std::vector<uint8_t>& input : inputs) {
+        const uint32_t       size = uint32_t(input.size());
+        std::vector<uint8_t> packed(GetDXBCCompressBound(size));
+        const uint32_t       packedSize = CompressDXBC(input.data(), size, packed.data(), uint32_t(packed.size()));
+        CHECK(packedSize >= DXBC_COMPRESSED_HEADER_SIZE && packedSize <= packed.size());
+        packed.resize(packedSize);
+        CHECK(GetDXBCDecompressedSize(packed.data(), packedSize) == size);
+
+        // padded so the block copies of the decoder would show up as a difference past the end
+        std::vector<uint8_t> unpacked(size + 32, 0xCD);
+        CHECK(DecompressDXBC(packed.data(), packedSize, unpacked.data(), size) == 1);
+        CHECK(memcmp(unpacked.data(), input.data(), size) == 0);
+        CHECK(unpacked[size] == 0xCD);
+        rawBytes += size;
+        packedBytes += packedSize;
+
+        if (size == 0)
+            continue;
+        CHECK(DecompressDXBC(packed.data(), packedSize, unpacked.data(), size - 1) == 0);
+        CHECK(DecompressDXBC(packed.data(), packedSize / 2, unpacked.data(), size) == 0);
+    }
+
+    // raw containers are not mistaken for compressed ones, and an output buffer too small to hold the result fails
+    CHECK(GetDXBCDecompressedSize(inputs[0].data(), uint32_t(inputs[0].size())) == 0);
+    std::vector<uint8_t> small(16);
+    CHECK(CompressDXBC(noise.data(), uint32_t(noise.size()), small.data(), uint32_t(small.size())) == 0);
+
+    printf("DXBC compression: %zu inputs round trip, %llu -> %llu bytes\n", inputs.size(), (unsigned long long)rawBytes,
+           (unsigned long long)packedBytes);
+    CHECK(packedBytes < rawBytes);
+}
+
+// Strips reflection and debug chunks with odd payload sizes from between the kept ones.
+static void runStrip()
+{
+    const Chunk                 program = createProgram(512, 3), signature = createData("ISGN", 24, 4), marker = createData("PRIV", 16, 5);
+    const std::vector<uint8_t>  container = createContainer({ createData("RDEF", 301, 1), signature, createData("STAT", 147, 2), program,
+                                                              createData("SPDB", 1023, 6), marker });
+    const uint32_t              strip[] = { fourCC("RDEF"), fourCC("STAT"), fourCC("SDBG"), fourCC("SPDB") };
+    const uint32_t              stripCount = uint32_t(sizeof(strip) / sizeof(strip[0]));
+    CHECK(ValidateDXBCContainer(container.data(), uint32_t(container.size())));
+
+    std::vector<uint8_t> stripped(container.size());
+    const uint32_t       size = StripDXBCChunks(container.data(), uint32_t(container.size()), strip, stripCount, stripped.data(), uint32_t(stripped.size()));
+    stripped.resize(size);
+
+    // the kept chunks in their order, byte for byte, right after the shorter table
+    const std::vector<uint8_t> expected = createContainer({ signature, program, marker });
+    CHECK(size == expected.size());
+    CHECK(stripped == expected);
+    CHECK(ValidateDXBCContainer(stripped.data(), size));
+    CHECK(validChecksum(stripped));
+    CHECK(VerifyDXBCStrip(container.data(), uint32_t(container.size()), stripped.data(), size, strip, stripCount));
+
+    // stripping again changes nothing
+    std::vector<uint8_t> again(stripped.size());
+    CHECK(StripDXBCChunks(stripped.data(), size, strip, stripCount, again.data(), uint32_t(again.size())) == size);
+    CHECK(again == stripped);
+    CHECK(VerifyDXBCStrip(stripped.data(), size, again.data(), size, strip, stripCount));
+
+    // a damaged copy, a copy with a chunk missing and an unstripped source are all rejected
+    std::vector<uint8_t> damaged = stripped;
+    damaged[size - 20] ^= 1;
+    uint32_t hash[4];
+    CalculateDXBCChecksum(damaged.data(), size, hash);
+    memcpy(damaged.data() + 4, hash, sizeof(hash));
+    CHECK(!VerifyDXBCStrip(container.data(), uint32_t(container.size()), damaged.data(), size, strip, stripCount));
+    const std::vector<uint8_t> missing = createContainer({ signature, program });
+    CHECK(!VerifyDXBCStrip(container.data(), uint32_t(container.size()), missing.data(), uint32_t(missing.size()), strip, stripCount));
+    CHECK(!VerifyDXBCStrip(container.data(), uint32_t(container.size()), container.data(), uint32_t(container.size()), strip, stripCount));
+    CHECK(StripDXBCChunks(container.data(), uint32_t(container.size()) - 4, strip, stripCount, again.data(), uint32_t(again.size())) == 0);
+
+    printf("DXBC strip: %zu -> %u bytes, %u chunks kept\n", container.size(), size, read32(stripped, 0x1C));
+}
+
+static std::string readText(const std::filesystem::path& path)
+{
+    std::ifstream     file(path, std::ios::binary);
+    std::stringstream text;
+    text << file.rdbuf();
+    return text.str();
+}
+
+// The header fxc /Fh writes for a blob.
+static void writeHeader(const std::filesystem::path& path, const char* name, const std::vector<uint8_t>& blob)
+{
+    std::ofstream file(path, std::ios::binary);
+    file << "#if 0\n//\n// Generated by Microsoft (R) HLSL Shader Compiler 10.1\n//\n#endif\n\nconst BYTE " << name << "[] =\n{\n";
+    for (size_t i = 0; i < blob.size(); ++i)
+        file << (i % 6 == 0 ? "\n    " : ", ") << unsigned(blob[i]) << (i + 1 < blob.size() && i % 6 == 5 ? "," : "");
+    file << "\n};\n";
+}
+
+// The bytes of the single array of a header, empty for an alias.
+static std::vector<uint8_t> readHeaderBlob(const std::filesystem::path& path)
+{
+    const std::string    text = readText(path);
+    const size_t         open = text.find('{', text.find("const BYTE ")), close = text.find('}', open);
+    std::vector<uint8_t> blob;
+    if (text.find("const BYTE ") == std::string::npos)
+        return blob;
+    for (const char* cursor = text.c_str() + open + 1; cursor < text.c_str() + close;) {
+        char* next;
+        blob.push_back(uint8_t(strtoul(cursor, &next, 0)));
+        cursor = next;
+        while (cursor < text.c_str() + close && (*cursor == ',' || isspace((unsigned char)*cursor)))
+            ++cursor;
+    }
+    return blob;
+}
+
+static int runTool(const std::string& arguments)
+{
+    const std::string command = std::string(FFX_DXBC_PATCH_PATH) + " " + arguments;
+    fflush(stdout);
+    const int status = system(command.c_str());
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+// Runs ffx_dxbc_patch over four headers, two of them (one in a subdirectory) holding the blob of the first
+// with different reflection data, and checks the aliases, the compressed arrays and the reruns.
+static void runDedup()
+{
+    char directoryTemplate[] = "/tmp/ffx_permutation_blobs_XXXXXX";
+    CHECK(mkdtemp(directoryTemplate) != nullptr);
+    const std::filesystem::path directory = directoryTemplate;
+    std::filesystem::create_directory(directory / "wave64");
+
+    const Chunk program = createProgram(1024, 1), other = createProgram(1024, 2);
+    const std::filesystem::path paths[] = { directory / "pass_0.h", directory / "pass_1.h", directory / "pass_2.h", directory / "wave64" / "pass_0.h" };
+    const char*                 names[] = { "g_pass_0", "g_pass_1", "g_pass_2", "g_pass_wave64_0" };
+    writeHeader(paths[0], names[0], createContainer({ createData("RDEF", 200, 1), program, createData("STAT", 148, 1) }));
+    writeHeader(paths[1], names[1], createContainer({ createData("RDEF", 200, 2), other, createData("STAT", 148, 2) }));
+    writeHeader(paths[2], names[2], createContainer({ createData("RDEF", 260, 3), program, createData("STAT", 148, 3) }));
+    writeHeader(paths[3], names[3], createContainer({ createData("RDEF", 180, 4), program, createData("SPDB", 999, 4) }));
+    {
+        std::ofstream list(directory / "headers.txt");
+        for (const std::filesystem::path& path : paths)
+            list << path.string() << "\n";
+    }
+    const std::string inputs = "@" + (directory / "headers.txt").string();
+
+    CHECK(runTool("-strip -dedup " + inputs) == 0);
+
+    const std::vector<uint8_t> owner = readHeaderBlob(paths[0]);
+    CHECK(ValidateDXBCContainer(owner.data(), uint32_t(owner.size())));
+    CHECK(validChecksum(owner));
+    CHECK(GetDXBCPatchFlags(owner.data(), uint32_t(owner.size())) == DXBC_PATCH_ALL);
+    CHECK(read32(owner, 0x1C) == 2);
+    CHECK(readText(paths[0]).rfind("#pragma once\n", 0) == 0);
+    CHECK(readHeaderBlob(paths[1]).size() == owner.size());
+    CHECK(readHeaderBlob(paths[1]) != owner);
+
+    // the aliases include the owner relative to themselves and keep their array name
+    const std::string alias = readText(paths[2]), nestedAlias = readText(paths[3]);
+    CHECK(readHeaderBlob(paths[2]).empty());
+    CHECK(alias.find("#include \"pass_0.h\"") != std::string::npos);
+    CHECK(alias.find("#define g_pass_2 g_pass_0") != std::string::npos);
+    CHECK(nestedAlias.find("#include \"../pass_0.h\"") != std::string::npos);
+    CHECK(nestedAlias.find("#define g_pass_wave64_0 g_pass_0") != std::string::npos);
+
+    // compressed arrays decompress to the deduplicated blob, and after that nothing is left to do
+    CHECK(runTool("-compress " + inputs) == 0);
+    const std::vector<uint8_t> packed = readHeaderBlob(paths[0]);
+    std::vector<uint8_t>       unpacked(GetDXBCDecompressedSize(packed.data(), uint32_t(packed.size())));
+    CHECK(unpacked.size() == owner.size());
+    CHECK(packed.size() < owner.size());
+    CHECK(DecompressDXBC(packed.data(), uint32_t(packed.size()), unpacked.data(), uint32_t(unpacked.size())) == 1);
+    CHECK(unpacked == owner);
+    CHECK(runTool("-check -strip -dedup -compress " + inputs) == 0);
+    CHECK(readText(paths[2]) == alias);
+
+    // an owner whose blob changed leaves its aliases stale, which fails the build and leaves them in place
+    writeHeader(paths[0], names[0], createContainer({ createProgram(1024, 9) }));
+    CHECK(runTool("-strip -dedup " + inputs) == 2);
+    CHECK(readText(paths[2]) == alias);
+
+    std::filesystem::remove_all(directory);
+}
+
+struct Blob
+{
+    const uint8_t* data;
+    uint32_t       size;
+};
+
+// the blobs of the HDR off and on permutations of a pass
+static const uint8_t g_hdr_0[] = { 0 };
+static const uint8_t g_hdr_1[] = { 1 };
+
+// Enumerates the FSR2 and FSR3 upscaler permutations with the guard the generated headers put around each of
+// them, and builds one table slot per HDR value the way the generated tables do.
+static void runManifest()
+{
+    uint32_t kept = 0;
+    for (uint32_t permutation = 0; permutation < (1u << 7); ++permutation) {
+        const uint32_t fp16 = permutation & 1, lanczos = (permutation >> 1) & 1, hdr = (permutation >> 2) & 1, lowResMotionVectors = (permutation >> 3) & 1,
+                       jitter = (permutation >> 4) & 1, depthInverted = (permutation >> 5) & 1, sharpening = (permutation >> 6) & 1;
+        const bool allowed = FFX_PERMUTATION_ALLOWED(FP16, fp16) && FFX_PERMUTATION_ALLOWED(USE_LANCZOS_TYPE, lanczos) && FFX_PERMUTATION_ALLOWED(HDR_COLOR_INPUT, hdr) &&
+                             FFX_PERMUTATION_ALLOWED(LOW_RES_MOTION_VECTORS, lowResMotionVectors) && FFX_PERMUTATION_ALLOWED(JITTER_MOTION_VECTORS, jitter) &&
+                             FFX_PERMUTATION_ALLOWED(DEPTH_INVERTED, depthInverted) && FFX_PERMUTATION_ALLOWED(ENABLE_SHARPENING, sharpening);
+        CHECK(allowed == (fp16 == 0 && hdr == 1 && depthInverted == 1));
+        kept += allowed;
+    }
+    CHECK(kept == 16);
+
+    static const Blob table[2] = {
+        {
+#if FFX_PERMUTATION_ALLOWED(FP16, 0) && FFX_PERMUTATION_ALLOWED(HDR_COLOR_INPUT, 0)
+            g_hdr_0, sizeof(g_hdr_0)
+#endif
+        },
+        {
+#if FFX_PERMUTATION_ALLOWED(FP16, 0) && FFX_PERMUTATION_ALLOWED(HDR_COLOR_INPUT, 1)
+            g_hdr_1, sizeof(g_hdr_1)
+#endif
+        },
+    };
+    CHECK(table[0].data == nullptr && table[0].size == 0);
+    CHECK(table[1].data == g_hdr_1 && table[1].size == 1);
+
+    printf("Permutation manifest: %u of 128 permutations kept\n", kept);
+}
+
+int main()
+{
+    runCompression();
+    runStrip();
+    runDedup();
+    runManifest();
+
+    return ffxMockExitCode();
+}
@@ -0,0 +1,152 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Minimal Win32 shim for building the DX11 backend against the recording mock
+// device on platforms without the Windows SDK. Only the types, macros and
+// functions referenced by the backend are provided.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+#include <type_traits>
+
+typedef int32_t         HRESULT;
+typedef uint8_t         BYTE;
+typedef uint16_t        WORD;
+typedef uint32_t        DWORD;
+typedef uint32_t        UINT;
+typedef int32_t         INT;
+typedef int             BOOL;
+typedef float           FLOAT;
+typedef size_t          SIZE_T;
+typedef intptr_t        INT_PTR;
+typedef void*           HMODULE;
+typedef void*           HANDLE;
+typedef void*           HWND;
+typedef void*           LPVOID;
+typedef const char*     LPCSTR;
+typedef const wchar_t*  LPCWSTR;
+typedef INT_PTR         (*FARPROC)();
+
+#define S_OK                            ((HRESULT)0)
+#define S_FALSE                         ((HRESULT)1)
+#define E_NOINTERFACE                   ((HRESULT)0x80004002)
+#define E_FAIL                          ((HRESULT)0x80004005)
+#define E_OUTOFMEMORY                   ((HRESULT)0x8007000E)
+#define E_INVALIDARG                    ((HRESULT)0x80070057)
+#define FAILED(hr)                      (((HRESULT)(hr)) < 0)
+#define SUCCEEDED(hr)                   (((HRESULT)(hr)) >= 0)
+#define TRUE                            1
+#define FALSE                           0
+
+#define FORMAT_MESSAGE_FROM_SYSTEM      0x00001000
+#define LANG_NEUTRAL                    0x00
+#define SUBLANG_DEFAULT                 0x01
+#define MAKELANGID(p, s)                ((((WORD)(s)) << 10) | (WORD)(p))
+#define MAKEFOURCC(a, b, c, d)          ((DWORD)(BYTE)(a) | ((DWORD)(BYTE)(b) << 8) | ((DWORD)(BYTE)(c) << 16) | ((DWORD)(BYTE)(d) << 24))
+
+typedef struct _GUID
+{
+    uint32_t    Data1;
+    uint16_t    Data2;
+    uint16_t    Data3;
+    uint8_t     Data4[8];
+} GUID;
+typedef GUID IID;
+
+#define REFGUID const GUID&
+#define REFIID  const IID&
+
+#define DEFINE_GUID(name, l, w1, w2, b1, b2, b3, b4, b5, b6, b7, b8) \
+    static const GUID name = { l, w1, w2, { b1, b2, b3, b4, b5, b6, b7, b8 } }
+
+inline bool operator==(REFGUID a, REFGUID b) { return memcmp(&a, &b, sizeof(GUID)) == 0; }
+inline bool operator!=(REFGUID a, REFGUID b) { return !(a == b); }
+
+// The shim interfaces carry no uuid attributes, so every interface type gets a
+// distinct identifier the first time it is queried. __uuidof accepts a type or
+// an expression, as it does with MSVC.
+inline uint32_t ffxMockNextInterfaceId()
+{
+    static uint32_t nextId = 0;
+    return ++nextId;
+}
+
+template<typename T>
+inline const GUID& ffxMockInterfaceId()
+{
+    static const GUID id = { ffxMockNextInterfaceId(), 0, 0, { 0 } };
+    return id;
+}
+
+#define __uuidof(x)         ffxMockInterfaceId<typename std::remove_cv<typename std::remove_pointer<typename std::remove_reference<__typeof__(x)>::type>::type>::type>()
+#define IID_PPV_ARGS(pp)    __uuidof(**(pp)), reinterpret_cast<void**>(pp)
+
+struct IUnknown
+{
+    virtual HRESULT QueryInterface(REFIID riid, void** ppvObject) = 0;
+    virtual UINT AddRef() = 0;
+    virtual UINT Release() = 0;
+
+    template<typename Q>
+    HRESULT QueryInterface(Q** pp) { return QueryInterface(__uuidof(Q), reinterpret_cast<void**>(pp)); }
+};
+
+inline DWORD FormatMessageW(DWORD, const void*, DWORD, DWORD, wchar_t* buffer, DWORD size, void*)
+{
+    if (buffer && size)
+        buffer[0] = L'\0';
+    return 0;
+}
+
+inline int wcstombs_s(size_t* converted, char* dst, size_t dstSize, const wchar_t* src, size_t count)
+{
+    const size_t length = wcstombs(dst, src, count < dstSize ? count : dstSize - 1);
+    if (length == (size_t)-1)
+    {
+        dst[0] = '\0';
+        return -1;
+    }
+    dst[length] = '\0';
+    if (converted)
+        *converted = length + 1;
+    return 0;
+}
+
+inline int _wfopen_s(FILE** file, const wchar_t* path, const wchar_t* mode)
+{
+    char narrowPath[1024];
+    char narrowMode[8];
+    if (wcstombs_s(nullptr, narrowPath, sizeof(narrowPath), path, sizeof(narrowPath) - 1) != 0 ||
+        wcstombs_s(nullptr, narrowMode, sizeof(narrowMode), mode, sizeof(narrowMode) - 1) != 0)
+    {
+        *file = nullptr;
+        return -1;
+    }
+    *file = fopen(narrowPath, narrowMode);
+    return *file ? 0 : -1;
+}
@@ -21,8 +21,119 @@
 // THE SOFTWARE.
 
 #include <FidelityFX/host/ffx_interface.h>
+#include <FidelityFX/host/ffx_task.h>
 #include "ffx_object_management.h"
 
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+static std::atomic<uint64_t> s_createdPipelineCount;
+static std::atomic<uint64_t> s_deferredPipelineCount;
+static std::atomic<uint64_t> s_lazyCreatedPipelineCount;
+static std::atomic<uint64_t> s_pipelineCreationTime;
+
+struct CreatePipelineTaskData
+{
+    FfxInterface*           backendInterface;
+    FfxEffect               effect;
+    FfxUInt32               effectContextId;
+    FfxCreatePipelineTask*  task;
+};
+
+static void createPipelineTask(void* taskData)
+{
+    CreatePipelineTaskData* data = static_cast<CreatePipelineTaskData*>(taskData);
+    FfxCreatePipelineTask* task = data->task;
+    task->errorCode = data->backendInterface->fpCreatePipeline(data->backendInterface, data->effect, task->pass, task->permutationOptions, &task->description, data->effectContextId, task->pipeline);
+}
+
+// the pipelines of a batch are independent, so they are created on as many threads as the task scheduler allows
+FfxErrorCode ffxCreatePipelines(FfxInterface* backendInterface, FfxEffect effect, FfxUInt32 effectContextId, FfxCreatePipelineTask* tasks, uint32_t taskCount)
+{
+    FFX_ASSERT(backendInterface->fpCreatePipeline);
+
+    std::vector<CreatePipelineTaskData> taskData(taskCount);
+    for (uint32_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+        taskData[taskIndex] = { backendInterface, effect, effectContextId, &tasks[taskIndex] };
+
+    const auto creationStart = std::chrono::steady_clock::now();
+    ffxRunTasks(createPipelineTask, taskData.data(), sizeof(CreatePipelineTaskData), taskCount);
+    s_pipelineCreationTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - creationStart).count();
+
+    FfxErrorCode errorCode = FFX_OK;
+    for (uint32_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+    {
+        if (tasks[taskIndex].errorCode == FFX_OK)
+            s_createdPipelineCount++;
+        else if (errorCode == FFX_OK)
+            errorCode = tasks[taskIndex].errorCode;
+    }
+    return errorCode;
+}
+
+void ffxDeferPipeline(FfxDeferredPipeline* deferredPipeline, FfxPass pass, uint32_t permutationOptions, const FfxPipelineDescription* pipelineDescription, FfxPipelineState* outPipeline)
+{
+    FFX_ASSERT(deferredPipeline);
+    FFX_ASSERT(pipelineDescription);
+    FFX_ASSERT(pipelineDescription->samplerCount <= FFX_DEFERRED_PIPELINE_MAX_SAMPLERS);
+    FFX_ASSERT(pipelineDescription->rootConstantBufferCount <= FFX_DEFERRED_PIPELINE_MAX_ROOT_CONSTANTS);
+
+    deferredPipeline->task = { pass, permutationOptions, *pipelineDescription, outPipeline, FFX_OK };
+    for (size_t samplerIndex = 0; samplerIndex < pipelineDescription->samplerCount; ++samplerIndex)
+        deferredPipeline->samplers[samplerIndex] = pipelineDescription->samplers[samplerIndex];
+    for (uint32_t constantIndex = 0; constantIndex < pipelineDescription->rootConstantBufferCount; ++constantIndex)
+        deferredPipeline->rootConstants[constantIndex] = pipelineDescription->rootConstants[constantIndex];
+    deferredPipeline->task.description.samplers = pipelineDescription->samplerCount ? deferredPipeline->samplers : nullptr;
+    deferredPipeline->task.description.rootConstants = pipelineDescription->rootConstantBufferCount ? deferredPipeline->rootConstants : nullptr;
+    deferredPipeline->pending = true;
+    s_deferredPipelineCount++;
+}
+
+// create every still pending pipeline of the list as one batch, a failed pipeline stays pending so the next use retries it
+FfxErrorCode ffxResolveDeferredPipelines(FfxInterface* backendInterface, FfxEffect effect, FfxUInt32 effectContextId, FfxDeferredPipeline* const* deferredPipelines, uint32_t deferredPipelineCount, FfxPatchPipelineFunc patchPipeline)
+{
+    FfxCreatePipelineTask tasks[16];
+    FfxDeferredPipeline* pendingPipelines[16];
+    uint32_t taskCount = 0;
+
+    for (uint32_t pipelineIndex = 0; pipelineIndex < deferredPipelineCount; ++pipelineIndex)
+    {
+        FfxDeferredPipeline* deferredPipeline = deferredPipelines[pipelineIndex];
+        if (!deferredPipeline->pending)
+            continue;
+
+        FFX_ASSERT(taskCount < sizeof(tasks) / sizeof(tasks[0]));
+        tasks[taskCount] = deferredPipeline->task;
+        pendingPipelines[taskCount++] = deferredPipeline;
+    }
+    if (taskCount == 0)
+        return FFX_OK;
+
+    FfxErrorCode errorCode = ffxCreatePipelines(backendInterface, effect, effectContextId, tasks, taskCount);
+    for (uint32_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+    {
+        if (tasks[taskIndex].errorCode != FFX_OK)
+            continue;
+
+        if (patchPipeline)
+            patchPipeline(tasks[taskIndex].pipeline);
+        pendingPipelines[taskIndex]->pending = false;
+        s_lazyCreatedPipelineCount++;
+    }
+    return errorCode;
+}
+
+void ffxGetPipelineCreationStats(FfxPipelineCreationStats* stats)
+{
+    FFX_ASSERT(stats);
+
+    stats->createdPipelineCount = s_createdPipelineCount;
+    stats->deferredPipelineCount = s_deferredPipelineCount;
+    stats->lazyCreatedPipelineCount = s_lazyCreatedPipelineCount;
+    stats->creationTime = s_pipelineCreationTime;
+}
+
 void ffxSafeReleasePipeline(FfxInterface* backendInterface, FfxPipelineState* pipeline, FfxUInt32 effectContextId)
 {
     FFX_ASSERT(pipeline);
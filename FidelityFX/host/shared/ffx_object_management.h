@@ -29,6 +29,44 @@
 extern "C" {
 #endif  // #if defined(__cplusplus)
 
+// one pipeline of a batch handed to ffxCreatePipelines, errorCode receives the result of its creation
+typedef struct FfxCreatePipelineTask
+{
+    FfxPass                 pass;
+    uint32_t                permutationOptions;
+    FfxPipelineDescription  description;
+    FfxPipelineState*       pipeline;
+    FfxErrorCode            errorCode;
+} FfxCreatePipelineTask;
+
+#define FFX_DEFERRED_PIPELINE_MAX_SAMPLERS          4
+#define FFX_DEFERRED_PIPELINE_MAX_ROOT_CONSTANTS    4
+
+// a pipeline recorded at context creation and only created by the first dispatch that uses it,
+// it keeps its own copy of the sampler and root constant descriptions the task points to
+typedef struct FfxDeferredPipeline
+{
+    FfxCreatePipelineTask       task;
+    FfxSamplerDescription       samplers[FFX_DEFERRED_PIPELINE_MAX_SAMPLERS];
+    FfxRootConstantDescription  rootConstants[FFX_DEFERRED_PIPELINE_MAX_ROOT_CONSTANTS];
+    bool                        pending;
+} FfxDeferredPipeline;
+
+// process wide pipeline creation counters, creationTime is in microseconds
+typedef struct FfxPipelineCreationStats
+{
+    uint64_t                createdPipelineCount;
+    uint64_t                deferredPipelineCount;
+    uint64_t                lazyCreatedPipelineCount;
+    uint64_t                creationTime;
+} FfxPipelineCreationStats;
+
+typedef FfxErrorCode (*FfxPatchPipelineFunc)(FfxPipelineState* pipeline);
+
+FFX_API FfxErrorCode ffxCreatePipelines(FfxInterface* backendInterface, FfxEffect effect, FfxUInt32 effectContextId, FfxCreatePipelineTask* tasks, uint32_t taskCount);
+FFX_API void ffxDeferPipeline(FfxDeferredPipeline* deferredPipeline, FfxPass pass, uint32_t permutationOptions, const FfxPipelineDescription* pipelineDescription, FfxPipelineState* outPipeline);
+FFX_API FfxErrorCode ffxResolveDeferredPipelines(FfxInterface* backendInterface, FfxEffect effect, FfxUInt32 effectContextId, FfxDeferredPipeline* const* deferredPipelines, uint32_t deferredPipelineCount, FfxPatchPipelineFunc patchPipeline);
+FFX_API void ffxGetPipelineCreationStats(FfxPipelineCreationStats* stats);
 FFX_API void ffxSafeReleasePipeline(FfxInterface* backendInterface, FfxPipelineState* pipeline, FfxUInt32 effectContextId);
 FFX_API void ffxSafeReleaseCopyResource(FfxInterface* backendInterface, FfxResourceInternal resource, FfxUInt32 effectContextId);
 FFX_API void ffxSafeReleaseResource(FfxInterface* backendInterface, FfxResourceInternal resource, FfxUInt32 effectContextId);
@@ -0,0 +1,224 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <FidelityFX/host/ffx_task.h>
+#include <FidelityFX/host/ffx_assert.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// shared with the helpers, a helper that starts after the batch finished only drops its reference
+struct TaskBatch
+{
+    FfxTaskFunc             task;
+    uint8_t*                taskData;
+    size_t                  taskDataStride;
+    uint32_t                taskCount;
+    std::atomic<uint32_t>   nextTask;
+
+    std::mutex              mutex;
+    std::condition_variable finished;
+    uint32_t                finishedTaskCount;
+};
+
+struct TaskWorker
+{
+    std::thread             thread;
+    bool                    exit;
+};
+
+// the settings and the threads owned by the SDK, guarded by one mutex. The workers are created on first use,
+// grow up to the thread count of the largest batch and are only retired by ffxSetTaskScheduler. The pool is
+// never destroyed so that no thread is joined from a static destructor
+struct TaskPool
+{
+    std::mutex                                  mutex;
+    std::condition_variable                     wake;
+    std::deque<std::shared_ptr<TaskBatch>>      queue;
+    std::vector<std::unique_ptr<TaskWorker>>    workers;
+
+    FfxScheduleTaskFunc                         scheduler = nullptr;
+    void*                                       schedulerUserData = nullptr;
+    uint32_t                                    threadCount = 1;
+};
+
+static TaskPool& taskPool()
+{
+    static TaskPool* pool = new TaskPool();
+    return *pool;
+}
+
+static void runTaskBatch(TaskBatch* batch)
+{
+    uint32_t finishedTaskCount = 0;
+    for (uint32_t taskIndex = batch->nextTask++; taskIndex < batch->taskCount; taskIndex = batch->nextTask++)
+    {
+        batch->task(batch->taskData + taskIndex * batch->taskDataStride);
+        finishedTaskCount++;
+    }
+
+    if (finishedTaskCount)
+    {
+        std::lock_guard<std::mutex> lock{ batch->mutex };
+        batch->finishedTaskCount += finishedTaskCount;
+        if (batch->finishedTaskCount == batch->taskCount)
+            batch->finished.notify_all();
+    }
+}
+
+static void runTaskBatchHelper(void* taskData)
+{
+    std::shared_ptr<TaskBatch>* batch = static_cast<std::shared_ptr<TaskBatch>*>(taskData);
+    runTaskBatch(batch->get());
+    delete batch;
+}
+
+static void runTaskWorker(TaskPool* pool, TaskWorker* worker)
+{
+    std::unique_lock<std::mutex> lock{ pool->mutex };
+    for (;;)
+    {
+        pool->wake.wait(lock, [pool, worker] { return worker->exit || !pool->queue.empty(); });
+        if (worker->exit)
+            return;
+
+        std::shared_ptr<TaskBatch> batch = std::move(pool->queue.front());
+        pool->queue.pop_front();
+
+        lock.unlock();
+        runTaskBatch(batch.get());
+        batch.reset();
+        lock.lock();
+    }
+}
+
+void ffxSetTaskScheduler(FfxScheduleTaskFunc scheduler, void* userData, uint32_t maxThreadCount)
+{
+    TaskPool& pool = taskPool();
+
+    std::vector<std::unique_ptr<TaskWorker>> retiredWorkers;
+    {
+        std::lock_guard<std::mutex> lock{ pool.mutex };
+        pool.scheduler = scheduler;
+        pool.schedulerUserData = userData;
+        pool.threadCount = maxThreadCount;
+
+        // batches still running finish on their calling threads
+        retiredWorkers.swap(pool.workers);
+        for (std::unique_ptr<TaskWorker>& worker : retiredWorkers)
+            worker->exit = true;
+    }
+    pool.wake.notify_all();
+
+    for (std::unique_ptr<TaskWorker>& worker : retiredWorkers)
+        worker->thread.join();
+}
+
+void ffxRunTasks(FfxTaskFunc task, void* taskData, size_t taskDataStride, uint32_t taskCount)
+{
+    FFX_ASSERT(task);
+
+    TaskPool& pool = taskPool();
+
+    FfxScheduleTaskFunc scheduler;
+    void* schedulerUserData;
+    uint32_t threadCount;
+    {
+        std::lock_guard<std::mutex> lock{ pool.mutex };
+        scheduler = pool.scheduler;
+        schedulerUserData = pool.schedulerUserData;
+        threadCount = pool.threadCount;
+    }
+
+    if (!threadCount)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    uint32_t helperCount = std::min(threadCount, taskCount);
+    if (helperCount <= 1)
+    {
+        for (uint32_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+            task(static_cast<uint8_t*>(taskData) + taskIndex * taskDataStride);
+        return;
+    }
+    helperCount--;
+
+    std::shared_ptr<TaskBatch> batch = std::make_shared<TaskBatch>();
+    batch->task = task;
+    batch->taskData = static_cast<uint8_t*>(taskData);
+    batch->taskDataStride = taskDataStride;
+    batch->taskCount = taskCount;
+    batch->nextTask = 0;
+    batch->finishedTaskCount = 0;
+
+    if (scheduler)
+    {
+        for (uint32_t helperIndex = 0; helperIndex < helperCount; ++helperIndex)
+            scheduler(runTaskBatchHelper, new std::shared_ptr<TaskBatch>(batch), schedulerUserData);
+    }
+    else
+    {
+        {
+            std::lock_guard<std::mutex> lock{ pool.mutex };
+            for (uint32_t helperIndex = 0; helperIndex < helperCount; ++helperIndex)
+                pool.queue.push_back(batch);
+
+            // the calling thread picks up whatever the missing workers would have done
+            try
+            {
+                pool.workers.reserve(helperCount);
+                while (pool.workers.size() < helperCount)
+                {
+                    std::unique_ptr<TaskWorker> worker{ new TaskWorker() };
+                    worker->exit = false;
+                    worker->thread = std::thread(runTaskWorker, &pool, worker.get());
+                    pool.workers.push_back(std::move(worker));
+                }
+            }
+            catch (...)
+            {
+            }
+        }
+        if (helperCount == 1)
+            pool.wake.notify_one();
+        else
+            pool.wake.notify_all();
+    }
+
+    runTaskBatch(batch.get());
+
+    {
+        std::unique_lock<std::mutex> lock{ batch->mutex };
+        batch->finished.wait(lock, [&batch] { return batch->finishedTaskCount == batch->taskCount; });
+    }
+
+    // drop the references no worker got to, so the queue only holds batches that still have work
+    if (!scheduler)
+    {
+        std::lock_guard<std::mutex> lock{ pool.mutex };
+        pool.queue.erase(std::remove(pool.queue.begin(), pool.queue.end(), batch), pool.queue.end());
+    }
+}
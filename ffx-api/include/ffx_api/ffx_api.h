@@ -59,6 +59,10 @@ typedef ffxApiHeader ffxConfigureDescHeader;
 typedef ffxApiHeader ffxQueryDescHeader;
 typedef ffxApiHeader ffxDispatchDescHeader;
 
+// Builds of the library with FFXAPI_VALIDATION defined check the descriptor chains passed to the providers
+// and report problems as warnings. Set the environment variable FFX_API_VALIDATION to 0 before the library
+// makes its first call to turn these checks off for the whole process.
+
 // Extensions for global debug
 #define FFX_API_CONFIGURE_GLOBALDEBUG_LEVEL_SILENCE  0x0000000u
 #define FFX_API_CONFIGURE_GLOBALDEBUG_LEVEL_ERRORS   0x0000001u
@@ -96,75 +96,93 @@ ffxReturnCode_t CreateBackend(const ffxCreateContextDescHeader *desc, bool& back
     return FFX_API_RETURN_OK;
 }
 
-void* GetDevice(const ffxApiHeader* desc)
+// looks at a single structure; true if it names the device, which is returned in outDevice
+static bool GetDevice(const ffxApiHeader* desc, void*& outDevice)
 {
-    for (const auto* it = desc; it; it = it->pNext)
+    switch (desc->type)
     {
-        switch (it->type)
-        {
-        case FFX_API_QUERY_DESC_TYPE_GET_VERSIONS:
-        {
-            return reinterpret_cast<const ffxQueryDescGetVersions*>(it)->device;
-        }
+    case FFX_API_QUERY_DESC_TYPE_GET_VERSIONS:
+    {
+        outDevice = reinterpret_cast<const ffxQueryDescGetVersions*>(desc)->device;
+        return true;
+    }
 #ifdef FFX_BACKEND_DX11
-        case FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX11:
-        {
-            return reinterpret_cast<const ffxCreateBackendDX11Desc*>(it)->device;
-        }
-        case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_FOR_HWND_DX11:
-        {
-            ID3D11Device* device = nullptr;
-            reinterpret_cast<const ffxCreateContextDescFrameGenerationSwapChainForHwndDX11*>(it)->gameQueue->GetDevice(&device);
-            device->Release();
-            return device;
-        }
-        case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_NEW_DX11:
-        {
-            ID3D11Device* device = nullptr;
-            reinterpret_cast<const ffxCreateContextDescFrameGenerationSwapChainNewDX11*>(it)->gameQueue->GetDevice(&device);
-            device->Release();
-            return device;
-        }
-        case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_WRAP_DX11:
-        {
-            ID3D11Device* device = nullptr;
-            reinterpret_cast<const ffxCreateContextDescFrameGenerationSwapChainWrapDX11*>(it)->gameQueue->GetDevice(&device);
-            device->Release();
-            return device;
-        }
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX11:
+    {
+        outDevice = reinterpret_cast<const ffxCreateBackendDX11Desc*>(desc)->device;
+        return true;
+    }
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_FOR_HWND_DX11:
+    {
+        ID3D11Device* device = nullptr;
+        reinterpret_cast<const ffxCreateContextDescFrameGenerationSwapChainForHwndDX11*>(desc)->gameQueue->GetDevice(&device);
+        device->Release();
+        outDevice = device;
+        return true;
+    }
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_NEW_DX11:
+    {
+        ID3D11Device* device = nullptr;
+        reinterpret_cast<const ffxCreateContextDescFrameGenerationSwapChainNewDX11*>(desc)->gameQueue->GetDevice(&device);
+        device->Release();
+        outDevice = device;
+        return true;
+    }
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_WRAP_DX11:
+    {
+        ID3D11Device* device = nullptr;
+        reinterpret_cast<const ffxCreateContextDescFrameGenerationSwapChainWrapDX11*>(desc)->gameQueue->GetDevice(&device);
+        device->Release();
+        outDevice = device;
+        return true;
+    }
 #elif FFX_BACKEND_DX12
-        case FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX12:
-        {
-            return reinterpret_cast<const ffxCreateBackendDX12Desc*>(it)->device;
-        }
-        case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_FOR_HWND_DX12:
-        {
-            ID3D12Device* device = nullptr;
-            reinterpret_cast<const ffxCreateContextDescFrameGenerationSwapChainForHwndDX12*>(it)->gameQueue->GetDevice(IID_PPV_ARGS(&device));
-            device->Release();
-            return device;
-        }
-        case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_NEW_DX12:
-        {
-            ID3D12Device* device = nullptr;
-            reinterpret_cast<const ffxCreateContextDescFrameGenerationSwapChainNewDX12*>(it)->gameQueue->GetDevice(IID_PPV_ARGS(&device));
-            device->Release();
-            return device;
-        }
-        case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_WRAP_DX12:
-        {
-            ID3D12Device* device = nullptr;
-            reinterpret_cast<const ffxCreateContextDescFrameGenerationSwapChainWrapDX12*>(it)->gameQueue->GetDevice(IID_PPV_ARGS(&device));
-            device->Release();
-            return device;
-        }
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX12:
+    {
+        outDevice = reinterpret_cast<const ffxCreateBackendDX12Desc*>(desc)->device;
+        return true;
+    }
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_FOR_HWND_DX12:
+    {
+        ID3D12Device* device = nullptr;
+        reinterpret_cast<const ffxCreateContextDescFrameGenerationSwapChainForHwndDX12*>(desc)->gameQueue->GetDevice(IID_PPV_ARGS(&device));
+        device->Release();
+        outDevice = device;
+        return true;
+    }
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_NEW_DX12:
+    {
+        ID3D12Device* device = nullptr;
+        reinterpret_cast<const ffxCreateContextDescFrameGenerationSwapChainNewDX12*>(desc)->gameQueue->GetDevice(IID_PPV_ARGS(&device));
+        device->Release();
+        outDevice = device;
+        return true;
+    }
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_WRAP_DX12:
+    {
+        ID3D12Device* device = nullptr;
+        reinterpret_cast<const ffxCreateContextDescFrameGenerationSwapChainWrapDX12*>(desc)->gameQueue->GetDevice(IID_PPV_ARGS(&device));
+        device->Release();
+        outDevice = device;
+        return true;
+    }
 #elif FFX_BACKEND_VK
-        case FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_VK:
-        {
-            return nullptr; // no idea what to return for now.
-        }
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_VK:
+    {
+        outDevice = nullptr; // no idea what to return for now.
+        return true;
+    }
 #endif
-        }
     }
-    return nullptr;
+    return false;
+}
+
+void IndexDescChain(const ffxApiHeader* desc, DescIndex& index)
+{
+    bool deviceFound = false;
+    for (auto it = desc; it; it = it->pNext)
+    {
+        if (!IndexDesc(it, index) && !deviceFound)
+            deviceFound = GetDevice(it, index.device);
+    }
 }
@@ -23,7 +23,7 @@
 #pragma once
 #include "ffx_provider.h"
 #include <ffx_api/ffx_api.hpp>
-#include <FidelityFx/host/ffx_interface.h>
+#include <FidelityFX/host/ffx_interface.h>
 
 ffxReturnCode_t CreateBackend(const ffxCreateContextDescHeader* desc, bool& backendFound, FfxInterface* iface, size_t contexts, Allocator& alloc);
 
@@ -35,4 +35,6 @@ inline ffxReturnCode_t MustCreateBackend(const ffxCreateContextDescHeader* desc,
     return FFX_API_RETURN_OK;
 }
 
-void* GetDevice(const ffxApiHeader* desc);
+// fills the index and its device with one walk over the chain, from the descriptor itself, for the calls that
+// select a provider. The walk lives next to the device lookup so that the check of each structure is inlined into it.
+void IndexDescChain(const ffxApiHeader* desc, DescIndex& index);
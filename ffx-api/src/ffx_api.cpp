@@ -26,16 +26,10 @@
 #include "ffx_provider.h"
 #include "backends.h"
 
-static uint64_t GetVersionOverride(const ffxApiHeader* header)
+// version override and device come from the index built when the call came in
+static const ffxProvider* SelectProvider(const ffxApiHeader* header, const DescIndex& index)
 {
-    for (auto it = header; it; it = it->pNext)
-    {
-        if (auto versionDesc = ffx::DynamicCast<ffxOverrideVersion>(it))
-        {
-            return versionDesc->versionId;
-        }
-    }
-    return 0;
+    return GetffxProvider(header->type, index.overrideVersion ? index.overrideVersion->versionId : 0, index.device);
 }
 
 FFX_API_ENTRY ffxReturnCode_t ffxCreateContext(ffxContext* context, ffxCreateContextDescHeader* desc, const ffxAllocationCallbacks* memCb)
@@ -45,11 +39,13 @@ FFX_API_ENTRY ffxReturnCode_t ffxCreateContext(ffxContext* context, ffxCreateCon
 
     *context = nullptr;
 
-    const ffxProvider* provider = GetffxProvider(desc->type, GetVersionOverride(desc), GetDevice(desc));
+    DescIndex index;
+    IndexDescChain(desc, index);
+    const ffxProvider* provider = SelectProvider(desc, index);
     VERIFY(provider != nullptr, FFX_API_RETURN_NO_PROVIDER);
     
     Allocator alloc{memCb};
-    return provider->CreateContext(context, desc, alloc);
+    return provider->CreateContext(context, desc, index, alloc);
 }
 
 FFX_API_ENTRY ffxReturnCode_t ffxDestroyContext(ffxContext* context, const ffxAllocationCallbacks* memCb)
@@ -65,13 +61,16 @@ FFX_API_ENTRY ffxReturnCode_t ffxConfigure(ffxContext* context, const ffxConfigu
     VERIFY(desc != nullptr, FFX_API_RETURN_ERROR_PARAMETER);
     VERIFY(context != nullptr, FFX_API_RETURN_ERROR_PARAMETER);
 
-    return GetAssociatedProvider(context)->Configure(context, desc);
+    DescIndex index;
+    IndexDescExtensions(desc, index);
+    return GetAssociatedProvider(context)->Configure(context, desc, index);
 }
 
 FFX_API_ENTRY ffxReturnCode_t ffxQuery(ffxContext* context, ffxQueryDescHeader* header)
 {
     VERIFY(header != nullptr, FFX_API_RETURN_ERROR_PARAMETER);
 
+    DescIndex index;
     if (context == nullptr)
     {
         if (auto desc = ffx::DynamicCast<ffxQueryDescGetVersions>(header))
@@ -88,9 +87,11 @@ FFX_API_ENTRY ffxReturnCode_t ffxQuery(ffxContext* context, ffxQueryDescHeader*
             }
             return FFX_API_RETURN_OK;
         }
-        else if (auto provider = GetffxProvider(header->type, GetVersionOverride(header), GetDevice(header)))
+
+        IndexDescChain(header, index);
+        if (auto provider = SelectProvider(header, index))
         {
-            return provider->Query(nullptr, header);
+            return provider->Query(nullptr, header, index);
         }
         else
         {
@@ -98,7 +99,8 @@ FFX_API_ENTRY ffxReturnCode_t ffxQuery(ffxContext* context, ffxQueryDescHeader*
         }
     }
 
-    return GetAssociatedProvider(context)->Query(context, header);
+    IndexDescExtensions(header, index);
+    return GetAssociatedProvider(context)->Query(context, header, index);
 }
 
 FFX_API_ENTRY ffxReturnCode_t ffxDispatch(ffxContext* context, const ffxDispatchDescHeader* desc)
@@ -106,5 +108,7 @@ FFX_API_ENTRY ffxReturnCode_t ffxDispatch(ffxContext* context, const ffxDispatch
     VERIFY(desc != nullptr, FFX_API_RETURN_ERROR_PARAMETER);
     VERIFY(context != nullptr, FFX_API_RETURN_ERROR_PARAMETER);
 
-    return GetAssociatedProvider(context)->Dispatch(context, desc);
+    DescIndex index;
+    IndexDescExtensions(desc, index);
+    return GetAssociatedProvider(context)->Dispatch(context, desc, index);
 }
@@ -28,6 +28,8 @@
 #include "ffx_provider_external.h"
 
 #include <array>
+#include <atomic>
+#include <mutex>
 #include <optional>
 
 #include <d3d12.h>
@@ -55,6 +57,69 @@ static constexpr size_t providerCount = _countof(providers);
 
 static std::array<std::optional<ffxProviderExternal>, 10> externalProviders = {};
 
+// providers already resolved for a descriptor type, version override and device. A hit skips the driver query
+// and the walk over both provider lists. Driver-side providers are found through the device, so each device gets
+// its own entries. The table is emptied whenever the set of external providers changes and its slots are reused.
+// Lookups do not take the mutex: the sequence number of an entry is odd while it is written, and an entry is only
+// trusted when its number was even and did not change while it was read.
+struct ProviderLookup
+{
+    std::atomic<uint32_t>           sequence;
+    std::atomic<ffxStructType_t>    descType;
+    std::atomic<uint64_t>           overrideId;
+    std::atomic<void*>              device;
+    std::atomic<const ffxProvider*> provider;
+};
+static std::array<ProviderLookup, 32> providerLookups;
+static std::atomic<size_t> providerLookupCount{0};
+static std::mutex providerLookupMutex;
+
+static const ffxProvider* FindProviderLookup(ffxStructType_t descType, uint64_t overrideId, void* device)
+{
+    const size_t count = providerLookupCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const ProviderLookup& lookup = providerLookups[i];
+        const uint32_t sequence = lookup.sequence.load(std::memory_order_acquire);
+        if (sequence & 1)
+            continue;
+
+        const bool match = lookup.descType.load(std::memory_order_relaxed) == descType &&
+                           lookup.overrideId.load(std::memory_order_relaxed) == overrideId &&
+                           lookup.device.load(std::memory_order_relaxed) == device;
+        const ffxProvider* provider = lookup.provider.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (match && lookup.sequence.load(std::memory_order_relaxed) == sequence)
+            return provider;
+    }
+    return nullptr;
+}
+
+// called with providerLookupMutex held
+static void AddProviderLookup(ffxStructType_t descType, uint64_t overrideId, void* device, const ffxProvider* provider)
+{
+    const size_t count = providerLookupCount.load(std::memory_order_relaxed);
+    if (count >= providerLookups.size())
+        return;
+
+    ProviderLookup& lookup = providerLookups[count];
+    const uint32_t sequence = lookup.sequence.load(std::memory_order_relaxed);
+    lookup.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    lookup.descType.store(descType, std::memory_order_relaxed);
+    lookup.overrideId.store(overrideId, std::memory_order_relaxed);
+    lookup.device.store(device, std::memory_order_relaxed);
+    lookup.provider.store(provider, std::memory_order_relaxed);
+    lookup.sequence.store(sequence + 2, std::memory_order_release);
+    providerLookupCount.store(count + 1, std::memory_order_release);
+}
+
+// called with providerLookupMutex held
+static void FlushProviderLookups()
+{
+    providerLookupCount.store(0, std::memory_order_release);
+}
+
 MIDL_INTERFACE("b58d6601-7401-4234-8180-6febfc0e484c")
 IAmdExtFfxApi : public IUnknown
 {
@@ -71,8 +136,10 @@ struct ExternalProviderData
 };
 #define FFX_EXTERNAL_PROVIDER_STRUCT_VERSION 1u
 
-void GetExternalProviders(ID3D12Device* device, uint64_t descType)
+// returns true when the driver extension was opened or a new external provider was added
+bool GetExternalProviders(ID3D12Device* device, uint64_t descType)
 {
+    bool changed = false;
 #ifdef FFX_BACKEND_DX12
     static IAmdExtFfxApi* apiExtension = nullptr;
 
@@ -99,6 +166,7 @@ void GetExternalProviders(ID3D12Device* device, uint64_t descType)
                             apiExtension->Release();
                         apiExtension = nullptr;
                     }
+                    changed = apiExtension != nullptr;
                 }
             }
         }
@@ -111,7 +179,7 @@ void GetExternalProviders(ID3D12Device* device, uint64_t descType)
         data.descType = descType;
         HRESULT hr = apiExtension->UpdateFfxApiProvider(&data, sizeof(data));
         if (hr != S_OK)
-            return;
+            return changed;
 
         for (auto& slot : externalProviders)
         {
@@ -125,18 +193,17 @@ void GetExternalProviders(ID3D12Device* device, uint64_t descType)
                 // first free slot. slots are filled start to end and never released.
                 // we do not have this provider yet, add it to the list.
                 slot = ffxProviderExternal{data.provider};
+                changed = true;
                 break;
             }
         }
     }
 #endif
+    return changed;
 }
 
-const ffxProvider* GetffxProvider(ffxStructType_t descType, uint64_t overrideId, void* device)
+static const ffxProvider* FindProvider(ffxStructType_t descType, uint64_t overrideId)
 {
-    // check driver-side providers
-    GetExternalProviders(reinterpret_cast<ID3D12Device*>(device), descType);
-
     for (const auto& provider : externalProviders)
     {
         if (provider.has_value())
@@ -155,6 +222,31 @@ const ffxProvider* GetffxProvider(ffxStructType_t descType, uint64_t overrideId,
     return nullptr;
 }
 
+const ffxProvider* GetffxProvider(ffxStructType_t descType, uint64_t overrideId, void* device)
+{
+    if (const ffxProvider* provider = FindProviderLookup(descType, overrideId, device))
+        return provider;
+
+    std::lock_guard<std::mutex> lock(providerLookupMutex);
+
+    // another thread may have resolved the same type meanwhile
+    if (const ffxProvider* provider = FindProviderLookup(descType, overrideId, device))
+        return provider;
+
+    // check driver-side providers
+    if (GetExternalProviders(reinterpret_cast<ID3D12Device*>(device), descType))
+        FlushProviderLookups();
+
+    const ffxProvider* provider = FindProvider(descType, overrideId);
+
+    // unknown types are not remembered, the table is meant for the handful of types an application uses.
+    // Once it is full, further types are looked up every time until the next flush.
+    if (provider)
+        AddProviderLookup(descType, overrideId, device, provider);
+
+    return provider;
+}
+
 const ffxProvider* GetAssociatedProvider(ffxContext* context)
 {
     const InternalContextHeader* hdr = (const InternalContextHeader*)(*context);
@@ -172,7 +264,11 @@ uint64_t GetProviderVersions(ffxStructType_t descType, void* device, uint64_t ca
     uint64_t count = 0;
 
     // check driver-side providers
-    GetExternalProviders(reinterpret_cast<ID3D12Device*>(device), descType);
+    {
+        std::lock_guard<std::mutex> lock(providerLookupMutex);
+        if (GetExternalProviders(reinterpret_cast<ID3D12Device*>(device), descType))
+            FlushProviderLookups();
+    }
 
     for (const auto& provider : externalProviders)
     {
@@ -23,7 +23,8 @@
 #pragma once
 #include <ffx_api/ffx_api.hpp>
 #include <ffx_api/ffx_api_types.h>
-#include <FidelityFx/host/ffx_types.h>
+#include <ffx_api/ffx_framegeneration.h>
+#include <FidelityFX/host/ffx_types.h>
 
 #define VERIFY(_cond, _retcode) \
     if (!(_cond)) return _retcode
@@ -62,6 +63,48 @@ struct Allocator
     }
 };
 
+// The structures chained to a descriptor that the runtime and the providers look up, each in a fixed slot. The
+// index is built in one walk over the chain when it enters the API, so no provider walks the chain again.
+struct DescIndex
+{
+    const ffxOverrideVersion*                                             overrideVersion = nullptr; // first one in the chain
+    void*                                                                 device          = nullptr; // from the first structure naming it
+    const ffxCreateContextDescFrameGenerationHudless*                     hudless         = nullptr; // last one in the chain
+    const ffxConfigureDescFrameGenerationRegisterDistortionFieldResource* distortionField = nullptr; // last one naming a resource
+};
+
+// puts a structure in its slot; false if it has none
+inline bool IndexDesc(const ffxApiHeader* desc, DescIndex& index)
+{
+    switch (desc->type)
+    {
+    case FFX_API_DESC_TYPE_OVERRIDE_VERSION:
+        if (!index.overrideVersion)
+            index.overrideVersion = reinterpret_cast<const ffxOverrideVersion*>(desc);
+        return true;
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATION_HUDLESS:
+        index.hudless = reinterpret_cast<const ffxCreateContextDescFrameGenerationHudless*>(desc);
+        return true;
+    case FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATION_REGISTERDISTORTIONRESOURCE:
+    {
+        const auto* distortionField = reinterpret_cast<const ffxConfigureDescFrameGenerationRegisterDistortionFieldResource*>(desc);
+        if (distortionField->distortionField.resource)
+            index.distortionField = distortionField;
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+// indexes the extensions of a call that goes to its context's provider, which needs no device; inline so that a
+// descriptor without extensions costs one test
+inline void IndexDescExtensions(const ffxApiHeader* desc, DescIndex& index)
+{
+    for (auto it = desc->pNext; it; it = it->pNext)
+        IndexDesc(it, index);
+}
+
 class ffxProvider
 {
 public:
@@ -76,15 +119,15 @@ public:
 
     virtual const char* GetVersionName() const = 0;
 
-    virtual ffxReturnCode_t CreateContext(ffxContext* context, ffxCreateContextDescHeader* desc, Allocator& alloc) const = 0;
+    virtual ffxReturnCode_t CreateContext(ffxContext* context, ffxCreateContextDescHeader* desc, const DescIndex& index, Allocator& alloc) const = 0;
 
     virtual ffxReturnCode_t DestroyContext(ffxContext* context, Allocator& alloc) const = 0;
 
-    virtual ffxReturnCode_t Configure(ffxContext* context, const ffxConfigureDescHeader* desc) const = 0;
+    virtual ffxReturnCode_t Configure(ffxContext* context, const ffxConfigureDescHeader* desc, const DescIndex& index) const = 0;
 
-    virtual ffxReturnCode_t Query(ffxContext* context, ffxQueryDescHeader* desc) const = 0;
+    virtual ffxReturnCode_t Query(ffxContext* context, ffxQueryDescHeader* desc, const DescIndex& index) const = 0;
 
-    virtual ffxReturnCode_t Dispatch(ffxContext* context, const ffxDispatchDescHeader* desc) const = 0;
+    virtual ffxReturnCode_t Dispatch(ffxContext* context, const ffxDispatchDescHeader* desc, const DescIndex& index) const = 0;
 };
 
 const ffxProvider* GetffxProvider(ffxStructType_t descType, uint64_t overrideId, void* device);
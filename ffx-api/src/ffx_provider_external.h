@@ -65,7 +65,7 @@ public:
         return data.versionName;
     }
 
-    ffxReturnCode_t CreateContext(ffxContext* context, ffxCreateContextDescHeader* desc, Allocator& alloc) const override
+    ffxReturnCode_t CreateContext(ffxContext* context, ffxCreateContextDescHeader* desc, const DescIndex&, Allocator& alloc) const override
     {
         TRY(data.createContext(context, desc, alloc.cb));
         // Ensure the provider is set to this external wrapper class.
@@ -78,17 +78,17 @@ public:
         return data.destroyContext(context, alloc.cb);
     }
 
-    ffxReturnCode_t Configure(ffxContext* context, const ffxConfigureDescHeader* desc) const override
+    ffxReturnCode_t Configure(ffxContext* context, const ffxConfigureDescHeader* desc, const DescIndex&) const override
     {
         return data.configure(context, desc);
     }
 
-    ffxReturnCode_t Query(ffxContext* context, ffxQueryDescHeader* desc) const override
+    ffxReturnCode_t Query(ffxContext* context, ffxQueryDescHeader* desc, const DescIndex&) const override
     {
         return data.query(context, desc);
     }
 
-    ffxReturnCode_t Dispatch(ffxContext* context, const ffxDispatchDescHeader* desc) const override
+    ffxReturnCode_t Dispatch(ffxContext* context, const ffxDispatchDescHeader* desc, const DescIndex&) const override
     {
         return data.dispatch(context, desc);
     }
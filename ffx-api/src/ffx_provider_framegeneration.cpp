@@ -83,7 +83,7 @@ const char* ffxProvider_FrameGeneration::GetVersionName() const
     return MAKE_VERSION_STRING(FFX_FRAMEINTERPOLATION_VERSION_MAJOR, FFX_FRAMEINTERPOLATION_VERSION_MINOR, FFX_FRAMEINTERPOLATION_VERSION_PATCH);
 }
 
-ffxReturnCode_t ffxProvider_FrameGeneration::CreateContext(ffxContext* context, ffxCreateContextDescHeader* header, Allocator& alloc) const
+ffxReturnCode_t ffxProvider_FrameGeneration::CreateContext(ffxContext* context, ffxCreateContextDescHeader* header, const DescIndex& index, Allocator& alloc) const
 {
     if (auto desc = ffx::DynamicCast<ffxCreateContextDescFrameGeneration>(header))
     {
@@ -121,12 +121,9 @@ ffxReturnCode_t ffxProvider_FrameGeneration::CreateContext(ffxContext* context,
             fiDescription.displaySize.height      = desc->displaySize.height;
             fiDescription.backBufferFormat = ConvertEnum<FfxSurfaceFormat>(desc->backBufferFormat);
             fiDescription.previousInterpolationSourceFormat = ConvertEnum<FfxSurfaceFormat>(desc->backBufferFormat);
-            for (auto it = header; it; it = it->pNext)
+            if (index.hudless)
             {
-                if (auto descHudless = ffx::DynamicCast<ffxCreateContextDescFrameGenerationHudless>(it))
-                {
-                    fiDescription.previousInterpolationSourceFormat = ConvertEnum<FfxSurfaceFormat>(descHudless->hudlessBackBufferFormat);
-                }
+                fiDescription.previousInterpolationSourceFormat = ConvertEnum<FfxSurfaceFormat>(index.hudless->hudlessBackBufferFormat);
             }
             // set up Frameinterpolation
             TRY2(ffxFrameInterpolationContextCreate(&internal_context->fiContext, &fiDescription));
@@ -211,7 +208,7 @@ ffxReturnCode_t ffxProvider_FrameGeneration::DestroyContext(ffxContext* context,
     return FFX_API_RETURN_OK;
 }
 
-ffxReturnCode_t ffxProvider_FrameGeneration::Configure(ffxContext* context, const ffxConfigureDescHeader* header) const
+ffxReturnCode_t ffxProvider_FrameGeneration::Configure(ffxContext* context, const ffxConfigureDescHeader* header, const DescIndex& index) const
 {
     VERIFY(context, FFX_API_RETURN_ERROR_PARAMETER);
     VERIFY(*context, FFX_API_RETURN_ERROR_PARAMETER);
@@ -348,15 +345,9 @@ ffxReturnCode_t ffxProvider_FrameGeneration::Configure(ffxContext* context, cons
         }
 
         internal_context->distortionField = FfxResource({});
-        for (auto it = header; it; it = it->pNext)
+        if (index.distortionField)
         {
-            if (auto distortionFieldDesc = ffx::DynamicCast<ffxConfigureDescFrameGenerationRegisterDistortionFieldResource>(it))
-            {
-                if (distortionFieldDesc->distortionField.resource)
-                {
-                    internal_context->distortionField = Convert(distortionFieldDesc->distortionField);
-                }
-            }
+            internal_context->distortionField = Convert(index.distortionField->distortionField);
         }
 
         return FFX_API_RETURN_OK;
@@ -367,7 +358,7 @@ ffxReturnCode_t ffxProvider_FrameGeneration::Configure(ffxContext* context, cons
     }
 }
 
-ffxReturnCode_t ffxProvider_FrameGeneration::Query(ffxContext* context, ffxQueryDescHeader* header) const
+ffxReturnCode_t ffxProvider_FrameGeneration::Query(ffxContext* context, ffxQueryDescHeader* header, const DescIndex&) const
 {
     VERIFY(header, FFX_API_RETURN_ERROR_PARAMETER);
     VERIFY(context, FFX_API_RETURN_ERROR_PARAMETER);
@@ -393,7 +384,7 @@ ffxReturnCode_t ffxProvider_FrameGeneration::Query(ffxContext* context, ffxQuery
     }
 }
 
-ffxReturnCode_t ffxProvider_FrameGeneration::Dispatch(ffxContext* context, const ffxDispatchDescHeader* header) const
+ffxReturnCode_t ffxProvider_FrameGeneration::Dispatch(ffxContext* context, const ffxDispatchDescHeader* header, const DescIndex&) const
 {
     VERIFY(context, FFX_API_RETURN_ERROR_PARAMETER);
     VERIFY(*context, FFX_API_RETURN_ERROR_PARAMETER);
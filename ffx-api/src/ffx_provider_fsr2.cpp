@@ -73,7 +73,7 @@ struct InternalFsr2Context
     ffxApiMessage fpMessage;
 };
 
-ffxReturnCode_t ffxProvider_FSR2::CreateContext(ffxContext* context, ffxCreateContextDescHeader* header, Allocator& alloc) const
+ffxReturnCode_t ffxProvider_FSR2::CreateContext(ffxContext* context, ffxCreateContextDescHeader* header, const DescIndex&, Allocator& alloc) const
 {
     VERIFY(context, FFX_API_RETURN_ERROR_PARAMETER);
     VERIFY(header, FFX_API_RETURN_ERROR_PARAMETER);
@@ -126,12 +126,12 @@ ffxReturnCode_t ffxProvider_FSR2::DestroyContext(ffxContext* context, Allocator&
     return FFX_API_RETURN_OK;
 }
 
-ffxReturnCode_t ffxProvider_FSR2::Configure(ffxContext*, const ffxConfigureDescHeader*) const
+ffxReturnCode_t ffxProvider_FSR2::Configure(ffxContext*, const ffxConfigureDescHeader*, const DescIndex&) const
 {
     return FFX_API_RETURN_ERROR_PARAMETER;
 }
 
-ffxReturnCode_t ffxProvider_FSR2::Query(ffxContext* context, ffxQueryDescHeader* header) const
+ffxReturnCode_t ffxProvider_FSR2::Query(ffxContext* context, ffxQueryDescHeader* header, const DescIndex&) const
 {
     VERIFY(header, FFX_API_RETURN_ERROR_PARAMETER);
 
@@ -198,7 +198,7 @@ ffxReturnCode_t ffxProvider_FSR2::Query(ffxContext* context, ffxQueryDescHeader*
     return FFX_API_RETURN_OK;
 }
 
-ffxReturnCode_t ffxProvider_FSR2::Dispatch(ffxContext* context, const ffxDispatchDescHeader* header) const
+ffxReturnCode_t ffxProvider_FSR2::Dispatch(ffxContext* context, const ffxDispatchDescHeader* header, const DescIndex&) const
 {
     VERIFY(context, FFX_API_RETURN_ERROR_PARAMETER);
     VERIFY(*context, FFX_API_RETURN_ERROR_PARAMETER);
@@ -89,7 +89,7 @@ struct InternalFsr3UpscalerUContext
     ffxApiMessage           fpMessage;
 };
 
-ffxReturnCode_t ffxProvider_FSR3Upscale::CreateContext(ffxContext* context, ffxCreateContextDescHeader* header, Allocator& alloc) const
+ffxReturnCode_t ffxProvider_FSR3Upscale::CreateContext(ffxContext* context, ffxCreateContextDescHeader* header, const DescIndex&, Allocator& alloc) const
 {
     VERIFY(context, FFX_API_RETURN_ERROR_PARAMETER);
     VERIFY(header, FFX_API_RETURN_ERROR_PARAMETER);
@@ -190,7 +190,7 @@ ffxReturnCode_t ffxProvider_FSR3Upscale::DestroyContext(ffxContext* context, All
     return FFX_API_RETURN_OK;
 }
 
-ffxReturnCode_t ffxProvider_FSR3Upscale::Configure(ffxContext* context, const ffxConfigureDescHeader* header) const
+ffxReturnCode_t ffxProvider_FSR3Upscale::Configure(ffxContext* context, const ffxConfigureDescHeader* header, const DescIndex&) const
 {
     VERIFY(context, FFX_API_RETURN_ERROR_PARAMETER);
     VERIFY(*context, FFX_API_RETURN_ERROR_PARAMETER);
@@ -210,7 +210,7 @@ ffxReturnCode_t ffxProvider_FSR3Upscale::Configure(ffxContext* context, const ff
     return FFX_API_RETURN_OK;
 }
 
-ffxReturnCode_t ffxProvider_FSR3Upscale::Query(ffxContext* context, ffxQueryDescHeader* header) const
+ffxReturnCode_t ffxProvider_FSR3Upscale::Query(ffxContext* context, ffxQueryDescHeader* header, const DescIndex&) const
 {
     VERIFY(header, FFX_API_RETURN_ERROR_PARAMETER);
 
@@ -294,7 +294,7 @@ ffxReturnCode_t ffxProvider_FSR3Upscale::Query(ffxContext* context, ffxQueryDesc
     return FFX_API_RETURN_OK;
 }
 
-ffxReturnCode_t ffxProvider_FSR3Upscale::Dispatch(ffxContext* context, const ffxDispatchDescHeader* header) const
+ffxReturnCode_t ffxProvider_FSR3Upscale::Dispatch(ffxContext* context, const ffxDispatchDescHeader* header, const DescIndex&) const
 {
     VERIFY(context, FFX_API_RETURN_ERROR_PARAMETER);
     VERIFY(*context, FFX_API_RETURN_ERROR_PARAMETER);
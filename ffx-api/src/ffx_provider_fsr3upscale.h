@@ -35,15 +35,15 @@ public:
 
     virtual const char* GetVersionName() const override;
 
-    virtual ffxReturnCode_t CreateContext(ffxContext* context, ffxCreateContextDescHeader* desc, Allocator& alloc) const override;
+    virtual ffxReturnCode_t CreateContext(ffxContext* context, ffxCreateContextDescHeader* desc, const DescIndex& index, Allocator& alloc) const override;
 
     virtual ffxReturnCode_t DestroyContext(ffxContext* context, Allocator& alloc) const override;
 
-    virtual ffxReturnCode_t Configure(ffxContext* context, const ffxConfigureDescHeader* desc) const override;
+    virtual ffxReturnCode_t Configure(ffxContext* context, const ffxConfigureDescHeader* desc, const DescIndex& index) const override;
 
-    virtual ffxReturnCode_t Query(ffxContext* context, ffxQueryDescHeader* desc) const override;
+    virtual ffxReturnCode_t Query(ffxContext* context, ffxQueryDescHeader* desc, const DescIndex& index) const override;
 
-    virtual ffxReturnCode_t Dispatch(ffxContext* context, const ffxDispatchDescHeader* desc) const override;
+    virtual ffxReturnCode_t Dispatch(ffxContext* context, const ffxDispatchDescHeader* desc, const DescIndex& index) const override;
 
     static ffxProvider_FSR3Upscale Instance;
     
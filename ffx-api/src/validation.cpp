@@ -35,22 +35,39 @@
 #include <ffx_api/ffx_framegeneration.h>
 #include <ffx_api/ffx_upscale.h>
 
-#include <unordered_map>
-#include <algorithm>
-#include <sstream>
+#include <stdlib.h>
 
 #define MAP_ENUM_NAME(_value) {_value, #_value}
 
 #ifdef FFXAPI_VALIDATION
 
-static std::unordered_map<uint64_t, const char*> EnumNameMap{
+// anything but FFX_API_VALIDATION=0 keeps validation on
+bool ValidationRequested()
+{
+#pragma warning(push)
+#pragma warning(disable : 4996) // getenv is only read once, from the first check
+    const char* value = getenv("FFX_API_VALIDATION");
+#pragma warning(pop)
+    return !(value && value[0] == '0' && value[1] == '\0');
+}
+
+struct EnumName
+{
+    uint64_t    value;
+    const char* name;
+};
+
+// only searched when a message is built, so a plain array is enough
+static const EnumName EnumNames[] = {
 #ifdef FFX_BACKEND_DX11
     MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATION),
     MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_REGISTERUIRESOURCE_DX11),
     MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_GLOBALDEBUG1),
     MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX11),
     MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATION),
-    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_DX11),
+    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_WRAP_DX11),
+    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_NEW_DX11),
+    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_FOR_HWND_DX11),
     MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_UPSCALE),
     MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_GET_VERSIONS),
     MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_INTERPOLATIONCOMMANDLIST_DX11),
@@ -110,60 +127,54 @@ static std::unordered_map<uint64_t, const char*> EnumNameMap{
 
 static const char* GetEnumName(uint64_t value)
 {
-    auto it = EnumNameMap.find(value);
-    if (it == EnumNameMap.end()) return "INVALID_ENUM";
-    return it->second;
+    for (const EnumName& entry : EnumNames)
+    {
+        if (entry.value == value)
+            return entry.name;
+    }
+    return "INVALID_ENUM";
 }
 
+// fixed size message on the stack, names are ASCII so they are widened char by char
+class Message
+{
+    wchar_t  text[256];
+    uint32_t length = 0;
+
+public:
+    Message() { text[0] = L'\0'; }
+
+    Message& operator<<(const char* str)
+    {
+        while (*str && length + 1 < _countof(text))
+            text[length++] = static_cast<wchar_t>(*str++);
+        text[length] = L'\0';
+        return *this;
+    }
+
+    const wchar_t* c_str() const { return text; }
+};
+
 #endif
 
-Validator& Validator::NoExtensions()
+void Validator::ReportUnexpected(const ffxApiHeader* extension) const
 {
 #ifdef FFXAPI_VALIDATION
-    for (auto *it = header->pNext; it; it = it->pNext)
-    {
-        // invalid extension!
-        std::wostringstream message{};
-        message << "After header " << GetEnumName(header->type) << ": ignoring unexpected extension " << GetEnumName(it->type);
-        callback(FFX_API_MESSAGE_TYPE_WARNING, message.str().c_str());
-    }
+    Message message;
+    message << "After header " << GetEnumName(header->type) << ": ignoring unexpected extension " << GetEnumName(extension->type);
+    callback(FFX_API_MESSAGE_TYPE_WARNING, message.c_str());
+#else
+    (void)extension;
 #endif
-    return *this;
 }
 
-Validator& Validator::AcceptExtensions(std::initializer_list<uint64_t> extensionsOnce, std::initializer_list<uint64_t> extensionsMany)
+void Validator::ReportDuplicate(const ffxApiHeader* extension) const
 {
 #ifdef FFXAPI_VALIDATION
-    std::vector<bool> seenOnce(extsOnce.size(), false);
-    for (auto *it = header->pNext; it; it = it->pNext)
-    {
-        bool canHave = extsMany.end() == std::find(extsMany.begin(), extsMany.end(), it->type);
-        if (!canHave)
-        {
-            auto it_once = std::find(extsOnce.begin(), extsOnce.end(), it->type);
-            if (it_once != extsOnce.end())
-            {
-                canHave = true; // prevent error further down even if present more than once.
-                auto idx = std::distance(extsOnce.begin(), it_once);
-                if (seenOnce[idx])
-                {
-                    // extension present more than once!
-                    std::wostringstream message{};
-                    message << "After header " << GetEnumName(header->type) << ": extension " << GetEnumName(it->type) << " present more than once";
-                    callback(FFX_API_MESSAGE_TYPE_WARNING, message.str().c_str());
-                }
-                seenOnce[idx] = true;
-            }
-        }
-        if (!canHave)
-        {
-            // invalid extension!
-            std::wostringstream message{};
-            message << "After header " << GetEnumName(header->type) << ": ignoring unexpected extension " << GetEnumName(it->type);
-            callback(FFX_API_MESSAGE_TYPE_WARNING, message.str().c_str());
-        }
-    }
+    Message message;
+    message << "After header " << GetEnumName(header->type) << ": extension " << GetEnumName(extension->type) << " present more than once";
+    callback(FFX_API_MESSAGE_TYPE_WARNING, message.c_str());
+#else
+    (void)extension;
 #endif
-
-    return *this;
 }
@@ -25,14 +25,83 @@
 #include <ffx_api/ffx_api.hpp>
 #include <initializer_list>
 
+#ifdef FFXAPI_VALIDATION
+// Process wide switch on top of FFXAPI_VALIDATION: setting the environment variable FFX_API_VALIDATION
+// to 0 turns validation off. It is read on the first check and kept, so later checks only test a flag.
+bool ValidationRequested();
+
+inline bool ValidationEnabled()
+{
+    static const bool enabled = ValidationRequested();
+    return enabled;
+}
+#endif
+
+// The checks are inline and only compare struct types; messages are formatted out of line and only on failure.
 class Validator
 {
     ffxApiMessage callback;
     const ffxApiHeader* header;
 
+    void ReportUnexpected(const ffxApiHeader* extension) const;
+    void ReportDuplicate(const ffxApiHeader* extension) const;
+
+    static bool Contains(std::initializer_list<uint64_t> types, uint64_t type, size_t& index)
+    {
+        index = 0;
+        for (uint64_t t : types)
+        {
+            if (t == type)
+                return true;
+            ++index;
+        }
+        return false;
+    }
+
 public:
     Validator(ffxApiMessage callback, const ffxApiHeader* header) : callback(callback), header(header) {}
 
-    Validator& AcceptExtensions(std::initializer_list<uint64_t> extensionsOnce, std::initializer_list<uint64_t> extensionsMany = {});
-    Validator& NoExtensions();
+    static bool Enabled()
+    {
+#ifdef FFXAPI_VALIDATION
+        return ValidationEnabled();
+#else
+        return false;
+#endif
+    }
+
+    Validator& AcceptExtensions(std::initializer_list<uint64_t> extensionsOnce, std::initializer_list<uint64_t> extensionsMany = {})
+    {
+        if (!Enabled())
+            return *this;
+
+        // a bit per entry of extensionsOnce, the lists are a handful of types at most
+        uint64_t seenOnce = 0;
+        for (auto* it = header->pNext; it; it = it->pNext)
+        {
+            size_t index;
+            if (Contains(extensionsMany, it->type, index))
+                continue;
+            if (!Contains(extensionsOnce, it->type, index))
+            {
+                ReportUnexpected(it);
+                continue;
+            }
+            const uint64_t bit = index < 64 ? 1ull << index : 0;
+            if (seenOnce & bit)
+                ReportDuplicate(it);
+            seenOnce |= bit;
+        }
+        return *this;
+    }
+
+    Validator& NoExtensions()
+    {
+        if (!Enabled())
+            return *this;
+
+        for (auto* it = header->pNext; it; it = it->pNext)
+            ReportUnexpected(it);
+        return *this;
+    }
 };